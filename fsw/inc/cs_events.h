@@ -200,7 +200,7 @@
 #define CS_RECOMPUTE_CFECORE_STARTED_DBG_EID 14
 
 /**
- * \brief CS cFE Core Checksum Failed Child Task Create Event ID
+ * \brief CS cFE Core Checksum Failed Job Not Queued Event ID
  *
  *  \par Type: ERROR
  *
@@ -208,22 +208,8 @@
  *
  *  This event message is issued when a recompute baseline
  *  for the cFE core command has been received and the
- *  recompute failed because CFE_ES_CreateChildTask returned
- *  an error.
- */
-#define CS_RECOMPUTE_CFECORE_CREATE_CHDTASK_ERR_EID 15
-
-/**
- * \brief CS cFE Core Checksum Failed Child Task In Use Event ID
- *
- *  \par Type: ERROR
- *
- *  \par Cause:
- *
- *  This event message is issued when a recompute baseline
- *  for the cFE core command has been received and the
- *  recompute failed because there is already a CS child
- *  task running.
+ *  recompute failed because the CS job queue is full
+ *  or the entry already has a job queued.
  */
 #define CS_RECOMPUTE_CFECORE_CHDTASK_ERR_EID 16
 
@@ -241,21 +227,7 @@
 #define CS_RECOMPUTE_OS_STARTED_DBG_EID 17
 
 /**
- * \brief CS OS Code Checksum Recompute Failed Child Task Create Event ID
- *
- *  \par Type: ERROR
- *
- *  \par Cause:
- *
- *  This event message is issued when a recompute baseline
- *  for the OS code segment command has been received and the
- *  recompute failed because CFE_ES_CreateChildTask returned
- *  an error.
- */
-#define CS_RECOMPUTE_OS_CREATE_CHDTASK_ERR_EID 18
-
-/**
- * \brief CS OS Code Checksum Recompute Failed Child Task In Use Event ID
+ * \brief CS OS Code Checksum Recompute Failed Job Not Queued Event ID
  *
  *  \par Type: ERROR
  *
@@ -263,8 +235,8 @@
  *
  *  This event message is issued when a recompute baseline
  *  for the OS code segment command has been received and the
- *  recompute failed because there is already a CS child
- *  task running.
+ *  recompute failed because the CS job queue is full
+ *  or the entry already has a job queued.
  */
 #define CS_RECOMPUTE_OS_CHDTASK_ERR_EID 19
 
@@ -281,20 +253,7 @@
 #define CS_ONESHOT_STARTED_DBG_EID 20
 
 /**
- * \brief CS Oneshot Checksum Failed Child Task Create Event ID
- *
- *  \par Type: ERROR
- *
- *  \par Cause:
- *
- *  This event message is issued when a OneShot calculation
- *  command has been received and the OneShot failed because
- *  CFE_ES_CreateChildTask returned an error.
- */
-#define CS_ONESHOT_CREATE_CHDTASK_ERR_EID 21
-
-/**
- * \brief CS Oneshot Checksum Failed Child Task In Use Event ID
+ * \brief CS Oneshot Checksum Failed Job Not Queued Event ID
  *
  *  \par Type: ERROR
  *
@@ -302,7 +261,7 @@
  *
  *  This event message is issued when a OneShot command
  *  has been received and the OneShot failed because
- *  there is already a CS child task running.
+ *  the CS job queue is full.
  */
 #define CS_ONESHOT_CHDTASK_ERR_EID 22
 
@@ -327,23 +286,10 @@
  *  \par Cause:
  *
  *  This event message is issued when a  cancel OneShot calculation
- *  command has been received and the OneShot task has been cancelled.
+ *  command has been received and the OneShot job has been cancelled.
  */
 #define CS_ONESHOT_CANCELLED_INF_EID 24
 
-/**
- * \brief CS Oneshot Checksum Failed Child Task Delete Event ID
- *
- *  \par Type: ERROR
- *
- *  \par Cause:
- *
- *  This event message is issued when a cancel OneShot calculation
- *  command has been received and the cancel OneShot failed because
- *  CFE_ES_DeleteChildTask returned an error.
- */
-#define CS_ONESHOT_CANCEL_DELETE_CHDTASK_ERR_EID 25
-
 /**
  * \brief CS Oneshot Checksum Cancel Failed No Oneshot Active Event ID
  *
@@ -353,7 +299,7 @@
  *
  *  This event message is issued when a cancel OneShot command
  *  has been received and the cancel OneShot failed because
- *  there was no OneShot child task running.
+ *  there was no OneShot job queued or running.
  */
 #define CS_ONESHOT_CANCEL_NO_CHDTASK_ERR_EID 26
 
@@ -557,20 +503,6 @@
  */
 #define CS_RECOMPUTE_EEPROM_STARTED_DBG_EID 42
 
-/**
- * \brief CS EEPROM Checksum Recompute Failed Child Task Create Event ID
- *
- *  \par Type: ERROR
- *
- *  \par Cause:
- *
- *  This event message is issued when a recompute baseline
- *  for the specified EEPROM Entry ID command has been
- *  received and the recompute failed because
- *  CFE_ES_CreateChildTask returned an error.
- */
-#define CS_RECOMPUTE_EEPROM_CREATE_CHDTASK_ERR_EID 43
-
 /**
  * \brief CS EEPROM Checksum Recompute Failed Invalid Entry ID Event ID
  *
@@ -585,7 +517,7 @@
 #define CS_RECOMPUTE_INVALID_ENTRY_EEPROM_ERR_EID 44
 
 /**
- * \brief CS EEPROM Checksum Recompute Failed Child Task In Use Event ID
+ * \brief CS EEPROM Checksum Recompute Failed Job Not Queued Event ID
  *
  *  \par Type: ERROR
  *
@@ -593,8 +525,8 @@
  *
  *  This event message is issued when a recompute baseline
  *  for the command specified Entry ID command has been
- *  received and the recompute failed because there is
- *  already a CS child task running.
+ *  received and the recompute failed because the CS job
+ *  queue is full or the entry already has a job queued.
  */
 #define CS_RECOMPUTE_EEPROM_CHDTASK_ERR_EID 45
 
@@ -756,20 +688,6 @@
  */
 #define CS_RECOMPUTE_MEMORY_STARTED_DBG_EID 57
 
-/**
- * \brief CS Memory Checksum Recompute Failed Child Task Create Event ID
- *
- *  \par Type: ERROR
- *
- *  \par Cause:
- *
- *  This event message is issued when a recompute baseline
- *  for the specified Memory Entry ID command has been
- *  received and the recompute failed because
- *  CFE_ES_CreateChildTask returned an error.
- */
-#define CS_RECOMPUTE_MEMORY_CREATE_CHDTASK_ERR_EID 58
-
 /**
  * \brief CS Memory Checksum Recompute Failed Invalid Entry ID Event ID
  *
@@ -784,7 +702,7 @@
 #define CS_RECOMPUTE_INVALID_ENTRY_MEMORY_ERR_EID 59
 
 /**
- * \brief CS Memory Checksum Recompute Failed Child Task In Use Event ID
+ * \brief CS Memory Checksum Recompute Failed Job Not Queued Event ID
  *
  *  \par Type: ERROR
  *
@@ -792,8 +710,8 @@
  *
  *  This event message is issued when a recompute baseline
  *  for the command specified Entry ID command has been
- *  received and the recompute failed because there is
- *  already a CS child task running.
+ *  received and the recompute failed because the CS job
+ *  queue is full or the entry already has a job queued.
  */
 #define CS_RECOMPUTE_MEMORY_CHDTASK_ERR_EID 60
 
@@ -957,20 +875,6 @@
  */
 #define CS_RECOMPUTE_TABLES_STARTED_DBG_EID 72
 
-/**
- * \brief CS Table Checksum Recompute Failed Child Task Create Event ID
- *
- *  \par Type: ERROR
- *
- *  \par Cause:
- *
- *  This event message is issued when a recompute baseline
- *  for the specified Tables Entry ID command has been
- *  received and the recompute failed because
- *  CFE_ES_CreateChildTask returned an error.
- */
-#define CS_RECOMPUTE_TABLES_CREATE_CHDTASK_ERR_EID 73
-
 /**
  * \brief CS Table Checksum Recompute Failed Table Not Found Event ID
  *
@@ -986,7 +890,7 @@
 #define CS_RECOMPUTE_UNKNOWN_NAME_TABLES_ERR_EID 74
 
 /**
- * \brief CS Table Checksum Recompute Failed Child Task In Use Event ID
+ * \brief CS Table Checksum Recompute Failed Job Not Queued Event ID
  *
  *  \par Type: ERROR
  *
@@ -994,8 +898,8 @@
  *
  *  This event message is issued when a recompute baseline
  *  for the command specified table command has been
- *  received and the recompute failed because there is
- *  already a CS child task running.
+ *  received and the recompute failed because the CS job
+ *  queue is full or the entry already has a job queued.
  */
 #define CS_RECOMPUTE_TABLES_CHDTASK_ERR_EID 75
 
@@ -1130,20 +1034,6 @@
  */
 #define CS_RECOMPUTE_APP_STARTED_DBG_EID 85
 
-/**
- * \brief CS App Checksum Recompute Failed Create Child Task Event ID
- *
- *  \par Type: ERROR
- *
- *  \par Cause:
- *
- *  This event message is issued when a recompute baseline
- *  for the specified app command has been
- *  received and the recompute failed because
- *  CFE_ES_CreateChildTask returned an error.
- */
-#define CS_RECOMPUTE_APP_CREATE_CHDTASK_ERR_EID 86
-
 /**
  * \brief CS App Checksum Recompute Failed App Not Found Event ID
  *
@@ -1159,7 +1049,7 @@
 #define CS_RECOMPUTE_UNKNOWN_NAME_APP_ERR_EID 87
 
 /**
- * \brief CS App Checksum Recompute Failed Child Task In Use Event ID
+ * \brief CS App Checksum Recompute Failed Job Not Queued Event ID
  *
  *  \par Type: ERROR
  *
@@ -1167,8 +1057,8 @@
  *
  *  This event message is issued when a recompute baseline
  *  for the command specified app command has been
- *  received and the recompute failed because there is
- *  already a CS child task running.
+ *  received and the recompute failed because the CS job
+ *  queue is full or the entry already has a job queued.
  */
 #define CS_RECOMPUTE_APP_CHDTASK_ERR_EID 88
 
@@ -1950,41 +1840,396 @@
 #define CS_CFE_TEXT_SEG_INF_EID 150
 
 /**
- * \brief CS Command Failed Due To Recompute Or Oneshot In Progress Event ID
+ * \brief CS Command Failed Due To Recompute In Progress Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause:
  *
- *  This event message is issued when certain commands are received while a
- *  recompute or oneshot is in progress.  Affected commands are those that
- *  affect the checksum processing (such as enable/disable commands).
+ *  This event message is issued when an enable or disable command is
+ *  received for a table type or entry that a recompute is working on.
+ *  Commands for other table types and entries are not affected.
  */
 #define CS_CMD_COMPUTE_PROG_ERR_EID 152
 
 /**
- * \brief CS Skipping Background Cycle Due To Recompute Or Oneshote In Progress Event ID
+ * \brief CS Apps Table Validate Failed Illegal State With Long Name Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when CS validation for the Apps definition table finds an entry
+ *  that contains a non-terminated name field.
+ */
+#define CS_VAL_APP_DEF_TBL_LONG_NAME_ERR_EID 154
+
+/**
+ * \brief CS Worker Pool Initialization Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when CS fails to create a semaphore or
+ *  child task for the checksum worker pool.  Workers that were created
+ *  are still used; if none were, checksums are computed by the calling task.
+ */
+#define CS_WORKER_INIT_ERR_EID 155
+
+/**
+ * \brief CS Worker Pool Job Timeout Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the checksum worker tasks do not
+ *  finish a job within #CS_WORKER_TIMEOUT milliseconds.  The worker pool
+ *  is disabled and the checksum is completed by the calling task.
+ */
+#define CS_WORKER_TIMEOUT_ERR_EID 156
+
+/**
+ * \brief CS EEPROM Table Validate Failed Illegal Algorithm Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the EEPROM table validation function detects an entry whose
+ *  Algorithm field is not one of the CS_ALGORITHM_... values
+ */
+#define CS_VAL_EEPROM_ALG_ERR_EID 157
+
+/**
+ * \brief CS Memory Table Validate Failed Illegal Algorithm Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the Memory table validation function detects an entry whose
+ *  Algorithm field is not one of the CS_ALGORITHM_... values
+ */
+#define CS_VAL_MEMORY_ALG_ERR_EID 158
+
+/**
+ * \brief CS Tables Table Validate Failed Illegal Algorithm Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the Tables table validation function detects an entry whose
+ *  Algorithm field is not one of the CS_ALGORITHM_... values
+ */
+#define CS_VAL_TABLES_ALG_ERR_EID 159
+
+/**
+ * \brief CS Apps Table Validate Failed Illegal Algorithm Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the Apps table validation function detects an entry whose
+ *  Algorithm field is not one of the CS_ALGORITHM_... values
+ */
+#define CS_VAL_APP_ALG_ERR_EID 160
+
+/**
+ * \brief CS Set Time Budget Command Event ID
  *
  *  \par Type: INFORMATION
  *
  *  \par Cause:
  *
- *  This event message is issued when the background cycle is attempted
- *  while a recompute or oneshot is in progress.
+ *  This event message is issued upon receipt of a set time budget command
  */
-#define CS_BKGND_COMPUTE_PROG_INF_EID 153
+#define CS_SET_TIME_BUDGET_INF_EID 161
 
 /**
- * \brief CS Apps Table Validate Failed Illegal State With Long Name Event ID
+ * \brief CS Set Time Budget Command Invalid Budget Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause:
  *
- *  This event message is issued when CS validation for the Apps definition table finds an entry
- *  that contains a non-terminated name field.
+ *  This event message is issued when a set time budget command specifies a time budget that is neither
+ *  zero nor between #CS_MIN_TIME_BUDGET and #CS_MAX_TIME_BUDGET
  */
-#define CS_VAL_APP_DEF_TBL_LONG_NAME_ERR_EID 154
+#define CS_SET_TIME_BUDGET_ERR_EID 162
+
+/**
+ * \brief CS Time Budget Adjusted Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued at the end of a full background pass when the time budget is adjusted
+ *  toward the target pass period
+ */
+#define CS_TIME_BUDGET_ADJ_DBG_EID 163
+
+/**
+ * \brief CS Block Miscompare Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued after an EEPROM or Memory entry with a block tree miscompares.  It reports
+ *  how many of the entry's leaf blocks miscompared and the address of the first one.  The leaves of the
+ *  last pass and the baseline tree can be dumped from the block results table to find the others.
+ */
+#define CS_BLOCK_MISCOMPARE_ERR_EID 164
+
+/**
+ * \brief CS Block Tree Allocation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when an EEPROM or Memory definition table entry requests a block tree but
+ *  there are not enough free trees or nodes in the block results table.  The entry is still checksummed,
+ *  without a block tree.
+ */
+#define CS_BLOCK_TREE_ALLOC_ERR_EID 165
+
+/**
+ * \brief CS Block Results Table Initialization Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the block results table could not be registered with Table
+ *  Services.  EEPROM and Memory entries are checksummed without block trees.
+ */
+#define CS_INIT_BLOCK_ERR_EID 166
+
+/**
+ * \brief CS Recompute Changed Blocks Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when an EEPROM or Memory recompute rehashed only the leaf blocks that
+ *  changed since the baseline, and derived the new baseline from the block tree.
+ */
+#define CS_RECOMPUTE_BLOCKS_DBG_EID 167
+
+/**
+ * \brief CS Single Bit Error Located Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued after a CRC miscompare of a cFE core, OS, EEPROM, Memory or App entry
+ *  when the difference between the expected and computed CRCs is exactly that of a single flipped bit.
+ *  The event names the byte address and bit number of the flip.
+ */
+#define CS_SINGLE_BIT_ERR_EID 168
+
+/**
+ * \brief CS App Reloaded Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the module ID of an app or library in the App table has changed
+ *  since its baseline was computed, because it was restarted or reloaded.  The entry's baseline is
+ *  computed again rather than reported as a miscompare.
+ */
+#define CS_APP_RELOADED_INF_EID 169
+
+/**
+ * \brief CS Set Revisit Period Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued upon receipt of a set revisit period command
+ */
+#define CS_SET_REVISIT_PERIOD_INF_EID 170
+
+/**
+ * \brief CS Set Revisit Period Command Invalid Table Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a set revisit period command specifies a table type that is not
+ *  between #CS_CFECORE and #CS_APP_TABLE
+ */
+#define CS_SET_REVISIT_PERIOD_ERR_EID 171
+
+/**
+ * \brief CS Recompute All Entries Started Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a recompute all entries command has been received and the job that
+ *  recomputes the table's entries has been queued.
+ */
+#define CS_RECOMPUTE_ALL_STARTED_DBG_EID 172
+
+/**
+ * \brief CS Recompute All Entries Invalid Table Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a recompute all entries command specifies a table type that is not
+ *  between #CS_CFECORE and #CS_APP_TABLE
+ */
+#define CS_RECOMPUTE_ALL_INVALID_ERR_EID 173
+
+/**
+ * \brief CS Recompute All Entries Job Not Queued Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a recompute all entries command has been received and the recompute
+ *  failed because the CS job queue is full or the table already has a recompute queued.
+ */
+#define CS_RECOMPUTE_ALL_CHDTASK_ERR_EID 174
+
+/**
+ * \brief CS Recompute All Entries Finished Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the job queued by a recompute all entries command has recomputed the
+ *  baseline of every entry in the table that is not #CS_STATE_EMPTY.
+ */
+#define CS_RECOMPUTE_ALL_FINISH_INF_EID 175
+
+/**
+ * \brief CS Job Queue Initialization Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued during initialization when CS could not create a semaphore or a child
+ *  task for the recompute and OneShot job queue.  Job tasks that were created still run the queue; if
+ *  none were, recompute and OneShot commands are rejected.
+ */
+#define CS_JOB_INIT_ERR_EID 176
+
+/**
+ * \brief CS Set Job Rate Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued upon receipt of a set job rate command
+ */
+#define CS_SET_JOB_RATE_INF_EID 177
+
+/**
+ * \brief CS Set Job Rate Command Invalid Burst Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a set job rate command specifies a non-zero rate with a burst size
+ *  of zero, which would never let a job checksum anything
+ */
+#define CS_SET_JOB_RATE_ERR_EID 178
+
+/**
+ * \brief CS Baseline Critical Data Store Access Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when CS could not register, restore or write the Critical Data Store
+ *  that keeps the checksum baselines.  Entries without a restored baseline compute a new one.  After
+ *  a register or write error the baselines are no longer saved until the next reset.
+ */
+#define CS_BASELINE_CDS_ERR_EID 179
+
+/**
+ * \brief CS Baseline Critical Data Store Invalid Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued during initialization when the baselines restored from the Critical
+ *  Data Store have the wrong version, number of records or CRC.  They are discarded and every entry
+ *  computes a new baseline.
+ */
+#define CS_BASELINE_CDS_INVALID_INF_EID 180
+
+/**
+ * \brief CS Baselines Restored Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued during initialization when entries of a table type start with the
+ *  baselines, or the unfinished checksums, they had before the processor reset
+ */
+#define CS_BASELINE_RESTORE_INF_EID 181
+
+/**
+ * \brief CS Table Too Large For Snapshot Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a table whose Tables table entry asks for a snapshot is larger
+ *  than #CS_TABLE_SNAPSHOT_SIZE bytes, each time the table is loaded.  The table is checksummed in
+ *  place instead.
+ */
+#define CS_COMPUTE_TABLES_SNAPSHOT_ERR_EID 182
+
+/**
+ * \brief CS Manage Table Command Invalid Table Type Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a manage table command names a table type other than EEPROM,
+ *  Memory, Tables, Apps or the block results table
+ */
+#define CS_MANAGE_TABLE_ERR_EID 183
+
+/**
+ * \brief CS Block Results Table Update Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the address of the block results table could not be taken again
+ *  after managing it.  EEPROM and Memory entries are checksummed without block trees from then on.
+ */
+#define CS_UPDATE_BLOCK_ERR_EID 184
 
 /**@}*/
 
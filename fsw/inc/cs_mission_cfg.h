@@ -40,8 +40,9 @@
  *        the requested data.
  *
  *  \par Limits:
- *         This parameter is limited to either #CFE_MISSION_ES_DEFAULT_CRC,
- *         or  #CFE_ES_CrcType_CRC_16
+ *         This parameter is limited to #CFE_MISSION_ES_DEFAULT_CRC,
+ *         #CFE_ES_CrcType_CRC_16, #CFE_ES_CrcType_CRC_32 or
+ *         #CS_CRC_TYPE_CRC_32C
  */
 #define CS_DEFAULT_ALGORITHM CFE_MISSION_ES_DEFAULT_CRC
 
@@ -26,45 +26,77 @@
 #define CS_MSG_H
 
 #include <cfe.h>
+#include "cs_platform_cfg.h"
 
 /**
  * \defgroup cfscstlm CFS Checksum Telemetry
  * \{
  */
 
+/**
+ *  \brief Status of one slot of the recompute and OneShot job queue
+ */
+typedef struct
+{
+    uint8  Type;     /**< \brief Job type, #CS_JOB_TYPE_RECOMPUTE to #CS_JOB_TYPE_ONESHOT */
+    uint8  Status;   /**< \brief Job state, #CS_JOB_STATUS_FREE to #CS_JOB_STATUS_CANCELLED */
+    uint16 Table;    /**< \brief Table type the job works on, #CS_CFECORE to #CS_APP_TABLE */
+    uint16 EntryID;  /**< \brief Entry the job recomputes */
+    uint16 Filler16; /**< \brief 16 bit padding */
+    uint32 Result;   /**< \brief New baseline, OneShot checksum, or number of entries recomputed */
+} CS_JobStatus_t;
+
 /**
  *  \brief Housekeeping Payload Structure
  */
 typedef struct
 {
-    uint8   CmdCounter;                  /**< \brief CS Application Command Counter */
-    uint8   CmdErrCounter;               /**< \brief CS Application Command Error Counter */
-    uint8   ChecksumState;               /**< \brief CS Application global checksum state */
-    uint8   EepromCSState;               /**< \brief CS EEPROM table checksum state */
-    uint8   MemoryCSState;               /**< \brief CS Memory table checksum state */
-    uint8   AppCSState;                  /**< \brief CS App table checksum state */
-    uint8   TablesCSState;               /**< \brief CS Tables table checksum state */
-    uint8   OSCSState;                   /**< \brief OS code segment checksum state */
-    uint8   CfeCoreCSState;              /**< \brief cFE Core code segment checksum stat e*/
-    uint8   RecomputeInProgress;         /**< \brief CS "Recompute In Progress" flag */
-    uint8   OneShotInProgress;           /**< \brief CS "OneShot In Progress" flag */
-    uint8   Filler8;                     /**< \brief 8 bit padding */
-    uint16  EepromCSErrCounter;          /**< \brief EEPROM miscompare counter */
-    uint16  MemoryCSErrCounter;          /**< \brief Memory miscompare counter */
-    uint16  AppCSErrCounter;             /**< \brief App miscompare counter */
-    uint16  TablesCSErrCounter;          /**< \brief Tables miscompare counter */
-    uint16  CfeCoreCSErrCounter;         /**< \brief cFE core miscompare counter */
-    uint16  OSCSErrCounter;              /**< \brief OS code segment miscopmare counter */
-    uint16  CurrentCSTable;              /**< \brief Current table being checksummed */
-    uint16  CurrentEntryInTable;         /**< \brief Current entry ID in table being checksummed */
-    uint32  EepromBaseline;              /**< \brief Baseline checksum for all of EEPROM */
-    uint32  OSBaseline;                  /**< \brief Baseline checksum for the OS code segment */
-    uint32  CfeCoreBaseline;             /**< \brief Basline checksum for the cFE core */
-    cpuaddr LastOneShotAddress;          /**< \brief Address used in last one shot checksum command */
-    uint32  LastOneShotSize;             /**< \brief Size used in the last one shot checksum command */
-    uint32  LastOneShotMaxBytesPerCycle; /**< \brief Max bytes per cycle for last one shot checksum command */
-    uint32  LastOneShotChecksum;         /**< \brief Checksum of the last one shot checksum command */
-    uint32  PassCounter;                 /**< \brief Number of times CS has passed through all of its tables */
+    uint8          CmdCounter;                  /**< \brief CS Application Command Counter */
+    uint8          CmdErrCounter;               /**< \brief CS Application Command Error Counter */
+    uint8          ChecksumState;               /**< \brief CS Application global checksum state */
+    uint8          EepromCSState;               /**< \brief CS EEPROM table checksum state */
+    uint8          MemoryCSState;               /**< \brief CS Memory table checksum state */
+    uint8          AppCSState;                  /**< \brief CS App table checksum state */
+    uint8          TablesCSState;               /**< \brief CS Tables table checksum state */
+    uint8          OSCSState;                   /**< \brief OS code segment checksum state */
+    uint8          CfeCoreCSState;              /**< \brief cFE Core code segment checksum stat e*/
+    uint8          RecomputeInProgress;         /**< \brief CS "Recompute In Progress" flag */
+    uint8          OneShotInProgress;           /**< \brief CS "OneShot In Progress" flag */
+    uint8          Filler8;                     /**< \brief 8 bit padding */
+    uint16         EepromCSErrCounter;          /**< \brief EEPROM miscompare counter */
+    uint16         MemoryCSErrCounter;          /**< \brief Memory miscompare counter */
+    uint16         AppCSErrCounter;             /**< \brief App miscompare counter */
+    uint16         TablesCSErrCounter;          /**< \brief Tables miscompare counter */
+    uint16         CfeCoreCSErrCounter;         /**< \brief cFE core miscompare counter */
+    uint16         OSCSErrCounter;              /**< \brief OS code segment miscopmare counter */
+    uint16         CurrentCSTable;              /**< \brief Current table being checksummed */
+    uint16         CurrentEntryInTable;         /**< \brief Current entry ID in table being checksummed */
+    uint32         EepromBaseline;              /**< \brief Baseline checksum for all of EEPROM */
+    uint32         OSBaseline;                  /**< \brief Baseline checksum for the OS code segment */
+    uint32         CfeCoreBaseline;             /**< \brief Basline checksum for the cFE core */
+    cpuaddr        LastOneShotAddress;          /**< \brief Address used in last one shot checksum command */
+    uint32         LastOneShotSize;             /**< \brief Size used in the last one shot checksum command */
+    uint32         LastOneShotMaxBytesPerCycle; /**< \brief Max bytes per cycle for last one shot checksum command */
+    uint32         LastOneShotChecksum;         /**< \brief Checksum of the last one shot checksum command */
+    uint32         PassCounter;                 /**< \brief Number of times CS has passed through all of its tables */
+    uint32         TimeBudget;                  /**< \brief Microseconds of checksumming per background cycle, 0 when
+                                                    limited by bytes per cycle */
+    uint32         TargetPassPeriod;            /**< \brief Seconds the time budget is adjusted to take for a full pass,
+                                                    0 when the time budget is fixed */
+    uint32         LastPassTime;                /**< \brief Milliseconds taken by the last full pass */
+    uint16         BitErrorCounter;             /**< \brief Number of miscompares located to a single bit */
+    uint16         LastBitErrorEntry;           /**< \brief Entry ID of the last single bit error */
+    uint8          LastBitErrorTable;           /**< \brief Table of the last single bit error, CS_CFECORE to
+                                                    CS_APP_TABLE */
+    uint8          LastBitErrorBit;             /**< \brief Bit number, 0 the least significant, of the last single bit
+                                                    error */
+    uint16         Filler16;                    /**< \brief 16 bit padding */
+    cpuaddr        LastBitErrorAddress;         /**< \brief Address of the byte holding the last single bit error */
+    uint32         DeadlineMissCounter;         /**< \brief Number of entries checked later than their revisit period */
+    uint32         JobRate;                     /**< \brief Bytes per second each job checksums, 0 when jobs run as
+                                                    fast as possible at low priority */
+    uint32         JobBurst;                    /**< \brief Bytes each job's token bucket holds */
+    CS_JobStatus_t Jobs[CS_JOB_QUEUE_DEPTH];    /**< \brief Status of each slot of the job queue */
 } CS_HkPacket_Payload_t;
 
 /**
@@ -126,6 +158,57 @@ typedef struct
                                 value */
 } CS_OneShotCmd_Payload_t;
 
+/**
+ * \brief Payload for setting the background time budget
+ */
+typedef struct
+{
+    uint32 TimeBudget;       /**< \brief Microseconds of checksumming per background cycle. Value of Zero to limit
+                                each cycle by bytes per cycle instead */
+    uint32 TargetPassPeriod; /**< \brief Seconds a full pass should take. Value of Zero to keep the time budget
+                                fixed */
+} CS_SetTimeBudgetCmd_Payload_t;
+
+/**
+ * \brief Payload for setting the job rate
+ */
+typedef struct
+{
+    uint32 BytesPerSecond; /**< \brief Bytes per second each job checksums. Value of Zero to run jobs as fast
+                              as possible at low priority */
+    uint32 BurstBytes;     /**< \brief Bytes each job can checksum at once after being idle */
+} CS_SetJobRateCmd_Payload_t;
+
+/**
+ * \brief Payload for managing a table
+ *
+ *  Laid out as the CFE_TBL_NotifyCmd_t Table Services sends.
+ */
+typedef struct
+{
+    uint32 Parameter; /**< \brief Table type of the table to manage */
+} CS_ManageTableCmd_Payload_t;
+
+/**
+ * \brief Payload for setting a table type's revisit period
+ */
+typedef struct
+{
+    uint16 Table;         /**< \brief Table type, #CS_CFECORE to #CS_APP_TABLE */
+    uint16 Filler16;      /**< \brief 16 bit padding */
+    uint32 RevisitPeriod; /**< \brief Seconds allowed between checks of an entry. Value of Zero to leave the
+                             table type to the round robin */
+} CS_SetRevisitPeriodCmd_Payload_t;
+
+/**
+ * \brief Payload for recomputing every baseline in a table
+ */
+typedef struct
+{
+    uint16 Table;    /**< \brief Table type, #CS_CFECORE to #CS_APP_TABLE */
+    uint16 Filler16; /**< \brief 16 bit padding */
+} CS_RecomputeAllCmd_Payload_t;
+
 /**
  * \brief No arguments command data type
  *
@@ -198,6 +281,61 @@ typedef struct
     CS_OneShotCmd_Payload_t Payload;
 } CS_OneShotCmd_t;
 
+/**
+ * \brief Command type for setting the background time budget
+ *
+ *  For command details see #CS_SET_TIME_BUDGET_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t       CommandHeader;
+    CS_SetTimeBudgetCmd_Payload_t Payload;
+} CS_SetTimeBudgetCmd_t;
+
+/**
+ * \brief Command type for setting a table type's revisit period
+ *
+ *  For command details see #CS_SET_REVISIT_PERIOD_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t          CommandHeader;
+    CS_SetRevisitPeriodCmd_Payload_t Payload;
+} CS_SetRevisitPeriodCmd_t;
+
+/**
+ * \brief Command type for setting the job rate
+ *
+ *  For command details see #CS_SET_JOB_RATE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t    CommandHeader;
+    CS_SetJobRateCmd_Payload_t Payload;
+} CS_SetJobRateCmd_t;
+
+/**
+ * \brief Command type for managing a table
+ *
+ *  For command details see #CS_MANAGE_TABLE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t     CommandHeader;
+    CS_ManageTableCmd_Payload_t Payload;
+} CS_ManageTableCmd_t;
+
+/**
+ * \brief Command type for recomputing every baseline in a table
+ *
+ *  For command details see #CS_RECOMPUTE_ALL_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t      CommandHeader;
+    CS_RecomputeAllCmd_Payload_t Payload;
+} CS_RecomputeAllCmd_t;
+
 /**\}*/
 
 #endif
@@ -101,8 +101,8 @@
  *  \par Description
  *         Computes a checksum on the command specified address
  *         and size of memory at the command specified rate.
- *         This command spawns a child task to complete the
- *         checksum.
+ *         This command queues a job for one of the CS job tasks
+ *         to complete the checksum.
  *
  *  \par Command Structure
  *       #CS_OneShotCmd_t
@@ -121,17 +121,14 @@
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
  *       - The address and size cannot be validated
- *       - A child task (recompute baseline or one shot ) is
- *         already running, precluding starting another. Only one child
- *         task is allowed to run at any given time.
- *       - The child task failed to be created
+ *       - The CS job queue already holds #CS_JOB_QUEUE_DEPTH jobs that
+ *         are queued or running.
  *
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
  *       - Error specific event message #CS_CMD_LEN_ERR_EID
  *       - Error specific event message #CS_ONESHOT_MEMVALIDATE_ERR_EID
  *       - Error specific event message #CS_ONESHOT_CHDTASK_ERR_EID
- *       - Error specific event message #CS_ONESHOT_CREATE_CHDTASK_ERR_EID
  *
  *  \par Criticality
  *       None
@@ -150,7 +147,8 @@
  * \brief Cancel one shot
  *
  *  \par Description
- *       Cancels a one shot calculation that is already in progress.
+ *       Cancels every one shot calculation that is queued or in progress.
+ *       A one shot that is running stops after the chunk it is working on.
  *
  *  \par Command Structure
  *       #CS_NoArgsCmd_t
@@ -166,13 +164,11 @@
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
  *       - A one shot calculation is not in progress
- *       - The child task could not be deleted
  *
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
  *       - Error specific event message #CS_CMD_LEN_ERR_EID
  *       - Error specific event message #CS_ONESHOT_CANCEL_NO_CHDTASK_ERR_EID
- *       - Error specific event message #CS_ONESHOT_CANCEL_DELETE_CHDTASK_ERR_EID
  *
  *  \par Criticality
  *       None
@@ -362,15 +358,13 @@
  *  \par Error Conditions
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
- *       - A child task (recompute baseline or one shot ) is
- *         already running, precluding starting another. Only one child
- *         task is allowed to run at any given time.
- *       - The child task failed to be created by Executive Services (ES)
+ *       - The CS job queue already holds #CS_JOB_QUEUE_DEPTH jobs that
+ *         are queued or running, or the entry already has a recompute
+ *         queued or running.
  *
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
  *       - Error specific event message #CS_CMD_LEN_ERR_EID
- *       - Error specific event message #CS_RECOMPUTE_CFECORE_CREATE_CHDTASK_ERR_EID
  *       - Error specific event message #CS_RECOMPUTE_CFECORE_CHDTASK_ERR_EID
  *
  *  \par Criticality
@@ -501,15 +495,13 @@
  *  \par Error Conditions
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
- *       - A child task (recompute baseline or one shot ) is
- *         already running, precluding starting another. Only one child
- *         task is allowed to run at any given time.
- *       - The child task failed to be created by Executive Services (ES)
+ *       - The CS job queue already holds #CS_JOB_QUEUE_DEPTH jobs that
+ *         are queued or running, or the entry already has a recompute
+ *         queued or running.
  *
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
  *       - Error specific event message #CS_CMD_LEN_ERR_EID
- *       - Error specific event message #CS_RECOMPUTE_OS_CREATE_CHDTASK_ERR_EID
  *       - Error specific event message #CS_RECOMPUTE_OS_CHDTASK_ERR_EID
  *
  *  \par Criticality
@@ -628,7 +620,7 @@
  *  \par Description
  *       Recompute the baseline checksum of the EEPROM
  *       table entry and use that value as the new baseline.
- *       This command spawns a child task to do the recompute.
+ *       This command queues a job for one of the CS job tasks to do the recompute.
  *
  *  \par Command Structure
  *       #CS_EntryCmd_t
@@ -646,16 +638,14 @@
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
  *       - The command specified Entry ID is invalid
- *       - A child task (recompute baseline or one shot ) is
- *         already running, precluding starting another. Only one child
- *         task is allowed to run at any given time.
- *       - The child task failed to be created by Executive Services (ES)
+ *       - The CS job queue already holds #CS_JOB_QUEUE_DEPTH jobs that
+ *         are queued or running, or the entry already has a recompute
+ *         queued or running.
  *
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
  *       - Error specific event message #CS_CMD_LEN_ERR_EID
  *       - Error specific event message #CS_RECOMPUTE_INVALID_ENTRY_EEPROM_ERR_EID
- *       - Error specific event message #CS_RECOMPUTE_EEPROM_CREATE_CHDTASK_ERR_EID
  *       - Error specific event message #CS_RECOMPUTE_EEPROM_CHDTASK_ERR_EID
  *
  *  \par Criticality
@@ -872,7 +862,7 @@
  *  \par Description
  *       Recompute the baseline checksum of the Memory
  *       table entry and use that value as the new baseline.
- *       This command spawns a child task to do the recompute.
+ *       This command queues a job for one of the CS job tasks to do the recompute.
  *
  *  \par Command Structure
  *       #CS_EntryCmd_t
@@ -890,16 +880,14 @@
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
  *       - The command specified Entry ID is invalid
- *       - A child task (recompute baseline or one shot ) is
- *         already running, precluding starting another. Only one child
- *         task is allowed to run at any given time.
- *       - The child task failed to be created by Executive Services (ES)
+ *       - The CS job queue already holds #CS_JOB_QUEUE_DEPTH jobs that
+ *         are queued or running, or the entry already has a recompute
+ *         queued or running.
  *
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
  *       - Error specific event message #CS_CMD_LEN_ERR_EID
  *       - Error specific event message #CS_RECOMPUTE_INVALID_ENTRY_MEMORY_ERR_EID
- *       - Error specific event message #CS_RECOMPUTE_MEMORY_CREATE_CHDTASK_ERR_EID
  *       - Error specific event message #CS_RECOMPUTE_MEMORY_CHDTASK_ERR_EID
  *
  *  \par Criticality
@@ -1117,7 +1105,7 @@
  *  \par Description
  *       Recompute the baseline checksum of the
  *       table and use that value as the new baseline.
- *       This command spawns a child task to do the recompute.
+ *       This command queues a job for one of the CS job tasks to do the recompute.
  *
  *  \par Command Structure
  *       #CS_TableNameCmd_t
@@ -1141,16 +1129,14 @@
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
  *       - The command specified table name is invalid
- *       - A child task (recompute baseline or one shot ) is
- *         already running, precluding starting another. Only one child
- *         task is allowed to run at any given time.
- *       - The child task failed to be created by Executive Services (ES)
+ *       - The CS job queue already holds #CS_JOB_QUEUE_DEPTH jobs that
+ *         are queued or running, or the entry already has a recompute
+ *         queued or running.
  *
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
  *       - Error specific event message #CS_CMD_LEN_ERR_EID
  *       - Error specific event message #CS_RECOMPUTE_UNKNOWN_NAME_TABLES_ERR_EID
- *       - Error specific event message #CS_RECOMPUTE_TABLES_CREATE_CHDTASK_ERR_EID
  *       - Error specific event message #CS_RECOMPUTE_TABLES_CHDTASK_ERR_EID
  *
  *  \par Criticality
@@ -1335,7 +1321,7 @@
  *  \par Description
  *       Recompute the baseline checksum of the
  *       app and use that value as the new baseline.
- *       This command spawns a child task to do the recompute.
+ *       This command queues a job for one of the CS job tasks to do the recompute.
  *
  *  \par Command Structure
  *       #CS_AppNameCmd_t
@@ -1353,16 +1339,14 @@
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
  *       - The command specified app name is invalid
- *       - A child task (recompute baseline or one shot ) is
- *         already running, precluding starting another. Only one child
- *         task is allowed to run at any given time.
- *       - The child task failed to be created by Executive Services (ES)
+ *       - The CS job queue already holds #CS_JOB_QUEUE_DEPTH jobs that
+ *         are queued or running, or the entry already has a recompute
+ *         queued or running.
  *
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
  *       - Error specific event message #CS_CMD_LEN_ERR_EID
  *       - Error specific event message #CS_RECOMPUTE_UNKNOWN_NAME_APP_ERR_EID
- *       - Error specific event message #CS_RECOMPUTE_APP_CREATE_CHDTASK_ERR_EID
  *       - Error specific event message #CS_RECOMPUTE_APP_CHDTASK_ERR_EID
  *
  *  \par Criticality
@@ -1443,6 +1427,214 @@
  */
 #define CS_DISABLE_NAME_APP_CC 39
 
+/**
+ * \brief Set background time budget
+ *
+ *  \par Description
+ *       Sets the number of microseconds of checksumming done in each
+ *       background cycle, and the period a full pass through all of the
+ *       tables should take.  With a time budget, each cycle checksums
+ *       #CS_TIME_BUDGET_CHUNK_SIZE byte chunks until the time is spent or
+ *       the current entry is finished.  With a target pass period, the
+ *       time budget is adjusted at the end of every pass so the next pass
+ *       takes about that long, within #CS_MIN_TIME_BUDGET and
+ *       #CS_MAX_TIME_BUDGET.  A time budget of zero returns to checksumming
+ *       a fixed number of bytes per cycle.
+ *
+ *  \par Command Structure
+ *       #CS_SetTimeBudgetCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdCounter will increment
+ *       - #CS_HkPacket_Payload_t.TimeBudget and
+ *         #CS_HkPacket_Payload_t.TargetPassPeriod will be updated
+ *       - The #CS_SET_TIME_BUDGET_INF_EID informational event message will be
+ *         generated when the command is received
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Time budget is neither zero nor between #CS_MIN_TIME_BUDGET and
+ *         #CS_MAX_TIME_BUDGET
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
+ *       - Error specific event message #CS_CMD_LEN_ERR_EID
+ *       - Error specific event message #CS_SET_TIME_BUDGET_ERR_EID
+ *
+ *  \par Criticality
+ *       A time budget close to the scheduler frame length may cause frame
+ *       overruns.
+ */
+#define CS_SET_TIME_BUDGET_CC 40
+
+/**
+ * \brief Set revisit period
+ *
+ *  \par Description
+ *       Sets the number of seconds allowed between background checks of
+ *       each entry of a table type.  Once a table type has a revisit
+ *       period, its sweeps are released half a period before their
+ *       deadline and run ahead of the round robin through the table types,
+ *       earliest deadline first.  The round robin resumes where it left
+ *       off when the sweep is done.  A period of zero leaves the table type
+ *       to the round robin.
+ *
+ *  \par Command Structure
+ *       #CS_SetRevisitPeriodCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdCounter will increment
+ *       - The #CS_SET_REVISIT_PERIOD_INF_EID informational event message will be
+ *         generated when the command is received
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Table type is not between #CS_CFECORE and #CS_APP_TABLE
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
+ *       - Error specific event message #CS_CMD_LEN_ERR_EID
+ *       - Error specific event message #CS_SET_REVISIT_PERIOD_ERR_EID
+ *
+ *  \par Criticality
+ *       A revisit period shorter than a table type's sweep keeps that table
+ *       type ahead of all the others.
+ */
+#define CS_SET_REVISIT_PERIOD_CC 41
+
+/**
+ * \brief Recompute all baselines in a table
+ *
+ *  \par Description
+ *       Recomputes the baseline of every entry of a table type that is not
+ *       #CS_STATE_EMPTY.  This command queues a single job for one of the
+ *       CS job tasks, which recomputes the entries one after another the
+ *       same way the recompute baseline command for the table type does.
+ *
+ *  \par Command Structure
+ *       #CS_RecomputeAllCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdCounter will increment
+ *       - #CS_HkPacket_Payload_t.RecomputeInProgress will be set to true
+ *       - The #CS_RECOMPUTE_ALL_STARTED_DBG_EID debug event message will be
+ *         generated when the command is received
+ *       - The #CS_RECOMPUTE_ALL_FINISH_INF_EID informational event message
+ *         will be generated when every entry has been recomputed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Table type is not between #CS_CFECORE and #CS_APP_TABLE
+ *       - The CS job queue already holds #CS_JOB_QUEUE_DEPTH jobs that
+ *         are queued or running, or the table already has a recompute
+ *         queued or running.
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
+ *       - Error specific event message #CS_CMD_LEN_ERR_EID
+ *       - Error specific event message #CS_RECOMPUTE_ALL_INVALID_ERR_EID
+ *       - Error specific event message #CS_RECOMPUTE_ALL_CHDTASK_ERR_EID
+ *
+ *  \par Criticality
+ *       As with #CS_RECOMPUTE_BASELINE_TABLE_CC, recomputing the Tables
+ *       table type also recomputes the CS Tables Definition Table entry,
+ *       whose checksum will be incorrect.
+ *
+ *  \sa #CS_RECOMPUTE_BASELINE_EEPROM_CC,
+ *      #CS_RECOMPUTE_BASELINE_MEMORY_CC,
+ *      #CS_RECOMPUTE_BASELINE_TABLE_CC,
+ *      #CS_RECOMPUTE_BASELINE_APP_CC
+ */
+#define CS_RECOMPUTE_ALL_CC 42
+
+/**
+ * \brief Set job rate
+ *
+ *  \par Description
+ *       Sets the rate at which recompute and OneShot jobs checksum.  Each
+ *       job has a token bucket that fills at the given number of bytes per
+ *       second up to the burst size, and checksums only as many bytes as
+ *       the bucket holds, a chunk at a time.  A rate of zero lets jobs run
+ *       without delays, with their job task dropped to #CS_JOB_LOW_PRIORITY
+ *       so that any higher priority task can take over.  Jobs take the
+ *       rate when they are queued; jobs already queued or running keep the
+ *       rate they have.
+ *
+ *  \par Command Structure
+ *       #CS_SetJobRateCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdCounter will increment
+ *       - #CS_HkPacket_Payload_t.JobRate and
+ *         #CS_HkPacket_Payload_t.JobBurst will be updated
+ *       - The #CS_SET_JOB_RATE_INF_EID informational event message will be
+ *         generated when the command is received
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Burst size is zero with a non-zero rate
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
+ *       - Error specific event message #CS_CMD_LEN_ERR_EID
+ *       - Error specific event message #CS_SET_JOB_RATE_ERR_EID
+ *
+ *  \par Criticality
+ *       A rate of zero lets jobs take all of the CPU that tasks of higher
+ *       priority than #CS_JOB_LOW_PRIORITY leave, including the background
+ *       share of the CS main task's cycles, see #CS_BKGND_MIN_SHARE.
+ */
+#define CS_SET_JOB_RATE_CC 43
+
+/**
+ * \brief Manage Table
+ *
+ *  \par Description
+ *       Lets CS manage one of its own tables.  Table Services sends this
+ *       command, through CFE_TBL_NotifyByMessage, when a load, validation
+ *       or dump of the table is pending.  Until then housekeeping requests
+ *       leave the table alone.
+ *
+ *  \par Command Structure
+ *       #CS_ManageTableCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - The table's pending load, validation or dump completes
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Parameter is not #CS_EEPROM_TABLE, #CS_MEMORY_TABLE,
+ *         #CS_TABLES_TABLE, #CS_APP_TABLE or #CS_BLOCK_TABLE
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
+ *       - Error specific event message #CS_CMD_LEN_ERR_EID
+ *       - Error specific event message #CS_MANAGE_TABLE_ERR_EID
+ *
+ *  \par Criticality
+ *       None.  #CS_HkPacket_Payload_t.CmdCounter does not increment, as
+ *       the command is not sent from the ground.  While a recompute of
+ *       the table is running, the table is managed at the next
+ *       housekeeping request after it finishes.  For #CS_BLOCK_TABLE
+ *       that is any EEPROM or Memory recompute.
+ */
+#define CS_MANAGE_TABLE_CC 44
+
 /**\}*/
 
 /**
@@ -1458,6 +1650,13 @@
 #define CS_NUM_TABLES   6 /**< \brief Number of checksum types*/
 /**\}*/
 
+/**
+ * \brief Block results table, a #CS_MANAGE_TABLE_CC parameter
+ *
+ * Not a checksum type, so numbered after them
+ */
+#define CS_BLOCK_TABLE CS_NUM_TABLES
+
 /**
  * \name CS Checkum States
  * \{
@@ -1468,6 +1667,27 @@
 #define CS_STATE_UNDEFINED 0x03 /**< \brief Entry not found state undefined */
 /**\}*/
 
+/**
+ * \name CS Job Types
+ * \{
+ */
+#define CS_JOB_TYPE_RECOMPUTE     1 /**< \brief Recompute one entry's baseline */
+#define CS_JOB_TYPE_RECOMPUTE_ALL 2 /**< \brief Recompute every entry of a table type */
+#define CS_JOB_TYPE_ONESHOT       3 /**< \brief One shot checksum of an address range */
+/**\}*/
+
+/**
+ * \name CS Job States
+ * \{
+ */
+#define CS_JOB_STATUS_FREE      0 /**< \brief Slot never used */
+#define CS_JOB_STATUS_QUEUED    1 /**< \brief Waiting for a job task */
+#define CS_JOB_STATUS_RUNNING   2 /**< \brief A job task is working on it */
+#define CS_JOB_STATUS_DONE      3 /**< \brief Finished, Result holds its outcome */
+#define CS_JOB_STATUS_FAILED    4 /**< \brief Could not be done */
+#define CS_JOB_STATUS_CANCELLED 5 /**< \brief Cancelled before it finished */
+/**\}*/
+
 #ifndef CS_OMIT_DEPRECATED
 #define CS_ONESHOT_CC                    CS_ONE_SHOT_CC
 #define CS_CANCEL_ONESHOT_CC             CS_CANCEL_ONE_SHOT_CC
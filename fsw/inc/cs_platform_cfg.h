@@ -108,7 +108,11 @@
  *
  *  \par Limits:
  *     This parameter is limited by the  uint16 datatype that defines it.
- *     This parameter is limited to 65535.
+ *     This parameter is limited to 65535.  The definition and results
+ *     tables are registered at this size, so they must also fit in
+ *     #CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE, which the build checks.  With
+ *     the default 16 KB limit that is at most 93 entries on a 64-bit
+ *     target, set by the 176 byte results entries.
  */
 #define CS_MAX_NUM_EEPROM_TABLE_ENTRIES 16
 
@@ -121,7 +125,11 @@
  *
  *  \par Limits:
  *     This parameter is limited by the  uint16 datatype that defines it.
- *     This parameter is limited to 65535.
+ *     This parameter is limited to 65535.  The definition and results
+ *     tables are registered at this size, so they must also fit in
+ *     #CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE, which the build checks.  With
+ *     the default 16 KB limit that is at most 93 entries on a 64-bit
+ *     target, set by the 176 byte results entries.
  */
 #define CS_MAX_NUM_MEMORY_TABLE_ENTRIES 16
 
@@ -134,6 +142,11 @@
  *  \par Limits:
  *       This parameter is limited by the maximum number of tables allowed
  *       in the system. This parameter is limited to #CFE_PLATFORM_TBL_MAX_NUM_TABLES
+ *       and to 65535.  The definition and results tables are registered at
+ *       this size, so they must also fit in #CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE,
+ *       which the build checks.  With the default 16 KB limit that is at most
+ *       75 entries on a 64-bit target, set by the 216 byte results entries;
+ *       checksumming 300 tables needs a limit of at least 64 KB.
  */
 #define CS_MAX_NUM_TABLES_TABLE_ENTRIES 24
 
@@ -144,11 +157,59 @@
  *        Maximum number of entries in the table of applications to checksum
  *
  *  \par Limits:
- *       This parameter is limited by the maximum number of applications allowed
- *       in the system. This parameter is limited to #CFE_PLATFORM_ES_MAX_APPLICATIONS
+ *       This parameter is limited by the maximum number of applications and
+ *       libraries allowed in the system, #CFE_PLATFORM_ES_MAX_APPLICATIONS plus
+ *       #CFE_PLATFORM_ES_MAX_LIBRARIES, and to 65535.  The definition and
+ *       results tables are registered at this size, so they must also fit in
+ *       #CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE, which the build checks.  With
+ *       the default 16 KB limit that is at most 81 entries on a 64-bit
+ *       target, set by the 200 byte results entries.
  */
 #define CS_MAX_NUM_APP_TABLE_ENTRIES 24
 
+/**
+ * \brief Block tree leaf size
+ *
+ *  \par  Description:
+ *        Number of bytes covered by each leaf of the block CRC tree kept
+ *        for EEPROM and Memory entries that request one.  Smaller leaves
+ *        locate a corruption more precisely but need more nodes.
+ *
+ *  \par Limits:
+ *       Must be at least 64.
+ */
+#define CS_BLOCK_TREE_LEAF_SIZE 4096
+
+/**
+ * \brief Maximum number of block trees
+ *
+ *  \par  Description:
+ *        Maximum number of EEPROM and Memory entries, across both tables,
+ *        that can keep a block CRC tree at the same time.
+ *
+ *  \par Limits:
+ *       Must be at least 1.
+ */
+#define CS_MAX_NUM_BLOCK_TREES 8
+
+/**
+ * \brief Number of block tree nodes
+ *
+ *  \par  Description:
+ *        Number of 32-bit nodes in the block results table, shared by all
+ *        block trees.  An entry of N leaves uses about 3 * N nodes: the
+ *        leaves of the last pass plus the baseline tree.  The default fits
+ *        5 MB of trees with 4 KB leaves.
+ *
+ *  \par Limits:
+ *       Must be at least 3.  The block results table, 4 bytes per node
+ *       plus 40 bytes per tree, is registered as a single buffered table,
+ *       so it must fit in #CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE, which the
+ *       build checks.  With the default 16 KB limit and 8 trees, that is at
+ *       most 4016 nodes.
+ */
+#define CS_MAX_NUM_BLOCK_NODES 3840
+
 /**
  * \brief Default number of bytes to checksum per cycle
  *
@@ -163,6 +224,234 @@
  */
 #define CS_DEFAULT_BYTES_PER_CYCLE (1024 * 16)
 
+/**
+ * \brief Default time budget per background cycle
+ *
+ *  \par  Description:
+ *        The default number of microseconds of checksumming in a single
+ *        background CS cycle, measured with the PSP timebase.  When non-zero
+ *        each cycle checksums #CS_TIME_BUDGET_CHUNK_SIZE byte chunks until the
+ *        time is spent or the entry is finished, instead of checksumming
+ *        #CS_DEFAULT_BYTES_PER_CYCLE bytes.  A value of 0 uses the byte limit.
+ *
+ *  \par Limits:
+ *       Must be 0 or between #CS_MIN_TIME_BUDGET and #CS_MAX_TIME_BUDGET.
+ */
+#define CS_DEFAULT_TIME_BUDGET 0
+
+/**
+ * \brief Minimum time budget per background cycle
+ *
+ *  \par  Description:
+ *        Smallest number of microseconds per background cycle that can be
+ *        commanded, or chosen when adjusting toward the target pass period.
+ *
+ *  \par Limits:
+ *       Must be at least 1 and no greater than #CS_MAX_TIME_BUDGET.
+ */
+#define CS_MIN_TIME_BUDGET 100
+
+/**
+ * \brief Maximum time budget per background cycle
+ *
+ *  \par  Description:
+ *        Largest number of microseconds per background cycle that can be
+ *        commanded, or chosen when adjusting toward the target pass period.
+ *        This should leave room for the rest of the scheduler frame.
+ *
+ *  \par Limits:
+ *       Must be no less than #CS_MIN_TIME_BUDGET.
+ */
+#define CS_MAX_TIME_BUDGET 50000
+
+/**
+ * \brief Bytes checksummed between time budget checks
+ *
+ *  \par  Description:
+ *        When a time budget is set, the background cycle checksums this many
+ *        bytes at a time and checks the timebase after each chunk, so a cycle
+ *        can overrun its budget by at most one chunk.  Recompute jobs take
+ *        chunks of this size from their token bucket.  EEPROM, Memory, OS
+ *        and cFE core chunks the worker pool can stripe are multiplied by
+ *        the number of worker pool lanes, and grown to at least two
+ *        #CS_WORKER_STRIPE_SIZE stripes.
+ *
+ *  \par Limits:
+ *       Must be at least 1.
+ */
+#define CS_TIME_BUDGET_CHUNK_SIZE 4096
+
+/**
+ * \brief Bytes checksummed between yield checks
+ *
+ *  \par  Description:
+ *        When #CS_DEFAULT_YIELD_INTERVAL is non-zero, the background cycle
+ *        checksums its bytes in blocks of this size, and checks after each
+ *        block whether it has held the CPU for the yield interval.  The
+ *        partial checksum carries on from one block to the next.  EEPROM,
+ *        Memory, OS and cFE core blocks the worker pool can stripe are
+ *        multiplied by the number of worker pool lanes, and grown to at
+ *        least two #CS_WORKER_STRIPE_SIZE stripes.
+ *
+ *  \par Limits:
+ *       Must be at least 1.
+ */
+#define CS_YIELD_BLOCK_SIZE (1024 * 16)
+
+/**
+ * \brief Default microseconds of checksumming between yields
+ *
+ *  \par  Description:
+ *        Once the background cycle has checksummed for this many
+ *        microseconds without a break, CS calls OS_TaskDelay(0) between
+ *        blocks of #CS_YIELD_BLOCK_SIZE bytes so tasks of the same priority
+ *        can run.  This keeps a large #CS_DEFAULT_BYTES_PER_CYCLE or time
+ *        budget from adding long stretches of jitter to the rest of the
+ *        rate group.  Time spent yielded is not counted against the time
+ *        budget.  A value of 0 never yields.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than an unsigned 32 bit
+ *       integer (4294967295).
+ */
+#define CS_DEFAULT_YIELD_INTERVAL 0
+
+/**
+ * \brief Default target period for a full background pass
+ *
+ *  \par  Description:
+ *        When non-zero and a time budget is set, the time budget is adjusted
+ *        at the end of each pass through all of the tables so that a full
+ *        pass takes about this many seconds.  A value of 0 keeps the time
+ *        budget fixed.
+ *
+ *  \par Limits:
+ *       CS does not place limits on this parameter.
+ */
+#define CS_DEFAULT_TARGET_PASS_PERIOD 0
+
+/**
+ * \name Default revisit periods
+ *
+ *  \par  Description:
+ *        Seconds allowed between background checks of each entry of a
+ *        table type.  Table types with a revisit period are swept in order
+ *        of deadline ahead of the round robin through the table types, and
+ *        an entry checked later than its revisit period counts as a
+ *        deadline miss.  A value of 0 leaves the table type to the round
+ *        robin.  Can be changed by command.
+ *
+ *  \par Limits:
+ *       CS does not place limits on these parameters.  A period shorter
+ *       than twice the time a sweep of the table type takes will be missed.
+ * \{
+ */
+#define CS_DEFAULT_CFECORE_REVISIT_PERIOD 0 /**< \brief cFE core revisit period */
+#define CS_DEFAULT_OS_REVISIT_PERIOD      0 /**< \brief OS code segment revisit period */
+#define CS_DEFAULT_EEPROM_REVISIT_PERIOD  0 /**< \brief EEPROM table revisit period */
+#define CS_DEFAULT_MEMORY_REVISIT_PERIOD  0 /**< \brief Memory table revisit period */
+#define CS_DEFAULT_TABLES_REVISIT_PERIOD  0 /**< \brief Tables table revisit period */
+#define CS_DEFAULT_APP_REVISIT_PERIOD     0 /**< \brief App table revisit period */
+/**\}*/
+
+/**
+ * \brief Number of bytes processed per step of the CRC engine
+ *
+ *  \par  Description:
+ *        The CS CRC engine uses slice-by-N lookup tables to process this
+ *        many bytes per step instead of one.  Larger values are faster on
+ *        processors with large data caches, at the cost of larger tables:
+ *        each slice adds 512 bytes of CRC-16 table and 1 KB each of CRC-32
+ *        and CRC-32C table to the application's read-only data.
+ *
+ *  \par Limits:
+ *       Must be either 8 or 16.
+ */
+#define CS_CRC_SLICE_WIDTH 8
+
+/**
+ * \brief Use hardware CRC instructions when available
+ *
+ *  \par  Description:
+ *        When true, CS probes the processor at initialization and uses
+ *        carry-less multiply (PCLMULQDQ / PMULL) and crc32 instructions
+ *        on x86-64 and ARMv8 processors that provide them.  The hardware
+ *        kernels produce the same results as the portable table kernels.
+ *        Set to false to always use the portable kernels.
+ *
+ *  \par Limits:
+ *       Must be true or false.  Has no effect on other processors.
+ */
+#define CS_CRC_HW_ACCELERATION true
+
+/**
+ * \brief Read each table type with streaming hints
+ *
+ *  \par  Description:
+ *        When true, every entry of the table type is checksummed in
+ *        #CS_STREAM_BLOCK_SIZE byte blocks, with each block prefetched with
+ *        a non-temporal hint while the one before it is checksummed, so a
+ *        pass over a large region does not evict the working sets of the
+ *        other applications on the processor.  On Linux the region is also
+ *        advised as read sequentially and not needed again.  EEPROM and
+ *        Memory entries can also select streaming one entry at a time with
+ *        the Streaming field of their definition table.  Streaming does
+ *        not change any checksum.
+ *
+ *  \par Limits:
+ *       Must be true or false.
+ * \{
+ */
+#define CS_CFECORE_STREAMING false /**< \brief Stream the cFE core code segment */
+#define CS_OS_STREAMING      false /**< \brief Stream the OS code segment */
+#define CS_EEPROM_STREAMING  false /**< \brief Stream every EEPROM table entry */
+#define CS_MEMORY_STREAMING  false /**< \brief Stream every Memory table entry */
+#define CS_TABLES_STREAMING  false /**< \brief Stream every Tables table entry */
+#define CS_APP_STREAMING     false /**< \brief Stream every App table entry */
+/**\}*/
+
+/**
+ * \brief Bytes prefetched ahead of a streaming checksum
+ *
+ *  \par  Description:
+ *        A streaming checksum prefetches the next block of this many bytes
+ *        while it checksums the current one.  Larger blocks hide more of
+ *        the memory latency but need more of the cache to hold the block
+ *        being prefetched.
+ *
+ *  \par Limits:
+ *       Must be a multiple of #CS_CACHE_LINE_SIZE.
+ */
+#define CS_STREAM_BLOCK_SIZE 4096
+
+/**
+ * \brief Size in bytes of the processor's data cache lines
+ *
+ *  \par  Description:
+ *        A streaming checksum issues one prefetch per cache line.
+ *
+ *  \par Limits:
+ *       Must be a power of two.
+ */
+#define CS_CACHE_LINE_SIZE 64
+
+/**
+ * \brief Size of the single bit error lookup tables
+ *
+ *  \par  Description:
+ *        When a CRC-16, CRC-32 or CRC-32C checksum miscompares, CS treats
+ *        the difference between the expected and computed values as the
+ *        syndrome of a single bit error and solves for the bit's position
+ *        with a baby-step giant-step discrete logarithm.  Each CRC type has
+ *        a table of this many precomputed steps, 8 bytes each.  Locating an
+ *        error in a region of N bytes takes about 8 * N / CS_SYNDROME_TABLE_SIZE
+ *        table searches, with no reads of the region.
+ *
+ *  \par Limits:
+ *       Must be between 16 and 32767.
+ */
+#define CS_SYNDROME_TABLE_SIZE 1024
+
 /**
  * \brief CS Child Task Priority
  *
@@ -176,20 +465,160 @@
 #define CS_CHILD_TASK_PRIORITY 200
 
 /**
- * \brief Delay between checksumming cycles for child task
+ * \brief Default job rate
  *
  *  \par  Description:
- *        CS child tasks perform checksum cycles like the main App.
- *        Since the child tasks aren't scheduled, there needs to be
- *        some other mechanism to prevent it from hogging the CPU.
- *        This parameter specifies the number of milliseconds to delay
- *        in between cycles.
+ *        Bytes per second each recompute or OneShot job checksums when CS
+ *        starts.  Job tasks aren't scheduled, so each job draws on a token
+ *        bucket filled at this rate to keep it from hogging the CPU.  The
+ *        rate can be changed with #CS_SET_JOB_RATE_CC.  A rate of zero runs
+ *        jobs as fast as possible at #CS_JOB_LOW_PRIORITY instead.
  *
  *  \par Limits:
- *       CS does not place limits on this parameter. It is intended to
- *       be configurable to prevent the child task from hogging the CPU
+ *       This parameter can't be larger than an unsigned 32 bit
+ *       integer (4294967295).
+ */
+#define CS_DEFAULT_JOB_RATE (1024 * 16)
+
+/**
+ * \brief Default job burst size
+ *
+ *  \par  Description:
+ *        Number of bytes a job's token bucket holds when CS starts, which
+ *        is how many bytes a job can checksum at once after it has been
+ *        idle, and how many it starts with.
+ *
+ *  \par Limits:
+ *       Must be at least 1, and can't be larger than an unsigned 32 bit
+ *       integer (4294967295).
+ */
+#define CS_DEFAULT_JOB_BURST (1024 * 16)
+
+/**
+ * \brief Job task priority when jobs are not rate limited
+ *
+ *  \par  Description:
+ *        With a job rate of zero, job tasks drop to this priority while
+ *        they run a job and checksum without delays, so they only use
+ *        time no higher priority task wants.  It should be lower, which
+ *        is a larger number, than every task that must not be held up.
+ *
+ *  \par Limits:
+ *       Valid range for a child task is 1 to 255
+ */
+#define CS_JOB_LOW_PRIORITY 250
+
+/**
+ * \brief Number of recompute and OneShot job tasks
+ *
+ *  \par  Description:
+ *        Number of child tasks CS creates at startup to run recompute
+ *        baseline and OneShot jobs from the job queue.  Each job task runs
+ *        one job at a time, so this many jobs make progress at once and
+ *        the rest wait in the queue.
+ *
+ *  \par Limits:
+ *       Must be between 1 and 8.
+ */
+#define CS_NUM_JOB_TASKS 2
+
+/**
+ * \brief Depth of the recompute and OneShot job queue
+ *
+ *  \par  Description:
+ *        Number of recompute baseline and OneShot jobs that can be queued
+ *        or running at once.  Housekeeping telemetry reports the status of
+ *        each slot, so each one adds to the size of the housekeeping packet.
+ *
+ *  \par Limits:
+ *       Must be between 1 and 255.
+ */
+#define CS_JOB_QUEUE_DEPTH 8
+
+/**
+ * \brief Share of each background cycle kept for background checking
+ *
+ *  \par  Description:
+ *        Recompute and OneShot jobs share the background cycle's byte
+ *        limit, or its time budget, with background checking.  What the
+ *        job tasks used since the last cycle is taken off the next cycle,
+ *        but never more than would leave background checking less than
+ *        this percentage of the cycle, so integrity monitoring carries on
+ *        at a reduced rate while jobs run.
+ *
+ *  \par Limits:
+ *       Must be between 1 and 100.  At 100 jobs do not slow background
+ *       checking at all.
+ */
+#define CS_BKGND_MIN_SHARE 25
+
+/**
+ * \brief Number of checksum worker tasks
+ *
+ *  \par  Description:
+ *        Number of child tasks CS creates at startup to checksum large
+ *        EEPROM, Memory, OS and cFE core regions in parallel.  The calling
+ *        task also processes stripes, so each cycle covers up to
+ *        (CS_NUM_WORKER_TASKS + 1) times the bytes-per-cycle limit.  A value
+ *        of 0 disables the worker pool and all checksums are computed by
+ *        the calling task.
+ *
+ *  \par Limits:
+ *       Must be between 0 and 8.  Values above the number of processor
+ *       cores available to CS gain nothing.
+ */
+#define CS_NUM_WORKER_TASKS 0
+
+/**
+ * \brief CS Worker Task Priority
+ *
+ *  \par  Description:
+ *        Priority of the checksum worker tasks.  Lower numbers are higher
+ *        priority, with 1 being the highest priority in the case of a child
+ *        task.
+ *
+ *  \par Limits:
+ *       Valid range for a child task is 1 to 255
  */
-#define CS_CHILD_TASK_DELAY 1000
+#define CS_WORKER_TASK_PRIORITY 200
+
+/**
+ * \brief Worker pool stripe size
+ *
+ *  \par  Description:
+ *        Number of bytes in each stripe handed to the worker pool.  Regions
+ *        shorter than two stripes are checksummed by the calling task.
+ *
+ *  \par Limits:
+ *       Must be at least 1024.  When #CS_NUM_WORKER_TASKS is not 0, two
+ *       stripes must fit in #CS_DEFAULT_BYTES_PER_CYCLE.
+ */
+#define CS_WORKER_STRIPE_SIZE 65536
+
+/**
+ * \brief Maximum number of stripes per worker pool job
+ *
+ *  \par  Description:
+ *        Upper bound on the number of stripes one region is split into.
+ *        Longer regions use proportionally larger stripes.
+ *
+ *  \par Limits:
+ *       Must be between 2 and 256.
+ */
+#define CS_WORKER_MAX_STRIPES 64
+
+/**
+ * \brief Worker pool job timeout
+ *
+ *  \par  Description:
+ *        Number of milliseconds the calling task waits for the workers to
+ *        finish a job.  If a job does not finish in time the worker pool is
+ *        disabled and CS continues checksumming without it.
+ *
+ *  \par Limits:
+ *       Must be greater than 0.
+ */
+#define CS_WORKER_TIMEOUT 1000
 
 /**
  * \brief Timeout for waiting for other apps to start
@@ -306,6 +735,84 @@
  */
 #define CS_CDS_NAME "CS_CDS"
 
+/**
+ * \brief Whether to preserve checksum baselines on processor reset
+ *
+ *  \par Description:
+ *       This determines whether the baselines of the cFE core and OS
+ *       code segments and of the EEPROM and Memory table entries, and
+ *       how far an unfinished checksum of each has got, are kept in a
+ *       Critical Data Store.  On a processor reset, entries that still
+ *       cover the same memory with the same algorithm start with their
+ *       old baseline instead of computing a new one.
+ *
+ *  \par Limits:
+ *       None
+ */
+#define CS_PRESERVE_BASELINES_ON_PROCESSOR_RESET true
+
+/**
+ * \brief Name of the Critical Data Store Used for CS baselines
+ *
+ *  \par Description:
+ *       Name of the Critical Data Store that keeps the checksum
+ *       baselines when #CS_PRESERVE_BASELINES_ON_PROCESSOR_RESET is true
+ *
+ *  \par Limits:
+ *       Must be a unique string with regards to CDS
+ */
+#define CS_BASELINE_CDS_NAME "CS_BASELINES"
+
+/**
+ * \brief Housekeeping requests between saves of the baselines
+ *
+ *  \par Description:
+ *       The baselines are copied to the Critical Data Store once every
+ *       this many housekeeping requests.  A processor reset loses the
+ *       progress made since the last save, and any entry first
+ *       baselined since then computes its baseline again.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1
+ */
+#define CS_BASELINE_SAVE_PERIOD 4
+
+/**
+ * \brief Whether table baselines start from the Table Services CRC
+ *
+ *  \par Description:
+ *       Table Services computes a #CFE_MISSION_ES_DEFAULT_CRC CRC of each
+ *       table image it loads.  When this is true, a Tables table entry
+ *       whose algorithm is that same CRC takes the CRC as its baseline as
+ *       soon as CS sees the table loaded or updated, so the first pass
+ *       over the table checks it rather than computing its baseline.
+ *       Entries with any other algorithm, and dump-only tables, still
+ *       compute their baseline on the first pass.
+ *
+ *  \par Limits:
+ *       Must be true or false.
+ */
+#define CS_ADOPT_TABLE_SERVICES_CRC true
+
+/**
+ * \brief Size of the table snapshot buffer
+ *
+ *  \par Description:
+ *       Tables table entries with Snapshot set are copied into a buffer
+ *       of this many bytes and the copy is checksummed, so that updates
+ *       to the table while it is checksummed do not make the entry start
+ *       over.  The default holds the largest table Table Services can
+ *       register.  A larger table is checksummed in place.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1.  The buffer is part of the CS
+ *       application data, so it is always allocated.
+ */
+#define CS_TABLE_SNAPSHOT_SIZE                                                    \
+    ((CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE > CFE_PLATFORM_TBL_MAX_DBL_TABLE_SIZE) \
+         ? CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE                                   \
+         : CFE_PLATFORM_TBL_MAX_DBL_TABLE_SIZE)
+
 /**
  * \brief Mission specific version number for CS application
  *
@@ -30,6 +30,7 @@
  **
  **************************************************************************/
 #include <cfe.h>
+#include "cs_platform_cfg.h"
 
 /**************************************************************************
  **
@@ -55,23 +56,94 @@
 #define CS_RESULTS_MEMORY_TABLE_NAME "ResMemoryTbl"
 #define CS_RESULTS_TABLES_TABLE_NAME "ResTablesTbl"
 #define CS_RESULTS_APP_TABLE_NAME    "ResAppTbl"
+#define CS_RESULTS_BLOCK_TABLE_NAME  "ResBlockTbl"
 /**\}*/
 
+/**
+ * \name Checksum algorithms
+ *
+ *  Selects the algorithm used for a definition table entry.  An entry
+ *  left at #CS_ALGORITHM_DEFAULT uses #CS_DEFAULT_ALGORITHM, so tables
+ *  written before the Algorithm field existed keep their behavior.
+ * \{
+ */
+#define CS_ALGORITHM_DEFAULT     0 /**< \brief #CS_DEFAULT_ALGORITHM */
+#define CS_ALGORITHM_CRC_16      1 /**< \brief CRC-16/ARC, as #CFE_ES_CrcType_CRC_16 */
+#define CS_ALGORITHM_CRC_32      2 /**< \brief CRC-32 (IEEE 802.3) */
+#define CS_ALGORITHM_CRC_32C     3 /**< \brief CRC-32C (Castagnoli) */
+#define CS_ALGORITHM_CRC_64      4 /**< \brief CRC-64/XZ (ECMA-182 polynomial, reflected) */
+#define CS_ALGORITHM_FLETCHER_64 5 /**< \brief Fletcher-64 over little-endian 32-bit words */
+#define CS_ALGORITHM_SHA_256     6 /**< \brief SHA-256 (FIPS 180-4) */
+#define CS_NUM_ALGORITHMS        7 /**< \brief Number of algorithm identifiers */
+/**\}*/
+
+/**
+ * \brief Size in bytes of the largest checksum digest (SHA-256)
+ */
+#define CS_MAX_DIGEST_SIZE 32
+
 /**************************************************************************
  **
  ** Type definitions
  **
  **************************************************************************/
 
+/**
+ * \brief A complete checksum value
+ *
+ *  The digest is stored big-endian and zero-filled past the size of the
+ *  algorithm's digest, so two digests compare equal with memcmp.
+ */
+typedef struct
+{
+    uint8 Bytes[CS_MAX_DIGEST_SIZE]; /**< \brief Digest bytes, most significant first */
+} CS_Digest_t;
+
+/**
+ * \brief An unfinished checksum calculation
+ *
+ *  Holds whatever state the entry's algorithm needs to continue a checksum
+ *  that spans several cycles.
+ */
+typedef union
+{
+    uint32 Crc;   /**< \brief CRC-16, CRC-32 and CRC-32C, as returned by #CS_CalculateCRC */
+    uint64 Crc64; /**< \brief CRC-64 */
+
+    struct
+    {
+        uint32 Sum1;          /**< \brief Sum of the words, modulo 2^32 - 1 */
+        uint32 Sum2;          /**< \brief Sum of the running Sum1, modulo 2^32 - 1 */
+        uint8  Partial[4];    /**< \brief Bytes of a word not yet complete */
+        uint32 PartialLength; /**< \brief Number of bytes in Partial */
+    } Fletcher64; /**< \brief Fletcher-64 */
+
+    struct
+    {
+        uint32 State[8];   /**< \brief Intermediate hash value */
+        uint64 Length;     /**< \brief Total bytes hashed so far */
+        uint8  Block[64];  /**< \brief Bytes of the current block not yet compressed */
+    } Sha256; /**< \brief SHA-256 */
+} CS_ChecksumContext_t;
+
 /**
  * \brief Data structure for the EEPROM or Memory definition table
+ *
+ *  An entry with HasExpectedValue set starts out with ExpectedValue as its
+ *  baseline, so even the first pass checks it.  The values can be computed
+ *  on the host with the cs_expected_values build target.
  */
 typedef struct
 {
-    cpuaddr StartAddress;       /**< \brief The Start address to Checksum */
-    uint16  State;              /**< \brief Uses the CS_STATE_... defines from above */
-    uint16  Filler16;           /** <\brief Padding */
-    uint32  NumBytesToChecksum; /**< \brief The number of Bytes to Checksum */
+    cpuaddr     StartAddress;       /**< \brief The Start address to Checksum */
+    uint16      State;              /**< \brief Uses the CS_STATE_... defines from above */
+    uint16      Algorithm;          /**< \brief Uses the CS_ALGORITHM_... defines from above */
+    uint32      NumBytesToChecksum; /**< \brief The number of Bytes to Checksum */
+    uint16      BlockTree;          /**< \brief true to keep a tree of block CRCs for the entry */
+    uint16      Streaming;          /**< \brief true to read the entry with streaming hints */
+    uint16      HasExpectedValue;   /**< \brief true to check the entry against ExpectedValue from the first pass */
+    uint16      Filler16;           /**< \brief Padding */
+    CS_Digest_t ExpectedValue;      /**< \brief The checksum the entry must have, in the Algorithm's digest form */
 } CS_Def_EepromMemory_Table_Entry_t;
 
 /**
@@ -79,32 +151,55 @@ typedef struct
  */
 typedef struct
 {
-    cpuaddr StartAddress;       /**< \brief The Start address to Checksum */
-    uint16  State;              /**< \brief Uses the CS_STATE_... defines from above */
-    uint16  ComputedYet;        /**< \brief Have we computed an Integrity value yet */
-    uint32  NumBytesToChecksum; /**< \brief The number of Bytes to Checksum */
-    uint32  ComparisonValue;    /**< \brief The Memory Integrity Value */
-    uint32  ByteOffset;         /**< \brief Where a previous unfinished calc left off */
-    uint32  TempChecksumValue;  /**< \brief The unfinished caluculation */
-    uint32  Filler32;           /**< \brief Padding */
+    cpuaddr              StartAddress;        /**< \brief The Start address to Checksum */
+    uint16               State;               /**< \brief Uses the CS_STATE_... defines from above */
+    uint16               ComputedYet;         /**< \brief Have we computed an Integrity value yet */
+    uint32               NumBytesToChecksum;  /**< \brief The number of Bytes to Checksum */
+    uint32               ComparisonValue;     /**< \brief First four bytes of ComparisonDigest */
+    uint32               ByteOffset;          /**< \brief Where a previous unfinished calc left off */
+    uint32               LastCheckTime;       /**< \brief Milliseconds time of the last completed check, 0 for none */
+    uint32               DeadlineMisses;      /**< \brief Checks later than the table type's revisit period */
+    uint16               Algorithm;           /**< \brief Uses the CS_ALGORITHM_... defines from above */
+    uint16               BlockTree;           /**< \brief Block tree number counting from 1, or 0 for none */
+    uint16               Streaming;           /**< \brief true to read the entry with streaming hints */
+    uint16               Filler16;            /**< \brief Padding */
+    CS_Digest_t          ComparisonDigest;    /**< \brief The Memory Integrity Value */
+    CS_ChecksumContext_t TempChecksumContext; /**< \brief The unfinished calculation, started over at ByteOffset 0 */
 } CS_Res_EepromMemory_Table_Entry_t;
 
 /**
  * \brief Data structure for the Tables definition table
+ *
+ *  HasExpectedValue works as for #CS_Def_EepromMemory_Table_Entry_t until
+ *  the table is next loaded.  A table updated more often than it can be
+ *  checksummed in place should set Snapshot, so the background copies it
+ *  all at once into a #CS_TABLE_SNAPSHOT_SIZE byte buffer and checksums
+ *  the copy.
  */
 typedef struct
 {
-    uint16 State;                           /**< \brief Uses the CS_STATE_... defines from above */
-    char   Name[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \brief name of the table */
+    uint16      State;                           /**< \brief Uses the CS_STATE_... defines from above */
+    uint16      Algorithm;                       /**< \brief Uses the CS_ALGORITHM_... defines from above */
+    uint16      HasExpectedValue;                /**< \brief true to check against ExpectedValue from the start */
+    uint16      Snapshot;                        /**< \brief true to checksum a copy of the table */
+    char        Name[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \brief name of the table */
+    CS_Digest_t ExpectedValue;                   /**< \brief The checksum the table must have */
 } CS_Def_Tables_Table_Entry_t;
 
 /**
  * \brief Data structure for the App definition table
+ *
+ *  HasExpectedValue works as for #CS_Def_EepromMemory_Table_Entry_t until
+ *  the app is next reloaded.
  */
 typedef struct
 {
-    uint16 State;                 /**< \brief Uses the CS_STATE_... defines from above */
-    char   Name[OS_MAX_API_NAME]; /**< \brief name of the app */
+    uint16      State;                 /**< \brief Uses the CS_STATE_... defines from above */
+    uint16      Algorithm;             /**< \brief Uses the CS_ALGORITHM_... defines from above */
+    uint16      HasExpectedValue;      /**< \brief true to check the app against ExpectedValue from the first pass */
+    uint16      Filler16;              /**< \brief Padding */
+    char        Name[OS_MAX_API_NAME]; /**< \brief name of the app */
+    CS_Digest_t ExpectedValue;         /**< \brief The checksum the app's code must have */
 } CS_Def_App_Table_Entry_t;
 
 /**
@@ -112,17 +207,23 @@ typedef struct
  */
 typedef struct
 {
-    cpuaddr          StartAddress;                    /**< \brief The Start address to Checksum */
-    uint16           State;                           /**< \brief Uses the CS_STATE_... defines from above */
-    uint16           ComputedYet;                     /**< \brief Have we computed an Integrity value yet */
-    uint32           NumBytesToChecksum;              /**< \brief The number of Bytes to Checksum */
-    uint32           ComparisonValue;                 /**< \brief The Memory Integrity Value */
-    uint32           ByteOffset;                      /**< \brief Where a previous unfinished calc left off */
-    uint32           TempChecksumValue;               /**< \brief The unfinished caluculation */
-    CFE_TBL_Handle_t TblHandle;                       /**< \brief handle recieved from CFE_TBL */
-    bool             IsCSOwner;                       /**< \brief Is CS the original owner of this table */
-    bool             Filler8;                         /**< \brief Padding */
-    char             Name[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \brief name of the table */
+    cpuaddr              StartAddress;        /**< \brief The Start address to Checksum */
+    uint16               State;               /**< \brief Uses the CS_STATE_... defines from above */
+    uint16               ComputedYet;         /**< \brief Have we computed an Integrity value yet */
+    uint32               NumBytesToChecksum;  /**< \brief The number of Bytes to Checksum */
+    uint32               ComparisonValue;     /**< \brief First four bytes of ComparisonDigest */
+    uint32               ByteOffset;          /**< \brief Where a previous unfinished calc left off */
+    uint32               LastCheckTime;       /**< \brief Milliseconds time of the last completed check, 0 for none */
+    uint32               DeadlineMisses;      /**< \brief Checks later than the table type's revisit period */
+    uint16               Algorithm;           /**< \brief Uses the CS_ALGORITHM_... defines from above */
+    CFE_TBL_Handle_t     TblHandle;           /**< \brief handle recieved from CFE_TBL */
+    bool                 IsCSOwner;           /**< \brief Is CS the original owner of this table */
+    bool                 InfoCached;          /**< \brief NumBytesToChecksum is the size of the loaded table */
+    bool                 Snapshot;            /**< \brief Checksum a copy of the table */
+    bool                 SnapshotStale;       /**< \brief The table was updated after its copy was taken */
+    CS_Digest_t          ComparisonDigest;    /**< \brief The Memory Integrity Value */
+    CS_ChecksumContext_t TempChecksumContext; /**< \brief The unfinished calculation, started over at ByteOffset 0 */
+    char                 Name[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \brief name of the table */
 } CS_Res_Tables_Table_Entry_t;
 
 /**
@@ -130,16 +231,58 @@ typedef struct
  */
 typedef struct
 {
-    cpuaddr StartAddress;          /**< \brief The Start address to Checksum */
-    uint16  State;                 /**< \brief Uses the CS_STATE_... defines from above */
-    uint16  ComputedYet;           /**< \brief Have we computed an Integrity value yet */
-    uint32  NumBytesToChecksum;    /**< \brief The number of Bytes to Checksum */
-    uint32  ComparisonValue;       /**< \brief The Memory Integrity Value */
-    uint32  ByteOffset;            /**< \brief Where a previous unfinished calc left off */
-    uint32  TempChecksumValue;     /**< \brief The unfinished caluculation */
-    char    Name[OS_MAX_API_NAME]; /**< \brief name of the app */
+    cpuaddr              StartAddress;          /**< \brief The Start address to Checksum */
+    uint16               State;                 /**< \brief Uses the CS_STATE_... defines from above */
+    uint16               ComputedYet;           /**< \brief Have we computed an Integrity value yet */
+    uint32               NumBytesToChecksum;    /**< \brief The number of Bytes to Checksum */
+    uint32               ComparisonValue;       /**< \brief First four bytes of ComparisonDigest */
+    uint32               ByteOffset;            /**< \brief Where a previous unfinished calc left off */
+    uint32               LastCheckTime;         /**< \brief Milliseconds time of the last completed check, 0 for none */
+    uint32               DeadlineMisses;        /**< \brief Checks later than the table type's revisit period */
+    uint16               Algorithm;             /**< \brief Uses the CS_ALGORITHM_... defines from above */
+    uint16               Filler16;              /**< \brief Padding */
+    CFE_ResourceId_t     ResourceID;            /**< \brief Module that StartAddress and NumBytesToChecksum are for */
+    CS_Digest_t          ComparisonDigest;      /**< \brief The Memory Integrity Value */
+    CS_ChecksumContext_t TempChecksumContext;   /**< \brief The unfinished calculation, started over at ByteOffset 0 */
+    char                 Name[OS_MAX_API_NAME]; /**< \brief name of the app */
 } CS_Res_App_Table_Entry_t;
 
+/**
+ * \brief Block CRC tree of an EEPROM or Memory entry
+ *
+ *  The tree's nodes start at FirstNode in the block results table.  The
+ *  first NumLeaves nodes are the leaves computed by the last pass.  The
+ *  baseline tree follows, one level after another from the leaves up to
+ *  the root.  Each leaf is the CRC of CS_BLOCK_TREE_LEAF_SIZE bytes of the
+ *  entry, and each higher node is the CRC of its one or two children as
+ *  stored in the table.
+ */
+typedef struct
+{
+    uint16 State;           /**< \brief #CS_STATE_EMPTY when the tree is unused */
+    uint16 Table;           /**< \brief #CS_EEPROM_TABLE or #CS_MEMORY_TABLE */
+    uint16 EntryID;         /**< \brief Entry in the table that owns the tree */
+    uint16 ComputedYet;     /**< \brief Have we computed the baseline tree yet */
+    uint16 CurrentValid;    /**< \brief Are the leaves of the last pass complete */
+    uint16 TypeCRC;         /**< \brief CRC type of every node */
+    uint32 NumLeaves;       /**< \brief Number of leaf blocks in the entry */
+    uint32 NumNodes;        /**< \brief Number of nodes, including the leaves of the last pass */
+    uint32 FirstNode;       /**< \brief Index of the tree's first node in the block results table */
+    uint32 ByteOffset;      /**< \brief Where the leaves of the current pass left off */
+    uint32 LeafCrc;         /**< \brief CRC of the unfinished leaf */
+    uint32 FailedLeaves;    /**< \brief Number of leaves that miscompared in the current pass */
+    uint32 FirstFailedLeaf; /**< \brief First leaf that miscompared in the current pass */
+} CS_Res_BlockTree_t;
+
+/**
+ * \brief Data structure for the block results table
+ */
+typedef struct
+{
+    CS_Res_BlockTree_t Trees[CS_MAX_NUM_BLOCK_TREES]; /**< \brief The block trees */
+    uint32             Nodes[CS_MAX_NUM_BLOCK_NODES]; /**< \brief Nodes of all of the block trees */
+} CS_Res_Block_Table_t;
+
 /**************************************************************************
  **
  **  Function Prototypes
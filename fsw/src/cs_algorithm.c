@@ -0,0 +1,677 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   The CFS Checksum (CS) Application's checksum algorithm registry
+ */
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+#include "cs_app.h"
+#include <string.h>
+#include "cs_crc.h"
+#include "cs_algorithm.h"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#if defined(POSIX_MADV_SEQUENTIAL)
+#define CS_STREAM_ADVICE
+#endif
+#endif
+
+/**************************************************************************
+ **
+ ** Local types and data
+ **
+ **************************************************************************/
+
+/* Fletcher-64 sums are kept modulo 2^32 - 1 */
+#define CS_FLETCHER64_MODULUS 0xFFFFFFFFULL
+
+/*
+ * Words added before the 64-bit running sums are folded back below 2^32.
+ * With both sums starting below 2^32, Sum2 stays below 2^32 * (1 + n(n+3)/2),
+ * which is under 2^60 for this many words.
+ */
+#define CS_FLETCHER64_BLOCK_WORDS 16384
+
+/* A prefetch for reading that is not expected to be reused (prefetchnta on x86, pldl1strm on ARMv8) */
+#if defined(__GNUC__)
+#define CS_STREAM_PREFETCH(Addr) __builtin_prefetch((Addr), 0, 0)
+#else
+#define CS_STREAM_PREFETCH(Addr) ((void)(Addr))
+#endif
+
+/* SHA-256 round constants (FIPS 180-4 section 4.2.2) */
+static const uint32 CS_Sha256K[64] = {
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2};
+
+/* SHA-256 initial hash value (FIPS 180-4 section 5.3.3) */
+static const uint32 CS_Sha256H0[8] = {0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A,
+                                      0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19};
+
+#define CS_SHA256_ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+/**************************************************************************
+ **
+ ** Digest helpers
+ **
+ **************************************************************************/
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS store a value big-endian at the start of a digest            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_DigestPut(CS_Digest_t *Digest, uint32 Offset, uint64 Value, uint32 Size)
+{
+    uint32 i = 0;
+
+    for (i = 0; i < Size; i++)
+    {
+        Digest->Bytes[Offset + i] = (uint8)(Value >> (8 * (Size - 1 - i)));
+    }
+}
+
+/**************************************************************************
+ **
+ ** CRC-16, CRC-32 and CRC-32C
+ **
+ **************************************************************************/
+
+static void CS_CrcAlgorithmInit(const CS_Algorithm_t *Algorithm, CS_ChecksumContext_t *Context)
+{
+    (void)Algorithm;
+
+    Context->Crc = 0;
+}
+
+static void CS_CrcAlgorithmUpdate(const CS_Algorithm_t *Algorithm, CS_ChecksumContext_t *Context,
+                                  const void *DataPtr, size_t DataLength)
+{
+    Context->Crc = CS_CalculateCRC(DataPtr, DataLength, Context->Crc, Algorithm->TypeCRC);
+}
+
+static void CS_CrcAlgorithmFinal(const CS_Algorithm_t *Algorithm, const CS_ChecksumContext_t *Context,
+                                 CS_Digest_t *Digest)
+{
+    (void)Algorithm;
+
+    CS_DigestPut(Digest, 0, Context->Crc, 4);
+}
+
+static void CS_CrcAlgorithmCombine(const CS_Algorithm_t *Algorithm, CS_ChecksumContext_t *ContextA,
+                                   const CS_ChecksumContext_t *ContextB, size_t LengthB)
+{
+    ContextA->Crc = CS_CrcCombine(ContextA->Crc, ContextB->Crc, LengthB, Algorithm->TypeCRC);
+}
+
+/**************************************************************************
+ **
+ ** CRC-64
+ **
+ **************************************************************************/
+
+static void CS_Crc64AlgorithmInit(const CS_Algorithm_t *Algorithm, CS_ChecksumContext_t *Context)
+{
+    (void)Algorithm;
+
+    Context->Crc64 = 0;
+}
+
+static void CS_Crc64AlgorithmUpdate(const CS_Algorithm_t *Algorithm, CS_ChecksumContext_t *Context,
+                                    const void *DataPtr, size_t DataLength)
+{
+    (void)Algorithm;
+
+    Context->Crc64 = CS_CalculateCRC64(DataPtr, DataLength, Context->Crc64);
+}
+
+static void CS_Crc64AlgorithmFinal(const CS_Algorithm_t *Algorithm, const CS_ChecksumContext_t *Context,
+                                   CS_Digest_t *Digest)
+{
+    (void)Algorithm;
+
+    CS_DigestPut(Digest, 0, Context->Crc64, 8);
+}
+
+static void CS_Crc64AlgorithmCombine(const CS_Algorithm_t *Algorithm, CS_ChecksumContext_t *ContextA,
+                                     const CS_ChecksumContext_t *ContextB, size_t LengthB)
+{
+    (void)Algorithm;
+
+    ContextA->Crc64 = CS_Crc64Combine(ContextA->Crc64, ContextB->Crc64, LengthB);
+}
+
+/**************************************************************************
+ **
+ ** Fletcher-64
+ **
+ ** The data is taken as little-endian 32-bit words so that the result
+ ** does not depend on the processor.  A trailing partial word is padded
+ ** with zeros.
+ **
+ **************************************************************************/
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS fold a 64-bit sum below 2^32, keeping it modulo 2^32 - 1     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CS_Fletcher64Fold(uint64 Sum)
+{
+    Sum = (Sum & 0xFFFFFFFF) + (Sum >> 32);
+    Sum = (Sum & 0xFFFFFFFF) + (Sum >> 32);
+
+    return (uint32)Sum;
+}
+
+static void CS_Fletcher64Init(const CS_Algorithm_t *Algorithm, CS_ChecksumContext_t *Context)
+{
+    (void)Algorithm;
+
+    memset(&Context->Fletcher64, 0, sizeof(Context->Fletcher64));
+}
+
+static void CS_Fletcher64Update(const CS_Algorithm_t *Algorithm, CS_ChecksumContext_t *Context, const void *DataPtr,
+                                size_t DataLength)
+{
+    const uint8 *BufPtr    = DataPtr;
+    uint64       Sum1      = Context->Fletcher64.Sum1;
+    uint64       Sum2      = Context->Fletcher64.Sum2;
+    uint32       Word      = 0;
+    uint32       NumWords  = 0;
+    uint32       BlockLeft = CS_FLETCHER64_BLOCK_WORDS;
+
+    (void)Algorithm;
+
+    /* Finish a word left over from the previous call */
+    while ((Context->Fletcher64.PartialLength > 0) && (DataLength > 0))
+    {
+        Context->Fletcher64.Partial[Context->Fletcher64.PartialLength++] = *BufPtr++;
+        DataLength--;
+
+        if (Context->Fletcher64.PartialLength == 4)
+        {
+            Word = (uint32)Context->Fletcher64.Partial[0] | ((uint32)Context->Fletcher64.Partial[1] << 8) |
+                   ((uint32)Context->Fletcher64.Partial[2] << 16) | ((uint32)Context->Fletcher64.Partial[3] << 24);
+            Sum1 += Word;
+            Sum2 += Sum1;
+
+            Context->Fletcher64.PartialLength = 0;
+        }
+    }
+
+    for (NumWords = DataLength / 4; NumWords > 0; NumWords--)
+    {
+        Word = (uint32)BufPtr[0] | ((uint32)BufPtr[1] << 8) | ((uint32)BufPtr[2] << 16) | ((uint32)BufPtr[3] << 24);
+        Sum1 += Word;
+        Sum2 += Sum1;
+        BufPtr += 4;
+
+        if (--BlockLeft == 0)
+        {
+            Sum1      = CS_Fletcher64Fold(Sum1);
+            Sum2      = CS_Fletcher64Fold(Sum2);
+            BlockLeft = CS_FLETCHER64_BLOCK_WORDS;
+        }
+    }
+
+    for (DataLength %= 4; DataLength > 0; DataLength--)
+    {
+        Context->Fletcher64.Partial[Context->Fletcher64.PartialLength++] = *BufPtr++;
+    }
+
+    Context->Fletcher64.Sum1 = CS_Fletcher64Fold(Sum1);
+    Context->Fletcher64.Sum2 = CS_Fletcher64Fold(Sum2);
+}
+
+static void CS_Fletcher64Final(const CS_Algorithm_t *Algorithm, const CS_ChecksumContext_t *Context,
+                               CS_Digest_t *Digest)
+{
+    uint64 Sum1 = Context->Fletcher64.Sum1;
+    uint64 Sum2 = Context->Fletcher64.Sum2;
+    uint32 Word = 0;
+    uint32 i    = 0;
+
+    (void)Algorithm;
+
+    if (Context->Fletcher64.PartialLength > 0)
+    {
+        for (i = 0; i < Context->Fletcher64.PartialLength; i++)
+        {
+            Word |= (uint32)Context->Fletcher64.Partial[i] << (8 * i);
+        }
+
+        Sum1 = CS_Fletcher64Fold(Sum1 + Word);
+        Sum2 = CS_Fletcher64Fold(Sum2 + Sum1);
+    }
+
+    /* 2^32 - 1 and 0 are the same value modulo 2^32 - 1 */
+    Sum1 %= CS_FLETCHER64_MODULUS;
+    Sum2 %= CS_FLETCHER64_MODULUS;
+
+    CS_DigestPut(Digest, 0, (Sum2 << 32) | Sum1, 8);
+}
+
+static void CS_Fletcher64Combine(const CS_Algorithm_t *Algorithm, CS_ChecksumContext_t *ContextA,
+                                 const CS_ChecksumContext_t *ContextB, size_t LengthB)
+{
+    uint64 WordsB = ((uint64)LengthB / 4) % CS_FLETCHER64_MODULUS;
+    uint64 Sum1A  = ContextA->Fletcher64.Sum1 % CS_FLETCHER64_MODULUS;
+    uint64 Sum2   = 0;
+
+    (void)Algorithm;
+
+    /* Every word of B adds all of A's words to Sum2 once more */
+    Sum2 = ((WordsB * Sum1A) % CS_FLETCHER64_MODULUS) + ContextA->Fletcher64.Sum2 + ContextB->Fletcher64.Sum2;
+
+    ContextA->Fletcher64.Sum1 = CS_Fletcher64Fold((uint64)ContextA->Fletcher64.Sum1 + ContextB->Fletcher64.Sum1);
+    ContextA->Fletcher64.Sum2 = CS_Fletcher64Fold(Sum2);
+
+    memcpy(ContextA->Fletcher64.Partial, ContextB->Fletcher64.Partial, sizeof(ContextA->Fletcher64.Partial));
+    ContextA->Fletcher64.PartialLength = ContextB->Fletcher64.PartialLength;
+}
+
+static bool CS_Fletcher64CanCombine(const CS_ChecksumContext_t *ContextA)
+{
+    /* B's words would straddle A's unfinished word */
+    return (ContextA->Fletcher64.PartialLength == 0);
+}
+
+/**************************************************************************
+ **
+ ** SHA-256
+ **
+ **************************************************************************/
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS SHA-256 compression of one 64-byte block                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_Sha256Transform(uint32 State[8], const uint8 *Block)
+{
+    uint32 W[64];
+    uint32 a, b, c, d, e, f, g, h;
+    uint32 T1 = 0;
+    uint32 T2 = 0;
+    uint32 t  = 0;
+
+    for (t = 0; t < 16; t++)
+    {
+        W[t] = ((uint32)Block[4 * t] << 24) | ((uint32)Block[4 * t + 1] << 16) | ((uint32)Block[4 * t + 2] << 8) |
+               (uint32)Block[4 * t + 3];
+    }
+
+    for (t = 16; t < 64; t++)
+    {
+        W[t] = (CS_SHA256_ROTR(W[t - 2], 17) ^ CS_SHA256_ROTR(W[t - 2], 19) ^ (W[t - 2] >> 10)) + W[t - 7] +
+               (CS_SHA256_ROTR(W[t - 15], 7) ^ CS_SHA256_ROTR(W[t - 15], 18) ^ (W[t - 15] >> 3)) + W[t - 16];
+    }
+
+    a = State[0];
+    b = State[1];
+    c = State[2];
+    d = State[3];
+    e = State[4];
+    f = State[5];
+    g = State[6];
+    h = State[7];
+
+    for (t = 0; t < 64; t++)
+    {
+        T1 = h + (CS_SHA256_ROTR(e, 6) ^ CS_SHA256_ROTR(e, 11) ^ CS_SHA256_ROTR(e, 25)) + ((e & f) ^ (~e & g)) +
+             CS_Sha256K[t] + W[t];
+        T2 = (CS_SHA256_ROTR(a, 2) ^ CS_SHA256_ROTR(a, 13) ^ CS_SHA256_ROTR(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h  = g;
+        g  = f;
+        f  = e;
+        e  = d + T1;
+        d  = c;
+        c  = b;
+        b  = a;
+        a  = T1 + T2;
+    }
+
+    State[0] += a;
+    State[1] += b;
+    State[2] += c;
+    State[3] += d;
+    State[4] += e;
+    State[5] += f;
+    State[6] += g;
+    State[7] += h;
+}
+
+static void CS_Sha256Init(const CS_Algorithm_t *Algorithm, CS_ChecksumContext_t *Context)
+{
+    (void)Algorithm;
+
+    memcpy(Context->Sha256.State, CS_Sha256H0, sizeof(Context->Sha256.State));
+    Context->Sha256.Length = 0;
+}
+
+static void CS_Sha256Update(const CS_Algorithm_t *Algorithm, CS_ChecksumContext_t *Context, const void *DataPtr,
+                            size_t DataLength)
+{
+    const uint8 *BufPtr   = DataPtr;
+    uint32       Buffered = (uint32)(Context->Sha256.Length % 64);
+    size_t       Copy     = 0;
+
+    (void)Algorithm;
+
+    Context->Sha256.Length += DataLength;
+
+    /* Top up a block left over from the previous call */
+    if (Buffered > 0)
+    {
+        Copy = ((DataLength < (64 - Buffered)) ? DataLength : (64 - Buffered));
+        memcpy(&Context->Sha256.Block[Buffered], BufPtr, Copy);
+        BufPtr += Copy;
+        DataLength -= Copy;
+
+        if (Buffered + Copy == 64)
+        {
+            CS_Sha256Transform(Context->Sha256.State, Context->Sha256.Block);
+        }
+    }
+
+    /* Whole blocks are compressed straight from the data */
+    while (DataLength >= 64)
+    {
+        CS_Sha256Transform(Context->Sha256.State, BufPtr);
+        BufPtr += 64;
+        DataLength -= 64;
+    }
+
+    memcpy(Context->Sha256.Block, BufPtr, DataLength);
+}
+
+static void CS_Sha256Final(const CS_Algorithm_t *Algorithm, const CS_ChecksumContext_t *Context, CS_Digest_t *Digest)
+{
+    uint32 State[8];
+    uint8  Block[64];
+    uint32 Buffered = (uint32)(Context->Sha256.Length % 64);
+    uint32 i        = 0;
+
+    (void)Algorithm;
+
+    memcpy(State, Context->Sha256.State, sizeof(State));
+    memcpy(Block, Context->Sha256.Block, Buffered);
+
+    /* Pad with a 1 bit, zeros, and the message length in bits */
+    Block[Buffered++] = 0x80;
+
+    if (Buffered > 56)
+    {
+        memset(&Block[Buffered], 0, 64 - Buffered);
+        CS_Sha256Transform(State, Block);
+        Buffered = 0;
+    }
+
+    memset(&Block[Buffered], 0, 56 - Buffered);
+
+    for (i = 0; i < 8; i++)
+    {
+        Block[56 + i] = (uint8)((Context->Sha256.Length * 8) >> (56 - (8 * i)));
+    }
+
+    CS_Sha256Transform(State, Block);
+
+    for (i = 0; i < 8; i++)
+    {
+        CS_DigestPut(Digest, 4 * i, State[i], 4);
+    }
+}
+
+/* Indexed by the CS_ALGORITHM_... identifiers */
+static const CS_Algorithm_t CS_AlgorithmTable[CS_NUM_ALGORITHMS] = {
+    {4, CS_DEFAULT_ALGORITHM, CS_CrcAlgorithmInit, CS_CrcAlgorithmUpdate, CS_CrcAlgorithmFinal,
+     CS_CrcAlgorithmCombine, NULL},
+    {4, CFE_ES_CrcType_CRC_16, CS_CrcAlgorithmInit, CS_CrcAlgorithmUpdate, CS_CrcAlgorithmFinal,
+     CS_CrcAlgorithmCombine, NULL},
+    {4, CFE_ES_CrcType_CRC_32, CS_CrcAlgorithmInit, CS_CrcAlgorithmUpdate, CS_CrcAlgorithmFinal,
+     CS_CrcAlgorithmCombine, NULL},
+    {4, CS_CRC_TYPE_CRC_32C, CS_CrcAlgorithmInit, CS_CrcAlgorithmUpdate, CS_CrcAlgorithmFinal,
+     CS_CrcAlgorithmCombine, NULL},
+    {8, CFE_ES_CrcType_NONE, CS_Crc64AlgorithmInit, CS_Crc64AlgorithmUpdate, CS_Crc64AlgorithmFinal,
+     CS_Crc64AlgorithmCombine, NULL},
+    {8, CFE_ES_CrcType_NONE, CS_Fletcher64Init, CS_Fletcher64Update, CS_Fletcher64Final, CS_Fletcher64Combine,
+     CS_Fletcher64CanCombine},
+    {32, CFE_ES_CrcType_NONE, CS_Sha256Init, CS_Sha256Update, CS_Sha256Final, NULL, NULL},
+};
+
+/**************************************************************************
+ **
+ ** Functions
+ **
+ **************************************************************************/
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS look up a checksum algorithm                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+const CS_Algorithm_t *CS_GetAlgorithm(uint16 AlgorithmId)
+{
+    if (AlgorithmId >= CS_NUM_ALGORITHMS)
+    {
+        AlgorithmId = CS_ALGORITHM_DEFAULT;
+    }
+
+    return &CS_AlgorithmTable[AlgorithmId];
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS start a new checksum                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_ChecksumInit(uint16 AlgorithmId, CS_ChecksumContext_t *Context)
+{
+    const CS_Algorithm_t *Algorithm = CS_GetAlgorithm(AlgorithmId);
+
+    Algorithm->Init(Algorithm, Context);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS add a block of memory to a checksum                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_ChecksumUpdate(uint16 AlgorithmId, CS_ChecksumContext_t *Context, const void *DataPtr, size_t DataLength)
+{
+    const CS_Algorithm_t *Algorithm = CS_GetAlgorithm(AlgorithmId);
+
+    Algorithm->Update(Algorithm, Context, DataPtr, DataLength);
+}
+
+#if defined(CS_STREAM_ADVICE)
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS advise the kernel how a region is going to be read           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_StreamAdvise(const void *DataPtr, size_t DataLength, int Advice)
+{
+    long    PageSize = sysconf(_SC_PAGESIZE);
+    cpuaddr Start    = 0;
+    cpuaddr End      = 0;
+
+    if (PageSize > 0)
+    {
+        Start = (cpuaddr)DataPtr & ~((cpuaddr)PageSize - 1);
+        End   = (cpuaddr)DataPtr + DataLength;
+
+        if (Advice == POSIX_MADV_DONTNEED)
+        {
+            /* Pages shared with the memory either side of the region may still be needed */
+            Start = ((cpuaddr)DataPtr + PageSize - 1) & ~((cpuaddr)PageSize - 1);
+            End &= ~((cpuaddr)PageSize - 1);
+        }
+
+        /* The advice is only a hint, so memory it does not apply to is not an error */
+        if (End > Start)
+        {
+            (void)posix_madvise((void *)Start, End - Start, Advice);
+        }
+    }
+}
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS add a block of memory to a checksum, reading it as a stream  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_ChecksumUpdateStreaming(uint16 AlgorithmId, CS_ChecksumContext_t *Context, const void *DataPtr,
+                                size_t DataLength)
+{
+    const CS_Algorithm_t *Algorithm = CS_GetAlgorithm(AlgorithmId);
+    const uint8          *BufPtr    = DataPtr;
+    size_t                Offset    = 0;
+    size_t                Block     = 0;
+    size_t                Line      = 0;
+    size_t                Ahead     = 0;
+
+#if defined(CS_STREAM_ADVICE)
+    CS_StreamAdvise(DataPtr, DataLength, POSIX_MADV_SEQUENTIAL);
+#endif
+
+    /* Fetching starts at the cache line holding the first byte */
+    for (Line = 0; Line < DataLength && Line < CS_STREAM_BLOCK_SIZE; Line += CS_CACHE_LINE_SIZE)
+    {
+        CS_STREAM_PREFETCH(BufPtr + Line);
+    }
+
+    do
+    {
+        Block = (((DataLength - Offset) < CS_STREAM_BLOCK_SIZE) ? (DataLength - Offset) : CS_STREAM_BLOCK_SIZE);
+
+        /* The next block is on its way while this one is checksummed */
+        Ahead = Offset + CS_STREAM_BLOCK_SIZE;
+        for (Line = Ahead; Line < DataLength && Line < Ahead + CS_STREAM_BLOCK_SIZE; Line += CS_CACHE_LINE_SIZE)
+        {
+            CS_STREAM_PREFETCH(BufPtr + Line);
+        }
+
+        Algorithm->Update(Algorithm, Context, BufPtr + Offset, Block);
+
+        Offset += Block;
+    } while (Offset < DataLength);
+
+#if defined(CS_STREAM_ADVICE)
+    CS_StreamAdvise(DataPtr, DataLength, POSIX_MADV_DONTNEED);
+#endif
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS finish a checksum                                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 CS_ChecksumFinal(uint16 AlgorithmId, const CS_ChecksumContext_t *Context, CS_Digest_t *Digest)
+{
+    const CS_Algorithm_t *Algorithm = CS_GetAlgorithm(AlgorithmId);
+
+    memset(Digest, 0, sizeof(*Digest));
+    Algorithm->Final(Algorithm, Context, Digest);
+
+    return CS_DigestSummary(Digest);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS digest of a CRC computed outside of CS                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_ChecksumFromCrc(uint16 AlgorithmId, CFE_ES_CrcType_Enum_t TypeCRC, uint32 Crc, CS_Digest_t *Digest)
+{
+    const CS_Algorithm_t *Algorithm = CS_GetAlgorithm(AlgorithmId);
+    bool                  Matches   = false;
+
+    if (Algorithm->Final == CS_CrcAlgorithmFinal && Algorithm->TypeCRC == TypeCRC)
+    {
+        Matches = true;
+
+        memset(Digest, 0, sizeof(*Digest));
+        CS_DigestPut(Digest, 0, Crc, 4);
+    }
+
+    return Matches;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS 32-bit summary of a digest                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 CS_DigestSummary(const CS_Digest_t *Digest)
+{
+    return ((uint32)Digest->Bytes[0] << 24) | ((uint32)Digest->Bytes[1] << 16) | ((uint32)Digest->Bytes[2] << 8) |
+           (uint32)Digest->Bytes[3];
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS whether a checksum can be continued by combining             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_ChecksumCanCombine(uint16 AlgorithmId, const CS_ChecksumContext_t *ContextA)
+{
+    const CS_Algorithm_t *Algorithm = CS_GetAlgorithm(AlgorithmId);
+    bool                  CanCombine = (Algorithm->Combine != NULL);
+
+    if (CanCombine && Algorithm->CanCombine != NULL)
+    {
+        CanCombine = Algorithm->CanCombine(ContextA);
+    }
+
+    return CanCombine;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS combine the checksums of two adjacent ranges                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_ChecksumCombine(uint16 AlgorithmId, CS_ChecksumContext_t *ContextA, const CS_ChecksumContext_t *ContextB,
+                        size_t LengthB)
+{
+    const CS_Algorithm_t *Algorithm = CS_GetAlgorithm(AlgorithmId);
+
+    if (Algorithm->Combine != NULL)
+    {
+        Algorithm->Combine(Algorithm, ContextA, ContextB, LengthB);
+    }
+}
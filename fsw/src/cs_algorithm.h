@@ -0,0 +1,247 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Checksum algorithm registry for the CFS Checksum (CS) Application
+ */
+#ifndef CS_ALGORITHM_H
+#define CS_ALGORITHM_H
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+#include "cs_tbldefs.h"
+
+/**************************************************************************
+ **
+ ** Type definitions
+ **
+ **************************************************************************/
+
+typedef struct CS_Algorithm CS_Algorithm_t;
+
+/**
+ * \brief Starts a new checksum in Context
+ */
+typedef void (*CS_AlgorithmInit_t)(const CS_Algorithm_t *Algorithm, CS_ChecksumContext_t *Context);
+
+/**
+ * \brief Adds DataLength bytes at DataPtr to the checksum in Context
+ */
+typedef void (*CS_AlgorithmUpdate_t)(const CS_Algorithm_t *Algorithm, CS_ChecksumContext_t *Context,
+                                     const void *DataPtr, size_t DataLength);
+
+/**
+ * \brief Writes the finished checksum in Context to Digest without changing Context
+ */
+typedef void (*CS_AlgorithmFinal_t)(const CS_Algorithm_t *Algorithm, const CS_ChecksumContext_t *Context,
+                                    CS_Digest_t *Digest);
+
+/**
+ * \brief Appends the checksum of a range B, started with Init, to the checksum in ContextA
+ */
+typedef void (*CS_AlgorithmCombine_t)(const CS_Algorithm_t *Algorithm, CS_ChecksumContext_t *ContextA,
+                                      const CS_ChecksumContext_t *ContextB, size_t LengthB);
+
+/**
+ * \brief Returns true when ContextA is at a point where Combine may be used
+ */
+typedef bool (*CS_AlgorithmCanCombine_t)(const CS_ChecksumContext_t *ContextA);
+
+/**
+ *  \brief CS checksum algorithm
+ *
+ *  One entry of the algorithm registry.  Combine is NULL for algorithms
+ *  whose checksums cannot be merged, and CanCombine is NULL when any
+ *  context can be combined.
+ */
+struct CS_Algorithm
+{
+    uint32                   DigestSize; /**< \brief Bytes of CS_Digest_t used by the algorithm */
+    CFE_ES_CrcType_Enum_t    TypeCRC;    /**< \brief CRC type for the algorithms built on #CS_CalculateCRC */
+    CS_AlgorithmInit_t       Init;       /**< \brief Starts a checksum */
+    CS_AlgorithmUpdate_t     Update;     /**< \brief Continues a checksum */
+    CS_AlgorithmFinal_t      Final;      /**< \brief Finishes a checksum */
+    CS_AlgorithmCombine_t    Combine;    /**< \brief Merges the checksums of adjacent ranges, or NULL */
+    CS_AlgorithmCanCombine_t CanCombine; /**< \brief Restricts when Combine may be used, or NULL */
+};
+
+/**************************************************************************
+ **
+ ** Function prototypes
+ **
+ **************************************************************************/
+
+/**
+ * \brief Looks up a checksum algorithm
+ *
+ *  \par Description
+ *       Returns the registry entry for one of the CS_ALGORITHM_...
+ *       identifiers.  #CS_ALGORITHM_DEFAULT uses #CS_DEFAULT_ALGORITHM.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Unknown identifiers are treated as #CS_ALGORITHM_DEFAULT.  The
+ *       definition table validation rejects them, so they can only come
+ *       from a corrupted results table.
+ *
+ *  \param [in] AlgorithmId  One of the CS_ALGORITHM_... identifiers
+ *
+ * \return Pointer to the registry entry, never NULL
+ */
+const CS_Algorithm_t *CS_GetAlgorithm(uint16 AlgorithmId);
+
+/**
+ * \brief Starts a new checksum
+ *
+ *  \param [in]  AlgorithmId  One of the CS_ALGORITHM_... identifiers
+ *  \param [out] Context      Context to initialize
+ */
+void CS_ChecksumInit(uint16 AlgorithmId, CS_ChecksumContext_t *Context);
+
+/**
+ * \brief Adds a block of memory to a checksum
+ *
+ *  \par Description
+ *       A checksum may be computed across any number of calls; the result
+ *       is the same as one call over all of the data.
+ *
+ *  \param [in]     AlgorithmId  Algorithm the context was started with
+ *  \param [in,out] Context      Context started by #CS_ChecksumInit
+ *  \param [in]     DataPtr      Pointer to the start of the memory
+ *  \param [in]     DataLength   Number of bytes to add
+ */
+void CS_ChecksumUpdate(uint16 AlgorithmId, CS_ChecksumContext_t *Context, const void *DataPtr, size_t DataLength);
+
+/**
+ * \brief Adds a block of memory to a checksum without filling the caches
+ *
+ *  \par Description
+ *       Gives the same result as #CS_ChecksumUpdate, but checksums the
+ *       memory #CS_STREAM_BLOCK_SIZE bytes at a time, prefetching each
+ *       block with a non-temporal hint while the block before it is
+ *       checksummed.  On Linux the memory is advised as read sequentially
+ *       before, and as not needed again after.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Prefetch and advice are hints only: without compiler support the
+ *       prefetches are left out, and advice the kernel rejects is ignored.
+ *
+ *  \param [in]     AlgorithmId  Algorithm the context was started with
+ *  \param [in,out] Context      Context started by #CS_ChecksumInit
+ *  \param [in]     DataPtr      Pointer to the start of the memory
+ *  \param [in]     DataLength   Number of bytes to add
+ */
+void CS_ChecksumUpdateStreaming(uint16 AlgorithmId, CS_ChecksumContext_t *Context, const void *DataPtr,
+                                size_t DataLength);
+
+/**
+ * \brief Finishes a checksum
+ *
+ *  \par Description
+ *       Writes the digest, zero-filled past the algorithm's digest size,
+ *       and returns its first four bytes as a 32-bit summary for events
+ *       and housekeeping.  For CRC-16, CRC-32 and CRC-32C the summary is
+ *       the CRC value itself, exactly as #CS_CalculateCRC returns it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The context is not changed.
+ *
+ *  \param [in]  AlgorithmId  Algorithm the context was started with
+ *  \param [in]  Context      Context started by #CS_ChecksumInit
+ *  \param [out] Digest       The finished checksum
+ *
+ * \return The 32-bit summary of the digest
+ */
+uint32 CS_ChecksumFinal(uint16 AlgorithmId, const CS_ChecksumContext_t *Context, CS_Digest_t *Digest);
+
+/**
+ * \brief Makes the digest of a CRC computed outside of CS
+ *
+ *  \par Description
+ *       If the algorithm is the CRC of type TypeCRC, writes the digest
+ *       #CS_ChecksumFinal would have written for the same CRC.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The CRC must be as #CFE_ES_CalculateCRC returns it, which is the
+ *       same as #CS_CalculateCRC.
+ *
+ *  \param [in]  AlgorithmId  One of the CS_ALGORITHM_... identifiers
+ *  \param [in]  TypeCRC      Type of CRC that Crc is
+ *  \param [in]  Crc          The CRC
+ *  \param [out] Digest       The digest, unchanged if the algorithm does
+ *                            not match
+ *
+ *  \return Boolean algorithm match response
+ *  \retval true  The algorithm computes that type of CRC, so Digest is set
+ *  \retval false The algorithm is a different checksum
+ */
+bool CS_ChecksumFromCrc(uint16 AlgorithmId, CFE_ES_CrcType_Enum_t TypeCRC, uint32 Crc, CS_Digest_t *Digest);
+
+/**
+ * \brief Gets the 32-bit summary of a digest
+ *
+ *  \par Description
+ *       Returns the first four bytes of the digest, the same summary
+ *       #CS_ChecksumFinal returns.
+ *
+ *  \param [in] Digest  The digest
+ *
+ * \return The 32-bit summary of the digest
+ */
+uint32 CS_DigestSummary(const CS_Digest_t *Digest);
+
+/**
+ * \brief Whether a checksum can be continued with #CS_ChecksumCombine
+ *
+ *  \par Description
+ *       False for algorithms that cannot merge checksums (SHA-256), and for
+ *       a Fletcher-64 context that ends partway through a 32-bit word.
+ *
+ *  \param [in] AlgorithmId  Algorithm the context was started with
+ *  \param [in] ContextA     Context that would be combined into
+ *
+ * \return true if #CS_ChecksumCombine may be used on ContextA
+ */
+bool CS_ChecksumCanCombine(uint16 AlgorithmId, const CS_ChecksumContext_t *ContextA);
+
+/**
+ * \brief Combines the checksums of two adjacent ranges of memory
+ *
+ *  \par Description
+ *       Given the context of a range A and the context of the range B that
+ *       immediately follows it, leaves in ContextA the context of A
+ *       followed by B, as if B had been passed to #CS_ChecksumUpdate.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       ContextB must have been started by #CS_ChecksumInit, and
+ *       #CS_ChecksumCanCombine must be true for ContextA.
+ *
+ *  \param [in]     AlgorithmId  Algorithm of both contexts
+ *  \param [in,out] ContextA     Context of the first range
+ *  \param [in]     ContextB     Context of the second range
+ *  \param [in]     LengthB      Length in bytes of the second range
+ */
+void CS_ChecksumCombine(uint16 AlgorithmId, CS_ChecksumContext_t *ContextA, const CS_ChecksumContext_t *ContextB,
+                        size_t LengthB);
+
+#endif
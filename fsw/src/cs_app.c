@@ -36,6 +36,7 @@
 #include "cs_app_cmds.h"
 #include "cs_cmds.h"
 #include "cs_init.h"
+#include "cs_crc.h"
 
 /*************************************************************************
 **
@@ -182,6 +183,9 @@ CFE_Status_t CS_AppInit(void)
 #if (CS_PRESERVE_STATES_ON_PROCESSOR_RESET == true)
         Result = CS_CreateRestoreStatesFromCDS();
 #endif
+
+        /* Read back the baselines from before a processor reset */
+        CS_BaselineInit();
     }
 
     if (Result == CFE_SUCCESS)
@@ -193,6 +197,18 @@ CFE_Status_t CS_AppInit(void)
     {
         CS_InitSegments();
 
+        /* Pick the fastest CRC kernels this processor supports */
+        CS_CrcInit(CS_CRC_HW_ACCELERATION);
+
+        /* Build the tables that locate single bit errors from CRC miscompares */
+        CS_SyndromeInit();
+
+        /* Start the tasks that checksum large regions in parallel */
+        CS_WorkerPoolInit();
+
+        /* Start the tasks that run recompute and OneShot jobs */
+        CS_JobsInit();
+
         /* initialize the place to ostart background checksumming */
         CS_AppData.HkPacket.Payload.CurrentCSTable      = 0;
         CS_AppData.HkPacket.Payload.CurrentEntryInTable = 0;
@@ -205,6 +221,8 @@ CFE_Status_t CS_AppInit(void)
         CS_AppData.HkPacket.Payload.OneShotInProgress   = false;
 
         CS_AppData.MaxBytesPerCycle = CS_DEFAULT_BYTES_PER_CYCLE;
+        CS_BudgetInit();
+        CS_SchedInit();
 
         /* Application startup event message */
         Result =
@@ -232,9 +250,11 @@ CFE_Status_t CS_AppPipe(const CFE_SB_Buffer_t *BufPtr)
         case CS_SEND_HK_MID:
             CS_HousekeepingCmd((CS_NoArgsCmd_t *)BufPtr);
 
-            /* update each table if there is no recompute happening on that table */
+            /* update each table that is due if there is no recompute happening on that table */
             Result = CS_HandleRoutineTableUpdates();
 
+            CS_BaselineUpdate();
+
             break;
 
         case CS_BACKGROUND_CYCLE_MID:
@@ -302,6 +322,41 @@ void CS_ProcessCmd(const CFE_SB_Buffer_t *BufPtr)
             }
             break;
 
+        case CS_SET_TIME_BUDGET_CC:
+            if (CS_VerifyCmdLength(&BufPtr->Msg, sizeof(CS_SetTimeBudgetCmd_t)))
+            {
+                CS_SetTimeBudgetCmd((CS_SetTimeBudgetCmd_t *)BufPtr);
+            }
+            break;
+
+        case CS_SET_REVISIT_PERIOD_CC:
+            if (CS_VerifyCmdLength(&BufPtr->Msg, sizeof(CS_SetRevisitPeriodCmd_t)))
+            {
+                CS_SetRevisitPeriodCmd((CS_SetRevisitPeriodCmd_t *)BufPtr);
+            }
+            break;
+
+        case CS_RECOMPUTE_ALL_CC:
+            if (CS_VerifyCmdLength(&BufPtr->Msg, sizeof(CS_RecomputeAllCmd_t)))
+            {
+                CS_RecomputeAllCmd((CS_RecomputeAllCmd_t *)BufPtr);
+            }
+            break;
+
+        case CS_SET_JOB_RATE_CC:
+            if (CS_VerifyCmdLength(&BufPtr->Msg, sizeof(CS_SetJobRateCmd_t)))
+            {
+                CS_SetJobRateCmd((CS_SetJobRateCmd_t *)BufPtr);
+            }
+            break;
+
+        case CS_MANAGE_TABLE_CC:
+            if (CS_VerifyCmdLength(&BufPtr->Msg, sizeof(CS_ManageTableCmd_t)))
+            {
+                CS_ManageTableCmd((CS_ManageTableCmd_t *)BufPtr);
+            }
+            break;
+
         case CS_ENABLE_ALL_CS_CC:
             if (CS_VerifyCmdLength(&BufPtr->Msg, sizeof(CS_NoArgsCmd_t)))
             {
@@ -598,6 +653,9 @@ void CS_HousekeepingCmd(const CS_NoArgsCmd_t *CmdPtr)
     }
     else
     {
+        /* Report the jobs that finished since the last packet */
+        CS_JobsDrain();
+
         /* Send housekeeping telemetry packet */
         CFE_SB_TimeStampMsg(CFE_MSG_PTR(CS_AppData.HkPacket.TelemetryHeader));
         CFE_SB_TransmitMsg(CFE_MSG_PTR(CS_AppData.HkPacket.TelemetryHeader), true);
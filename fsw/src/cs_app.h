@@ -41,6 +41,12 @@
 #include "cs_perfids.h"
 #include "cs_verify.h"
 #include "cs_version.h"
+#include "cs_worker.h"
+#include "cs_budget.h"
+#include "cs_syndrome.h"
+#include "cs_sched.h"
+#include "cs_jobs.h"
+#include "cs_baseline.h"
 
 /**************************************************************************
  **
@@ -72,17 +78,17 @@
 #define CS_TABLETYPE_NAME_SIZE 10
 /**\}*/
 
+/**
+ * \brief Bit of a table type in the table management masks
+ */
+#define CS_TABLE_BIT(Table) ((uint32)1 << (Table))
+
 /**
  * \name CS Child Task Names
  * \{
  */
-#define CS_RECOMP_OS_TASK_NAME      "CS_RecmpOSTsk"
-#define CS_RECOMP_CFECORE_TASK_NAME "CS_RecmpCfeCoreTsk"
-#define CS_RECOMP_MEMORY_TASK_NAME  "CS_RecmpMemoryTsk"
-#define CS_RECOMP_EEPROM_TASK_NAME  "CS_RecmpEepromTsk"
-#define CS_RECOMP_APP_TASK_NAME     "CS_RecmpAppTsk"
-#define CS_RECOMP_TABLES_TASK_NAME  "CS_RecmpTableTsk"
-#define CS_ONESHOT_TASK_NAME        "CS_OneShotTask"
+#define CS_JOB_TASK_NAME    "CS_JobTsk"
+#define CS_WORKER_TASK_NAME "CS_WorkerTsk"
 /**\}*/
 
 /**
@@ -94,6 +100,34 @@
  */
 #define CS_WAKEUP_TIMEOUT 1000
 
+/**
+ * \name Name index sizes
+ *
+ * Each index has two slots for every entry of its table, so no more
+ * than half the slots are ever in use.
+ * \{
+ */
+#define CS_TABLES_NAME_INDEX_SIZE (2 * CS_MAX_NUM_TABLES_TABLE_ENTRIES)
+#define CS_APP_NAME_INDEX_SIZE    (2 * CS_MAX_NUM_APP_TABLE_ENTRIES)
+/**\}*/
+
+/**
+ * \name Enabled entry map sizes
+ *
+ * \par Description
+ *      An enabled entry map has one bit for each entry of a table with
+ *      the given number of entries, rounded up to whole 32 bit words.
+ *      Ahead of those words is a summary with one bit for each of them
+ *      that is non-zero, so a sparse map of a large table is searched
+ *      a summary word, not 32 entries, at a time.
+ * \{
+ */
+#define CS_ENABLED_MAP_BIT_WORDS(NumEntries)     (((NumEntries) + 31) / 32)
+#define CS_ENABLED_MAP_SUMMARY_WORDS(NumEntries) ((CS_ENABLED_MAP_BIT_WORDS(NumEntries) + 31) / 32)
+#define CS_ENABLED_MAP_WORDS(NumEntries) \
+    (CS_ENABLED_MAP_SUMMARY_WORDS(NumEntries) + CS_ENABLED_MAP_BIT_WORDS(NumEntries))
+/**\}*/
+
 /*************************************************************************
  **
  ** Type definitions
@@ -110,22 +144,10 @@ typedef struct
     char   PipeName[CS_CMD_PIPE_NAME_LEN]; /**< \brief Command pipe name */
     uint16 PipeDepth;                      /**< \brief Command pipe depth */
 
-    uint16          ChildTaskTable;   /**< \brief Table for the child task to process */
-    uint16          ChildTaskEntryID; /**< \brief Entry in table for child task to process */
-    CFE_ES_TaskId_t ChildTaskID;      /**< \brief Task ID for the child task */
-
     uint32 MaxBytesPerCycle; /**< \brief Max number of bytes to process in a cycle */
 
     uint32 RunStatus; /**< \brief Application run status */
 
-    CS_Res_EepromMemory_Table_Entry_t *RecomputeEepromMemoryEntryPtr; /**< \brief Pointer to an entry to recompute in
-                                                                         the EEPROM or Memory table */
-
-    CS_Res_App_Table_Entry_t *RecomputeAppEntryPtr;       /**< \brief Pointer to an entry to recompute in the
-                                                                      Application table */
-    CS_Res_Tables_Table_Entry_t *RecomputeTablesEntryPtr; /**< \brief Pointer to an entry to recompute in the
-                                                                      Tables table */
-
     CFE_SB_PipeId_t CmdPipe; /**< \brief Command pipe ID */
 
     CFE_TBL_Handle_t DefEepromTableHandle; /**< \brief Handle to the EEPROM definition table */
@@ -140,6 +162,11 @@ typedef struct
     CFE_TBL_Handle_t DefAppTableHandle; /**< \brief Handle to the Apps definition table */
     CFE_TBL_Handle_t ResAppTableHandle; /**< \brief Hanlde to the Apps results table */
 
+    CFE_TBL_Handle_t ResBlockTableHandle; /**< \brief Handle to the block results table */
+
+    uint32 TableNotified;      /**< \brief Table types Table Services notifies CS to manage, see #CS_TABLE_BIT */
+    uint32 TableManagePending; /**< \brief Table types notified but not yet managed, see #CS_TABLE_BIT */
+
     CS_Def_EepromMemory_Table_Entry_t *DefEepromTblPtr; /**< \brief Pointer to the EEPROM definition table */
     CS_Res_EepromMemory_Table_Entry_t *ResEepromTblPtr; /**< \brief Pointer to the EEPROM results table */
 
@@ -152,6 +179,25 @@ typedef struct
     CS_Def_App_Table_Entry_t *DefAppTblPtr; /**< \brief Pointer to the Apps definition table */
     CS_Res_App_Table_Entry_t *ResAppTblPtr; /**< \brief Pointer to the Apps results table */
 
+    CS_Res_Block_Table_t *ResBlockTblPtr; /**< \brief Pointer to the block results table, NULL if unavailable */
+
+    uint32 TablesNameIndex[CS_TABLES_NAME_INDEX_SIZE];         /**< \brief Tables table entries by name */
+    uint32 AppNameIndex[CS_APP_NAME_INDEX_SIZE];               /**< \brief Apps table entries by name */
+    uint32 ValidateTablesNameIndex[CS_TABLES_NAME_INDEX_SIZE]; /**< \brief Tables table being validated by name */
+    uint32 ValidateAppNameIndex[CS_APP_NAME_INDEX_SIZE];       /**< \brief Apps table being validated by name */
+
+    uint32 EepromEnabledMap[CS_ENABLED_MAP_WORDS(CS_MAX_NUM_EEPROM_TABLE_ENTRIES)]; /**< \brief EEPROM enabled bits */
+    uint32 MemoryEnabledMap[CS_ENABLED_MAP_WORDS(CS_MAX_NUM_MEMORY_TABLE_ENTRIES)]; /**< \brief Memory enabled bits */
+    uint32 TablesEnabledMap[CS_ENABLED_MAP_WORDS(CS_MAX_NUM_TABLES_TABLE_ENTRIES)]; /**< \brief Tables enabled bits */
+    uint32 AppEnabledMap[CS_ENABLED_MAP_WORDS(CS_MAX_NUM_APP_TABLE_ENTRIES)];       /**< \brief Apps enabled bits */
+
+    CS_WorkerPool_t WorkerPool; /**< \brief Checksum worker pool */
+    CS_Budget_t     Budget;     /**< \brief Background cycle time budget state */
+    CS_Syndrome_t   Syndrome;   /**< \brief Single bit error lookup tables */
+    CS_Sched_t      Sched;      /**< \brief Background deadline scheduler state */
+    CS_JobQueue_t   Jobs;       /**< \brief Recompute and OneShot job queue */
+    CS_Baseline_t   Baseline;   /**< \brief Baselines kept across processor resets */
+
     CS_Res_EepromMemory_Table_Entry_t OSCodeSeg;      /**< \brief OS code segment 'table' */
     CS_Res_EepromMemory_Table_Entry_t CfeCoreCodeSeg; /**< \brief cFE core code segment 'table' */
 
@@ -172,6 +218,9 @@ typedef struct
     CS_Res_Tables_Table_Entry_t *AppResTablesTblPtr; /**< \brief CS results entry for the CS apps */
     CS_Res_Tables_Table_Entry_t *TblResTablesTblPtr; /**< \brief CS results table entry for the CS tables */
 
+    CS_Res_Tables_Table_Entry_t *SnapshotOwner;                         /**< \brief Entry copied in TableSnapshot */
+    uint8                        TableSnapshot[CS_TABLE_SNAPSHOT_SIZE]; /**< \brief Copy of a Tables entry */
+
 #if (CS_PRESERVE_STATES_ON_PROCESSOR_RESET == true)
     CFE_ES_CDSHandle_t DataStoreHandle; /**< \brief Handle to critical data store created by CS */
 #endif
@@ -46,7 +46,7 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CS_DisableAppCmd(const CS_NoArgsCmd_t *CmdPtr)
 {
-        if (CS_CheckRecomputeOneshot() == false)
+        if (CS_CheckRecomputeTable(CS_APP_TABLE) == false)
         {
             CS_AppData.HkPacket.Payload.AppCSState = CS_STATE_DISABLED;
             CS_ZeroAppTempValues();
@@ -67,7 +67,7 @@ void CS_DisableAppCmd(const CS_NoArgsCmd_t *CmdPtr)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CS_EnableAppCmd(const CS_NoArgsCmd_t *CmdPtr)
 {
-        if (CS_CheckRecomputeOneshot() == false)
+        if (CS_CheckRecomputeTable(CS_APP_TABLE) == false)
         {
             CS_AppData.HkPacket.Payload.AppCSState = CS_STATE_ENABLED;
 
@@ -126,42 +126,29 @@ void CS_ReportBaselineAppCmd(const CS_AppNameCmd_t *CmdPtr)
 void CS_RecomputeBaselineAppCmd(const CS_AppNameCmd_t *CmdPtr)
 {
     /* command verification variables */
-    CFE_ES_TaskId_t           ChildTaskID;
-    CFE_Status_t              Status;
     CS_Res_App_Table_Entry_t *ResultsEntry;
     char                      Name[OS_MAX_API_NAME];
 
-        if (CS_AppData.HkPacket.Payload.RecomputeInProgress == false && CS_AppData.HkPacket.Payload.OneShotInProgress == false)
-        {
             strncpy(Name, CmdPtr->Payload.Name, sizeof(Name) - 1);
             Name[sizeof(Name) - 1] = '\0';
 
             /* make sure the entry is a valid number and is defined in the table */
             if (CS_GetAppResTblEntryByName(&ResultsEntry, Name))
             {
-                /* There is no child task running right now, we can use it*/
-                CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
-
-                /* fill in child task variables */
-                CS_AppData.ChildTaskTable = CS_APP_TABLE;
-
-                CS_AppData.RecomputeAppEntryPtr = ResultsEntry;
-
-                Status = CFE_ES_CreateChildTask(&ChildTaskID, CS_RECOMP_APP_TASK_NAME, CS_RecomputeAppChildTask, NULL,
-                                                CFE_PLATFORM_ES_DEFAULT_STACK_SIZE, CS_CHILD_TASK_PRIORITY, 0);
-                if (Status == CFE_SUCCESS)
+                if (CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE, CS_APP_TABLE,
+                                           (uint16)(ResultsEntry - CS_AppData.ResAppTblPtr)))
                 {
                     CFE_EVS_SendEvent(CS_RECOMPUTE_APP_STARTED_DBG_EID, CFE_EVS_EventType_DEBUG,
                                       "Recompute baseline of app %s started", Name);
                     CS_AppData.HkPacket.Payload.CmdCounter++;
                 }
-                else /* child task creation failed */
+                else
                 {
-                    CFE_EVS_SendEvent(CS_RECOMPUTE_APP_CREATE_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "Recompute baseline of app %s failed, CFE_ES_CreateChildTask returned: 0x%08X",
-                                      Name, (unsigned int)Status);
+                    /*send event that we can't queue another job right now */
+                    CFE_EVS_SendEvent(CS_RECOMPUTE_APP_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "App recompute baseline for app %s failed: job queue full or already queued",
+                                      Name);
                     CS_AppData.HkPacket.Payload.CmdErrCounter++;
-                    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
                 }
             }
             else
@@ -170,14 +157,6 @@ void CS_RecomputeBaselineAppCmd(const CS_AppNameCmd_t *CmdPtr)
                                   "App recompute baseline failed, app %s not found", Name);
                 CS_AppData.HkPacket.Payload.CmdErrCounter++;
             }
-        }
-        else
-        {
-            /*send event that we can't start another task right now */
-            CFE_EVS_SendEvent(CS_RECOMPUTE_APP_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "App recompute baseline for app %s failed: child task in use", Name);
-            CS_AppData.HkPacket.Payload.CmdErrCounter++;
-        }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -192,16 +171,18 @@ void CS_DisableNameAppCmd(const CS_AppNameCmd_t *CmdPtr)
     CS_Def_App_Table_Entry_t *DefinitionEntry;
     char                      Name[OS_MAX_API_NAME];
 
-        if (CS_CheckRecomputeOneshot() == false)
-        {
-            strncpy(Name, CmdPtr->Payload.Name, sizeof(Name) - 1);
-            Name[sizeof(Name) - 1] = '\0';
+        strncpy(Name, CmdPtr->Payload.Name, sizeof(Name) - 1);
+        Name[sizeof(Name) - 1] = '\0';
 
-            if (CS_GetAppResTblEntryByName(&ResultsEntry, Name))
+        if (CS_GetAppResTblEntryByName(&ResultsEntry, Name))
+        {
+            if (CS_CheckRecomputeEntry(CS_APP_TABLE, (uint16)(ResultsEntry - CS_AppData.ResAppTblPtr)) == false)
             {
-                ResultsEntry->State             = CS_STATE_DISABLED;
-                ResultsEntry->TempChecksumValue = 0;
-                ResultsEntry->ByteOffset        = 0;
+                ResultsEntry->State         = CS_STATE_DISABLED;
+                ResultsEntry->ByteOffset    = 0;
+                ResultsEntry->LastCheckTime = 0;
+                CS_SetEnabledMapEntry(CS_AppData.AppEnabledMap, CS_MAX_NUM_APP_TABLE_ENTRIES,
+                                      (uint16)(ResultsEntry - CS_AppData.ResAppTblPtr), CS_STATE_DISABLED);
 
                 CFE_EVS_SendEvent(CS_DISABLE_APP_NAME_INF_EID, CFE_EVS_EventType_INFORMATION,
                                   "Checksumming of app %s is Disabled", Name);
@@ -220,14 +201,14 @@ void CS_DisableNameAppCmd(const CS_AppNameCmd_t *CmdPtr)
 
                 CS_AppData.HkPacket.Payload.CmdCounter++;
             }
+        }
 
-            else
-            {
-                CFE_EVS_SendEvent(CS_DISABLE_APP_UNKNOWN_NAME_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "App disable app command failed, app %s not found", Name);
-                CS_AppData.HkPacket.Payload.CmdErrCounter++;
-            }
-        } /* end InProgress if */
+        else
+        {
+            CFE_EVS_SendEvent(CS_DISABLE_APP_UNKNOWN_NAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "App disable app command failed, app %s not found", Name);
+            CS_AppData.HkPacket.Payload.CmdErrCounter++;
+        }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -242,14 +223,16 @@ void CS_EnableNameAppCmd(const CS_AppNameCmd_t *CmdPtr)
     CS_Def_App_Table_Entry_t *DefinitionEntry;
     char                      Name[OS_MAX_API_NAME];
 
-        if (CS_CheckRecomputeOneshot() == false)
-        {
-            strncpy(Name, CmdPtr->Payload.Name, sizeof(Name) - 1);
-            Name[sizeof(Name) - 1] = '\0';
+        strncpy(Name, CmdPtr->Payload.Name, sizeof(Name) - 1);
+        Name[sizeof(Name) - 1] = '\0';
 
-            if (CS_GetAppResTblEntryByName(&ResultsEntry, Name))
+        if (CS_GetAppResTblEntryByName(&ResultsEntry, Name))
+        {
+            if (CS_CheckRecomputeEntry(CS_APP_TABLE, (uint16)(ResultsEntry - CS_AppData.ResAppTblPtr)) == false)
             {
                 ResultsEntry->State = CS_STATE_ENABLED;
+                CS_SetEnabledMapEntry(CS_AppData.AppEnabledMap, CS_MAX_NUM_APP_TABLE_ENTRIES,
+                                      (uint16)(ResultsEntry - CS_AppData.ResAppTblPtr), CS_STATE_ENABLED);
 
                 CFE_EVS_SendEvent(CS_ENABLE_APP_NAME_INF_EID, CFE_EVS_EventType_INFORMATION,
                                   "Checksumming of app %s is Enabled", Name);
@@ -268,11 +251,11 @@ void CS_EnableNameAppCmd(const CS_AppNameCmd_t *CmdPtr)
 
                 CS_AppData.HkPacket.Payload.CmdCounter++;
             }
-            else
-            {
-                CFE_EVS_SendEvent(CS_ENABLE_APP_UNKNOWN_NAME_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "App enable app command failed, app %s not found", Name);
-                CS_AppData.HkPacket.Payload.CmdErrCounter++;
-            }
-        } /* end InProgress if */
+        }
+        else
+        {
+            CFE_EVS_SendEvent(CS_ENABLE_APP_UNKNOWN_NAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "App enable app command failed, app %s not found", Name);
+            CS_AppData.HkPacket.Payload.CmdErrCounter++;
+        }
 }
@@ -0,0 +1,360 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   The CFS Checksum (CS) Application's baselines kept across processor resets
+ */
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+#include "cs_app.h"
+#include "cs_events.h"
+#include <string.h>
+#include "cs_crc.h"
+#include "cs_jobs.h"
+#include "cs_baseline.h"
+
+/**************************************************************************
+ **
+ ** Functions
+ **
+ **************************************************************************/
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that finds a table type's entries and records       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static CS_Res_EepromMemory_Table_Entry_t *CS_BaselineEntries(uint16 Table, uint16 *NumEntries,
+                                                             CS_BaselineRecord_t **Records)
+{
+    CS_Res_EepromMemory_Table_Entry_t *Entries = NULL;
+
+    *NumEntries = 0;
+    *Records    = NULL;
+
+    switch (Table)
+    {
+        case CS_CFECORE:
+            Entries     = &CS_AppData.CfeCoreCodeSeg;
+            *NumEntries = 1;
+            *Records    = &CS_AppData.Baseline.Store.Records[0];
+            break;
+
+        case CS_OSCORE:
+            Entries     = &CS_AppData.OSCodeSeg;
+            *NumEntries = 1;
+            *Records    = &CS_AppData.Baseline.Store.Records[1];
+            break;
+
+        case CS_EEPROM_TABLE:
+            Entries     = CS_AppData.ResEepromTblPtr;
+            *NumEntries = CS_MAX_NUM_EEPROM_TABLE_ENTRIES;
+            *Records    = &CS_AppData.Baseline.Store.Records[2];
+            break;
+
+        case CS_MEMORY_TABLE:
+            Entries     = CS_AppData.ResMemoryTblPtr;
+            *NumEntries = CS_MAX_NUM_MEMORY_TABLE_ENTRIES;
+            *Records    = &CS_AppData.Baseline.Store.Records[2 + CS_MAX_NUM_EEPROM_TABLE_ENTRIES];
+            break;
+
+        default:
+            break;
+    }
+
+    if (Entries == NULL)
+    {
+        *NumEntries = 0;
+    }
+
+    return Entries;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that identifies the memory an entry covers          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CS_BaselineIdentity(const CS_Res_EepromMemory_Table_Entry_t *Entry)
+{
+    struct
+    {
+        cpuaddr StartAddress;
+        uint32  NumBytesToChecksum;
+        uint16  Algorithm;
+        uint16  HasBlockTree;
+    } Identity;
+
+    /* Clear the padding so it does not change the CRC */
+    memset(&Identity, 0, sizeof(Identity));
+
+    Identity.StartAddress       = Entry->StartAddress;
+    Identity.NumBytesToChecksum = Entry->NumBytesToChecksum;
+    Identity.Algorithm          = Entry->Algorithm;
+    Identity.HasBlockTree       = (Entry->BlockTree != 0);
+
+    return CS_CalculateCRC(&Identity, sizeof(Identity), 0, CFE_ES_CrcType_CRC_32);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that checks whether an entry's definition gives its */
+/* baseline                                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool CS_BaselineHasExpectedValue(uint16 Table, uint16 EntryID)
+{
+    const CS_Def_EepromMemory_Table_Entry_t *DefEntries = NULL;
+
+    if (Table == CS_EEPROM_TABLE)
+    {
+        DefEntries = CS_AppData.DefEepromTblPtr;
+    }
+    else if (Table == CS_MEMORY_TABLE)
+    {
+        DefEntries = CS_AppData.DefMemoryTblPtr;
+    }
+
+    return (DefEntries != NULL && DefEntries[EntryID].HasExpectedValue == true);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that computes the CRC of the baseline records       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CS_BaselineStoreCrc(void)
+{
+    return CS_CalculateCRC(CS_AppData.Baseline.Store.Records, sizeof(CS_AppData.Baseline.Store.Records), 0,
+                           CFE_ES_CrcType_CRC_32);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that initializes baseline preservation              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_BaselineInit(void)
+{
+#if (CS_PRESERVE_BASELINES_ON_PROCESSOR_RESET == true)
+    CS_BaselineStore_t *Store = &CS_AppData.Baseline.Store;
+    CFE_Status_t        Result;
+
+    memset(Store, 0, sizeof(*Store));
+    CS_AppData.Baseline.Restored  = false;
+    CS_AppData.Baseline.SaveCount = 0;
+
+    Result = CFE_ES_RegisterCDS(&CS_AppData.Baseline.DataStoreHandle, sizeof(*Store), CS_BASELINE_CDS_NAME);
+
+    if (Result == CFE_ES_CDS_ALREADY_EXISTS)
+    {
+        /*
+        ** Pre-existing CDS area - read the baselines from before the reset...
+        */
+        Result = CFE_ES_RestoreFromCDS(Store, CS_AppData.Baseline.DataStoreHandle);
+
+        if (Result == CFE_SUCCESS)
+        {
+            if (Store->Version == CS_BASELINE_VERSION && Store->NumRecords == CS_BASELINE_NUM_RECORDS &&
+                Store->Crc == CS_BaselineStoreCrc())
+            {
+                CS_AppData.Baseline.Restored = true;
+            }
+            else
+            {
+                CFE_EVS_SendEvent(CS_BASELINE_CDS_INVALID_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "Baselines in Critical Data Store discarded: version %d, %d records",
+                                  (int)Store->Version, (int)Store->NumRecords);
+
+                memset(Store, 0, sizeof(*Store));
+            }
+        }
+        else
+        {
+            /* The next save writes over whatever the CDS holds */
+            CFE_EVS_SendEvent(CS_BASELINE_CDS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Baseline Critical Data Store restore error = 0x%08X", (unsigned int)Result);
+
+            memset(Store, 0, sizeof(*Store));
+        }
+    }
+    else if (Result != CFE_SUCCESS)
+    {
+        /*
+        ** CDS is broken - prevent further errors...
+        */
+        CS_AppData.Baseline.DataStoreHandle = CFE_ES_CDS_BAD_HANDLE;
+
+        CFE_EVS_SendEvent(CS_BASELINE_CDS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Baseline Critical Data Store register error = 0x%08X", (unsigned int)Result);
+    }
+#endif
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that restores a table type's baselines              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_BaselineRestore(uint16 Table)
+{
+    static const char *const TableNames[] = {"cFE Core", "OS", "EEPROM", "Memory"};
+
+    CS_Res_EepromMemory_Table_Entry_t *Entries     = NULL;
+    CS_Res_EepromMemory_Table_Entry_t *Entry       = NULL;
+    CS_BaselineRecord_t               *Records     = NULL;
+    CS_BaselineRecord_t               *Record      = NULL;
+    uint16                             NumEntries  = 0;
+    uint16                             EntryID     = 0;
+    uint16                             NumRestored = 0;
+    bool                               Restored    = false;
+
+    if (CS_AppData.Baseline.Restored)
+    {
+        Entries = CS_BaselineEntries(Table, &NumEntries, &Records);
+
+        for (EntryID = 0; EntryID < NumEntries; EntryID++)
+        {
+            Entry    = &Entries[EntryID];
+            Record   = &Records[EntryID];
+            Restored = false;
+
+            if (Entry->State == CS_STATE_EMPTY || Record->Identity != CS_BaselineIdentity(Entry))
+            {
+                continue;
+            }
+
+            /* An expected value from the definition table is never replaced */
+            if (Record->ComputedYet == true && !CS_BaselineHasExpectedValue(Table, EntryID))
+            {
+                Entry->ComputedYet      = true;
+                Entry->ComparisonValue  = Record->ComparisonValue;
+                Entry->ComparisonDigest = Record->ComparisonDigest;
+                Restored                = true;
+            }
+
+            /* A block tree's leaf CRCs are not kept, so its entry starts over */
+            if (Entry->BlockTree == 0 && Record->ByteOffset != 0 && Record->ByteOffset < Entry->NumBytesToChecksum)
+            {
+                Entry->ByteOffset          = Record->ByteOffset;
+                Entry->TempChecksumContext = Record->TempChecksumContext;
+                Restored                   = true;
+            }
+
+            if (Restored)
+            {
+                NumRestored++;
+            }
+        }
+
+        if (NumRestored > 0)
+        {
+            CFE_EVS_SendEvent(CS_BASELINE_RESTORE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "Restored %d %s baselines from Critical Data Store", NumRestored, TableNames[Table]);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that saves the baselines                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_BaselineSave(void)
+{
+    CS_BaselineStore_t                *Store      = &CS_AppData.Baseline.Store;
+    CS_Res_EepromMemory_Table_Entry_t *Entries    = NULL;
+    CS_Res_EepromMemory_Table_Entry_t *Entry      = NULL;
+    CS_BaselineRecord_t               *Records    = NULL;
+    CS_BaselineRecord_t               *Record     = NULL;
+    uint16                             NumEntries = 0;
+    uint16                             EntryID    = 0;
+    uint16                             Table      = 0;
+    CFE_Status_t                       Result;
+
+    /*
+    ** Handle is defined when CDS is active...
+    */
+    if (CFE_RESOURCEID_TEST_DEFINED(CS_AppData.Baseline.DataStoreHandle))
+    {
+        for (Table = CS_CFECORE; Table <= CS_MEMORY_TABLE; Table++)
+        {
+            Entries = CS_BaselineEntries(Table, &NumEntries, &Records);
+
+            for (EntryID = 0; EntryID < NumEntries; EntryID++)
+            {
+                /* A job task may be part way through changing an entry a recompute owns */
+                if (CS_JobsEntryBusy(Table, (Table == CS_CFECORE || Table == CS_OSCORE) ? 0 : EntryID))
+                {
+                    continue;
+                }
+
+                Entry  = &Entries[EntryID];
+                Record = &Records[EntryID];
+
+                memset(Record, 0, sizeof(*Record));
+
+                Record->Identity            = CS_BaselineIdentity(Entry);
+                Record->ComputedYet         = Entry->ComputedYet;
+                Record->ComparisonValue     = Entry->ComparisonValue;
+                Record->ByteOffset          = Entry->ByteOffset;
+                Record->ComparisonDigest    = Entry->ComparisonDigest;
+                Record->TempChecksumContext = Entry->TempChecksumContext;
+            }
+        }
+
+        Store->Version    = CS_BASELINE_VERSION;
+        Store->NumRecords = CS_BASELINE_NUM_RECORDS;
+        Store->Crc        = CS_BaselineStoreCrc();
+
+        Result = CFE_ES_CopyToCDS(CS_AppData.Baseline.DataStoreHandle, Store);
+
+        if (Result != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(CS_BASELINE_CDS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Baseline Critical Data Store write error = 0x%08X", (unsigned int)Result);
+            /*
+            ** CDS is broken - prevent further errors...
+            */
+            CS_AppData.Baseline.DataStoreHandle = CFE_ES_CDS_BAD_HANDLE;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that saves the baselines periodically               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_BaselineUpdate(void)
+{
+    CS_AppData.Baseline.SaveCount++;
+
+    if (CS_AppData.Baseline.SaveCount >= CS_BASELINE_SAVE_PERIOD)
+    {
+        CS_AppData.Baseline.SaveCount = 0;
+        CS_BaselineSave();
+    }
+}
@@ -0,0 +1,168 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Baselines kept across processor resets for the CFS Checksum (CS) Application
+ */
+#ifndef CS_BASELINE_H
+#define CS_BASELINE_H
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+#include "cs_tbldefs.h"
+#include "cs_platform_cfg.h"
+
+/**************************************************************************
+ **
+ ** Macro definitions
+ **
+ **************************************************************************/
+
+/**
+ * \brief Layout version of the baselines in the Critical Data Store
+ *
+ * \par Description
+ *      Baselines saved with any other version are discarded.  Change it
+ *      whenever #CS_BaselineRecord_t changes.
+ */
+#define CS_BASELINE_VERSION 1
+
+/**
+ * \brief Number of baseline records
+ *
+ * \par Description
+ *      One record each for the cFE core and OS code segments, then one per
+ *      EEPROM table entry and one per Memory table entry.
+ */
+#define CS_BASELINE_NUM_RECORDS (2 + CS_MAX_NUM_EEPROM_TABLE_ENTRIES + CS_MAX_NUM_MEMORY_TABLE_ENTRIES)
+
+/**************************************************************************
+ **
+ ** Type definitions
+ **
+ **************************************************************************/
+
+/**
+ *  \brief Baseline and unfinished checksum of one entry
+ */
+typedef struct
+{
+    uint32               Identity;            /**< \brief CRC of the memory and algorithm the entry covers */
+    uint16               ComputedYet;         /**< \brief Have we computed an Integrity value yet */
+    uint16               Filler16;            /**< \brief Padding */
+    uint32               ComparisonValue;     /**< \brief First four bytes of ComparisonDigest */
+    uint32               ByteOffset;          /**< \brief Where a previous unfinished calc left off */
+    CS_Digest_t          ComparisonDigest;    /**< \brief The Memory Integrity Value */
+    CS_ChecksumContext_t TempChecksumContext; /**< \brief The unfinished calculation */
+} CS_BaselineRecord_t;
+
+/**
+ *  \brief Baselines as kept in the Critical Data Store
+ */
+typedef struct
+{
+    uint16              Version;                          /**< \brief #CS_BASELINE_VERSION */
+    uint16              NumRecords;                       /**< \brief #CS_BASELINE_NUM_RECORDS */
+    uint32              Crc;                              /**< \brief CRC-32 of the records */
+    CS_BaselineRecord_t Records[CS_BASELINE_NUM_RECORDS]; /**< \brief Records in table type order */
+} CS_BaselineStore_t;
+
+/**
+ *  \brief CS baseline preservation state
+ */
+typedef struct
+{
+    CFE_ES_CDSHandle_t DataStoreHandle; /**< \brief Handle to the baseline critical data store */
+    bool               Restored;        /**< \brief true while Store holds the baselines from before the reset */
+    uint32             SaveCount;       /**< \brief Housekeeping requests since the baselines were last saved */
+    CS_BaselineStore_t Store;           /**< \brief Copy of the critical data store */
+} CS_Baseline_t;
+
+/**************************************************************************
+ **
+ ** Function prototypes
+ **
+ **************************************************************************/
+
+/**
+ * \brief Initializes baseline preservation
+ *
+ *  \par Description
+ *       Registers the Critical Data Store that keeps the baselines.  If
+ *       it already existed, restores it and keeps the baselines for
+ *       #CS_BaselineRestore if their version, number of records and CRC
+ *       are all valid.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once during application initialization, before the tables
+ *       are initialized.  Does nothing if
+ *       #CS_PRESERVE_BASELINES_ON_PROCESSOR_RESET is false.  Critical Data
+ *       Store errors are not fatal; every entry then computes a new
+ *       baseline.
+ */
+void CS_BaselineInit(void);
+
+/**
+ * \brief Restores the baselines of a table type's entries
+ *
+ *  \par Description
+ *       Every entry whose address, size, algorithm and block tree are
+ *       the same as when its record was saved gets back its baseline and,
+ *       without a block tree, the progress of its unfinished checksum.
+ *       Entries whose definition has an expected value keep it as their
+ *       baseline.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once the table type's results are set up.  Entries with a
+ *       block tree start their checksum over, since their leaf CRCs are
+ *       not kept.
+ *
+ *  \param [in]  Table  #CS_CFECORE, #CS_OSCORE, #CS_EEPROM_TABLE or
+ *                      #CS_MEMORY_TABLE
+ */
+void CS_BaselineRestore(uint16 Table);
+
+/**
+ * \brief Saves the baselines to the Critical Data Store
+ *
+ *  \par Description
+ *       Records the baseline and unfinished checksum of each entry and
+ *       writes the records, with their version and CRC, to the Critical
+ *       Data Store.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called by the main task.  Entries a recompute owns keep
+ *       their last saved record.
+ */
+void CS_BaselineSave(void);
+
+/**
+ * \brief Saves the baselines once every #CS_BASELINE_SAVE_PERIOD calls
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called on each housekeeping request.
+ */
+void CS_BaselineUpdate(void);
+
+#endif
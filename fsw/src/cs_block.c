@@ -0,0 +1,568 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Block CRC trees for the CFS Checksum (CS) Application
+ */
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+#include "cs_app.h"
+#include <string.h>
+#include "cs_events.h"
+#include "cs_crc.h"
+#include "cs_algorithm.h"
+#include "cs_block.h"
+
+/* The block results table is registered as a single buffered table */
+CompileTimeAssert(sizeof(CS_Res_Block_Table_t) <= CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE, CS_BlockTableTooLarge);
+
+/**************************************************************************
+ **
+ ** Functions
+ **
+ **************************************************************************/
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that finds the block tree of a results entry        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static CS_Res_BlockTree_t *CS_BlockTreeGet(const CS_Res_EepromMemory_Table_Entry_t *ResultsEntry)
+{
+    CS_Res_BlockTree_t *Tree = NULL;
+
+    if (CS_AppData.ResBlockTblPtr != NULL && ResultsEntry->BlockTree != 0 &&
+        ResultsEntry->BlockTree <= CS_MAX_NUM_BLOCK_TREES)
+    {
+        Tree = &CS_AppData.ResBlockTblPtr->Trees[ResultsEntry->BlockTree - 1];
+
+        if (Tree->State == CS_STATE_EMPTY)
+        {
+            Tree = NULL;
+        }
+    }
+
+    return Tree;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that names the table a block tree belongs to        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static const char *CS_BlockTreeTableType(const CS_Res_BlockTree_t *Tree)
+{
+    return ((Tree->Table == CS_EEPROM_TABLE) ? "EEPROM" : "Memory");
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that computes one node from its children            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CS_BlockTreeHashChildren(const CS_Res_BlockTree_t *Tree, const uint32 *Level, uint32 LevelSize,
+                                       uint32 Parent)
+{
+    uint32 NumChildren = ((2 * Parent + 1 < LevelSize) ? 2 : 1);
+
+    return CS_CalculateCRC(&Level[2 * Parent], NumChildren * sizeof(uint32), 0, (CFE_ES_CrcType_Enum_t)Tree->TypeCRC);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that recomputes the nodes above a leaf              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_BlockTreeUpdatePath(const CS_Res_BlockTree_t *Tree, uint32 Leaf)
+{
+    uint32 *Level     = &CS_AppData.ResBlockTblPtr->Nodes[Tree->FirstNode + Tree->NumLeaves];
+    uint32  LevelSize = Tree->NumLeaves;
+    uint32  Index     = Leaf;
+
+    while (LevelSize > 1)
+    {
+        Index /= 2;
+        Level[LevelSize + Index] = CS_BlockTreeHashChildren(Tree, Level, LevelSize, Index);
+
+        Level += LevelSize;
+        LevelSize = (LevelSize + 1) / 2;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that computes every node above the baseline leaves  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_BlockTreeBuild(const CS_Res_BlockTree_t *Tree)
+{
+    uint32 *Level     = &CS_AppData.ResBlockTblPtr->Nodes[Tree->FirstNode + Tree->NumLeaves];
+    uint32  LevelSize = Tree->NumLeaves;
+    uint32  Parent    = 0;
+
+    while (LevelSize > 1)
+    {
+        for (Parent = 0; Parent < (LevelSize + 1) / 2; Parent++)
+        {
+            Level[LevelSize + Parent] = CS_BlockTreeHashChildren(Tree, Level, LevelSize, Parent);
+        }
+
+        Level += LevelSize;
+        LevelSize = (LevelSize + 1) / 2;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that finds free nodes for a new block tree          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool CS_BlockTreeFindNodes(uint32 NumNodes, uint32 *FirstNode)
+{
+    const CS_Res_BlockTree_t *Tree      = NULL;
+    uint32                    Candidate = 0;
+    uint32                    Loop      = 0;
+    bool                      Moved     = true;
+
+    /* First fit: move past every tree that overlaps until none do */
+    while (Moved && Candidate + NumNodes <= CS_MAX_NUM_BLOCK_NODES)
+    {
+        Moved = false;
+
+        for (Loop = 0; Loop < CS_MAX_NUM_BLOCK_TREES; Loop++)
+        {
+            Tree = &CS_AppData.ResBlockTblPtr->Trees[Loop];
+
+            if (Tree->State != CS_STATE_EMPTY && Candidate < Tree->FirstNode + Tree->NumNodes &&
+                Tree->FirstNode < Candidate + NumNodes)
+            {
+                Candidate = Tree->FirstNode + Tree->NumNodes;
+                Moved     = true;
+            }
+        }
+    }
+
+    *FirstNode = Candidate;
+
+    return (Candidate + NumNodes <= CS_MAX_NUM_BLOCK_NODES);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that initializes the block results table            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_BlockTreeInit(void)
+{
+    CFE_Status_t          Result = CFE_SUCCESS;
+    CS_Res_Block_Table_t *TblPtr = NULL;
+
+    CS_AppData.ResBlockTblPtr = NULL;
+
+    Result = CFE_TBL_Register(&CS_AppData.ResBlockTableHandle, CS_RESULTS_BLOCK_TABLE_NAME,
+                              sizeof(CS_Res_Block_Table_t), CFE_TBL_OPT_SNGL_BUFFER | CFE_TBL_OPT_DUMP_ONLY, NULL);
+
+    if (Result == CFE_SUCCESS)
+    {
+        Result = CFE_TBL_GetAddress((void *)&TblPtr, CS_AppData.ResBlockTableHandle);
+    }
+
+    if (Result == CFE_SUCCESS && TblPtr != NULL)
+    {
+        memset(TblPtr, 0, sizeof(*TblPtr));
+        CS_AppData.ResBlockTblPtr = TblPtr;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(CS_INIT_BLOCK_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Table initialization failed for block trees: 0x%08X", (unsigned int)Result);
+    }
+
+    /* A dump of the table is only done when it is managed */
+    if (CS_AppData.ResBlockTblPtr != NULL &&
+        CFE_TBL_NotifyByMessage(CS_AppData.ResBlockTableHandle, CFE_SB_ValueToMsgId(CS_CMD_MID), CS_MANAGE_TABLE_CC,
+                                CS_BLOCK_TABLE) == CFE_SUCCESS)
+    {
+        CS_AppData.TableNotified |= CS_TABLE_BIT(CS_BLOCK_TABLE);
+    }
+    else
+    {
+        CS_AppData.TableNotified &= ~CS_TABLE_BIT(CS_BLOCK_TABLE);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that manages the block results table                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_BlockTreeManage(void)
+{
+    CFE_Status_t          Result = CFE_SUCCESS;
+    CS_Res_Block_Table_t *TblPtr = NULL;
+
+    if (CS_AppData.ResBlockTblPtr != NULL)
+    {
+        CFE_TBL_ReleaseAddress(CS_AppData.ResBlockTableHandle);
+        CFE_TBL_Manage(CS_AppData.ResBlockTableHandle);
+
+        Result = CFE_TBL_GetAddress((void *)&TblPtr, CS_AppData.ResBlockTableHandle);
+
+        /* The table is dump only, so the contents never change here */
+        if ((Result == CFE_SUCCESS || Result == CFE_TBL_INFO_UPDATED) && TblPtr != NULL)
+        {
+            CS_AppData.ResBlockTblPtr = TblPtr;
+        }
+        else
+        {
+            CS_AppData.ResBlockTblPtr = NULL;
+
+            CFE_EVS_SendEvent(CS_UPDATE_BLOCK_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Table update failed for block trees: 0x%08X, checksumming without block trees",
+                              (unsigned int)Result);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that counts the nodes of a block tree               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 CS_BlockTreeNumNodes(uint32 NumLeaves)
+{
+    uint32 LevelSize = NumLeaves;
+    uint32 NumNodes  = NumLeaves; /* The leaves of the current pass */
+
+    while (LevelSize > 1)
+    {
+        NumNodes += LevelSize;
+        LevelSize = (LevelSize + 1) / 2;
+    }
+
+    /* The root */
+    return NumNodes + LevelSize;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that assigns block trees to a new table's entries   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_BlockTreeAllocate(uint16 Table, const CS_Def_EepromMemory_Table_Entry_t *DefinitionTblPtr,
+                          CS_Res_EepromMemory_Table_Entry_t *ResultsTblPtr, uint16 NumEntries)
+{
+    CS_Res_BlockTree_t *Tree      = NULL;
+    uint16              Loop      = 0;
+    uint16              TreeIndex = 0;
+    uint32              NumLeaves = 0;
+    uint32              NumNodes  = 0;
+    uint32              FirstNode = 0;
+
+    if (CS_AppData.ResBlockTblPtr != NULL)
+    {
+        for (TreeIndex = 0; TreeIndex < CS_MAX_NUM_BLOCK_TREES; TreeIndex++)
+        {
+            if (CS_AppData.ResBlockTblPtr->Trees[TreeIndex].Table == Table)
+            {
+                memset(&CS_AppData.ResBlockTblPtr->Trees[TreeIndex], 0, sizeof(CS_Res_BlockTree_t));
+            }
+        }
+    }
+
+    for (Loop = 0; Loop < NumEntries; Loop++)
+    {
+        ResultsTblPtr[Loop].BlockTree = 0;
+
+        if (CS_AppData.ResBlockTblPtr != NULL && DefinitionTblPtr[Loop].State != CS_STATE_EMPTY &&
+            DefinitionTblPtr[Loop].BlockTree && DefinitionTblPtr[Loop].NumBytesToChecksum > 0)
+        {
+            NumLeaves = (DefinitionTblPtr[Loop].NumBytesToChecksum + CS_BLOCK_TREE_LEAF_SIZE - 1) /
+                        CS_BLOCK_TREE_LEAF_SIZE;
+            NumNodes  = CS_BlockTreeNumNodes(NumLeaves);
+
+            for (TreeIndex = 0; TreeIndex < CS_MAX_NUM_BLOCK_TREES; TreeIndex++)
+            {
+                if (CS_AppData.ResBlockTblPtr->Trees[TreeIndex].State == CS_STATE_EMPTY)
+                {
+                    break;
+                }
+            }
+
+            if (TreeIndex < CS_MAX_NUM_BLOCK_TREES && CS_BlockTreeFindNodes(NumNodes, &FirstNode))
+            {
+                Tree = &CS_AppData.ResBlockTblPtr->Trees[TreeIndex];
+
+                Tree->State     = CS_STATE_ENABLED;
+                Tree->Table     = Table;
+                Tree->EntryID   = Loop;
+                Tree->NumLeaves = NumLeaves;
+                Tree->NumNodes  = NumNodes;
+                Tree->FirstNode = FirstNode;
+
+                /* CRC algorithms get leaves they can combine, everything else gets CRC-32 */
+                Tree->TypeCRC = CS_GetAlgorithm(DefinitionTblPtr[Loop].Algorithm)->TypeCRC;
+                if (Tree->TypeCRC == CFE_ES_CrcType_NONE)
+                {
+                    Tree->TypeCRC = CFE_ES_CrcType_CRC_32;
+                }
+
+                ResultsTblPtr[Loop].BlockTree = TreeIndex + 1;
+            }
+            else
+            {
+                CFE_EVS_SendEvent(CS_BLOCK_TREE_ALLOC_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s entry %d: No room for a block tree of %u nodes",
+                                  (Table == CS_EEPROM_TABLE) ? "EEPROM" : "Memory", Loop, (unsigned int)NumNodes);
+            }
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that adds the bytes of a cycle to a block tree      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_BlockTreeUpdate(const CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint32 Offset, uint32 Length)
+{
+    CS_Res_BlockTree_t *Tree       = CS_BlockTreeGet(ResultsEntry);
+    uint32 *            Current    = NULL;
+    uint32 *            Baseline   = NULL;
+    cpuaddr             Address    = 0;
+    uint32              NumBytes   = 0;
+    uint32              Leaf       = 0;
+    bool                IsBaseline = false;
+
+    if (Tree != NULL)
+    {
+        if (Offset == 0)
+        {
+            /* A new pass through the entry */
+            Tree->ByteOffset      = 0;
+            Tree->LeafCrc         = 0;
+            Tree->FailedLeaves    = 0;
+            Tree->FirstFailedLeaf = 0;
+            Tree->CurrentValid    = false;
+        }
+
+        /* The leaves can only follow a pass from its start */
+        if (Offset == Tree->ByteOffset)
+        {
+            Current    = &CS_AppData.ResBlockTblPtr->Nodes[Tree->FirstNode];
+            Baseline   = &Current[Tree->NumLeaves];
+            Address    = ResultsEntry->StartAddress + Offset;
+            IsBaseline = (!ResultsEntry->ComputedYet || !Tree->ComputedYet);
+
+            while (Length > 0)
+            {
+                NumBytes = CS_BLOCK_TREE_LEAF_SIZE - (Tree->ByteOffset % CS_BLOCK_TREE_LEAF_SIZE);
+                if (NumBytes > Length)
+                {
+                    NumBytes = Length;
+                }
+
+                Tree->LeafCrc = CS_CalculateCRC((void *)Address, NumBytes, Tree->LeafCrc,
+                                                (CFE_ES_CrcType_Enum_t)Tree->TypeCRC);
+
+                Address += NumBytes;
+                Length -= NumBytes;
+                Tree->ByteOffset += NumBytes;
+
+                if ((Tree->ByteOffset % CS_BLOCK_TREE_LEAF_SIZE) == 0 ||
+                    Tree->ByteOffset >= ResultsEntry->NumBytesToChecksum)
+                {
+                    Leaf = (Tree->ByteOffset - 1) / CS_BLOCK_TREE_LEAF_SIZE;
+
+                    if (IsBaseline)
+                    {
+                        Baseline[Leaf] = Tree->LeafCrc;
+                    }
+                    else
+                    {
+                        Current[Leaf] = Tree->LeafCrc;
+
+                        if (Current[Leaf] != Baseline[Leaf])
+                        {
+                            if (Tree->FailedLeaves == 0)
+                            {
+                                Tree->FirstFailedLeaf = Leaf;
+                            }
+                            Tree->FailedLeaves++;
+                        }
+                    }
+
+                    Tree->LeafCrc = 0;
+                }
+            }
+
+            if (Tree->ByteOffset >= ResultsEntry->NumBytesToChecksum)
+            {
+                if (IsBaseline)
+                {
+                    CS_BlockTreeBuild(Tree);
+                    memcpy(Current, Baseline, Tree->NumLeaves * sizeof(uint32));
+                    Tree->ComputedYet = true;
+                }
+
+                Tree->CurrentValid = true;
+            }
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that reports the leaf blocks that miscompared       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_BlockTreeReportMiscompare(const CS_Res_EepromMemory_Table_Entry_t *ResultsEntry)
+{
+    const CS_Res_BlockTree_t *Tree = CS_BlockTreeGet(ResultsEntry);
+
+    if (Tree != NULL && Tree->CurrentValid && Tree->FailedLeaves > 0)
+    {
+        CFE_EVS_SendEvent(CS_BLOCK_MISCOMPARE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s entry %d: %u of %u blocks miscompared, first at 0x%08X", CS_BlockTreeTableType(Tree),
+                          Tree->EntryID, (unsigned int)Tree->FailedLeaves, (unsigned int)Tree->NumLeaves,
+                          (unsigned int)(ResultsEntry->StartAddress + Tree->FirstFailedLeaf * CS_BLOCK_TREE_LEAF_SIZE));
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that drops the leaves of the current pass           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_BlockTreeInvalidate(uint16 Table, uint16 EntryID, bool AllEntries)
+{
+    CS_Res_BlockTree_t *Tree = NULL;
+    uint32              i    = 0;
+
+    if (CS_AppData.ResBlockTblPtr != NULL)
+    {
+        for (i = 0; i < CS_MAX_NUM_BLOCK_TREES; i++)
+        {
+            Tree = &CS_AppData.ResBlockTblPtr->Trees[i];
+
+            if (Tree->State != CS_STATE_EMPTY && Tree->Table == Table && (AllEntries || Tree->EntryID == EntryID))
+            {
+                /* A pass in progress stops following the entry until it starts over */
+                Tree->ByteOffset      = 0;
+                Tree->LeafCrc         = 0;
+                Tree->FailedLeaves    = 0;
+                Tree->FirstFailedLeaf = 0;
+                Tree->CurrentValid    = false;
+            }
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that recomputes a baseline from its block tree      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_BlockTreeRecompute(CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, CS_Job_t *Job)
+{
+    CS_Res_BlockTree_t * Tree           = CS_BlockTreeGet(ResultsEntry);
+    uint32 *             Current        = NULL;
+    uint32 *             Baseline       = NULL;
+    uint32               Leaf           = 0;
+    uint32               LeafLength     = 0;
+    uint32               NumRehashed    = 0;
+    uint64               Start          = 0;
+    bool                 Recomputed     = false;
+    CS_ChecksumContext_t Context;
+    CS_ChecksumContext_t LeafContext;
+
+    if (Tree != NULL && Tree->ComputedYet && CS_GetAlgorithm(ResultsEntry->Algorithm)->TypeCRC == Tree->TypeCRC)
+    {
+        Current  = &CS_AppData.ResBlockTblPtr->Nodes[Tree->FirstNode];
+        Baseline = &Current[Tree->NumLeaves];
+
+        for (Leaf = 0; Leaf < Tree->NumLeaves; Leaf++)
+        {
+            /* Leaves from before the recompute was requested may predate the change being recomputed */
+            if (!Tree->CurrentValid)
+            {
+                LeafLength = ResultsEntry->NumBytesToChecksum - Leaf * CS_BLOCK_TREE_LEAF_SIZE;
+                if (LeafLength > CS_BLOCK_TREE_LEAF_SIZE)
+                {
+                    LeafLength = CS_BLOCK_TREE_LEAF_SIZE;
+                }
+
+                /* Pace the reverifying like the rest of the recompute job */
+                CS_JobsPace(Job, LeafLength);
+
+                Start         = CS_BudgetGetTime();
+                Current[Leaf] = CS_CalculateCRC((void *)(ResultsEntry->StartAddress + Leaf * CS_BLOCK_TREE_LEAF_SIZE),
+                                                LeafLength, 0, (CFE_ES_CrcType_Enum_t)Tree->TypeCRC);
+                CS_BudgetJobCharge(Job, LeafLength, Start);
+            }
+
+            if (Current[Leaf] != Baseline[Leaf])
+            {
+                Baseline[Leaf] = Current[Leaf];
+                CS_BlockTreeUpdatePath(Tree, Leaf);
+
+                NumRehashed++;
+            }
+        }
+
+        /* The entry's checksum is the combination of its leaves */
+        CS_ChecksumInit(ResultsEntry->Algorithm, &Context);
+        memset(&LeafContext, 0, sizeof(LeafContext));
+
+        for (Leaf = 0; Leaf < Tree->NumLeaves; Leaf++)
+        {
+            LeafLength = ResultsEntry->NumBytesToChecksum - Leaf * CS_BLOCK_TREE_LEAF_SIZE;
+            if (LeafLength > CS_BLOCK_TREE_LEAF_SIZE)
+            {
+                LeafLength = CS_BLOCK_TREE_LEAF_SIZE;
+            }
+
+            LeafContext.Crc = Baseline[Leaf];
+            CS_ChecksumCombine(ResultsEntry->Algorithm, &Context, &LeafContext, LeafLength);
+        }
+
+        ResultsEntry->ComparisonValue =
+            CS_ChecksumFinal(ResultsEntry->Algorithm, &Context, &ResultsEntry->ComparisonDigest);
+        ResultsEntry->ComputedYet = true;
+        ResultsEntry->ByteOffset  = 0;
+
+        Tree->FailedLeaves    = 0;
+        Tree->FirstFailedLeaf = 0;
+
+        *ComputedCSValue = ResultsEntry->ComparisonValue;
+        Recomputed       = true;
+
+        /* CS_JobsDrain reports how many blocks were rehashed */
+        Job->NumBlocks         = Tree->NumLeaves;
+        Job->NumBlocksRehashed = NumRehashed;
+    }
+
+    return Recomputed;
+}
@@ -0,0 +1,175 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Block CRC trees for the CFS Checksum (CS) Application
+ */
+#ifndef CS_BLOCK_H
+#define CS_BLOCK_H
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+#include "cs_tbldefs.h"
+#include "cs_jobs.h"
+
+/**************************************************************************
+ **
+ ** Function prototypes
+ **
+ **************************************************************************/
+
+/**
+ * \brief Initializes the block results table
+ *
+ *  \par Description
+ *       Registers the dump-only block results table with Table Services
+ *       and clears it, then has Table Services notify CS when the table
+ *       needs managing.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called before the EEPROM and Memory tables are initialized.  If the
+ *       table cannot be registered, entries are checksummed without block
+ *       trees.
+ */
+void CS_BlockTreeInit(void);
+
+/**
+ * \brief Manages the block results table
+ *
+ *  \par Description
+ *       Releases the block results table, lets Table Services do any
+ *       pending dump of it and takes its address again.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Does nothing if the table is unavailable.  Not called while an
+ *       EEPROM or Memory recompute may be using the block trees.
+ */
+void CS_BlockTreeManage(void);
+
+/**
+ * \brief Number of nodes a block tree needs
+ *
+ *  \param [in] NumLeaves  Number of leaf blocks in the entry
+ *
+ * \return Nodes for the leaves of a pass plus the baseline tree
+ */
+uint32 CS_BlockTreeNumNodes(uint32 NumLeaves);
+
+/**
+ * \brief Assigns block trees to the entries of a new EEPROM or Memory table
+ *
+ *  \par Description
+ *       Frees the trees of the table's previous entries, then assigns a
+ *       tree to each entry whose definition requests one, from the trees
+ *       and nodes left free by the other table.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The results entries have already been reset from the definition
+ *       table, so each new tree starts without a baseline.
+ *
+ *  \param [in]     Table             #CS_EEPROM_TABLE or #CS_MEMORY_TABLE
+ *  \param [in]     DefinitionTblPtr  The new definition table
+ *  \param [in,out] ResultsTblPtr     The results table to assign trees in
+ *  \param [in]     NumEntries        The number of entries in the tables
+ */
+void CS_BlockTreeAllocate(uint16 Table, const CS_Def_EepromMemory_Table_Entry_t *DefinitionTblPtr,
+                          CS_Res_EepromMemory_Table_Entry_t *ResultsTblPtr, uint16 NumEntries);
+
+/**
+ * \brief Adds the bytes checksummed this cycle to an entry's block tree
+ *
+ *  \par Description
+ *       Computes the leaf CRCs covering the bytes.  While the entry has no
+ *       baseline the leaves become the baseline tree, otherwise they are
+ *       compared to it and each leaf that differs is counted.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Does nothing for entries without a block tree.  Called before the
+ *       entry's ComputedYet flag is set for the cycle that finishes it.
+ *
+ *  \param [in] ResultsEntry  The entry being checksummed
+ *  \param [in] Offset        Offset into the entry of the first byte
+ *  \param [in] Length        Number of bytes checksummed this cycle
+ */
+void CS_BlockTreeUpdate(const CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint32 Offset, uint32 Length);
+
+/**
+ * \brief Reports the leaf blocks of an entry that miscompared
+ *
+ *  \par Description
+ *       Sends an event with the number of leaves that miscompared in the
+ *       pass that just finished and the address of the first one.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Does nothing for entries without a block tree or without failed
+ *       leaves.
+ *
+ *  \param [in] ResultsEntry  The entry that miscompared
+ */
+void CS_BlockTreeReportMiscompare(const CS_Res_EepromMemory_Table_Entry_t *ResultsEntry);
+
+/**
+ * \brief Drops the leaves of the current pass of block trees
+ *
+ *  \par Description
+ *       Marks the leaves of the last pass of the matching trees as stale
+ *       and stops any pass in progress from adding to them, so only a pass
+ *       started afterwards can stand in for the entry's memory.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called when a recompute of the entries is queued.  Does nothing
+ *       for entries without a block tree.
+ *
+ *  \param [in] Table       #CS_EEPROM_TABLE or #CS_MEMORY_TABLE
+ *  \param [in] EntryID     The entry whose tree is dropped
+ *  \param [in] AllEntries  Drop the trees of every entry of the table
+ */
+void CS_BlockTreeInvalidate(uint16 Table, uint16 EntryID, bool AllEntries);
+
+/**
+ * \brief Recomputes an entry's baseline from its block tree
+ *
+ *  \par Description
+ *       Replaces the baseline of every leaf that differs, updates their
+ *       paths to the root, and combines the baseline leaves into the
+ *       entry's new baseline checksum.  The leaves of the last pass are
+ *       used if it was started after the recompute was queued, otherwise
+ *       every leaf is checksummed again.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only possible when the tree has a baseline and the entry's
+ *       algorithm is the CRC the tree is built with.  Called from a
+ *       recompute job, whose rate the reverifying is paced to and which
+ *       records the number of blocks rehashed for #CS_JobsDrain to report.
+ *
+ *  \param [in,out] ResultsEntry     The entry to recompute
+ *  \param [out]    ComputedCSValue  The new baseline's 32-bit summary
+ *  \param [in,out] Job              The recompute job
+ *
+ * \return true if the baseline was recomputed, false if the whole entry
+ *         must be checksummed instead
+ */
+bool CS_BlockTreeRecompute(CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, CS_Job_t *Job);
+
+#endif
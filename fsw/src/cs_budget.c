@@ -0,0 +1,418 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   The CFS Checksum (CS) Application's background cycle time budget
+ */
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+#include "cs_app.h"
+#include <string.h>
+#include "cs_events.h"
+#include "cs_algorithm.h"
+#include "cs_worker.h"
+#include "cs_budget.h"
+
+/**************************************************************************
+ **
+ ** Functions
+ **
+ **************************************************************************/
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that limits what jobs may take of a cycle's budget  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CS_BudgetJobShare(uint32 Limit, uint32 Used)
+{
+    uint32 MaxShare = Limit - (uint32)(((uint64)Limit * CS_BKGND_MIN_SHARE) / 100);
+
+    return ((Used < MaxShare) ? Used : MaxShare);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that yields the CPU once the main task has          */
+/* checksummed for the yield interval                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_BudgetYieldPoint(void)
+{
+    uint64 Now     = CS_BudgetGetTime();
+    uint64 Resumed = 0;
+
+    if (Now - CS_AppData.Budget.RunStart >= CS_AppData.Budget.YieldInterval)
+    {
+        OS_TaskDelay(0);
+
+        /* Only CS's own checksumming counts against the cycle's time budget */
+        Resumed = CS_BudgetGetTime();
+        CS_AppData.Budget.CycleStart += Resumed - Now;
+        CS_AppData.Budget.RunStart = Resumed;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that picks how many tasks share each chunk          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CS_BudgetLanes(uint16 AlgorithmId, const CS_ChecksumContext_t *Context, uint32 *LaneBytes,
+                             bool FixedChunks, bool UseWorkerPool)
+{
+    uint32 Lanes = (UseWorkerPool ? CS_WorkerPoolLanes() : 1);
+    uint32 Bytes = *LaneBytes;
+
+    /* Fixed size chunks grow until the pool can stripe them */
+    if (Lanes > 1 && FixedChunks && (size_t)Bytes * Lanes < CS_WORKER_MIN_STRIPED_LENGTH)
+    {
+        Bytes = (uint32)((CS_WORKER_MIN_STRIPED_LENGTH + Lanes - 1) / Lanes);
+    }
+
+    /* A chunk the pool would not stripe, including one of an algorithm
+     * that cannot be combined, takes the calling task alone */
+    if (Lanes > 1 && CS_WorkerPoolStripes(AlgorithmId, Context, (size_t)Bytes * Lanes))
+    {
+        *LaneBytes = Bytes;
+    }
+    else
+    {
+        Lanes = 1;
+    }
+
+    return Lanes;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that checksums a chunk a block at a time            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CS_BudgetChecksumBlocks(uint16 AlgorithmId, CS_ChecksumContext_t *Context, cpuaddr Address,
+                                      uint32 Length, uint32 Lanes, bool UseWorkerPool, bool Streaming, bool Yield)
+{
+    uint32 BlockSize = Length;
+    uint32 Offset    = 0;
+    uint32 Block     = 0;
+    uint32 Charge    = 0;
+    bool   Striped   = false;
+
+    if (Yield)
+    {
+        BlockSize = CS_YIELD_BLOCK_SIZE * Lanes;
+
+        /* The blocks of a striped chunk stay long enough to be striped */
+        if (Lanes > 1 && BlockSize < CS_WORKER_MIN_STRIPED_LENGTH)
+        {
+            BlockSize = (uint32)CS_WORKER_MIN_STRIPED_LENGTH;
+        }
+    }
+
+    /* The context carries the partial checksum from one block to the next */
+    do
+    {
+        Block   = (((Length - Offset) < BlockSize) ? (Length - Offset) : BlockSize);
+        Striped = false;
+
+        if (UseWorkerPool)
+        {
+            Striped =
+                CS_WorkerPoolChecksumUpdate(AlgorithmId, Context, (void *)(Address + Offset), Block, Streaming);
+        }
+        else if (Streaming)
+        {
+            CS_ChecksumUpdateStreaming(AlgorithmId, Context, (void *)(Address + Offset), Block);
+        }
+        else
+        {
+            CS_ChecksumUpdate(AlgorithmId, Context, (void *)(Address + Offset), Block);
+        }
+
+        /* Each lane of a striped block did its share at the same time */
+        Charge += (Striped ? (Block + Lanes - 1) / Lanes : Block);
+        Offset += Block;
+
+        if (Yield)
+        {
+            CS_BudgetYieldPoint();
+        }
+    } while (Offset < Length);
+
+    return Charge;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that initializes the background time budget         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_BudgetInit(void)
+{
+    memset(&CS_AppData.Budget, 0, sizeof(CS_AppData.Budget));
+
+    CS_AppData.HkPacket.Payload.TimeBudget       = CS_DEFAULT_TIME_BUDGET;
+    CS_AppData.HkPacket.Payload.TargetPassPeriod = CS_DEFAULT_TARGET_PASS_PERIOD;
+    CS_AppData.HkPacket.Payload.LastPassTime     = 0;
+
+    CS_AppData.Budget.YieldInterval = CS_DEFAULT_YIELD_INTERVAL;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that reads the PSP timebase in microseconds         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint64 CS_BudgetGetTime(void)
+{
+    uint32 Tbu            = 0;
+    uint32 Tbl            = 0;
+    uint32 TicksPerSecond = CFE_PSP_GetTimerTicksPerSecond();
+    uint64 Ticks          = 0;
+    uint64 Time           = 0;
+
+    if (TicksPerSecond != 0)
+    {
+        CFE_PSP_Get_Timebase(&Tbu, &Tbl);
+        Ticks = ((uint64)Tbu << 32) | Tbl;
+
+        /* Split so the multiply cannot overflow however long the timebase has been running */
+        Time = ((Ticks / TicksPerSecond) * 1000000) + (((Ticks % TicksPerSecond) * 1000000) / TicksPerSecond);
+    }
+
+    return Time;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that starts timing a background cycle               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_BudgetStartCycle(void)
+{
+    uint32 JobBytes = 0;
+    uint32 JobTime  = 0;
+
+    CS_JobsCollectCharges(&JobBytes, &JobTime);
+
+    CS_AppData.Budget.CycleStart = CS_BudgetGetTime();
+    CS_AppData.Budget.RunStart   = CS_AppData.Budget.CycleStart;
+    CS_AppData.Budget.BytesLeft =
+        CS_AppData.MaxBytesPerCycle - CS_BudgetJobShare(CS_AppData.MaxBytesPerCycle, JobBytes);
+    CS_AppData.Budget.JobTime = CS_BudgetJobShare(CS_AppData.HkPacket.Payload.TimeBudget, JobTime);
+
+    if (!CS_AppData.Budget.PassTimed)
+    {
+        CS_AppData.Budget.PassStart = CS_AppData.Budget.CycleStart;
+        CS_AppData.Budget.PassTimed = true;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that checks whether the background cycle's budget   */
+/* is used up                                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_BudgetCycleSpent(void)
+{
+    uint32 TimeBudget = CS_AppData.HkPacket.Payload.TimeBudget;
+    bool   Spent      = false;
+
+    if (TimeBudget != 0)
+    {
+        /* The time budget may have been changed during the cycle, so the jobs' share is added rather than taken off */
+        Spent = ((CS_BudgetGetTime() - CS_AppData.Budget.CycleStart) + CS_AppData.Budget.JobTime >= TimeBudget);
+    }
+    else
+    {
+        Spent = (CS_AppData.Budget.BytesLeft == 0);
+    }
+
+    return Spent;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that checksums as much of an entry as the budget    */
+/* allows                                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 CS_BudgetChecksumUpdate(uint16 AlgorithmId, CS_ChecksumContext_t *Context, cpuaddr Address, uint32 DataLength,
+                               uint32 MaxBytes, bool UseWorkerPool, bool Streaming, CS_Job_t *Job)
+{
+    uint32 TimeBudget = CS_AppData.HkPacket.Payload.TimeBudget;
+    uint32 LaneBytes  = MaxBytes;
+    uint32 ChunkSize  = 0;
+    uint32 Limit      = DataLength;
+    uint32 NumBytes   = 0;
+    uint32 Chunk      = 0;
+    uint32 Charge     = 0;
+    uint32 Lanes      = 1;
+    uint64 Start      = 0;
+    bool   InCycle    = (Job == NULL);
+    bool   Done       = false;
+
+    if (!InCycle || TimeBudget != 0)
+    {
+        LaneBytes = CS_TIME_BUDGET_CHUNK_SIZE;
+    }
+    else if (LaneBytes > CS_AppData.Budget.BytesLeft)
+    {
+        /* Earlier entries in this cycle have used part of its bytes */
+        LaneBytes = CS_AppData.Budget.BytesLeft;
+    }
+
+    /* Each task in the worker pool gets a full chunk, if the pool will stripe it */
+    Lanes     = CS_BudgetLanes(AlgorithmId, Context, &LaneBytes, (!InCycle || TimeBudget != 0), UseWorkerPool);
+    ChunkSize = LaneBytes * Lanes;
+
+    /* Job tasks are not part of the background cycle, they pace each chunk with the job's token bucket */
+    if (!InCycle)
+    {
+        TimeBudget = 0;
+
+        /* A grown chunk is not cut short by the job's byte limit */
+        if (Lanes > 1 && MaxBytes < LaneBytes)
+        {
+            MaxBytes = LaneBytes;
+        }
+
+        if (MaxBytes * Lanes < DataLength)
+        {
+            Limit = MaxBytes * Lanes;
+        }
+    }
+
+    while (!Done)
+    {
+        Chunk = (((Limit - NumBytes) < ChunkSize) ? (Limit - NumBytes) : ChunkSize);
+
+        if (!InCycle)
+        {
+            /* The job is only charged for its checksumming, not for waiting on its token bucket */
+            CS_JobsPace(Job, Chunk);
+            Start = CS_BudgetGetTime();
+        }
+
+        /* Job tasks are held back by their token buckets, so only the main task yields */
+        Charge += CS_BudgetChecksumBlocks(AlgorithmId, Context, Address + NumBytes, Chunk, Lanes, UseWorkerPool,
+                                          Streaming, (InCycle && CS_AppData.Budget.YieldInterval != 0));
+
+        NumBytes += Chunk;
+
+        if (!InCycle)
+        {
+            CS_BudgetJobCharge(Job, Chunk, Start);
+        }
+
+        /* Without a time budget one chunk is the whole cycle, while a job carries on to its byte limit */
+        Done = (NumBytes >= Limit || (InCycle && TimeBudget == 0) ||
+                (TimeBudget != 0 &&
+                 (CS_BudgetGetTime() - CS_AppData.Budget.CycleStart) + CS_AppData.Budget.JobTime >= TimeBudget));
+    }
+
+    if (TimeBudget == 0 && InCycle)
+    {
+        CS_AppData.Budget.BytesLeft -= ((Charge < CS_AppData.Budget.BytesLeft) ? Charge : CS_AppData.Budget.BytesLeft);
+    }
+
+    return NumBytes;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that charges a job for its checksumming             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_BudgetJobCharge(CS_Job_t *Job, uint32 Bytes, uint64 Start)
+{
+    Job->BytesCharged += Bytes;
+    Job->TimeCharged += (uint32)(CS_BudgetGetTime() - Start);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that finishes timing a full background pass and     */
+/* adjusts the time budget toward the target pass period           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_BudgetEndPass(void)
+{
+    uint64 Now        = CS_BudgetGetTime();
+    uint64 PassTime   = 0;
+    uint64 Target     = (uint64)CS_AppData.HkPacket.Payload.TargetPassPeriod * 1000000;
+    uint64 OldBudget  = CS_AppData.HkPacket.Payload.TimeBudget;
+    uint64 NewBudget  = OldBudget;
+    uint64 LastPassMs = 0;
+
+    if (CS_AppData.Budget.PassTimed)
+    {
+        PassTime   = Now - CS_AppData.Budget.PassStart;
+        LastPassMs = PassTime / 1000;
+
+        CS_AppData.HkPacket.Payload.LastPassTime = ((LastPassMs > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32)LastPassMs);
+
+        if (OldBudget != 0 && Target != 0 && PassTime != 0)
+        {
+            /* The number of cycles in a pass is inversely proportional to the budget */
+            if (PassTime >= Target * CS_BUDGET_MAX_ADJUST)
+            {
+                NewBudget = OldBudget * CS_BUDGET_MAX_ADJUST;
+            }
+            else if (PassTime * CS_BUDGET_MAX_ADJUST <= Target)
+            {
+                NewBudget = OldBudget / CS_BUDGET_MAX_ADJUST;
+            }
+            else
+            {
+                NewBudget = (OldBudget * PassTime) / Target;
+            }
+
+            if (NewBudget < CS_MIN_TIME_BUDGET)
+            {
+                NewBudget = CS_MIN_TIME_BUDGET;
+            }
+            else if (NewBudget > CS_MAX_TIME_BUDGET)
+            {
+                NewBudget = CS_MAX_TIME_BUDGET;
+            }
+
+            if (NewBudget != OldBudget)
+            {
+                CS_AppData.HkPacket.Payload.TimeBudget = (uint32)NewBudget;
+
+                CFE_EVS_SendEvent(CS_TIME_BUDGET_ADJ_DBG_EID, CFE_EVS_EventType_DEBUG,
+                                  "Pass took %u ms, time budget adjusted from %u to %u usec",
+                                  (unsigned int)CS_AppData.HkPacket.Payload.LastPassTime, (unsigned int)OldBudget,
+                                  (unsigned int)NewBudget);
+            }
+        }
+    }
+
+    /* The next pass starts now, whether or not a cycle is running */
+    CS_AppData.Budget.PassStart = Now;
+    CS_AppData.Budget.PassTimed = true;
+}
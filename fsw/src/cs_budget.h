@@ -0,0 +1,211 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Background cycle time budget for the CFS Checksum (CS) Application
+ */
+#ifndef CS_BUDGET_H
+#define CS_BUDGET_H
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+#include "cs_tbldefs.h"
+#include "cs_jobs.h"
+
+/**************************************************************************
+ **
+ ** Macro definitions
+ **
+ **************************************************************************/
+
+/**
+ * \brief Largest factor the time budget changes by at the end of a pass
+ *
+ * \par Description
+ *      Damps the adjustment toward the target pass period so one unusual
+ *      pass, such as one slowed by a recompute, cannot swing the budget
+ *      from one limit to the other.
+ */
+#define CS_BUDGET_MAX_ADJUST 2
+
+/**************************************************************************
+ **
+ ** Type definitions
+ **
+ **************************************************************************/
+
+/**
+ *  \brief CS background time budget state
+ *
+ *  Times are microseconds since an arbitrary point, from #CS_BudgetGetTime.
+ */
+typedef struct
+{
+    uint64 CycleStart;    /**< \brief Time the current background cycle started, moved on by time spent yielded */
+    uint64 PassStart;     /**< \brief Time the current full pass started */
+    bool   PassTimed;     /**< \brief true once PassStart is set for the current pass */
+    uint32 BytesLeft;     /**< \brief Bytes left in the current background cycle's byte limit */
+    uint32 JobTime;       /**< \brief Microseconds of the current cycle's time budget used by jobs */
+    uint32 YieldInterval; /**< \brief Microseconds of checksumming between yields, 0 to never yield */
+    uint64 RunStart;      /**< \brief Time the main task last started or resumed checksumming */
+} CS_Budget_t;
+
+/**************************************************************************
+ **
+ ** Function prototypes
+ **
+ **************************************************************************/
+
+/**
+ * \brief Initializes the background time budget
+ *
+ *  \par Description
+ *       Sets the time budget, target pass period and yield interval to
+ *       their platform defaults and clears the timing state.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once during application initialization.
+ */
+void CS_BudgetInit(void);
+
+/**
+ * \brief Reads the PSP timebase in microseconds
+ *
+ *  \par Description
+ *       Converts the free running PSP timebase to microseconds using the
+ *       PSP timer tick rate.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Returns 0 if the PSP does not report a tick rate, in which case no
+ *       time ever appears to pass.
+ *
+ * \return Microseconds since an arbitrary point
+ */
+uint64 CS_BudgetGetTime(void);
+
+/**
+ * \brief Starts timing a background cycle
+ *
+ *  \par Description
+ *       Records the start of the background cycle, and of the full pass
+ *       if this is the first cycle of the pass, and gives the cycle
+ *       #CS_AppData_t::MaxBytesPerCycle bytes to spend.  The bytes and time
+ *       the job tasks have used since the last cycle are taken off the
+ *       cycle's byte limit and time budget, leaving background checking
+ *       at least #CS_BKGND_MIN_SHARE percent of each.
+ */
+void CS_BudgetStartCycle(void);
+
+/**
+ * \brief Checks whether the background cycle's budget is used up
+ *
+ *  \par Description
+ *       With a time budget, the cycle is over once what is left of the
+ *       time budget after the jobs' share has passed since
+ *       #CS_BudgetStartCycle.  Without one, the cycle is over
+ *       once all of its bytes have been checksummed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The background functions use this to carry on to the next entry,
+ *       or the next table, with what is left of the cycle.
+ *
+ *  \return Boolean cycle over response
+ *  \retval true  Nothing is left of the cycle's budget
+ *  \retval false There is budget left for more entries
+ */
+bool CS_BudgetCycleSpent(void);
+
+/**
+ * \brief Adds the next part of an entry to its checksum within the cycle's budget
+ *
+ *  \par Description
+ *       Without a time budget, adds up to MaxBytes bytes to the checksum,
+ *       and no more than the bytes left in the cycle, which are reduced by
+ *       the bytes added.  With a time budget, adds #CS_TIME_BUDGET_CHUNK_SIZE
+ *       byte chunks until the cycle's time budget is spent or DataLength
+ *       bytes are done.  At least one chunk is always done so every cycle
+ *       makes progress.  With a yield interval, the chunks are checksummed
+ *       in #CS_YIELD_BLOCK_SIZE byte blocks, and the main task yields the
+ *       CPU between blocks once it has checksummed for the yield interval.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       #CS_BudgetStartCycle has been called for this cycle.  A job task
+ *       is not part of a background cycle, so for a job up to MaxBytes
+ *       bytes are added in #CS_TIME_BUDGET_CHUNK_SIZE byte chunks, each
+ *       paced by #CS_JobsPace and charged to the job.  When the worker
+ *       pool will stripe the bytes of all its lanes, each lane gets the
+ *       bytes of one lane, and the cycle is charged each lane's share of
+ *       the striped blocks.  Chunks and yield blocks are then grown to at
+ *       least #CS_WORKER_MIN_STRIPED_LENGTH bytes.
+ *
+ *  \param [in]     AlgorithmId    Algorithm the context was started with
+ *  \param [in,out] Context        Context started by #CS_ChecksumInit
+ *  \param [in]     Address        Address of the first byte to add
+ *  \param [in]     DataLength     Number of bytes left in the entry
+ *  \param [in]     MaxBytes       Byte limit for each worker pool lane
+ *                                 when there is no time budget
+ *  \param [in]     UseWorkerPool  true to use #CS_WorkerPoolChecksumUpdate,
+ *                                 false to use #CS_ChecksumUpdate
+ *  \param [in]     Streaming      true to read the memory with streaming
+ *                                 hints, see #CS_ChecksumUpdateStreaming
+ *  \param [in,out] Job            Job doing the checksum, or NULL for the
+ *                                 background cycle
+ *
+ * \return Number of bytes added to the checksum
+ */
+uint32 CS_BudgetChecksumUpdate(uint16 AlgorithmId, CS_ChecksumContext_t *Context, cpuaddr Address, uint32 DataLength,
+                               uint32 MaxBytes, bool UseWorkerPool, bool Streaming, CS_Job_t *Job);
+
+/**
+ * \brief Charges a job for checksumming it has done
+ *
+ *  \par Description
+ *       Counts up the job's bytes and time, which the next background
+ *       cycle takes off its own budget.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called by the job task running the job.
+ *
+ *  \param [in,out] Job    Job that did the checksumming
+ *  \param [in]     Bytes  Number of bytes checksummed
+ *  \param [in]     Start  #CS_BudgetGetTime when the checksumming started
+ */
+void CS_BudgetJobCharge(CS_Job_t *Job, uint32 Bytes, uint64 Start);
+
+/**
+ * \brief Finishes timing a full background pass
+ *
+ *  \par Description
+ *       Reports the time the pass took in housekeeping telemetry.  If a
+ *       time budget and a target pass period are both set, scales the time
+ *       budget by the ratio of the pass time to the target, by at most a
+ *       factor of #CS_BUDGET_MAX_ADJUST and within #CS_MIN_TIME_BUDGET and
+ *       #CS_MAX_TIME_BUDGET.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called whenever the pass counter is incremented.
+ */
+void CS_BudgetEndPass(void);
+
+#endif
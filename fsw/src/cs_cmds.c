@@ -34,6 +34,9 @@
 #include "cs_cmds.h"
 #include "cs_utils.h"
 #include "cs_compute.h"
+#include "cs_budget.h"
+#include "cs_sched.h"
+#include "cs_jobs.h"
 
 /**************************************************************************
  **
@@ -70,6 +73,8 @@ void CS_ResetCmd(const CS_NoArgsCmd_t *CmdPtr)
     CS_AppData.HkPacket.Payload.AppCSErrCounter     = 0;
     CS_AppData.HkPacket.Payload.CfeCoreCSErrCounter = 0;
     CS_AppData.HkPacket.Payload.OSCSErrCounter      = 0;
+    CS_AppData.HkPacket.Payload.BitErrorCounter     = 0;
+    CS_AppData.HkPacket.Payload.DeadlineMissCounter = 0;
     CS_AppData.HkPacket.Payload.PassCounter         = 0;
 
     CFE_EVS_SendEvent(CS_RESET_INF_EID, CFE_EVS_EventType_DEBUG, "Reset Counters command recieved");
@@ -105,20 +110,16 @@ void CS_BackgroundCheckCycle(const CS_NoArgsCmd_t *CmdPtr)
     }
     else
     {
+        /* Finished recomputes must be reported before the background cycle looks for the entries they own */
+        CS_JobsDrain();
+
         if (CS_AppData.HkPacket.Payload.ChecksumState == CS_STATE_ENABLED)
         {
             DoneWithCycle = false;
             EndOfList     = false;
 
-            /* Skip this background cycle if there's a recompute or one shot in
-             * progress */
-            if (CS_AppData.HkPacket.Payload.RecomputeInProgress == true ||
-                CS_AppData.HkPacket.Payload.OneShotInProgress == true)
-            {
-                CFE_EVS_SendEvent(CS_BKGND_COMPUTE_PROG_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                  "Skipping background cycle. Recompute or oneshot in progress.");
-                DoneWithCycle = true;
-            }
+            /* Recompute and OneShot jobs share the cycle's budget rather than stopping it */
+            CS_BudgetStartCycle();
 
             /* We check for end-of-list because we don't necessarily know the
                order in which the table entries are defined, and we don't
@@ -126,6 +127,9 @@ void CS_BackgroundCheckCycle(const CS_NoArgsCmd_t *CmdPtr)
 
             while ((DoneWithCycle != true) && (EndOfList != true))
             {
+                /* A table type due by its revisit period goes ahead of the round robin */
+                CS_SchedSelectTable();
+
                 /* We need to check the current table value here because
                    it is updated (and possibly reset to zero) inside each
                    function called */
@@ -171,6 +175,7 @@ void CS_BackgroundCheckCycle(const CS_NoArgsCmd_t *CmdPtr)
                         CS_AppData.HkPacket.Payload.CurrentCSTable      = 0;
                         CS_AppData.HkPacket.Payload.CurrentEntryInTable = 0;
                         CS_AppData.HkPacket.Payload.PassCounter++;
+                        CS_BudgetEndPass();
                         DoneWithCycle = true;
                         break;
 
@@ -346,44 +351,17 @@ void CS_ReportBaselineOSCmd(const CS_NoArgsCmd_t *CmdPtr)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CS_RecomputeBaselineCfeCoreCmd(const CS_NoArgsCmd_t *CmdPtr)
 {
-    /* command verification variables */
-    CFE_ES_TaskId_t ChildTaskID;
-    CFE_Status_t    Status;
-
-    if (CS_AppData.HkPacket.Payload.RecomputeInProgress == false &&
-        CS_AppData.HkPacket.Payload.OneShotInProgress == false)
+    if (CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE, CS_CFECORE, 0))
     {
-        /* There is no child task running right now, we can use it*/
-        CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
-
-        /* fill in child task variables */
-        CS_AppData.ChildTaskTable                = CS_CFECORE;
-        CS_AppData.ChildTaskEntryID              = 0;
-        CS_AppData.RecomputeEepromMemoryEntryPtr = &CS_AppData.CfeCoreCodeSeg;
-
-        Status = CFE_ES_CreateChildTask(&ChildTaskID, CS_RECOMP_CFECORE_TASK_NAME, CS_RecomputeEepromMemoryChildTask,
-                                        NULL, CFE_PLATFORM_ES_DEFAULT_STACK_SIZE, CS_CHILD_TASK_PRIORITY, 0);
-
-        if (Status == CFE_SUCCESS)
-        {
-            CFE_EVS_SendEvent(CS_RECOMPUTE_CFECORE_STARTED_DBG_EID, CFE_EVS_EventType_DEBUG,
-                              "Recompute of cFE core started");
-            CS_AppData.HkPacket.Payload.CmdCounter++;
-        }
-        else /* child task creation failed */
-        {
-            CFE_EVS_SendEvent(CS_RECOMPUTE_CFECORE_CREATE_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Recompute cFE core failed, CFE_ES_CreateChildTask returned: 0x%08X",
-                              (unsigned int)Status);
-            CS_AppData.HkPacket.Payload.CmdErrCounter++;
-            CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
-        }
+        CFE_EVS_SendEvent(CS_RECOMPUTE_CFECORE_STARTED_DBG_EID, CFE_EVS_EventType_DEBUG,
+                          "Recompute of cFE core started");
+        CS_AppData.HkPacket.Payload.CmdCounter++;
     }
     else
     {
-        /*send event that we can't start another task right now */
+        /*send event that we can't queue another job right now */
         CFE_EVS_SendEvent(CS_RECOMPUTE_CFECORE_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "Recompute cFE core failed: child task in use");
+                          "Recompute cFE core failed: job queue full or recompute already queued");
         CS_AppData.HkPacket.Payload.CmdErrCounter++;
     }
 }
@@ -395,43 +373,17 @@ void CS_RecomputeBaselineCfeCoreCmd(const CS_NoArgsCmd_t *CmdPtr)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CS_RecomputeBaselineOSCmd(const CS_NoArgsCmd_t *CmdPtr)
 {
-    /* command verification variables */
-    CFE_ES_TaskId_t ChildTaskID;
-    CFE_Status_t    Status;
-
-    if (CS_AppData.HkPacket.Payload.RecomputeInProgress == false &&
-        CS_AppData.HkPacket.Payload.OneShotInProgress == false)
+    if (CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE, CS_OSCORE, 0))
     {
-        /* There is no child task running right now, we can use it*/
-        CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
-
-        /* fill in child task variables */
-        CS_AppData.ChildTaskTable                = CS_OSCORE;
-        CS_AppData.ChildTaskEntryID              = 0;
-        CS_AppData.RecomputeEepromMemoryEntryPtr = &CS_AppData.OSCodeSeg;
-
-        Status = CFE_ES_CreateChildTask(&ChildTaskID, CS_RECOMP_OS_TASK_NAME, CS_RecomputeEepromMemoryChildTask, NULL,
-                                        CFE_PLATFORM_ES_DEFAULT_STACK_SIZE, CS_CHILD_TASK_PRIORITY, 0);
-        if (Status == CFE_SUCCESS)
-        {
-            CFE_EVS_SendEvent(CS_RECOMPUTE_OS_STARTED_DBG_EID, CFE_EVS_EventType_DEBUG,
-                              "Recompute of OS code segment started");
-            CS_AppData.HkPacket.Payload.CmdCounter++;
-        }
-        else /* child task creation failed */
-        {
-            CFE_EVS_SendEvent(CS_RECOMPUTE_OS_CREATE_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Recompute OS code segment failed, CFE_ES_CreateChildTask returned: 0x%08X",
-                              (unsigned int)Status);
-            CS_AppData.HkPacket.Payload.CmdErrCounter++;
-            CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
-        }
+        CFE_EVS_SendEvent(CS_RECOMPUTE_OS_STARTED_DBG_EID, CFE_EVS_EventType_DEBUG,
+                          "Recompute of OS code segment started");
+        CS_AppData.HkPacket.Payload.CmdCounter++;
     }
     else
     {
-        /*send event that we can't start another task right now */
+        /*send event that we can't queue another job right now */
         CFE_EVS_SendEvent(CS_RECOMPUTE_OS_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "Recompute OS code segment failed: child task in use");
+                          "Recompute OS code segment failed: job queue full or recompute already queued");
         CS_AppData.HkPacket.Payload.CmdErrCounter++;
     }
 }
@@ -444,61 +396,37 @@ void CS_RecomputeBaselineOSCmd(const CS_NoArgsCmd_t *CmdPtr)
 void CS_OneShotCmd(const CS_OneShotCmd_t *CmdPtr)
 {
     /* command verification variables */
-    CFE_ES_TaskId_t ChildTaskID;
-    CFE_Status_t    Status;
+    CFE_Status_t Status;
+    uint32       MaxBytesPerCycle = CmdPtr->Payload.MaxBytesPerCycle;
 
     /* validate size and address */
     Status = CFE_PSP_MemValidateRange(CmdPtr->Payload.Address, CmdPtr->Payload.Size, CFE_PSP_MEM_ANY);
 
     if (Status == CFE_SUCCESS)
     {
-        if (CS_AppData.HkPacket.Payload.RecomputeInProgress == false &&
-            CS_AppData.HkPacket.Payload.OneShotInProgress == false)
+        if (MaxBytesPerCycle == 0)
         {
-            /* There is no child task running right now, we can use it*/
-            CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
-            CS_AppData.HkPacket.Payload.OneShotInProgress   = true;
+            MaxBytesPerCycle = CS_AppData.MaxBytesPerCycle;
+        }
 
-            CS_AppData.HkPacket.Payload.LastOneShotAddress = CmdPtr->Payload.Address;
-            CS_AppData.HkPacket.Payload.LastOneShotSize    = CmdPtr->Payload.Size;
-            if (CmdPtr->Payload.MaxBytesPerCycle == 0)
-            {
-                CS_AppData.HkPacket.Payload.LastOneShotMaxBytesPerCycle = CS_AppData.MaxBytesPerCycle;
-            }
-            else
-            {
-                CS_AppData.HkPacket.Payload.LastOneShotMaxBytesPerCycle = CmdPtr->Payload.MaxBytesPerCycle;
-            }
+        if (CS_JobsSubmitOneShot(CmdPtr->Payload.Address, CmdPtr->Payload.Size, MaxBytesPerCycle))
+        {
+            CS_AppData.HkPacket.Payload.LastOneShotAddress          = CmdPtr->Payload.Address;
+            CS_AppData.HkPacket.Payload.LastOneShotSize             = CmdPtr->Payload.Size;
+            CS_AppData.HkPacket.Payload.LastOneShotMaxBytesPerCycle = MaxBytesPerCycle;
+            CS_AppData.HkPacket.Payload.LastOneShotChecksum         = 0;
 
-            CS_AppData.HkPacket.Payload.LastOneShotChecksum = 0;
+            CFE_EVS_SendEvent(CS_ONESHOT_STARTED_DBG_EID, CFE_EVS_EventType_DEBUG,
+                              "OneShot checksum started on address: 0x%08X, size: %d",
+                              (unsigned int)(CmdPtr->Payload.Address), (int)(CmdPtr->Payload.Size));
 
-            Status = CFE_ES_CreateChildTask(&ChildTaskID, CS_ONESHOT_TASK_NAME, CS_OneShotChildTask, NULL,
-                                            CFE_PLATFORM_ES_DEFAULT_STACK_SIZE, CS_CHILD_TASK_PRIORITY, 0);
-            if (Status == CFE_SUCCESS)
-            {
-                CFE_EVS_SendEvent(CS_ONESHOT_STARTED_DBG_EID, CFE_EVS_EventType_DEBUG,
-                                  "OneShot checksum started on address: 0x%08X, size: %d",
-                                  (unsigned int)(CmdPtr->Payload.Address), (int)(CmdPtr->Payload.Size));
-
-                CS_AppData.ChildTaskID = ChildTaskID;
-                CS_AppData.HkPacket.Payload.CmdCounter++;
-            }
-            else /* child task creation failed */
-            {
-                CFE_EVS_SendEvent(CS_ONESHOT_CREATE_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "OneShot checkum failed, CFE_ES_CreateChildTask returned: 0x%08X",
-                                  (unsigned int)Status);
-
-                CS_AppData.HkPacket.Payload.CmdErrCounter++;
-                CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
-                CS_AppData.HkPacket.Payload.OneShotInProgress   = false;
-            }
+            CS_AppData.HkPacket.Payload.CmdCounter++;
         }
         else
         {
-            /*send event that we can't start another task right now */
+            /*send event that we can't queue another job right now */
             CFE_EVS_SendEvent(CS_ONESHOT_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "OneShot checksum failed: child task in use");
+                              "OneShot checksum failed: job queue full");
 
             CS_AppData.HkPacket.Payload.CmdErrCounter++;
         }
@@ -519,31 +447,12 @@ void CS_OneShotCmd(const CS_OneShotCmd_t *CmdPtr)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CS_CancelOneShotCmd(const CS_NoArgsCmd_t *CmdPtr)
 {
-    /* command verification variables */
-    CFE_Status_t Status;
-
-    /* Make sure there is a OneShot command in use */
-    if (CS_AppData.HkPacket.Payload.RecomputeInProgress == false &&
-        CS_AppData.HkPacket.Payload.OneShotInProgress == true)
+    /* Make sure there is a OneShot job to cancel */
+    if (CS_JobsCancelOneShots())
     {
-        Status = CFE_ES_DeleteChildTask(CS_AppData.ChildTaskID);
-
-        if (Status == CFE_SUCCESS)
-        {
-            CS_AppData.ChildTaskID                          = CFE_ES_TASKID_UNDEFINED;
-            CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
-            CS_AppData.HkPacket.Payload.OneShotInProgress   = false;
-            CS_AppData.HkPacket.Payload.CmdCounter++;
-            CFE_EVS_SendEvent(CS_ONESHOT_CANCELLED_INF_EID, CFE_EVS_EventType_INFORMATION,
-                              "OneShot checksum calculation has been cancelled");
-        }
-        else
-        {
-            CFE_EVS_SendEvent(CS_ONESHOT_CANCEL_DELETE_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Cancel OneShot checksum failed, CFE_ES_DeleteChildTask returned:  0x%08X",
-                              (unsigned int)Status);
-            CS_AppData.HkPacket.Payload.CmdErrCounter++;
-        }
+        CS_AppData.HkPacket.Payload.CmdCounter++;
+        CFE_EVS_SendEvent(CS_ONESHOT_CANCELLED_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "OneShot checksum calculation has been cancelled");
     }
     else
     {
@@ -552,3 +461,154 @@ void CS_CancelOneShotCmd(const CS_NoArgsCmd_t *CmdPtr)
         CS_AppData.HkPacket.Payload.CmdErrCounter++;
     }
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Set the background time budget command                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_SetTimeBudgetCmd(const CS_SetTimeBudgetCmd_t *CmdPtr)
+{
+    uint32 TimeBudget = CmdPtr->Payload.TimeBudget;
+
+    if (TimeBudget == 0 || (TimeBudget >= CS_MIN_TIME_BUDGET && TimeBudget <= CS_MAX_TIME_BUDGET))
+    {
+        CS_AppData.HkPacket.Payload.TimeBudget       = TimeBudget;
+        CS_AppData.HkPacket.Payload.TargetPassPeriod = CmdPtr->Payload.TargetPassPeriod;
+
+        /* Time the next pass from its first cycle under the new budget */
+        CS_AppData.Budget.PassTimed = false;
+
+        CFE_EVS_SendEvent(CS_SET_TIME_BUDGET_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Time budget set to %u usec, target pass period %u seconds", (unsigned int)TimeBudget,
+                          (unsigned int)CmdPtr->Payload.TargetPassPeriod);
+
+        CS_AppData.HkPacket.Payload.CmdCounter++;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(CS_SET_TIME_BUDGET_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Set time budget failed, budget %u usec is not 0 or in %u to %u",
+                          (unsigned int)TimeBudget, (unsigned int)CS_MIN_TIME_BUDGET,
+                          (unsigned int)CS_MAX_TIME_BUDGET);
+
+        CS_AppData.HkPacket.Payload.CmdErrCounter++;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Set a table type's revisit period command                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_SetRevisitPeriodCmd(const CS_SetRevisitPeriodCmd_t *CmdPtr)
+{
+    uint16 Table = CmdPtr->Payload.Table;
+
+    if (Table < CS_NUM_TABLES)
+    {
+        CS_AppData.Sched.RevisitPeriod[Table] = CmdPtr->Payload.RevisitPeriod;
+
+        /* Sweep under the new period straight away rather than at the old deadline */
+        CS_AppData.Sched.Deadline[Table] = 0;
+
+        CFE_EVS_SendEvent(CS_SET_REVISIT_PERIOD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Revisit period of table type %d set to %u seconds", Table,
+                          (unsigned int)CmdPtr->Payload.RevisitPeriod);
+
+        CS_AppData.HkPacket.Payload.CmdCounter++;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(CS_SET_REVISIT_PERIOD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Set revisit period failed, table type %d is not 0 to %d", Table, CS_NUM_TABLES - 1);
+
+        CS_AppData.HkPacket.Payload.CmdErrCounter++;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Set the job rate command                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_SetJobRateCmd(const CS_SetJobRateCmd_t *CmdPtr)
+{
+    uint32 BytesPerSecond = CmdPtr->Payload.BytesPerSecond;
+    uint32 BurstBytes     = CmdPtr->Payload.BurstBytes;
+
+    if (BytesPerSecond == 0 || BurstBytes != 0)
+    {
+        CS_AppData.HkPacket.Payload.JobRate  = BytesPerSecond;
+        CS_AppData.HkPacket.Payload.JobBurst = BurstBytes;
+
+        CFE_EVS_SendEvent(CS_SET_JOB_RATE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Job rate set to %u bytes per second, burst %u bytes", (unsigned int)BytesPerSecond,
+                          (unsigned int)BurstBytes);
+
+        CS_AppData.HkPacket.Payload.CmdCounter++;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(CS_SET_JOB_RATE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Set job rate failed, burst cannot be 0 with a rate of %u bytes per second",
+                          (unsigned int)BytesPerSecond);
+
+        CS_AppData.HkPacket.Payload.CmdErrCounter++;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Manage table command                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_ManageTableCmd(const CS_ManageTableCmd_t *CmdPtr)
+{
+    uint32 Table = CmdPtr->Payload.Parameter;
+
+    if (Table == CS_EEPROM_TABLE || Table == CS_MEMORY_TABLE || Table == CS_TABLES_TABLE || Table == CS_APP_TABLE ||
+        Table == CS_BLOCK_TABLE)
+    {
+        CS_AppData.TableManagePending |= CS_TABLE_BIT(Table);
+
+        /* Failures disable the table type and send their own events */
+        CS_HandleRoutineTableUpdates();
+    }
+    else
+    {
+        CFE_EVS_SendEvent(CS_MANAGE_TABLE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Manage table failed, table type %u is not a CS table", (unsigned int)Table);
+
+        CS_AppData.HkPacket.Payload.CmdErrCounter++;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Recompute all baselines in a table command                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_RecomputeAllCmd(const CS_RecomputeAllCmd_t *CmdPtr)
+{
+    uint16 Table = CmdPtr->Payload.Table;
+
+    if (Table >= CS_NUM_TABLES)
+    {
+        CFE_EVS_SendEvent(CS_RECOMPUTE_ALL_INVALID_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Recompute all failed, table type %d is not 0 to %d", Table, CS_NUM_TABLES - 1);
+        CS_AppData.HkPacket.Payload.CmdErrCounter++;
+    }
+    else if (CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE_ALL, Table, 0))
+    {
+        CFE_EVS_SendEvent(CS_RECOMPUTE_ALL_STARTED_DBG_EID, CFE_EVS_EventType_DEBUG,
+                          "Recompute of all entries of table type %d started", Table);
+        CS_AppData.HkPacket.Payload.CmdCounter++;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(CS_RECOMPUTE_ALL_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Recompute all of table type %d failed: job queue full or recompute already queued", Table);
+        CS_AppData.HkPacket.Payload.CmdErrCounter++;
+    }
+}
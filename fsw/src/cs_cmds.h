@@ -278,4 +278,87 @@ void CS_OneShotCmd(const CS_OneShotCmd_t *CmdPtr);
  */
 void CS_CancelOneShotCmd(const CS_NoArgsCmd_t *CmdPtr);
 
+/**
+ * \brief Process a set time budget command
+ *
+ *  \par Description
+ *        Sets the time budget for each background cycle and the
+ *        target period for a full background pass.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        A time budget of 0 returns to limiting each cycle by bytes.
+ *
+ *  \param[in] CmdPtr Command pointer, verified non-null in CS_AppMain
+ *
+ *  \sa #CS_SET_TIME_BUDGET_CC
+ */
+void CS_SetTimeBudgetCmd(const CS_SetTimeBudgetCmd_t *CmdPtr);
+
+/**
+ * \brief Process a set revisit period command
+ *
+ *  \par Description
+ *        Sets the seconds allowed between background checks of each
+ *        entry of a table type.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The table type's next sweep is due straight away.
+ *
+ *  \param[in] CmdPtr Command pointer, verified non-null in CS_AppMain
+ *
+ *  \sa #CS_SET_REVISIT_PERIOD_CC
+ */
+void CS_SetRevisitPeriodCmd(const CS_SetRevisitPeriodCmd_t *CmdPtr);
+
+/**
+ * \brief Process a set job rate command
+ *
+ *  \par Description
+ *        Sets the rate and burst size of the token bucket that paces
+ *        each recompute and OneShot job.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        Only jobs queued afterwards take the new rate.  A rate of 0 runs
+ *        jobs without delays at #CS_JOB_LOW_PRIORITY.
+ *
+ *  \param[in] CmdPtr Command pointer, verified non-null in CS_AppMain
+ *
+ *  \sa #CS_SET_JOB_RATE_CC
+ */
+void CS_SetJobRateCmd(const CS_SetJobRateCmd_t *CmdPtr);
+
+/**
+ * \brief Process a manage table command
+ *
+ *  \par Description
+ *        Manages one of the CS tables after Table Services notifies CS
+ *        that a load, validation or dump of it is pending.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        A table with a recompute running is managed at the first
+ *        housekeeping request after the recompute finishes.
+ *
+ *  \param[in] CmdPtr Command pointer, verified non-null in CS_AppMain
+ *
+ *  \sa #CS_MANAGE_TABLE_CC
+ */
+void CS_ManageTableCmd(const CS_ManageTableCmd_t *CmdPtr);
+
+/**
+ * \brief Process a recompute all baselines command
+ *
+ *  \par Description
+ *        Queues one job that recomputes the baseline of every entry of a
+ *        table type.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        Rejected while another recompute of the table type is queued or
+ *        running.
+ *
+ *  \param[in] CmdPtr Command pointer, verified non-null in CS_AppMain
+ *
+ *  \sa #CS_RECOMPUTE_ALL_CC
+ */
+void CS_RecomputeAllCmd(const CS_RecomputeAllCmd_t *CmdPtr);
+
 #endif
@@ -33,6 +33,11 @@
 #include "cs_events.h"
 #include "cs_compute.h"
 #include "cs_utils.h"
+#include "cs_crc.h"
+#include "cs_algorithm.h"
+#include "cs_budget.h"
+#include "cs_block.h"
+#include "cs_jobs.h"
 /**************************************************************************
  **
  ** Functions
@@ -46,7 +51,7 @@
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 CFE_Status_t CS_ComputeEepromMemory(CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue,
-                                    bool *DoneWithEntry)
+                                    bool *DoneWithEntry, CS_Job_t *Job)
 {
     uint32       OffsetIntoCurrEntry     = 0;
     cpuaddr      FirstAddrThisCycle      = 0;
@@ -54,7 +59,8 @@ CFE_Status_t CS_ComputeEepromMemory(CS_Res_EepromMemory_Table_Entry_t *ResultsEn
     int32        NumBytesRemainingCycles = 0;
     uint32       NewChecksumValue        = 0;
     CFE_Status_t Status                  = CFE_SUCCESS;
-    *DoneWithEntry                       = false;
+    CS_Digest_t  NewDigest;
+    *DoneWithEntry = false;
 
     /* By the time we get here, we know we have an enabled entry */
 
@@ -62,25 +68,34 @@ CFE_Status_t CS_ComputeEepromMemory(CS_Res_EepromMemory_Table_Entry_t *ResultsEn
     FirstAddrThisCycle      = ResultsEntry->StartAddress + OffsetIntoCurrEntry;
     NumBytesRemainingCycles = ResultsEntry->NumBytesToChecksum - OffsetIntoCurrEntry;
 
-    NumBytesThisCycle = ((CS_AppData.MaxBytesPerCycle < NumBytesRemainingCycles) ? CS_AppData.MaxBytesPerCycle
-                                                                                 : NumBytesRemainingCycles);
+    if (OffsetIntoCurrEntry == 0)
+    {
+        CS_ChecksumInit(ResultsEntry->Algorithm, &ResultsEntry->TempChecksumContext);
+    }
 
-    NewChecksumValue = CFE_ES_CalculateCRC((void *)(FirstAddrThisCycle), NumBytesThisCycle,
-                                           ResultsEntry->TempChecksumValue, CS_DEFAULT_ALGORITHM);
+    NumBytesThisCycle =
+        CS_BudgetChecksumUpdate(ResultsEntry->Algorithm, &ResultsEntry->TempChecksumContext, FirstAddrThisCycle,
+                                NumBytesRemainingCycles, CS_AppData.MaxBytesPerCycle, true,
+                                (ResultsEntry->Streaming == true), Job);
 
     NumBytesRemainingCycles -= NumBytesThisCycle;
 
+    CS_BlockTreeUpdate(ResultsEntry, OffsetIntoCurrEntry, NumBytesThisCycle);
+
     if (NumBytesRemainingCycles <= 0)
     {
         /* We are finished CS'ing all of the parts for this Entry */
         *DoneWithEntry = true;
 
+        NewChecksumValue =
+            CS_ChecksumFinal(ResultsEntry->Algorithm, &ResultsEntry->TempChecksumContext, &NewDigest);
+
         if (ResultsEntry->ComputedYet == true)
         {
             /* This is NOT the first time through this Entry.
              We have already computed a CS value for this Entry */
 
-            if (NewChecksumValue != ResultsEntry->ComparisonValue)
+            if (memcmp(&NewDigest, &ResultsEntry->ComparisonDigest, sizeof(NewDigest)) != 0)
             {
                 /* If the just-computed value differ from the saved value */
                 Status = CS_ERROR;
@@ -93,30 +108,48 @@ CFE_Status_t CS_ComputeEepromMemory(CS_Res_EepromMemory_Table_Entry_t *ResultsEn
         else
         {
             /* This is the first time through this Entry */
-            ResultsEntry->ComputedYet     = true;
-            ResultsEntry->ComparisonValue = NewChecksumValue;
+            ResultsEntry->ComputedYet      = true;
+            ResultsEntry->ComparisonValue  = NewChecksumValue;
+            ResultsEntry->ComparisonDigest = NewDigest;
         }
 
-        *ComputedCSValue                = NewChecksumValue;
-        ResultsEntry->ByteOffset        = 0;
-        ResultsEntry->TempChecksumValue = 0;
+        *ComputedCSValue         = NewChecksumValue;
+        ResultsEntry->ByteOffset = 0;
     }
     else
     {
         /* We not finished this Entry.  Will try to finish during next wakeup */
         ResultsEntry->ByteOffset += NumBytesThisCycle;
-        ResultsEntry->TempChecksumValue = NewChecksumValue;
     }
 
     return Status;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that releases the address of a table                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_ReleaseTableAddress(const CS_Res_Tables_Table_Entry_t *ResultsEntry, CFE_TBL_Handle_t TblHandle)
+{
+    CFE_Status_t Result;
+
+    Result = CFE_TBL_ReleaseAddress(TblHandle);
+    if (Result != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(CS_COMPUTE_TABLES_RELEASE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "CS Tables: Could not release addresss for table %s, returned: 0x%08X", ResultsEntry->Name,
+                          (unsigned int)Result);
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* CS function that computes the checksum for Tables               */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, bool *DoneWithEntry)
+CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, bool *DoneWithEntry,
+                              CS_Job_t *Job)
 {
     uint32       OffsetIntoCurrEntry     = 0;
     cpuaddr      FirstAddrThisCycle      = 0;
@@ -128,6 +161,9 @@ CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32
     CFE_Status_t ResultShare             = 0;
     CFE_Status_t ResultGetInfo           = 0;
     CFE_Status_t ResultGetAddress        = 0;
+    bool         InfoRead                = false;
+    bool         UseSnapshot             = false;
+    CS_Digest_t  NewDigest;
 
     /* variables to get the table address */
     CFE_TBL_Handle_t LocalTblHandle = CFE_TBL_BAD_TABLE_HANDLE;
@@ -147,6 +183,8 @@ CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32
         ResultShare = CFE_TBL_Share(&LocalTblHandle, ResultsEntry->Name);
         Result      = ResultShare;
 
+        ResultsEntry->InfoCached = false;
+
         if (Result == CFE_SUCCESS)
         {
             ResultsEntry->TblHandle = LocalTblHandle;
@@ -159,12 +197,18 @@ CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32
 
     if (Result == CFE_SUCCESS)
     {
-        ResultGetInfo = CFE_TBL_GetInfo(&TblInfo, ResultsEntry->Name);
-
-        /* We want to try to get the address even if the GetInfo fails. This
-        provides the CFE_TBL_UNREGISTERED if the table has gone away */
+        /* This provides the CFE_TBL_UNREGISTERED if the table has gone away */
         ResultGetAddress = CFE_TBL_GetAddress((void *)&LocalAddress, LocalTblHandle);
         Result           = ResultGetAddress;
+
+        /* The size of the table only needs to be read again when Table Services
+           reports something other than the same table image as last time */
+        if (ResultsEntry->InfoCached == false || Result != CFE_SUCCESS)
+        {
+            ResultsEntry->InfoCached = false;
+
+            ResultGetInfo = CFE_TBL_GetInfo(&TblInfo, ResultsEntry->Name);
+        }
     }
 
     /* if the table was never loaded, release the address to prevent the table from being
@@ -183,7 +227,8 @@ CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32
 
         /* reset the stored  data in the results table since the
            table went away */
-        ResultsEntry->TblHandle = CFE_TBL_BAD_TABLE_HANDLE;
+        ResultsEntry->TblHandle  = CFE_TBL_BAD_TABLE_HANDLE;
+        ResultsEntry->InfoCached = false;
         CS_ResetTablesTblResultEntry(ResultsEntry);
         ResultsEntry->ComparisonValue    = 0;
         ResultsEntry->StartAddress       = 0;
@@ -196,56 +241,139 @@ CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32
     if (Result == CFE_SUCCESS || Result == CFE_TBL_INFO_UPDATED)
     {
         /* push in the get data from the table info */
-        if (ResultGetInfo == CFE_SUCCESS)
+        if (ResultsEntry->InfoCached == false && ResultGetInfo == CFE_SUCCESS)
         {
             ResultsEntry->NumBytesToChecksum = TblInfo.Size;
+            ResultsEntry->InfoCached         = true;
+            InfoRead                         = true;
         }
         ResultsEntry->StartAddress = LocalAddress;
 
+        /* Only the background checksums a snapshot, and only of a table that fits */
+        if (ResultsEntry->Snapshot == true && Job == NULL)
+        {
+            if (ResultsEntry->NumBytesToChecksum <= sizeof(CS_AppData.TableSnapshot))
+            {
+                UseSnapshot = true;
+
+                /* Start over if another entry's snapshot replaced this one's */
+                if (CS_AppData.SnapshotOwner != ResultsEntry)
+                {
+                    ResultsEntry->ByteOffset = 0;
+                }
+            }
+            else if (InfoRead == true)
+            {
+                CFE_EVS_SendEvent(CS_COMPUTE_TABLES_SNAPSHOT_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "CS Tables: Table %s is %u bytes, too large for the %u byte snapshot",
+                                  ResultsEntry->Name, (unsigned int)ResultsEntry->NumBytesToChecksum,
+                                  (unsigned int)sizeof(CS_AppData.TableSnapshot));
+            }
+        }
+
         /* if the table has been updated since the last time we
          looked at it, we need to start over again. We can also
          use the new value as a baseline checksum */
         if (Result == CFE_TBL_INFO_UPDATED)
         {
-            CS_ResetTablesTblResultEntry(ResultsEntry);
+            if (UseSnapshot == true && ResultsEntry->ByteOffset > 0)
+            {
+                /* The snapshot is still whole, but its baseline is old once it is checked */
+                ResultsEntry->SnapshotStale = true;
+            }
+            else
+            {
+                CS_ResetTablesTblResultEntry(ResultsEntry);
+            }
         }
 
+#if (CS_ADOPT_TABLE_SERVICES_CRC == true)
+        /* Table Services computed a CRC of the image it loaded, so unless the
+           entry uses a different algorithm the first pass can check against it.
+           A recompute takes on the value it computes, so it does not use it */
+        if (InfoRead == true && Job == NULL && ResultsEntry->ComputedYet == false && ResultsEntry->ByteOffset == 0 &&
+            TblInfo.TableLoadedOnce == true && TblInfo.DumpOnly == false &&
+            CS_ChecksumFromCrc(ResultsEntry->Algorithm, CFE_MISSION_ES_DEFAULT_CRC, TblInfo.Crc,
+                               &ResultsEntry->ComparisonDigest) == true)
+        {
+            ResultsEntry->ComputedYet     = true;
+            ResultsEntry->ComparisonValue = TblInfo.Crc;
+        }
+#endif
+
         OffsetIntoCurrEntry     = ResultsEntry->ByteOffset;
         FirstAddrThisCycle      = ResultsEntry->StartAddress + OffsetIntoCurrEntry;
         NumBytesRemainingCycles = ResultsEntry->NumBytesToChecksum - OffsetIntoCurrEntry;
 
-        NumBytesThisCycle = ((CS_AppData.MaxBytesPerCycle < NumBytesRemainingCycles) ? CS_AppData.MaxBytesPerCycle
-                                                                                     : NumBytesRemainingCycles);
+        if (UseSnapshot == true)
+        {
+            /* Copy the whole table under one hold of its address, so that
+               updates made while the copy is checked cannot restart the entry */
+            if (OffsetIntoCurrEntry == 0)
+            {
+                memcpy(CS_AppData.TableSnapshot, (const void *)ResultsEntry->StartAddress,
+                       ResultsEntry->NumBytesToChecksum);
+
+                CS_AppData.SnapshotOwner    = ResultsEntry;
+                ResultsEntry->SnapshotStale = false;
+            }
+
+            FirstAddrThisCycle = (cpuaddr)CS_AppData.TableSnapshot + OffsetIntoCurrEntry;
+
+            /* The owner can update the table while the copy is checked */
+            CS_ReleaseTableAddress(ResultsEntry, LocalTblHandle);
+        }
+
+        if (OffsetIntoCurrEntry == 0)
+        {
+            CS_ChecksumInit(ResultsEntry->Algorithm, &ResultsEntry->TempChecksumContext);
+        }
 
-        NewChecksumValue = CFE_ES_CalculateCRC((void *)(FirstAddrThisCycle), NumBytesThisCycle,
-                                               ResultsEntry->TempChecksumValue, CS_DEFAULT_ALGORITHM);
+        NumBytesThisCycle =
+            CS_BudgetChecksumUpdate(ResultsEntry->Algorithm, &ResultsEntry->TempChecksumContext, FirstAddrThisCycle,
+                                    NumBytesRemainingCycles, CS_AppData.MaxBytesPerCycle, false,
+                                    CS_TABLES_STREAMING, Job);
 
         NumBytesRemainingCycles -= NumBytesThisCycle;
 
         /* Have we finished all of the parts for this Entry */
         if (NumBytesRemainingCycles <= 0)
         {
-            /* Start over if an update occurred after we started the last part */
-            CFE_TBL_ReleaseAddress(LocalTblHandle);
-            Result = CFE_TBL_GetAddress((void *)&LocalAddress, LocalTblHandle);
+            if (UseSnapshot == false)
+            {
+                /* Start over if an update occurred after we started the last part */
+                CFE_TBL_ReleaseAddress(LocalTblHandle);
+                Result = CFE_TBL_GetAddress((void *)&LocalAddress, LocalTblHandle);
+            }
+            else
+            {
+                /* The snapshot cannot have changed, and the next cycle sees any update */
+                Result = CFE_SUCCESS;
+            }
+
             if (Result == CFE_TBL_INFO_UPDATED)
             {
-                *ComputedCSValue                = 0;
-                ResultsEntry->ComputedYet       = false;
-                ResultsEntry->ComparisonValue   = 0;
-                ResultsEntry->ByteOffset        = 0;
-                ResultsEntry->TempChecksumValue = 0;
+                *ComputedCSValue              = 0;
+                ResultsEntry->ComputedYet     = false;
+                ResultsEntry->ComparisonValue = 0;
+                ResultsEntry->ByteOffset      = 0;
+
+                /* Read the table info again next cycle for the new image */
+                ResultsEntry->InfoCached = false;
             }
             else
             {
                 /* No last second updates, post the result for this table */
                 *DoneWithEntry = true;
 
+                NewChecksumValue =
+                    CS_ChecksumFinal(ResultsEntry->Algorithm, &ResultsEntry->TempChecksumContext, &NewDigest);
+
                 if (ResultsEntry->ComputedYet == true)
                 {
                     /* This is NOT the first time through this Entry.
                        We have already computed a CS value for this Entry */
-                    if (NewChecksumValue != ResultsEntry->ComparisonValue)
+                    if (memcmp(&NewDigest, &ResultsEntry->ComparisonDigest, sizeof(NewDigest)) != 0)
                     {
                         /* If the just-computed value differ from the saved value */
                         Status = CS_ERROR;
@@ -258,31 +386,34 @@ CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32
                 else
                 {
                     /* This is the first time through this Entry */
-                    ResultsEntry->ComputedYet     = true;
-                    ResultsEntry->ComparisonValue = NewChecksumValue;
+                    ResultsEntry->ComputedYet      = true;
+                    ResultsEntry->ComparisonValue  = NewChecksumValue;
+                    ResultsEntry->ComparisonDigest = NewDigest;
                 }
 
-                *ComputedCSValue                = NewChecksumValue;
-                ResultsEntry->ByteOffset        = 0;
-                ResultsEntry->TempChecksumValue = 0;
+                *ComputedCSValue         = NewChecksumValue;
+                ResultsEntry->ByteOffset = 0;
+
+                if (ResultsEntry->SnapshotStale == true)
+                {
+                    /* The table was updated after the snapshot was taken, so
+                       the next pass needs the baseline of the new image */
+                    ResultsEntry->ComputedYet   = false;
+                    ResultsEntry->InfoCached    = false;
+                    ResultsEntry->SnapshotStale = false;
+                }
             }
         }
         else
         {
             /* We have  not finished this Entry.  Will try to finish during next wakeup */
             ResultsEntry->ByteOffset += NumBytesThisCycle;
-            ResultsEntry->TempChecksumValue = NewChecksumValue;
-            *ComputedCSValue                = NewChecksumValue;
         }
 
         /* We are done with the table for this cycle, so we need to release the address */
-
-        Result = CFE_TBL_ReleaseAddress(LocalTblHandle);
-        if (Result != CFE_SUCCESS)
+        if (UseSnapshot == false)
         {
-            CFE_EVS_SendEvent(CS_COMPUTE_TABLES_RELEASE_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "CS Tables: Could not release addresss for table %s, returned: 0x%08X",
-                              ResultsEntry->Name, (unsigned int)Result);
+            CS_ReleaseTableAddress(ResultsEntry, LocalTblHandle);
         }
 
     } /* end if tabled was success or updated */
@@ -299,12 +430,32 @@ CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32
     return Status;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that looks up the module ID of an app or library    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static CFE_Status_t CS_GetAppResourceID(CFE_ResourceId_t *ResourceID, const char *Name)
+{
+    CFE_Status_t Result;
+
+    Result = CFE_ES_GetAppIDByName((CFE_ES_AppId_t *)ResourceID, Name);
+    if (Result == CFE_ES_ERR_NAME_NOT_FOUND)
+    {
+        /* Also check for a matching library name */
+        Result = CFE_ES_GetLibIDByName((CFE_ES_LibId_t *)ResourceID, Name);
+    }
+
+    return Result;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* CS function that computes the checksum for Apps                 */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, bool *DoneWithEntry)
+CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, bool *DoneWithEntry,
+                           CS_Job_t *Job)
 {
     uint32       OffsetIntoCurrEntry     = 0;
     cpuaddr      FirstAddrThisCycle      = 0;
@@ -312,12 +463,13 @@ CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *Compu
     int32        NumBytesRemainingCycles = 0;
     uint32       NewChecksumValue        = 0;
     CFE_Status_t Status                  = CFE_SUCCESS;
-    CFE_Status_t ResultGetResourceID     = CS_ERROR;
+    CFE_Status_t ResultGetResourceID     = CFE_SUCCESS;
     CFE_Status_t ResultGetResourceInfo   = CS_ERROR;
     bool         ResultAddressValid      = false;
+    CS_Digest_t  NewDigest;
 
     /* variables to get applications address */
-    CFE_ResourceId_t ResourceID = CFE_RESOURCEID_UNDEFINED;
+    CFE_ResourceId_t ResourceID = ResultsEntry->ResourceID;
     CFE_ES_AppInfo_t AppInfo;
 
     /* By the time we get here, we know we have an enabled entry */
@@ -325,21 +477,54 @@ CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *Compu
     /* set the done flag to false originally */
     *DoneWithEntry = false;
 
-    ResultGetResourceID = CFE_ES_GetAppIDByName((CFE_ES_AppId_t *)&ResourceID, ResultsEntry->Name);
-    if (ResultGetResourceID == CFE_ES_ERR_NAME_NOT_FOUND)
+    /* The module is looked up by name at the start of each entry.  The cycles
+       after that use the module ID, address and size cached in the entry, once
+       a lookup by ID shows the module is still loaded */
+    if (CFE_RESOURCEID_TEST_DEFINED(ResourceID) && ResultsEntry->ByteOffset != 0 &&
+        CFE_ES_GetModuleInfo(&AppInfo, ResourceID) != CFE_SUCCESS)
     {
-        /* Also check for a matching library name */
-        ResultGetResourceID = CFE_ES_GetLibIDByName((CFE_ES_LibId_t *)&ResourceID, ResultsEntry->Name);
+        /* The module was unloaded part way through the entry and its code may
+           no longer be mapped, so drop the entry and start it over */
+        ResultsEntry->ByteOffset = 0;
+    }
+
+    if (ResultsEntry->ByteOffset == 0 || !CFE_RESOURCEID_TEST_DEFINED(ResourceID))
+    {
+        ResultGetResourceID = CS_GetAppResourceID(&ResourceID, ResultsEntry->Name);
     }
 
     if (ResultGetResourceID == CFE_SUCCESS)
     {
-        /* We got a valid ResourceID, so get the Resource info */
+        if (CFE_RESOURCEID_TEST_DEFINED(ResultsEntry->ResourceID) &&
+            CFE_RESOURCEID_TEST_EQUAL(ResourceID, ResultsEntry->ResourceID))
+        {
+            /* Same module as last time, so the address and size are still good */
+            ResultGetResourceInfo = CFE_SUCCESS;
+            ResultAddressValid    = true;
+        }
+        else
+        {
+            if (CFE_RESOURCEID_TEST_DEFINED(ResultsEntry->ResourceID))
+            {
+                /* The app was restarted or reloaded, so its old baseline no longer applies */
+                if (ResultsEntry->ComputedYet == true)
+                {
+                    CFE_EVS_SendEvent(CS_APP_RELOADED_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                      "App %s was reloaded, computing a new baseline", ResultsEntry->Name);
+
+                    ResultsEntry->ComputedYet     = false;
+                    ResultsEntry->ComparisonValue = 0;
+                }
+
+                ResultsEntry->ByteOffset = 0;
+            }
 
-        ResultGetResourceInfo = CFE_ES_GetModuleInfo(&AppInfo, ResourceID);
+            /* We got a valid ResourceID, so get the Resource info */
+            ResultGetResourceInfo = CFE_ES_GetModuleInfo(&AppInfo, ResourceID);
+        }
     }
 
-    if (ResultGetResourceInfo == CFE_SUCCESS)
+    if (ResultGetResourceInfo == CFE_SUCCESS && ResultAddressValid == false)
     {
         /* We got a valid ResourceID and good App info, so check the for valid addresses */
 
@@ -354,6 +539,7 @@ CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *Compu
             /* Push in the data from the module info */
             ResultsEntry->NumBytesToChecksum = AppInfo.CodeSize;
             ResultsEntry->StartAddress       = AppInfo.CodeAddress;
+            ResultsEntry->ResourceID         = ResourceID;
             ResultAddressValid               = true;
         }
     }
@@ -366,24 +552,50 @@ CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *Compu
         FirstAddrThisCycle      = ResultsEntry->StartAddress + OffsetIntoCurrEntry;
         NumBytesRemainingCycles = ResultsEntry->NumBytesToChecksum - OffsetIntoCurrEntry;
 
-        NumBytesThisCycle = ((CS_AppData.MaxBytesPerCycle < NumBytesRemainingCycles) ? CS_AppData.MaxBytesPerCycle
-                                                                                     : NumBytesRemainingCycles);
+        if (OffsetIntoCurrEntry == 0)
+        {
+            CS_ChecksumInit(ResultsEntry->Algorithm, &ResultsEntry->TempChecksumContext);
+        }
 
-        NewChecksumValue = CFE_ES_CalculateCRC((void *)(FirstAddrThisCycle), NumBytesThisCycle,
-                                               ResultsEntry->TempChecksumValue, CS_DEFAULT_ALGORITHM);
+        NumBytesThisCycle =
+            CS_BudgetChecksumUpdate(ResultsEntry->Algorithm, &ResultsEntry->TempChecksumContext, FirstAddrThisCycle,
+                                    NumBytesRemainingCycles, CS_AppData.MaxBytesPerCycle, false,
+                                    CS_APP_STREAMING, Job);
 
         NumBytesRemainingCycles -= NumBytesThisCycle;
 
-        if (NumBytesRemainingCycles <= 0)
+        /* An entry that took more than one cycle is only good if the module was
+           not reloaded part way through, so look it up by name again */
+        if (NumBytesRemainingCycles <= 0 && OffsetIntoCurrEntry != 0)
+        {
+            if (CS_GetAppResourceID(&ResourceID, ResultsEntry->Name) != CFE_SUCCESS ||
+                !CFE_RESOURCEID_TEST_EQUAL(ResourceID, ResultsEntry->ResourceID))
+            {
+                /* Start over, and the next cycle will find out what happened */
+                NumBytesRemainingCycles  = 0;
+                NumBytesThisCycle        = 0;
+                ResultsEntry->ByteOffset = 0;
+                ResultAddressValid       = false;
+            }
+        }
+
+        if (ResultAddressValid == false)
+        {
+            /* The module changed under us, so there is nothing to report this cycle */
+        }
+        else if (NumBytesRemainingCycles <= 0)
         {
             /* We are finished CS'ing all of the parts for this Entry */
             *DoneWithEntry = true;
 
+            NewChecksumValue =
+                CS_ChecksumFinal(ResultsEntry->Algorithm, &ResultsEntry->TempChecksumContext, &NewDigest);
+
             if (ResultsEntry->ComputedYet == true)
             {
                 /* This is NOT the first time through this Entry.
                  We have already computed a CS value for this Entry */
-                if (NewChecksumValue != ResultsEntry->ComparisonValue)
+                if (memcmp(&NewDigest, &ResultsEntry->ComparisonDigest, sizeof(NewDigest)) != 0)
                 {
                     /* If the just-computed value differ from the saved value */
                     Status = CS_ERROR;
@@ -396,20 +608,18 @@ CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *Compu
             else
             {
                 /* This is the first time through this Entry */
-                ResultsEntry->ComputedYet     = true;
-                ResultsEntry->ComparisonValue = NewChecksumValue;
+                ResultsEntry->ComputedYet      = true;
+                ResultsEntry->ComparisonValue  = NewChecksumValue;
+                ResultsEntry->ComparisonDigest = NewDigest;
             }
 
-            *ComputedCSValue                = NewChecksumValue;
-            ResultsEntry->ByteOffset        = 0;
-            ResultsEntry->TempChecksumValue = 0;
+            *ComputedCSValue         = NewChecksumValue;
+            ResultsEntry->ByteOffset = 0;
         }
         else
         {
             /* We have not finished this Entry.  Will try to finish during next wakeup */
             ResultsEntry->ByteOffset += NumBytesThisCycle;
-            ResultsEntry->TempChecksumValue = NewChecksumValue;
-            *ComputedCSValue                = NewChecksumValue;
         }
     } /* end if got module id ok */
     else
@@ -429,155 +639,184 @@ CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *Compu
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* CS child task for recomputing EEPROM and Memory entry baselines */
+/* CS function that marks a definition table modified              */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void CS_RecomputeEepromMemoryChildTask(void)
+static void CS_RecomputeDefModified(uint16 Table)
 {
-    uint32                             NewChecksumValue = 0;
-    char                               TableType[CS_TABLETYPE_NAME_SIZE];
-    CS_Res_EepromMemory_Table_Entry_t *ResultsEntry         = NULL;
-    uint16                             Table                = 0;
-    uint16                             EntryID              = 0;
-    uint16                             PreviousState        = CS_STATE_EMPTY;
-    bool                               DoneWithEntry        = false;
-    uint16                             PreviousDefState     = CS_STATE_EMPTY;
-    bool                               DefEntryFound        = false;
-    uint16                             DefEntryID           = 0;
-    CS_Def_EepromMemory_Table_Entry_t *DefTblPtr            = NULL;
-    uint16                             MaxDefEntries        = 0;
-    CFE_TBL_Handle_t                   DefTblHandle         = CFE_TBL_BAD_TABLE_HANDLE;
-    CS_Res_Tables_Table_Entry_t *      TablesTblResultEntry = NULL;
-
-    strncpy(TableType, "Undef Tbl", CS_TABLETYPE_NAME_SIZE); /* Initialize table type string */
-
-    Table        = CS_AppData.ChildTaskTable;
-    EntryID      = CS_AppData.ChildTaskEntryID;
-    ResultsEntry = CS_AppData.RecomputeEepromMemoryEntryPtr;
-
-    /* we want to  make sure that the entry isn't being checksummed in the
-     background at the same time we are recomputing */
-    PreviousState       = ResultsEntry->State;
-    ResultsEntry->State = CS_STATE_DISABLED;
+    if (Table == CS_EEPROM_TABLE)
+    {
+        CS_ResetTablesTblResultEntry(CS_AppData.EepResTablesTblPtr);
+        CFE_TBL_Modified(CS_AppData.DefEepromTableHandle);
+    }
+    else if (Table == CS_MEMORY_TABLE)
+    {
+        CS_ResetTablesTblResultEntry(CS_AppData.MemResTablesTblPtr);
+        CFE_TBL_Modified(CS_AppData.DefMemoryTableHandle);
+    }
+    else if (Table == CS_TABLES_TABLE)
+    {
+        CS_ResetTablesTblResultEntry(CS_AppData.TblResTablesTblPtr);
+        CFE_TBL_Modified(CS_AppData.DefTablesTableHandle);
+    }
+    else
+    {
+        CS_ResetTablesTblResultEntry(CS_AppData.AppResTablesTblPtr);
+        CFE_TBL_Modified(CS_AppData.DefAppTableHandle);
+    }
+}
 
-    /* Set entry as if this is the first time we are computing the checksum,
-       since we want the entry to take on the new value */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that disables the definition entry being recomputed */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_RecomputeDisableDefEntry(CS_Job_t *Job)
+{
+    uint16                       Table          = Job->Info.Table;
+    uint16                       EntryID        = Job->Info.EntryID;
+    CS_Def_Tables_Table_Entry_t *DefTablesEntry = NULL;
+    CS_Def_App_Table_Entry_t    *DefAppEntry    = NULL;
 
-    ResultsEntry->ByteOffset        = 0;
-    ResultsEntry->TempChecksumValue = 0;
-    ResultsEntry->ComputedYet       = false;
+    Job->DefState = NULL;
 
-    /* Update the definition table entry as well.  We need to determine which memory type is
-       being updated as well as which entry in the table is being updated. */
-    if ((Table != CS_OSCORE) && (Table != CS_CFECORE))
+    /* This assumes that the definition table entries are in the same order as the
+       results table entries, which should be a safe assumption. */
+    if (Table == CS_EEPROM_TABLE)
     {
-        if (Table == CS_EEPROM_TABLE)
+        if ((CS_AppData.ResEepromTblPtr[EntryID].StartAddress == CS_AppData.DefEepromTblPtr[EntryID].StartAddress) &&
+            (CS_AppData.DefEepromTblPtr[EntryID].State != CS_STATE_EMPTY))
         {
-            DefTblPtr            = CS_AppData.DefEepromTblPtr;
-            MaxDefEntries        = CS_MAX_NUM_EEPROM_TABLE_ENTRIES;
-            DefTblHandle         = CS_AppData.DefEepromTableHandle;
-            TablesTblResultEntry = CS_AppData.EepResTablesTblPtr;
+            Job->DefState = &CS_AppData.DefEepromTblPtr[EntryID].State;
         }
-        else
+    }
+    else if (Table == CS_MEMORY_TABLE)
+    {
+        if ((CS_AppData.ResMemoryTblPtr[EntryID].StartAddress == CS_AppData.DefMemoryTblPtr[EntryID].StartAddress) &&
+            (CS_AppData.DefMemoryTblPtr[EntryID].State != CS_STATE_EMPTY))
         {
-            DefTblPtr            = CS_AppData.DefMemoryTblPtr;
-            MaxDefEntries        = CS_MAX_NUM_MEMORY_TABLE_ENTRIES;
-            DefTblHandle         = CS_AppData.DefMemoryTableHandle;
-            TablesTblResultEntry = CS_AppData.MemResTablesTblPtr;
+            Job->DefState = &CS_AppData.DefMemoryTblPtr[EntryID].State;
         }
-
-        if (EntryID < MaxDefEntries)
+    }
+    else if (Table == CS_TABLES_TABLE)
+    {
+        if (CS_GetTableDefTblEntryByName(&DefTablesEntry, CS_AppData.ResTablesTblPtr[EntryID].Name))
         {
-            /* This assumes that the definition table entries are in the same order as the
-               results table entries, which should be a safe assumption. */
-            if ((ResultsEntry->StartAddress == DefTblPtr[EntryID].StartAddress) &&
-                (DefTblPtr[EntryID].State != CS_STATE_EMPTY))
-            {
-                DefEntryFound            = true;
-                PreviousDefState         = DefTblPtr[EntryID].State;
-                DefTblPtr[EntryID].State = CS_STATE_DISABLED;
-                DefEntryID               = EntryID;
-                CS_ResetTablesTblResultEntry(TablesTblResultEntry);
-                CFE_TBL_Modified(DefTblHandle);
-            }
+            Job->DefState = &DefTablesEntry->State;
         }
     }
-
-    while (!DoneWithEntry)
+    else if (Table == CS_APP_TABLE)
     {
-        CS_ComputeEepromMemory(ResultsEntry, &NewChecksumValue, &DoneWithEntry);
+        if (CS_GetAppDefTblEntryByName(&DefAppEntry, CS_AppData.ResAppTblPtr[EntryID].Name))
+        {
+            Job->DefState = &DefAppEntry->State;
+        }
+    }
 
-        OS_TaskDelay(CS_CHILD_TASK_DELAY);
+    if (Job->DefState != NULL)
+    {
+        Job->PreviousDefState = *Job->DefState;
+        *Job->DefState        = CS_STATE_DISABLED;
+        CS_RecomputeDefModified(Table);
     }
+}
 
-    /* The new checksum value is stored in the table by the above functions */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that restores the definition entry once recomputed  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_RecomputeRestoreDefEntry(CS_Job_t *Job)
+{
+    if (Job->DefState != NULL)
+    {
+        *Job->DefState = Job->PreviousDefState;
+        Job->DefState  = NULL;
+        CS_RecomputeDefModified(Job->Info.Table);
+    }
+}
 
-    /* reset the entry's variables for a newly computed value */
-    ResultsEntry->TempChecksumValue = 0;
-    ResultsEntry->ByteOffset        = 0;
-    ResultsEntry->ComputedYet       = true;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS job for recomputing EEPROM and Memory entry baselines        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_RecomputeEepromMemory(CS_Job_t *Job)
+{
+    uint32                             NewChecksumValue     = 0;
+    CS_Res_EepromMemory_Table_Entry_t *ResultsEntry         = NULL;
+    uint16                             Table                = 0;
+    uint16                             EntryID              = 0;
+    uint16                             PreviousState        = CS_STATE_EMPTY;
+    bool                               DoneWithEntry        = false;
 
-    /* restore the entry's previous state */
-    ResultsEntry->State = PreviousState;
+    Table   = Job->Info.Table;
+    EntryID = Job->Info.EntryID;
 
-    /* Restore the definition table if we found one earlier */
-    if (DefEntryFound)
+    if (Table == CS_CFECORE)
     {
-        DefTblPtr[DefEntryID].State = PreviousDefState;
-        CS_ResetTablesTblResultEntry(TablesTblResultEntry);
-        CFE_TBL_Modified(DefTblHandle);
+        ResultsEntry = &CS_AppData.CfeCoreCodeSeg;
     }
-
-    /* send event message */
-
-    if (Table == CS_EEPROM_TABLE)
+    else if (Table == CS_OSCORE)
     {
-        snprintf(TableType, CS_TABLETYPE_NAME_SIZE, "%s", "EEPROM");
+        ResultsEntry = &CS_AppData.OSCodeSeg;
     }
-    if (Table == CS_MEMORY_TABLE)
+    else if (Table == CS_EEPROM_TABLE)
     {
-        snprintf(TableType, CS_TABLETYPE_NAME_SIZE, "%s", "Memory");
+        ResultsEntry = &CS_AppData.ResEepromTblPtr[EntryID];
     }
-    if (Table == CS_CFECORE)
+    else
     {
-        snprintf(TableType, CS_TABLETYPE_NAME_SIZE, "%s", "cFE Core");
-        CS_AppData.HkPacket.Payload.CfeCoreBaseline = NewChecksumValue;
+        ResultsEntry = &CS_AppData.ResMemoryTblPtr[EntryID];
     }
-    if (Table == CS_OSCORE)
+
+    /* we want to  make sure that the entry isn't being checksummed in the
+     background at the same time we are recomputing */
+    PreviousState       = ResultsEntry->State;
+    ResultsEntry->State = CS_STATE_DISABLED;
+
+    /* Set entry as if this is the first time we are computing the checksum,
+       since we want the entry to take on the new value */
+
+    ResultsEntry->ByteOffset  = 0;
+    ResultsEntry->ComputedYet = false;
+
+    /* Only the blocks that changed need rehashing if the entry has a block tree */
+    if (!CS_BlockTreeRecompute(ResultsEntry, &NewChecksumValue, Job))
     {
-        snprintf(TableType, CS_TABLETYPE_NAME_SIZE, "%s", "OS");
-        CS_AppData.HkPacket.Payload.OSBaseline = NewChecksumValue;
+        while (!DoneWithEntry)
+        {
+            CS_ComputeEepromMemory(ResultsEntry, &NewChecksumValue, &DoneWithEntry, Job);
+        }
     }
 
-    CFE_EVS_SendEvent(CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID, CFE_EVS_EventType_INFORMATION,
-                      "%s entry %d recompute finished. New baseline is 0X%08X", TableType, EntryID,
-                      (unsigned int)NewChecksumValue);
+    /* The new checksum value is stored in the table by the above functions */
+
+    /* reset the entry's variables for a newly computed value */
+    ResultsEntry->ByteOffset  = 0;
+    ResultsEntry->ComputedYet = true;
+
+    /* restore the entry's previous state */
+    ResultsEntry->State = PreviousState;
 
-    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
-    CFE_ES_ExitChildTask();
+    Job->Info.Result = NewChecksumValue;
+    Job->Outcome     = CS_JOB_STATUS_DONE;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* CS child task for recomputing baselines for Apps                */
+/* CS job for recomputing baselines for Apps                       */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void CS_RecomputeAppChildTask(void)
+void CS_RecomputeApp(CS_Job_t *Job)
 {
     uint32                    NewChecksumValue = 0;
     CS_Res_App_Table_Entry_t *ResultsEntry     = NULL;
     uint16                    PreviousState    = CS_STATE_EMPTY;
     bool                      DoneWithEntry    = false;
     CFE_Status_t              Status           = CS_ERROR;
-    uint16                    PreviousDefState = CS_STATE_EMPTY;
-    bool                      DefEntryFound    = false;
-    uint16                    DefEntryID       = 0;
-    CS_Def_App_Table_Entry_t *DefTblPtr        = NULL;
-    uint16                    MaxDefEntries    = 0;
-    CFE_TBL_Handle_t          DefTblHandle     = CFE_TBL_BAD_TABLE_HANDLE;
 
-    /* Get the variables to use from the global data */
-    ResultsEntry = CS_AppData.RecomputeAppEntryPtr;
+    ResultsEntry = &CS_AppData.ResAppTblPtr[Job->Info.EntryID];
 
     /* we want to  make sure that the entry isn't being checksummed in the
      background at the same time we are recomputing */
@@ -588,102 +827,52 @@ void CS_RecomputeAppChildTask(void)
     /* Set entry as if this is the first time we are computing the checksum,
        since we want the entry to take on the new value */
 
-    ResultsEntry->ByteOffset        = 0;
-    ResultsEntry->TempChecksumValue = 0;
-    ResultsEntry->ComputedYet       = false;
-
-    /* Update the definition table entry as well.  We need to determine which memory type is
-       being updated as well as which entry in the table is being updated. */
-    DefTblPtr     = CS_AppData.DefAppTblPtr;
-    MaxDefEntries = CS_MAX_NUM_APP_TABLE_ENTRIES;
-    DefTblHandle  = CS_AppData.DefAppTableHandle;
-
-    DefEntryID = 0;
-
-    while ((!DefEntryFound) && (DefEntryID < MaxDefEntries))
-    {
-        if ((strncmp(ResultsEntry->Name, DefTblPtr[DefEntryID].Name, OS_MAX_API_NAME) == 0) &&
-            (DefTblPtr[DefEntryID].State != CS_STATE_EMPTY))
-        {
-            DefEntryFound               = true;
-            PreviousDefState            = DefTblPtr[DefEntryID].State;
-            DefTblPtr[DefEntryID].State = CS_STATE_DISABLED;
-            CS_ResetTablesTblResultEntry(CS_AppData.AppResTablesTblPtr);
-            CFE_TBL_Modified(DefTblHandle);
-        }
-        else
-        {
-            DefEntryID++;
-        }
-    }
+    ResultsEntry->ByteOffset  = 0;
+    ResultsEntry->ComputedYet = false;
 
     while (!DoneWithEntry)
     {
-        Status = CS_ComputeApp(ResultsEntry, &NewChecksumValue, &DoneWithEntry);
+        Status = CS_ComputeApp(ResultsEntry, &NewChecksumValue, &DoneWithEntry, Job);
 
         if (Status == CS_ERR_NOT_FOUND)
         {
             break;
         }
-
-        OS_TaskDelay(CS_CHILD_TASK_DELAY);
     }
     /* The new checksum value is stored in the table by the above functions */
 
     /* restore the entry's state */
     ResultsEntry->State = PreviousState;
 
-    /* Restore the definition table if we found one earlier */
-    if (DefEntryFound)
-    {
-        DefTblPtr[DefEntryID].State = PreviousDefState;
-        CS_ResetTablesTblResultEntry(CS_AppData.AppResTablesTblPtr);
-        CFE_TBL_Modified(DefTblHandle);
-    }
-
     if (Status == CS_ERR_NOT_FOUND)
     {
-        CFE_EVS_SendEvent(CS_RECOMPUTE_ERROR_APP_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "App %s recompute failed. Could not get address", ResultsEntry->Name);
+        Job->Outcome = CS_JOB_STATUS_FAILED;
     }
     else
     {
         /* reset the entry's variables for a newly computed value */
-        ResultsEntry->TempChecksumValue = 0;
-        ResultsEntry->ByteOffset        = 0;
-        ResultsEntry->ComputedYet       = true;
+        ResultsEntry->ByteOffset  = 0;
+        ResultsEntry->ComputedYet = true;
 
-        /* send event message */
-        CFE_EVS_SendEvent(CS_RECOMPUTE_FINISH_APP_INF_EID, CFE_EVS_EventType_INFORMATION,
-                          "App %s recompute finished. New baseline is 0x%08X", ResultsEntry->Name,
-                          (unsigned int)NewChecksumValue);
+        Job->Info.Result = NewChecksumValue;
+        Job->Outcome     = CS_JOB_STATUS_DONE;
     }
-
-    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
-    CFE_ES_ExitChildTask();
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* CS child task for recomputing baselines for Tables              */
+/* CS job for recomputing baselines for Tables                     */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void CS_RecomputeTablesChildTask(void)
+void CS_RecomputeTables(CS_Job_t *Job)
 {
     uint32                       NewChecksumValue = 0;
     CS_Res_Tables_Table_Entry_t *ResultsEntry     = NULL;
     uint16                       PreviousState    = CS_STATE_EMPTY;
     bool                         DoneWithEntry    = false;
     CFE_Status_t                 Status           = CS_ERROR;
-    uint16                       PreviousDefState = CS_STATE_EMPTY;
-    bool                         DefEntryFound    = false;
-    uint16                       DefEntryID       = 0;
-    CS_Def_Tables_Table_Entry_t *DefTblPtr        = NULL;
-    uint16                       MaxDefEntries    = 0;
-    CFE_TBL_Handle_t             DefTblHandle     = CFE_TBL_BAD_TABLE_HANDLE;
 
-    /* Get the variables to use from the global data */
-    ResultsEntry = CS_AppData.RecomputeTablesEntryPtr;
+    ResultsEntry = &CS_AppData.ResTablesTblPtr[Job->Info.EntryID];
 
     /* we want to  make sure that the entry isn't being checksummed in the
      background at the same time we are recomputing */
@@ -694,127 +883,81 @@ void CS_RecomputeTablesChildTask(void)
     /* Set entry as if this is the first time we are computing the checksum,
      since we want the entry to take on the new value */
 
-    ResultsEntry->ByteOffset        = 0;
-    ResultsEntry->TempChecksumValue = 0;
-    ResultsEntry->ComputedYet       = false;
-
-    /* Update the definition table entry as well.  We need to determine which memory type is
-     being updated as well as which entry in the table is being updated. */
-    DefTblPtr     = CS_AppData.DefTablesTblPtr;
-    MaxDefEntries = CS_MAX_NUM_TABLES_TABLE_ENTRIES;
-    DefTblHandle  = CS_AppData.DefTablesTableHandle;
-
-    DefEntryID = 0;
-
-    while ((!DefEntryFound) && (DefEntryID < MaxDefEntries))
-    {
-        if ((strncmp(ResultsEntry->Name, DefTblPtr[DefEntryID].Name, CFE_TBL_MAX_FULL_NAME_LEN) == 0) &&
-            (DefTblPtr[DefEntryID].State != CS_STATE_EMPTY))
-        {
-            DefEntryFound               = true;
-            PreviousDefState            = DefTblPtr[DefEntryID].State;
-            DefTblPtr[DefEntryID].State = CS_STATE_DISABLED;
-            CS_ResetTablesTblResultEntry(CS_AppData.TblResTablesTblPtr);
-            CFE_TBL_Modified(DefTblHandle);
-        }
-        else
-        {
-            DefEntryID++;
-        }
-    }
+    ResultsEntry->ByteOffset  = 0;
+    ResultsEntry->ComputedYet = false;
 
     while (!DoneWithEntry)
     {
-        Status = CS_ComputeTables(ResultsEntry, &NewChecksumValue, &DoneWithEntry);
+        Status = CS_ComputeTables(ResultsEntry, &NewChecksumValue, &DoneWithEntry, Job);
 
         if (Status == CS_ERR_NOT_FOUND)
         {
             break;
         }
-
-        OS_TaskDelay(CS_CHILD_TASK_DELAY);
     }
 
     /* The new checksum value is stored in the table by the above functions */
     if (Status == CS_ERR_NOT_FOUND)
     {
-        CFE_EVS_SendEvent(CS_RECOMPUTE_ERROR_TABLES_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "Table %s recompute failed. Could not get address", ResultsEntry->Name);
+        Job->Outcome = CS_JOB_STATUS_FAILED;
     }
     else
     {
         /* reset the entry's variables for a newly computed value */
-        ResultsEntry->TempChecksumValue = 0;
-        ResultsEntry->ByteOffset        = 0;
-        ResultsEntry->ComputedYet       = true;
+        ResultsEntry->ByteOffset  = 0;
+        ResultsEntry->ComputedYet = true;
 
-        /* send event message */
-        CFE_EVS_SendEvent(CS_RECOMPUTE_FINISH_TABLES_INF_EID, CFE_EVS_EventType_INFORMATION,
-                          "Table %s recompute finished. New baseline is 0x%08X", ResultsEntry->Name,
-                          (unsigned int)NewChecksumValue);
+        Job->Info.Result = NewChecksumValue;
+        Job->Outcome     = CS_JOB_STATUS_DONE;
     }
 
     /* restore the entry's state */
     ResultsEntry->State = PreviousState;
-
-    /* Restore the definition table if we found one earlier */
-    if (DefEntryFound)
-    {
-        DefTblPtr[DefEntryID].State = PreviousDefState;
-        CS_ResetTablesTblResultEntry(CS_AppData.TblResTablesTblPtr);
-        CFE_TBL_Modified(DefTblHandle);
-    }
-
-    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
-    CFE_ES_ExitChildTask();
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* CS child task for getting the checksum on an area of memory      */
+/* CS job for getting the checksum on an area of memory            */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void CS_OneShotChildTask(void)
+void CS_OneShot(CS_Job_t *Job)
 {
     uint32  NewChecksumValue        = 0;
     uint32  NumBytesRemainingCycles = 0;
     uint32  NumBytesThisCycle       = 0;
     cpuaddr FirstAddrThisCycle      = 0;
     uint32  MaxBytesPerCycle        = 0;
+    uint64  Start                   = 0;
 
     NewChecksumValue        = 0;
-    NumBytesRemainingCycles = CS_AppData.HkPacket.Payload.LastOneShotSize;
-    FirstAddrThisCycle      = CS_AppData.HkPacket.Payload.LastOneShotAddress;
-    MaxBytesPerCycle        = CS_AppData.HkPacket.Payload.LastOneShotMaxBytesPerCycle;
+    NumBytesRemainingCycles = Job->Size;
+    FirstAddrThisCycle      = Job->Address;
+    MaxBytesPerCycle        = Job->MaxBytesPerCycle;
 
-    while (NumBytesRemainingCycles > 0)
+    /* A cancel takes effect between chunks */
+    while (NumBytesRemainingCycles > 0 && !Job->Cancel)
     {
         NumBytesThisCycle = ((MaxBytesPerCycle < NumBytesRemainingCycles) ? MaxBytesPerCycle : NumBytesRemainingCycles);
 
-        NewChecksumValue = CFE_ES_CalculateCRC((void *)(FirstAddrThisCycle), NumBytesThisCycle, NewChecksumValue,
-                                               CS_DEFAULT_ALGORITHM);
+        CS_JobsPace(Job, NumBytesThisCycle);
+
+        Start            = CS_BudgetGetTime();
+        NewChecksumValue = CS_CalculateCRC((void *)(FirstAddrThisCycle), NumBytesThisCycle, NewChecksumValue,
+                                           CS_DEFAULT_ALGORITHM);
+        CS_BudgetJobCharge(Job, NumBytesThisCycle, Start);
 
         /* Update the remainders for the next cycle */
         FirstAddrThisCycle += NumBytesThisCycle;
         NumBytesRemainingCycles -= NumBytesThisCycle;
-
-        OS_TaskDelay(CS_CHILD_TASK_DELAY);
     }
 
-    /*Checksum Calculation is done! */
-
-    /* put the new checksum value in the baseline */
-    CS_AppData.HkPacket.Payload.LastOneShotChecksum = NewChecksumValue;
-
-    /* send event message */
-    CFE_EVS_SendEvent(CS_ONESHOT_FINISHED_INF_EID, CFE_EVS_EventType_INFORMATION,
-                      "OneShot checksum on Address: 0x%08X, size %d completed. Checksum =  0x%08X",
-                      (unsigned int)(CS_AppData.HkPacket.Payload.LastOneShotAddress),
-                      (unsigned int)(CS_AppData.HkPacket.Payload.LastOneShotSize),
-                      (unsigned int)(CS_AppData.HkPacket.Payload.LastOneShotChecksum));
-
-    CS_AppData.HkPacket.Payload.OneShotInProgress = false;
-    CS_AppData.ChildTaskID                = CFE_ES_TASKID_UNDEFINED;
-
-    CFE_ES_ExitChildTask();
+    if (NumBytesRemainingCycles > 0)
+    {
+        Job->Outcome = CS_JOB_STATUS_CANCELLED;
+    }
+    else
+    {
+        Job->Info.Result = NewChecksumValue;
+        Job->Outcome     = CS_JOB_STATUS_DONE;
+    }
 }
@@ -31,6 +31,7 @@
  **************************************************************************/
 #include "cfe.h"
 #include "cs_tbldefs.h"
+#include "cs_jobs.h"
 
 /**
  * \brief Computes checksums on EEPROM or Memory types
@@ -56,12 +57,15 @@
  *                                     the specified entry's checksum was
  *                                     completed during this call.
  *
+ *  \param [in,out] Job                Job doing the checksum, or NULL for
+ *                                     the background cycle
+ *
  * \return Execution status
  * \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
  * \retval #CS_ERROR   \copybrief CS_ERROR
  */
 CFE_Status_t CS_ComputeEepromMemory(CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue,
-                                    bool *DoneWithEntry);
+                                    bool *DoneWithEntry, CS_Job_t *Job);
 
 /**
  * \brief Computes checksums on tables
@@ -71,7 +75,12 @@ CFE_Status_t CS_ComputeEepromMemory(CS_Res_EepromMemory_Table_Entry_t *ResultsEn
  *       function is used to compute checksums for tables.
  *
  *  \par Assumptions, External Events, and Notes:
- *        None
+ *        With #CS_ADOPT_TABLE_SERVICES_CRC, a background entry that has
+ *        no baseline when the table is loaded or updated takes the Table
+ *        Services CRC as its baseline if its algorithm is the same CRC.
+ *        A background entry with Snapshot set copies the table into
+ *        #CS_AppData_t::TableSnapshot when it starts and checksums the
+ *        copy, so an update part way through does not start it over.
  *
  *  \param [in]   ResultsEntry         A pointer to the entry in a table
  *                                     that we want to compute the
@@ -85,12 +94,16 @@ CFE_Status_t CS_ComputeEepromMemory(CS_Res_EepromMemory_Table_Entry_t *ResultsEn
  *                                     the specified entry's checksum was
  *                                     completed during this call.
  *
+ *  \param [in,out] Job                Job doing the checksum, or NULL for
+ *                                     the background cycle
+ *
  * \return Execution status
  * \retval #CFE_SUCCESS       \copybrief CFE_SUCCESS
  * \retval #CS_ERROR         \copybrief CS_ERROR
  * \retval #CS_ERR_NOT_FOUND \copydoc CS_ERR_NOT_FOUND
  */
-CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, bool *DoneWithEntry);
+CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, bool *DoneWithEntry,
+                              CS_Job_t *Job);
 
 /**
  * \brief Computes checksums on applications
@@ -114,63 +127,107 @@ CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32
  *                                     the specified entry's checksum was
  *                                     completed during this call.
  *
+ *  \param [in,out] Job                Job doing the checksum, or NULL for
+ *                                     the background cycle
+ *
  * \return Execution status
  * \retval #CFE_SUCCESS       \copybrief CFE_SUCCESS
  * \retval #CS_ERROR         \copybrief CS_ERROR
  * \retval #CS_ERR_NOT_FOUND \copydoc CS_ERR_NOT_FOUND
  */
-CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, bool *DoneWithEntry);
+CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, bool *DoneWithEntry,
+                           CS_Job_t *Job);
+
+/**
+ * \brief Disables the definition table entry of a recompute
+ *
+ *  \par Description
+ *       Disables the definition table entry matching the entry a recompute
+ *       job names, if there is one, and tells Table Services the
+ *       definition table changed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        Only called by the main task, when the job is queued, so the
+ *        definition table and its Tables results entry are never changed
+ *        while background checking works on them.  Definition table
+ *        updates are held off while the job is busy, see #CS_JobsBusy.
+ *
+ *  \param [in,out] Job  Recompute job naming the entry, which keeps the
+ *                       state to restore
+ */
+void CS_RecomputeDisableDefEntry(CS_Job_t *Job);
 
 /**
- * \brief Child task main function for recomputing  baselines for
- *        EEPROM and Memory types
+ * \brief Restores the definition table entry of a recompute
  *
  *  \par Description
- *       Child task main function that is spawned when a recompute
- *       baseline command is received for EEPROM, Memory, OS code segment
- *       or cFE core code segment.
+ *       Puts back the state #CS_RecomputeDisableDefEntry saved and tells
+ *       Table Services the definition table changed.
  *
  *  \par Assumptions, External Events, and Notes:
- *        Only one child task for CS can be running at any one time.
+ *        Only called by the main task, when the job is reported.
+ *
+ *  \param [in,out] Job  Recompute job
+ */
+void CS_RecomputeRestoreDefEntry(CS_Job_t *Job);
+
+/**
+ * \brief Recomputes the baseline of an EEPROM, Memory, OS code segment
+ *        or cFE core code segment entry
+ *
+ *  \par Description
+ *       Job function run by a CS job task for a recompute baseline command
+ *       for EEPROM, Memory, the OS code segment or the cFE core code
+ *       segment.  The entry is disabled while it is recomputed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        Runs in a job task, so the job is reported by #CS_JobsDrain.
+ *
+ *  \param [in,out] Job  Job naming the table type and entry, which gets
+ *                       the new baseline
  */
-void CS_RecomputeEepromMemoryChildTask(void);
+void CS_RecomputeEepromMemory(CS_Job_t *Job);
 
 /**
- * \brief Child task main function for recomputing baselines for
- *        Tables
+ * \brief Recomputes the baseline of a Tables entry
  *
  *  \par Description
- *       Child task main function that is spawned when a recompute
-        baseline command is received for a table.
+ *       Job function run by a CS job task for a recompute baseline command
+ *       for a table.
  *
  *  \par Assumptions, External Events, and Notes:
- *        Only one child task for CS can be running at any one time.
+ *        Runs in a job task, so the job is reported by #CS_JobsDrain.
+ *
+ *  \param [in,out] Job  Job naming the entry, which gets the new baseline
  */
-void CS_RecomputeTablesChildTask(void);
+void CS_RecomputeTables(CS_Job_t *Job);
 
 /**
- * \brief Child task main function for recomputing  baselines for
- *        Applications
+ * \brief Recomputes the baseline of an App entry
  *
  *  \par Description
-        Child task main function that is spawned when a recompute
- *       baseline command is received for Applications.
+ *       Job function run by a CS job task for a recompute baseline command
+ *       for an application.
  *
  *  \par Assumptions, External Events, and Notes:
- *        Only one child task for CS can be running at any one time.
+ *        Runs in a job task, so the job is reported by #CS_JobsDrain.
+ *
+ *  \param [in,out] Job  Job naming the entry, which gets the new baseline
  */
-void CS_RecomputeAppChildTask(void);
+void CS_RecomputeApp(CS_Job_t *Job);
 
 /**
- * \brief Child task main function for computing a one shot calculatipn
+ * \brief Computes a one shot checksum
  *
  *  \par Description
- *       Child task main function that is spawned when a one shot
- *       command is received.
+ *       Job function run by a CS job task for a one shot command.  Stops
+ *       between chunks if the job is cancelled.
  *
  *  \par Assumptions, External Events, and Notes:
- *        Only one child task for CS can be running at any one time.
+ *        Runs in a job task, so the job is reported by #CS_JobsDrain.
+ *
+ *  \param [in,out] Job  Job giving the address range, which gets the checksum
  */
-void CS_OneShotChildTask(void);
+void CS_OneShot(CS_Job_t *Job);
 
 #endif
@@ -0,0 +1,156 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   CRC engine for the CFS Checksum (CS) Application
+ */
+#ifndef CS_CRC_H
+#define CS_CRC_H
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+
+/**
+ * \brief CRC-32C (Castagnoli) algorithm identifier
+ *
+ *  \par Description
+ *       The cFE CRC types do not include CRC-32C, so CS defines its own
+ *       identifier for it.  It may be passed to #CS_CalculateCRC or used
+ *       as #CS_DEFAULT_ALGORITHM.
+ */
+#define CS_CRC_TYPE_CRC_32C 0x20
+
+/**
+ * \brief Selects the CRC kernels used by the CRC engine
+ *
+ *  \par Description
+ *       Probes the processor (CPUID on x86-64, HWCAP on ARMv8) and selects
+ *       the fastest available kernel for each CRC algorithm: carry-less
+ *       multiply folding for CRC-16 and CRC-32, and the native crc32
+ *       instructions for CRC-32C (and CRC-32 on ARMv8).  Algorithms with
+ *       no hardware support keep the portable slice-by-N kernel.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once during application initialization, before any
+ *       checksum is computed.  All kernels produce identical results.
+ *       Hardware kernels are only built when #CS_CRC_HW_ACCELERATION is
+ *       true and the compiler targets x86-64 or little-endian AArch64.
+ *
+ *  \param [in] UseHardware  When false, only the portable kernels are used
+ */
+void CS_CrcInit(bool UseHardware);
+
+/**
+ * \brief Calculates a CRC over a block of memory
+ *
+ *  \par Description
+ *       Computes the CRC of the specified block of memory using the
+ *       kernel selected by #CS_CrcInit.  The result is bit-identical to
+ *       #CFE_ES_CalculateCRC for the same arguments, so a CRC may be
+ *       computed across several calls by passing the previous result
+ *       back in as the InputCRC.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The CRC-16 result is returned sign-extended to 32 bits, exactly
+ *       as #CFE_ES_CalculateCRC returns it.  The CRC-32 is the reflected
+ *       IEEE 802.3 CRC and #CS_CRC_TYPE_CRC_32C is the Castagnoli CRC,
+ *       both with zlib-style chaining, so an InputCRC of 0 starts a new
+ *       CRC.  Unsupported algorithms return 0.
+ *
+ *  \param [in] DataPtr     Pointer to the start of the memory to CRC
+ *  \param [in] DataLength  Number of bytes to include in the CRC
+ *  \param [in] InputCRC    Starting value of the CRC, or the result of a
+ *                          previous call when continuing a CRC
+ *  \param [in] TypeCRC     CRC algorithm to use
+ *
+ * \return The computed CRC value
+ */
+uint32 CS_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC, CFE_ES_CrcType_Enum_t TypeCRC);
+
+/**
+ * \brief Combines the CRCs of two adjacent ranges of memory
+ *
+ *  \par Description
+ *       Given the CRC of a range A and the CRC of the range B that
+ *       immediately follows it, computes the CRC of A followed by B
+ *       without touching the data again.  This lets the sub-ranges of a
+ *       region be checksummed in any order, or concurrently, and still
+ *       produce the same value as one sequential pass.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       CrcB must be computed with an InputCRC of 0.  CrcA may be computed
+ *       with any InputCRC, and the result is the CRC of A and B from that
+ *       same starting value.  The cost is logarithmic in LengthB: x^(8 *
+ *       LengthB) mod P is built by squaring with GF(2) shift-and-add
+ *       multiplies.  Unsupported algorithms return 0.
+ *
+ *  \param [in] CrcA     CRC of the first range
+ *  \param [in] CrcB     CRC of the second range, started from 0
+ *  \param [in] LengthB  Length in bytes of the second range
+ *  \param [in] TypeCRC  CRC algorithm used for both ranges
+ *
+ * \return The CRC of the two ranges together
+ */
+uint32 CS_CrcCombine(uint32 CrcA, uint32 CrcB, size_t LengthB, CFE_ES_CrcType_Enum_t TypeCRC);
+
+/**
+ * \brief Calculates a CRC-64 over a block of memory
+ *
+ *  \par Description
+ *       Computes the CRC-64/XZ (reflected ECMA-182 polynomial) of the
+ *       specified block of memory.  Like the CRC-32s it uses zlib-style
+ *       chaining, so an InputCRC of 0 starts a new CRC and a CRC may be
+ *       computed across several calls by passing the previous result back
+ *       in as the InputCRC.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Always uses the portable slice-by-N kernel.
+ *
+ *  \param [in] DataPtr     Pointer to the start of the memory to CRC
+ *  \param [in] DataLength  Number of bytes to include in the CRC
+ *  \param [in] InputCRC    Starting value of the CRC, or the result of a
+ *                          previous call when continuing a CRC
+ *
+ * \return The computed CRC value
+ */
+uint64 CS_CalculateCRC64(const void *DataPtr, size_t DataLength, uint64 InputCRC);
+
+/**
+ * \brief Combines the CRC-64s of two adjacent ranges of memory
+ *
+ *  \par Description
+ *       The CRC-64 counterpart of #CS_CrcCombine.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       CrcB must be computed with an InputCRC of 0.
+ *
+ *  \param [in] CrcA     CRC-64 of the first range
+ *  \param [in] CrcB     CRC-64 of the second range, started from 0
+ *  \param [in] LengthB  Length in bytes of the second range
+ *
+ * \return The CRC-64 of the two ranges together
+ */
+uint64 CS_Crc64Combine(uint64 CrcA, uint64 CrcB, size_t LengthB);
+
+#endif
@@ -31,6 +31,8 @@
 #include "cs_app_cmds.h"
 #include "cs_cmds.h"
 #include "cs_init.h"
+#include "cs_block.h"
+#include "cs_baseline.h"
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
@@ -102,6 +104,9 @@ CFE_Status_t CS_InitAllTables(void)
 {
     CFE_Status_t ResultInit = CFE_SUCCESS;
 
+    /* The block trees must be available before the EEPROM and Memory tables are processed */
+    CS_BlockTreeInit();
+
     ResultInit = CS_TableInit(&CS_AppData.DefEepromTableHandle, &CS_AppData.ResEepromTableHandle,
                               (void *)&CS_AppData.DefEepromTblPtr, (void *)&CS_AppData.ResEepromTblPtr, CS_EEPROM_TABLE,
                               CS_DEF_EEPROM_TABLE_NAME, CS_RESULTS_EEPROM_TABLE_NAME, CS_MAX_NUM_EEPROM_TABLE_ENTRIES,
@@ -117,6 +122,8 @@ CFE_Status_t CS_InitAllTables(void)
     }
     else
     {
+        CS_BaselineRestore(CS_EEPROM_TABLE);
+
         ResultInit = CS_TableInit(&CS_AppData.DefMemoryTableHandle, &CS_AppData.ResMemoryTableHandle,
                                   (void *)&CS_AppData.DefMemoryTblPtr, (void *)&CS_AppData.ResMemoryTblPtr,
                                   CS_MEMORY_TABLE, CS_DEF_MEMORY_TABLE_NAME, CS_RESULTS_MEMORY_TABLE_NAME,
@@ -130,6 +137,10 @@ CFE_Status_t CS_InitAllTables(void)
             CFE_EVS_SendEvent(CS_INIT_MEMORY_ERR_EID, CFE_EVS_EventType_ERROR,
                               "Table initialization failed for Memory: 0x%08X", (unsigned int)ResultInit);
         }
+        else
+        {
+            CS_BaselineRestore(CS_MEMORY_TABLE);
+        }
     }
 
     if (ResultInit == CFE_SUCCESS)
@@ -191,7 +202,10 @@ void CS_InitSegments(void)
         CS_AppData.CfeCoreCodeSeg.ComputedYet        = false;
         CS_AppData.CfeCoreCodeSeg.ComparisonValue    = 0;
         CS_AppData.CfeCoreCodeSeg.ByteOffset         = 0;
-        CS_AppData.CfeCoreCodeSeg.TempChecksumValue  = 0;
+        CS_AppData.CfeCoreCodeSeg.LastCheckTime      = 0;
+        CS_AppData.CfeCoreCodeSeg.DeadlineMisses     = 0;
+        CS_AppData.CfeCoreCodeSeg.Algorithm          = CS_ALGORITHM_DEFAULT;
+        CS_AppData.CfeCoreCodeSeg.Streaming          = CS_CFECORE_STREAMING;
         CS_AppData.CfeCoreCodeSeg.State              = CS_STATE_DISABLED;
 
         CFE_EVS_SendEvent(CS_CFE_TEXT_SEG_INF_EID, CFE_EVS_EventType_INFORMATION, "CFE Text Segment disabled");
@@ -203,7 +217,10 @@ void CS_InitSegments(void)
         CS_AppData.CfeCoreCodeSeg.ComputedYet        = false;
         CS_AppData.CfeCoreCodeSeg.ComparisonValue    = 0;
         CS_AppData.CfeCoreCodeSeg.ByteOffset         = 0;
-        CS_AppData.CfeCoreCodeSeg.TempChecksumValue  = 0;
+        CS_AppData.CfeCoreCodeSeg.LastCheckTime      = 0;
+        CS_AppData.CfeCoreCodeSeg.DeadlineMisses     = 0;
+        CS_AppData.CfeCoreCodeSeg.Algorithm          = CS_ALGORITHM_DEFAULT;
+        CS_AppData.CfeCoreCodeSeg.Streaming          = CS_CFECORE_STREAMING;
         CS_AppData.CfeCoreCodeSeg.State              = CS_STATE_ENABLED;
     }
 
@@ -218,7 +235,10 @@ void CS_InitSegments(void)
         CS_AppData.OSCodeSeg.ComputedYet        = false;
         CS_AppData.OSCodeSeg.ComparisonValue    = 0;
         CS_AppData.OSCodeSeg.ByteOffset         = 0;
-        CS_AppData.OSCodeSeg.TempChecksumValue  = 0;
+        CS_AppData.OSCodeSeg.LastCheckTime      = 0;
+        CS_AppData.OSCodeSeg.DeadlineMisses     = 0;
+        CS_AppData.OSCodeSeg.Algorithm          = CS_ALGORITHM_DEFAULT;
+        CS_AppData.OSCodeSeg.Streaming          = CS_OS_STREAMING;
         CS_AppData.OSCodeSeg.State              = CS_STATE_DISABLED;
 
         CFE_EVS_SendEvent(CS_OS_TEXT_SEG_INF_EID, CFE_EVS_EventType_INFORMATION,
@@ -231,7 +251,13 @@ void CS_InitSegments(void)
         CS_AppData.OSCodeSeg.ComputedYet        = false;
         CS_AppData.OSCodeSeg.ComparisonValue    = 0;
         CS_AppData.OSCodeSeg.ByteOffset         = 0;
-        CS_AppData.OSCodeSeg.TempChecksumValue  = 0;
+        CS_AppData.OSCodeSeg.LastCheckTime      = 0;
+        CS_AppData.OSCodeSeg.DeadlineMisses     = 0;
+        CS_AppData.OSCodeSeg.Algorithm          = CS_ALGORITHM_DEFAULT;
+        CS_AppData.OSCodeSeg.Streaming          = CS_OS_STREAMING;
         CS_AppData.OSCodeSeg.State              = CS_STATE_ENABLED;
     }
+
+    CS_BaselineRestore(CS_CFECORE);
+    CS_BaselineRestore(CS_OSCORE);
 }
@@ -0,0 +1,704 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   The CFS Checksum (CS) Application's recompute and OneShot job queue
+ */
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+#include "cs_app.h"
+#include <string.h>
+#include <stdio.h>
+#include "cs_events.h"
+#include "cs_compute.h"
+#include "cs_budget.h"
+#include "cs_block.h"
+#include "cs_jobs.h"
+
+/**************************************************************************
+ **
+ ** Local data
+ **
+ **************************************************************************/
+
+/* Indexed by the CS_CFECORE ... CS_APP_TABLE identifiers */
+static const char *const CS_JobTableNames[CS_NUM_TABLES] = {"cFE Core", "OS", "EEPROM", "Memory", "Tables", "App"};
+
+/**************************************************************************
+ **
+ ** Functions
+ **
+ **************************************************************************/
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that checks whether a job is queued or running      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool CS_JobPending(const CS_Job_t *Job)
+{
+    /* Only CS_JobsDrain moves a job on from running, so a finished job still counts until it is reported */
+    return (Job->Info.Status == CS_JOB_STATUS_QUEUED || Job->Info.Status == CS_JOB_STATUS_RUNNING);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that updates the job status telemetry               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_JobsUpdateTlm(void)
+{
+    CS_JobQueue_t *Queue     = &CS_AppData.Jobs;
+    bool           Recompute = false;
+    bool           OneShot   = false;
+    uint32         i         = 0;
+
+    for (i = 0; i < CS_JOB_QUEUE_DEPTH; i++)
+    {
+        if (CS_JobPending(&Queue->Job[i]))
+        {
+            if (Queue->Job[i].Info.Type == CS_JOB_TYPE_ONESHOT)
+            {
+                OneShot = true;
+            }
+            else
+            {
+                Recompute = true;
+            }
+        }
+
+        CS_AppData.HkPacket.Payload.Jobs[i] = Queue->Job[i].Info;
+    }
+
+    CS_AppData.HkPacket.Payload.RecomputeInProgress = Recompute;
+    CS_AppData.HkPacket.Payload.OneShotInProgress   = OneShot;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that claims a free job slot                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static CS_Job_t *CS_JobsClaim(uint8 Type)
+{
+    CS_JobQueue_t *Queue = &CS_AppData.Jobs;
+    CS_Job_t      *Job   = NULL;
+    uint32         i     = 0;
+
+    if (Queue->Active)
+    {
+        for (i = 0; i < CS_JOB_QUEUE_DEPTH && Job == NULL; i++)
+        {
+            if (!CS_JobPending(&Queue->Job[i]))
+            {
+                Job = &Queue->Job[i];
+
+                memset(Job, 0, sizeof(*Job));
+                Job->Info.Type = Type;
+                Job->Rate      = CS_AppData.HkPacket.Payload.JobRate;
+                Job->Burst     = CS_AppData.HkPacket.Payload.JobBurst;
+            }
+        }
+    }
+
+    return Job;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that hands a claimed job slot to the job tasks      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_JobsQueue(CS_Job_t *Job)
+{
+    CS_JobQueue_t *Queue = &CS_AppData.Jobs;
+
+    Job->Info.Status = CS_JOB_STATUS_QUEUED;
+
+    OS_MutSemTake(Queue->MutexId);
+    Queue->Pending.Slot[Queue->Pending.Head % CS_JOB_QUEUE_DEPTH] = (uint8)(Job - Queue->Job);
+    Queue->Pending.Head++;
+    OS_MutSemGive(Queue->MutexId);
+
+    OS_CountSemGive(Queue->PendingSemId);
+
+    CS_JobsUpdateTlm();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that recomputes the entry a job names               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_JobsRecomputeEntry(CS_Job_t *Job)
+{
+    if (Job->Info.Table == CS_TABLES_TABLE)
+    {
+        CS_RecomputeTables(Job);
+    }
+    else if (Job->Info.Table == CS_APP_TABLE)
+    {
+        CS_RecomputeApp(Job);
+    }
+    else
+    {
+        CS_RecomputeEepromMemory(Job);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that recomputes every entry of a table type         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_JobsRecomputeAll(CS_Job_t *Job)
+{
+    uint16 NumEntries = 1;
+    uint16 EntryID    = 0;
+    uint16 State      = CS_STATE_ENABLED;
+    uint32 Recomputed = 0;
+
+    if (Job->Info.Table == CS_EEPROM_TABLE)
+    {
+        NumEntries = CS_MAX_NUM_EEPROM_TABLE_ENTRIES;
+    }
+    else if (Job->Info.Table == CS_MEMORY_TABLE)
+    {
+        NumEntries = CS_MAX_NUM_MEMORY_TABLE_ENTRIES;
+    }
+    else if (Job->Info.Table == CS_TABLES_TABLE)
+    {
+        NumEntries = CS_MAX_NUM_TABLES_TABLE_ENTRIES;
+    }
+    else if (Job->Info.Table == CS_APP_TABLE)
+    {
+        NumEntries = CS_MAX_NUM_APP_TABLE_ENTRIES;
+    }
+
+    for (EntryID = 0; EntryID < NumEntries; EntryID++)
+    {
+        /* The code segments are a single entry that is always there */
+        if (Job->Info.Table == CS_EEPROM_TABLE)
+        {
+            State = CS_AppData.ResEepromTblPtr[EntryID].State;
+        }
+        else if (Job->Info.Table == CS_MEMORY_TABLE)
+        {
+            State = CS_AppData.ResMemoryTblPtr[EntryID].State;
+        }
+        else if (Job->Info.Table == CS_TABLES_TABLE)
+        {
+            State = CS_AppData.ResTablesTblPtr[EntryID].State;
+        }
+        else if (Job->Info.Table == CS_APP_TABLE)
+        {
+            State = CS_AppData.ResAppTblPtr[EntryID].State;
+        }
+
+        if (State != CS_STATE_EMPTY)
+        {
+            /* Background checking takes the entries before EntryID back, so the last one must be written first */
+            CS_JOB_MEMORY_BARRIER();
+
+            Job->Info.EntryID = EntryID;
+            CS_JobsRecomputeEntry(Job);
+
+            if (Job->Outcome == CS_JOB_STATUS_DONE)
+            {
+                Recomputed++;
+            }
+        }
+    }
+
+    Job->Info.Result = Recomputed;
+    Job->Outcome     = CS_JOB_STATUS_DONE;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that reports a finished job                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_JobsReport(CS_Job_t *Job)
+{
+    uint16 Table = Job->Info.Table;
+
+    Job->Info.Status = Job->Outcome;
+
+    CS_RecomputeRestoreDefEntry(Job);
+
+    if (Job->Info.Type == CS_JOB_TYPE_ONESHOT)
+    {
+        if (Job->Outcome == CS_JOB_STATUS_DONE)
+        {
+            CS_AppData.HkPacket.Payload.LastOneShotAddress          = Job->Address;
+            CS_AppData.HkPacket.Payload.LastOneShotSize             = Job->Size;
+            CS_AppData.HkPacket.Payload.LastOneShotMaxBytesPerCycle = Job->MaxBytesPerCycle;
+            CS_AppData.HkPacket.Payload.LastOneShotChecksum         = Job->Info.Result;
+
+            CFE_EVS_SendEvent(CS_ONESHOT_FINISHED_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "OneShot checksum on Address: 0x%08X, size %d completed. Checksum =  0x%08X",
+                              (unsigned int)(Job->Address), (unsigned int)(Job->Size),
+                              (unsigned int)(Job->Info.Result));
+        }
+    }
+    else if (Job->Info.Type == CS_JOB_TYPE_RECOMPUTE_ALL)
+    {
+        if (Table == CS_CFECORE)
+        {
+            CS_AppData.HkPacket.Payload.CfeCoreBaseline = CS_AppData.CfeCoreCodeSeg.ComparisonValue;
+        }
+        else if (Table == CS_OSCORE)
+        {
+            CS_AppData.HkPacket.Payload.OSBaseline = CS_AppData.OSCodeSeg.ComparisonValue;
+        }
+
+        CFE_EVS_SendEvent(CS_RECOMPUTE_ALL_FINISH_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "%s recompute of all entries finished, %u entries recomputed", CS_JobTableNames[Table],
+                          (unsigned int)Job->Info.Result);
+    }
+    else if (Table == CS_TABLES_TABLE)
+    {
+        if (Job->Outcome == CS_JOB_STATUS_DONE)
+        {
+            CFE_EVS_SendEvent(CS_RECOMPUTE_FINISH_TABLES_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "Table %s recompute finished. New baseline is 0x%08X",
+                              CS_AppData.ResTablesTblPtr[Job->Info.EntryID].Name, (unsigned int)Job->Info.Result);
+        }
+        else
+        {
+            CFE_EVS_SendEvent(CS_RECOMPUTE_ERROR_TABLES_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Table %s recompute failed. Could not get address",
+                              CS_AppData.ResTablesTblPtr[Job->Info.EntryID].Name);
+        }
+    }
+    else if (Table == CS_APP_TABLE)
+    {
+        if (Job->Outcome == CS_JOB_STATUS_DONE)
+        {
+            CFE_EVS_SendEvent(CS_RECOMPUTE_FINISH_APP_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "App %s recompute finished. New baseline is 0x%08X",
+                              CS_AppData.ResAppTblPtr[Job->Info.EntryID].Name, (unsigned int)Job->Info.Result);
+        }
+        else
+        {
+            CFE_EVS_SendEvent(CS_RECOMPUTE_ERROR_APP_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "App %s recompute failed. Could not get address",
+                              CS_AppData.ResAppTblPtr[Job->Info.EntryID].Name);
+        }
+    }
+    else
+    {
+        if (Table == CS_CFECORE)
+        {
+            CS_AppData.HkPacket.Payload.CfeCoreBaseline = Job->Info.Result;
+        }
+        else if (Table == CS_OSCORE)
+        {
+            CS_AppData.HkPacket.Payload.OSBaseline = Job->Info.Result;
+        }
+
+        if (Job->NumBlocks != 0)
+        {
+            CFE_EVS_SendEvent(CS_RECOMPUTE_BLOCKS_DBG_EID, CFE_EVS_EventType_DEBUG,
+                              "%s entry %d recompute rehashed %u of %u blocks", CS_JobTableNames[Table],
+                              Job->Info.EntryID, (unsigned int)Job->NumBlocksRehashed, (unsigned int)Job->NumBlocks);
+        }
+
+        CFE_EVS_SendEvent(CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "%s entry %d recompute finished. New baseline is 0X%08X", CS_JobTableNames[Table],
+                          Job->Info.EntryID, (unsigned int)Job->Info.Result);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that starts the job queue                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_JobsInit(void)
+{
+    CS_JobQueue_t *Queue  = &CS_AppData.Jobs;
+    int32          Status = OS_SUCCESS;
+    uint32         i      = 0;
+    char           TaskName[CFE_MISSION_MAX_API_LEN];
+
+    memset(Queue, 0, sizeof(*Queue));
+
+    CS_AppData.HkPacket.Payload.JobRate  = CS_DEFAULT_JOB_RATE;
+    CS_AppData.HkPacket.Payload.JobBurst = CS_DEFAULT_JOB_BURST;
+
+    Status = OS_MutSemCreate(&Queue->MutexId, CS_JOB_MUTEX_SEM_NAME, 0);
+
+    if (Status == OS_SUCCESS)
+    {
+        Status = OS_CountSemCreate(&Queue->PendingSemId, CS_JOB_PENDING_SEM_NAME, 0, 0);
+    }
+
+    if (Status != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(CS_JOB_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Job queue semaphore create failed, RC = 0x%08X", (unsigned int)Status);
+    }
+    else
+    {
+        for (i = 0; i < CS_NUM_JOB_TASKS; i++)
+        {
+            snprintf(TaskName, sizeof(TaskName), "%s%u", CS_JOB_TASK_NAME, (unsigned int)i);
+
+            Status = CFE_ES_CreateChildTask(&Queue->TaskId[Queue->NumTasks], TaskName, CS_JobTask, NULL,
+                                            CFE_PLATFORM_ES_DEFAULT_STACK_SIZE, CS_CHILD_TASK_PRIORITY, 0);
+
+            if (Status != CFE_SUCCESS)
+            {
+                CFE_EVS_SendEvent(CS_JOB_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Job task %d create failed, CFE_ES_CreateChildTask returned: 0x%08X", (int)i,
+                                  (unsigned int)Status);
+                break;
+            }
+
+            Queue->NumTasks++;
+        }
+
+        Queue->Active = (Queue->NumTasks > 0);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that queues a recompute job                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_JobsSubmitRecompute(uint8 Type, uint16 Table, uint16 EntryID)
+{
+    CS_JobQueue_t *Queue     = &CS_AppData.Jobs;
+    CS_Job_t      *Job       = NULL;
+    CS_Job_t      *Other     = NULL;
+    bool           Duplicate = false;
+    uint32         i         = 0;
+
+    for (i = 0; i < CS_JOB_QUEUE_DEPTH; i++)
+    {
+        Other = &Queue->Job[i];
+
+        /* Two jobs recomputing the same entry would each restore the state the other saved */
+        if (CS_JobPending(Other) && Other->Info.Type != CS_JOB_TYPE_ONESHOT && Other->Info.Table == Table &&
+            (Type == CS_JOB_TYPE_RECOMPUTE_ALL || Other->Info.Type == CS_JOB_TYPE_RECOMPUTE_ALL ||
+             Other->Info.EntryID == EntryID))
+        {
+            Duplicate = true;
+        }
+    }
+
+    if (!Duplicate)
+    {
+        Job = CS_JobsClaim(Type);
+    }
+
+    if (Job != NULL)
+    {
+        Job->Info.Table   = Table;
+        Job->Info.EntryID = ((Type == CS_JOB_TYPE_RECOMPUTE_ALL) ? 0 : EntryID);
+
+        if (Type == CS_JOB_TYPE_RECOMPUTE)
+        {
+            CS_RecomputeDisableDefEntry(Job);
+        }
+
+        /* The leaves checksummed so far may predate whatever the recompute is for */
+        CS_BlockTreeInvalidate(Table, EntryID, (Type == CS_JOB_TYPE_RECOMPUTE_ALL));
+
+        CS_JobsQueue(Job);
+    }
+
+    return (Job != NULL);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that queues a OneShot job                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_JobsSubmitOneShot(cpuaddr Address, uint32 Size, uint32 MaxBytesPerCycle)
+{
+    CS_Job_t *Job = CS_JobsClaim(CS_JOB_TYPE_ONESHOT);
+
+    if (Job != NULL)
+    {
+        Job->Address          = Address;
+        Job->Size             = Size;
+        Job->MaxBytesPerCycle = MaxBytesPerCycle;
+
+        CS_JobsQueue(Job);
+    }
+
+    return (Job != NULL);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that cancels every OneShot job                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_JobsCancelOneShots(void)
+{
+    CS_JobQueue_t *Queue     = &CS_AppData.Jobs;
+    bool           Cancelled = false;
+    uint32         i         = 0;
+
+    for (i = 0; i < CS_JOB_QUEUE_DEPTH; i++)
+    {
+        if (Queue->Job[i].Info.Type == CS_JOB_TYPE_ONESHOT && CS_JobPending(&Queue->Job[i]) &&
+            !Queue->Job[i].Cancel)
+        {
+            Queue->Job[i].Cancel = true;
+            Cancelled            = true;
+        }
+    }
+
+    return Cancelled;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that checks for a recompute in a table type         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_JobsBusy(uint16 Table)
+{
+    CS_JobQueue_t *Queue = &CS_AppData.Jobs;
+    bool           Busy  = false;
+    uint32         i     = 0;
+
+    for (i = 0; i < CS_JOB_QUEUE_DEPTH; i++)
+    {
+        if (CS_JobPending(&Queue->Job[i]) && Queue->Job[i].Info.Type != CS_JOB_TYPE_ONESHOT &&
+            Queue->Job[i].Info.Table == Table)
+        {
+            Busy = true;
+        }
+    }
+
+    return Busy;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that checks whether a recompute owns an entry       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_JobsEntryBusy(uint16 Table, uint16 EntryID)
+{
+    CS_JobQueue_t *Queue = &CS_AppData.Jobs;
+    CS_Job_t      *Job   = NULL;
+    bool           Busy  = false;
+    uint32         i     = 0;
+
+    for (i = 0; i < CS_JOB_QUEUE_DEPTH; i++)
+    {
+        Job = &Queue->Job[i];
+
+        /* A recompute of every entry only moves forward, so an old EntryID just holds back more entries */
+        if (CS_JobPending(Job) && Job->Info.Type != CS_JOB_TYPE_ONESHOT && Job->Info.Table == Table &&
+            (Job->Info.EntryID == EntryID ||
+             (Job->Info.Type == CS_JOB_TYPE_RECOMPUTE_ALL && Job->Info.EntryID < EntryID)))
+        {
+            Busy = true;
+        }
+    }
+
+    /* Pairs with the barrier before a recompute of every entry moves on */
+    CS_JOB_MEMORY_BARRIER();
+
+    return Busy;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that collects what the job tasks have used          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_JobsCollectCharges(uint32 *Bytes, uint32 *Time)
+{
+    CS_JobQueue_t *Queue        = &CS_AppData.Jobs;
+    CS_Job_t      *Job          = NULL;
+    uint32         BytesCharged = 0;
+    uint32         TimeCharged  = 0;
+    uint32         i            = 0;
+
+    *Bytes = 0;
+    *Time  = 0;
+
+    for (i = 0; i < CS_JOB_QUEUE_DEPTH; i++)
+    {
+        Job = &Queue->Job[i];
+
+        /* Read each counter once, since the job task may be counting it up */
+        BytesCharged = Job->BytesCharged;
+        TimeCharged  = Job->TimeCharged;
+
+        *Bytes += BytesCharged - Job->BytesTaken;
+        *Time += TimeCharged - Job->TimeTaken;
+
+        Job->BytesTaken = BytesCharged;
+        Job->TimeTaken  = TimeCharged;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that holds a job to its rate                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_JobsPace(CS_Job_t *Job, uint32 Bytes)
+{
+    int64  Full    = (int64)Job->Burst * 1000000;
+    uint64 Now     = 0;
+    uint64 Elapsed = 0;
+    uint64 Wait    = 0;
+
+    if (Job->Rate != 0)
+    {
+        Now     = CS_BudgetGetTime();
+        Elapsed = Now - Job->Refilled;
+
+        /* Tokens are kept in byte-microseconds so no fraction of a byte is lost between calls */
+        if (Elapsed >= (uint64)(Full - Job->Tokens) / Job->Rate)
+        {
+            Job->Tokens = Full;
+        }
+        else
+        {
+            Job->Tokens += (int64)(Elapsed * Job->Rate);
+        }
+
+        Job->Refilled = Now;
+        Job->Tokens -= (int64)Bytes * 1000000;
+
+        if (Job->Tokens < 0)
+        {
+            /* Round up to whole milliseconds; sleeping too long only refills the bucket sooner */
+            Wait = ((uint64)(-Job->Tokens) + Job->Rate - 1) / Job->Rate;
+
+            OS_TaskDelay((uint32)((Wait + 999) / 1000));
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that reports the jobs the job tasks have finished   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_JobsDrain(void)
+{
+    CS_JobQueue_t *Queue = &CS_AppData.Jobs;
+    CS_JobRing_t  *Ring  = NULL;
+    uint32         i     = 0;
+
+    for (i = 0; i < CS_NUM_JOB_TASKS; i++)
+    {
+        Ring = &Queue->Completed[i];
+
+        while (Ring->Tail != Ring->Head)
+        {
+            /* Pairs with the barrier before the job task moved Head */
+            CS_JOB_MEMORY_BARRIER();
+
+            CS_JobsReport(&Queue->Job[Ring->Slot[Ring->Tail % CS_JOB_QUEUE_DEPTH]]);
+            Ring->Tail++;
+        }
+    }
+
+    CS_JobsUpdateTlm();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that runs a job                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_JobsRun(CS_Job_t *Job)
+{
+    Job->Outcome  = CS_JOB_STATUS_FAILED;
+    Job->Tokens   = (int64)Job->Burst * 1000000;
+    Job->Refilled = CS_BudgetGetTime();
+
+    /* Without a rate limit the job only gets the CPU that higher priority tasks leave */
+    OS_TaskSetPriority(OS_TaskGetId(), (Job->Rate == 0) ? CS_JOB_LOW_PRIORITY : CS_CHILD_TASK_PRIORITY);
+
+    if (Job->Cancel)
+    {
+        Job->Outcome = CS_JOB_STATUS_CANCELLED;
+    }
+    else if (Job->Info.Type == CS_JOB_TYPE_ONESHOT)
+    {
+        CS_OneShot(Job);
+    }
+    else if (Job->Info.Type == CS_JOB_TYPE_RECOMPUTE_ALL)
+    {
+        CS_JobsRecomputeAll(Job);
+    }
+    else
+    {
+        CS_JobsRecomputeEntry(Job);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS job queue child task                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_JobTask(void)
+{
+    CS_JobQueue_t *Queue     = &CS_AppData.Jobs;
+    CS_JobRing_t  *Completed = NULL;
+    CS_Job_t      *Job       = NULL;
+    uint8          Slot      = 0;
+
+    OS_MutSemTake(Queue->MutexId);
+    Completed = &Queue->Completed[Queue->NextTaskIndex++];
+    OS_MutSemGive(Queue->MutexId);
+
+    while (OS_CountSemTake(Queue->PendingSemId) == OS_SUCCESS)
+    {
+        OS_MutSemTake(Queue->MutexId);
+        Slot = Queue->Pending.Slot[Queue->Pending.Tail % CS_JOB_QUEUE_DEPTH];
+        Queue->Pending.Tail++;
+        Job              = &Queue->Job[Slot];
+        Job->Info.Status = CS_JOB_STATUS_RUNNING;
+        OS_MutSemGive(Queue->MutexId);
+
+        CS_JobsRun(Job);
+
+        /* Only this task adds to its completion ring, and the slot must be written before Head moves */
+        Completed->Slot[Completed->Head % CS_JOB_QUEUE_DEPTH] = Slot;
+        CS_JOB_MEMORY_BARRIER();
+        Completed->Head++;
+    }
+
+    CFE_ES_ExitChildTask();
+}
@@ -0,0 +1,341 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Recompute and OneShot job queue for the CFS Checksum (CS) Application
+ */
+#ifndef CS_JOBS_H
+#define CS_JOBS_H
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+#include "cs_platform_cfg.h"
+#include "cs_msg.h"
+
+/**************************************************************************
+ **
+ ** Macro definitions
+ **
+ **************************************************************************/
+
+/**
+ * \name CS Job Queue Semaphore Names
+ * \{
+ */
+#define CS_JOB_MUTEX_SEM_NAME   "CS_JobMutex"
+#define CS_JOB_PENDING_SEM_NAME "CS_JobPending"
+/**\}*/
+
+/**
+ * \brief Orders a job task's writes to a job before the completion ring's head
+ *
+ * \par Description
+ *      A full barrier where the compiler provides one.  Without it the job
+ *      queue still relies on the ring's head being written last.
+ */
+#if defined(__GNUC__)
+#define CS_JOB_MEMORY_BARRIER() __sync_synchronize()
+#else
+#define CS_JOB_MEMORY_BARRIER()
+#endif
+
+/**************************************************************************
+ **
+ ** Type definitions
+ **
+ **************************************************************************/
+
+/**
+ *  \brief One slot of the CS job queue
+ *
+ *  The main task fills in a slot when it queues a job and reports it when
+ *  the job comes back on a completion ring.  A job task owns the slot in
+ *  between.
+ */
+typedef struct
+{
+    CS_JobStatus_t Info; /**< \brief What the job is and how it is going, as reported in telemetry */
+
+    cpuaddr Address;          /**< \brief Start address of a OneShot */
+    uint32  Size;             /**< \brief Size in bytes of a OneShot */
+    uint32  MaxBytesPerCycle; /**< \brief Bytes of a OneShot checksummed at a time */
+
+    uint32 Rate;     /**< \brief Bytes per second the job checksums, 0 for no limit at low priority */
+    uint32 Burst;    /**< \brief Bytes the job's token bucket holds */
+    int64  Tokens;   /**< \brief Bytes in the token bucket times 1000000, negative while the job is ahead */
+    uint64 Refilled; /**< \brief #CS_BudgetGetTime when the token bucket was last filled */
+
+    uint32 NumBlocks;         /**< \brief Leaf blocks of the block tree a recompute used, 0 if it used none */
+    uint32 NumBlocksRehashed; /**< \brief Leaf blocks the recompute rehashed */
+
+    uint16 *DefState;         /**< \brief State of the definition entry a recompute disabled, NULL if none */
+    uint16  PreviousDefState; /**< \brief State to put back in *DefState once the recompute is reported */
+
+    uint8         Outcome; /**< \brief Status the job finished with, set by the job task */
+    volatile bool Cancel;  /**< \brief Set by the main task to stop a OneShot after its current chunk */
+
+    volatile uint32 BytesCharged; /**< \brief Bytes checksummed so far, counted up by the job task */
+    volatile uint32 TimeCharged;  /**< \brief Microseconds spent checksumming so far, counted up by the job task */
+    uint32          BytesTaken;   /**< \brief BytesCharged already taken off the background budget */
+    uint32          TimeTaken;    /**< \brief TimeCharged already taken off the background budget */
+} CS_Job_t;
+
+/**
+ *  \brief Ring of job slot numbers
+ *
+ *  Head and Tail count up forever; the slot number at a count is kept in
+ *  Slot[count % #CS_JOB_QUEUE_DEPTH].  A ring never holds more than
+ *  #CS_JOB_QUEUE_DEPTH slot numbers because there are only that many jobs.
+ */
+typedef struct
+{
+    volatile uint32 Head;                     /**< \brief Count of slot numbers put on the ring */
+    volatile uint32 Tail;                     /**< \brief Count of slot numbers taken off the ring */
+    uint8           Slot[CS_JOB_QUEUE_DEPTH]; /**< \brief Slot numbers */
+} CS_JobRing_t;
+
+/**
+ *  \brief CS job queue state
+ *
+ *  Jobs are queued on the Pending ring, which the job tasks share under
+ *  MutexId.  Each job task puts the jobs it finishes on its own Completed
+ *  ring, which only the main task takes from, so no lock is needed there.
+ */
+typedef struct
+{
+    bool   Active;        /**< \brief true when there are job tasks to run queued jobs */
+    uint32 NumTasks;      /**< \brief Number of job tasks running */
+    uint32 NextTaskIndex; /**< \brief Completed ring for the next job task to start */
+
+    CFE_ES_TaskId_t TaskId[CS_NUM_JOB_TASKS]; /**< \brief Job task IDs */
+
+    osal_id_t MutexId;      /**< \brief Protects the Pending ring and NextTaskIndex */
+    osal_id_t PendingSemId; /**< \brief Counting semaphore given once for each queued job */
+
+    CS_Job_t     Job[CS_JOB_QUEUE_DEPTH];     /**< \brief Job slots */
+    CS_JobRing_t Pending;                     /**< \brief Jobs waiting for a job task */
+    CS_JobRing_t Completed[CS_NUM_JOB_TASKS]; /**< \brief Jobs finished by each job task */
+} CS_JobQueue_t;
+
+/**************************************************************************
+ **
+ ** Function prototypes
+ **
+ **************************************************************************/
+
+/**
+ * \brief Starts the job queue
+ *
+ *  \par Description
+ *       Creates the job queue semaphores and #CS_NUM_JOB_TASKS job tasks at
+ *       #CS_CHILD_TASK_PRIORITY, and sets the job rate to its default.  If
+ *       only some of the job tasks can be created the queue runs with those.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once during application initialization.  If nothing could
+ *       be created the queue stays inactive and every job is rejected.
+ */
+void CS_JobsInit(void);
+
+/**
+ * \brief Queues a recompute job
+ *
+ *  \par Description
+ *       Queues a #CS_JOB_TYPE_RECOMPUTE job for one entry, or a
+ *       #CS_JOB_TYPE_RECOMPUTE_ALL job for every entry of a table type,
+ *       and sets #CS_HkPacket_Payload_t.RecomputeInProgress.  The
+ *       definition table entry of a single entry stays disabled until the
+ *       job is reported, see #CS_RecomputeDisableDefEntry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called by the main task.  The entry has been validated by
+ *       the caller.
+ *
+ *  \param [in]  Type     #CS_JOB_TYPE_RECOMPUTE or #CS_JOB_TYPE_RECOMPUTE_ALL
+ *  \param [in]  Table    Table type, #CS_CFECORE to #CS_APP_TABLE
+ *  \param [in]  EntryID  Entry to recompute, ignored for #CS_JOB_TYPE_RECOMPUTE_ALL
+ *
+ *  \return Boolean queued response
+ *  \retval true  The job is queued
+ *  \retval false The queue is inactive or full, or the entry or table
+ *                already has a recompute queued or running
+ */
+bool CS_JobsSubmitRecompute(uint8 Type, uint16 Table, uint16 EntryID);
+
+/**
+ * \brief Queues a OneShot job
+ *
+ *  \par Description
+ *       Queues a #CS_JOB_TYPE_ONESHOT job and sets
+ *       #CS_HkPacket_Payload_t.OneShotInProgress.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called by the main task.  The address range has been
+ *       validated by the caller.
+ *
+ *  \param [in]  Address           Start address of the memory to checksum
+ *  \param [in]  Size              Number of bytes to checksum
+ *  \param [in]  MaxBytesPerCycle  Bytes to checksum at a time
+ *
+ *  \return Boolean queued response
+ *  \retval true  The job is queued
+ *  \retval false The queue is inactive or full
+ */
+bool CS_JobsSubmitOneShot(cpuaddr Address, uint32 Size, uint32 MaxBytesPerCycle);
+
+/**
+ * \brief Cancels every OneShot job
+ *
+ *  \par Description
+ *       Marks every OneShot job that is queued or running to be cancelled.
+ *       A queued job is dropped when a job task picks it up, and a running
+ *       one stops after the chunk it is working on.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called by the main task.  The jobs are reported as
+ *       #CS_JOB_STATUS_CANCELLED by #CS_JobsDrain once their job task is
+ *       done with them.
+ *
+ *  \return Boolean cancelled response
+ *  \retval true  At least one OneShot job was marked to be cancelled
+ *  \retval false There was no OneShot job to cancel
+ */
+bool CS_JobsCancelOneShots(void);
+
+/**
+ * \brief Checks whether a table type has a recompute queued or running
+ *
+ *  \par Description
+ *       Used to hold off table updates that would move the results
+ *       entries out from under a recompute.
+ *
+ *  \param [in]  Table  Table type, #CS_CFECORE to #CS_APP_TABLE
+ *
+ *  \return Boolean busy response
+ *  \retval true  A recompute of an entry of the table type is queued or running
+ *  \retval false No recompute involves the table type
+ */
+bool CS_JobsBusy(uint16 Table);
+
+/**
+ * \brief Checks whether a recompute owns an entry
+ *
+ *  \par Description
+ *       An entry is owned by a recompute of that entry from the time it is
+ *       queued until it is reported.  A recompute of every entry of a
+ *       table type owns the entries it has not finished yet.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called by the main task.  Background checking skips owned
+ *       entries so it never works on an entry a job task is recomputing.
+ *
+ *  \param [in]  Table    Table type, #CS_CFECORE to #CS_APP_TABLE
+ *  \param [in]  EntryID  Entry in the table, 0 for the code segments
+ *
+ *  \return Boolean owned response
+ *  \retval true  A recompute owns the entry
+ *  \retval false Background checking may work on the entry
+ */
+bool CS_JobsEntryBusy(uint16 Table, uint16 EntryID);
+
+/**
+ * \brief Collects what the job tasks have used since the last call
+ *
+ *  \par Description
+ *       Adds up the bytes checksummed and the time spent by every job
+ *       since the previous call, so they can be taken off the background
+ *       cycle's budget.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called by the main task.  Each job's counters are only ever
+ *       counted up by its job task, so no lock is needed.
+ *
+ *  \param [out] Bytes  Bytes checksummed by job tasks
+ *  \param [out] Time   Microseconds spent checksumming by job tasks
+ */
+void CS_JobsCollectCharges(uint32 *Bytes, uint32 *Time);
+
+/**
+ * \brief Holds a job to its rate
+ *
+ *  \par Description
+ *       Takes Bytes from the job's token bucket, which fills at the job's
+ *       rate up to its burst size, and delays the job task until the bucket
+ *       is no longer overdrawn.  Bytes may be more than the burst size; the
+ *       job then waits for the whole of it.  A job with a rate of zero is
+ *       never delayed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called by the job task running the job, before it checksums
+ *       the bytes.
+ *
+ *  \param [in,out] Job    Job about to checksum
+ *  \param [in]     Bytes  Number of bytes about to be checksummed
+ */
+void CS_JobsPace(CS_Job_t *Job, uint32 Bytes);
+
+/**
+ * \brief Reports the jobs the job tasks have finished
+ *
+ *  \par Description
+ *       Takes each finished job off the completion rings, sets its final
+ *       status, sends its completion event and updates the baselines and
+ *       OneShot results in housekeeping telemetry.  Then updates
+ *       #CS_HkPacket_Payload_t.RecomputeInProgress,
+ *       #CS_HkPacket_Payload_t.OneShotInProgress and the job status array.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called by the main task, which is the only task that takes
+ *       from the completion rings.
+ */
+void CS_JobsDrain(void);
+
+/**
+ * \brief Runs a job
+ *
+ *  \par Description
+ *       Runs the recompute or OneShot the job describes and sets its
+ *       outcome and result.  A job marked to be cancelled before it starts
+ *       is not run.  The job starts with a full token bucket, and the job
+ *       task runs it at #CS_JOB_LOW_PRIORITY if it has no rate limit.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Runs in a job task, so it sends no events; #CS_JobsDrain reports
+ *       the job.
+ *
+ *  \param [in,out] Job  Job to run
+ */
+void CS_JobsRun(CS_Job_t *Job);
+
+/**
+ * \brief Job task main function
+ *
+ *  \par Description
+ *       Runs queued jobs one at a time for as long as the pending
+ *       semaphore can be taken, putting each finished job on this task's
+ *       completion ring.
+ */
+void CS_JobTask(void);
+
+#endif
@@ -48,7 +48,7 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CS_DisableMemoryCmd(const CS_NoArgsCmd_t *CmdPtr)
 {
-        if (CS_CheckRecomputeOneshot() == false)
+        if (CS_CheckRecomputeTable(CS_MEMORY_TABLE) == false)
         {
             CS_AppData.HkPacket.Payload.MemoryCSState = CS_STATE_DISABLED;
             CS_ZeroMemoryTempValues();
@@ -71,7 +71,7 @@ void CS_DisableMemoryCmd(const CS_NoArgsCmd_t *CmdPtr)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CS_EnableMemoryCmd(const CS_NoArgsCmd_t *CmdPtr)
 {
-        if (CS_CheckRecomputeOneshot() == false)
+        if (CS_CheckRecomputeTable(CS_MEMORY_TABLE) == false)
         {
             CS_AppData.HkPacket.Payload.MemoryCSState = CS_STATE_ENABLED;
 
@@ -146,45 +146,29 @@ void CS_ReportBaselineEntryIDMemoryCmd(const CS_EntryCmd_t *CmdPtr)
 void CS_RecomputeBaselineMemoryCmd(const CS_EntryCmd_t *CmdPtr)
 {
     /* command verification variables */
-    CFE_ES_TaskId_t ChildTaskID    = CFE_ES_TASKID_UNDEFINED;
-    CFE_Status_t    Status         = CS_ERROR;
-    uint16          EntryID        = 0;
-    uint16          State          = CS_STATE_EMPTY;
+    uint16 EntryID = 0;
+    uint16 State   = CS_STATE_EMPTY;
 
         EntryID = CmdPtr->Payload.EntryID;
 
-        if (CS_AppData.HkPacket.Payload.RecomputeInProgress == false && CS_AppData.HkPacket.Payload.OneShotInProgress == false)
-        {
             /* make sure the entry is a valid number and is defined in the table */
             if ((EntryID < CS_MAX_NUM_MEMORY_TABLE_ENTRIES) &&
                 (CS_AppData.ResMemoryTblPtr[EntryID].State != CS_STATE_EMPTY))
             {
-                /* There is no child task running right now, we can use it*/
-                CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
-
-                /* fill in child task variables */
-                CS_AppData.ChildTaskTable   = CS_MEMORY_TABLE;
-                CS_AppData.ChildTaskEntryID = EntryID;
-
-                CS_AppData.RecomputeEepromMemoryEntryPtr = &CS_AppData.ResMemoryTblPtr[EntryID];
-
-                Status =
-                    CFE_ES_CreateChildTask(&ChildTaskID, CS_RECOMP_MEMORY_TASK_NAME, CS_RecomputeEepromMemoryChildTask,
-                                           NULL, CFE_PLATFORM_ES_DEFAULT_STACK_SIZE, CS_CHILD_TASK_PRIORITY, 0);
-                if (Status == CFE_SUCCESS)
+                if (CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE, CS_MEMORY_TABLE, EntryID))
                 {
                     CFE_EVS_SendEvent(CS_RECOMPUTE_MEMORY_STARTED_DBG_EID, CFE_EVS_EventType_DEBUG,
                                       "Recompute baseline of Memory Entry ID %d started", EntryID);
                     CS_AppData.HkPacket.Payload.CmdCounter++;
                 }
-                else /* child task creation failed */
+                else
                 {
+                    /*send event that we can't queue another job right now */
                     CFE_EVS_SendEvent(
-                        CS_RECOMPUTE_MEMORY_CREATE_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                        "Recompute baseline of Memory Entry ID %d failed, ES_CreateChildTask returned:  0x%08X",
-                        EntryID, (unsigned int)Status);
+                        CS_RECOMPUTE_MEMORY_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Recompute baseline of Memory Entry ID %d failed: job queue full or recompute already queued",
+                        EntryID);
                     CS_AppData.HkPacket.Payload.CmdErrCounter++;
-                    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
                 }
             }
             else
@@ -205,14 +189,6 @@ void CS_RecomputeBaselineMemoryCmd(const CS_EntryCmd_t *CmdPtr)
 
                 CS_AppData.HkPacket.Payload.CmdErrCounter++;
             }
-        }
-        else
-        {
-            /*send event that we can't start another task right now */
-            CFE_EVS_SendEvent(CS_RECOMPUTE_MEMORY_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Recompute baseline of Memory Entry ID %d failed: child task in use", EntryID);
-            CS_AppData.HkPacket.Payload.CmdErrCounter++;
-        }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -227,7 +203,7 @@ void CS_EnableEntryIDMemoryCmd(const CS_EntryCmd_t *CmdPtr)
     uint16                             EntryID        = 0;
     uint16                             State          = CS_STATE_EMPTY;
 
-        if (CS_CheckRecomputeOneshot() == false)
+        if (CS_CheckRecomputeEntry(CS_MEMORY_TABLE, CmdPtr->Payload.EntryID) == false)
         {
             EntryID = CmdPtr->Payload.EntryID;
 
@@ -237,6 +213,8 @@ void CS_EnableEntryIDMemoryCmd(const CS_EntryCmd_t *CmdPtr)
                 ResultsEntry = &CS_AppData.ResMemoryTblPtr[EntryID];
 
                 ResultsEntry->State = CS_STATE_ENABLED;
+                CS_SetEnabledMapEntry(CS_AppData.MemoryEnabledMap, CS_MAX_NUM_MEMORY_TABLE_ENTRIES, EntryID,
+                                      CS_STATE_ENABLED);
 
                 CFE_EVS_SendEvent(CS_ENABLE_MEMORY_ENTRY_INF_EID, CFE_EVS_EventType_INFORMATION,
                                   "Checksumming of Memory Entry ID %d is Enabled", EntryID);
@@ -287,7 +265,7 @@ void CS_DisableEntryIDMemoryCmd(const CS_EntryCmd_t *CmdPtr)
     uint16                             EntryID        = 0;
     uint16                             State          = CS_STATE_EMPTY;
 
-        if (CS_CheckRecomputeOneshot() == false)
+        if (CS_CheckRecomputeEntry(CS_MEMORY_TABLE, CmdPtr->Payload.EntryID) == false)
         {
             EntryID = CmdPtr->Payload.EntryID;
 
@@ -296,9 +274,11 @@ void CS_DisableEntryIDMemoryCmd(const CS_EntryCmd_t *CmdPtr)
             {
                 ResultsEntry = &CS_AppData.ResMemoryTblPtr[EntryID];
 
-                ResultsEntry->State             = CS_STATE_DISABLED;
-                ResultsEntry->TempChecksumValue = 0;
-                ResultsEntry->ByteOffset        = 0;
+                ResultsEntry->State         = CS_STATE_DISABLED;
+                ResultsEntry->ByteOffset    = 0;
+                ResultsEntry->LastCheckTime = 0;
+                CS_SetEnabledMapEntry(CS_AppData.MemoryEnabledMap, CS_MAX_NUM_MEMORY_TABLE_ENTRIES, EntryID,
+                                      CS_STATE_DISABLED);
 
                 CFE_EVS_SendEvent(CS_DISABLE_MEMORY_ENTRY_INF_EID, CFE_EVS_EventType_INFORMATION,
                                   "Checksumming of Memory Entry ID %d is Disabled", EntryID);
@@ -0,0 +1,185 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   The CFS Checksum (CS) Application's background deadline scheduler
+ */
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+#include "cs_app.h"
+#include <string.h>
+#include "cs_budget.h"
+#include "cs_sched.h"
+
+/**************************************************************************
+ **
+ ** Functions
+ **
+ **************************************************************************/
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that initializes the deadline scheduler             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_SchedInit(void)
+{
+    memset(&CS_AppData.Sched, 0, sizeof(CS_AppData.Sched));
+
+    CS_AppData.Sched.RevisitPeriod[CS_CFECORE]      = CS_DEFAULT_CFECORE_REVISIT_PERIOD;
+    CS_AppData.Sched.RevisitPeriod[CS_OSCORE]       = CS_DEFAULT_OS_REVISIT_PERIOD;
+    CS_AppData.Sched.RevisitPeriod[CS_EEPROM_TABLE] = CS_DEFAULT_EEPROM_REVISIT_PERIOD;
+    CS_AppData.Sched.RevisitPeriod[CS_MEMORY_TABLE] = CS_DEFAULT_MEMORY_REVISIT_PERIOD;
+    CS_AppData.Sched.RevisitPeriod[CS_TABLES_TABLE] = CS_DEFAULT_TABLES_REVISIT_PERIOD;
+    CS_AppData.Sched.RevisitPeriod[CS_APP_TABLE]    = CS_DEFAULT_APP_REVISIT_PERIOD;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that picks the table type to work on next           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_SchedSelectTable(void)
+{
+    uint16 Current      = CS_AppData.HkPacket.Payload.CurrentCSTable;
+    uint16 Best         = Current;
+    uint16 Table        = 0;
+    uint64 Now          = 0;
+    uint64 Half         = 0;
+    uint64 Deadline     = 0;
+    uint64 BestDeadline = 0;
+    bool   Found        = false;
+    bool   HasPeriods   = false;
+
+    for (Table = 0; Table < CS_NUM_TABLES; Table++)
+    {
+        HasPeriods = (HasPeriods || CS_AppData.Sched.RevisitPeriod[Table] != 0);
+    }
+
+    if (HasPeriods && Current < CS_NUM_TABLES)
+    {
+        Now = CS_BudgetGetTime();
+
+        for (Table = 0; Table < CS_NUM_TABLES; Table++)
+        {
+            if (CS_AppData.Sched.RevisitPeriod[Table] != 0)
+            {
+                Half     = (uint64)CS_AppData.Sched.RevisitPeriod[Table] * 500000;
+                Deadline = CS_AppData.Sched.Deadline[Table];
+
+                /* Released half a period before its deadline, or straight away for the first sweep */
+                if ((Deadline <= Half || Now >= Deadline - Half) && (!Found || Deadline < BestDeadline))
+                {
+                    Best         = Table;
+                    BestDeadline = Deadline;
+                    Found        = true;
+                }
+            }
+        }
+
+        if (Best != Current)
+        {
+            if (!CS_AppData.Sched.Preempted)
+            {
+                CS_AppData.Sched.Preempted   = true;
+                CS_AppData.Sched.ResumeTable = Current;
+            }
+
+            CS_AppData.Sched.Cursor[Current]                = CS_AppData.HkPacket.Payload.CurrentEntryInTable;
+            CS_AppData.HkPacket.Payload.CurrentCSTable      = Best;
+            CS_AppData.HkPacket.Payload.CurrentEntryInTable = CS_AppData.Sched.Cursor[Best];
+        }
+
+        if (!CS_AppData.Sched.SweepStarted[Best])
+        {
+            CS_AppData.Sched.SweepStart[Best]   = Now;
+            CS_AppData.Sched.SweepStarted[Best] = true;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that finishes the sweep of the current table type   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_SchedTableDone(void)
+{
+    uint16 Table   = CS_AppData.HkPacket.Payload.CurrentCSTable;
+    bool   Resumed = false;
+
+    if (Table < CS_NUM_TABLES)
+    {
+        if (CS_AppData.Sched.RevisitPeriod[Table] != 0 && CS_AppData.Sched.SweepStarted[Table])
+        {
+            /* An entry checked early in this sweep is checked again by the end of the next */
+            CS_AppData.Sched.Deadline[Table] =
+                CS_AppData.Sched.SweepStart[Table] + ((uint64)CS_AppData.Sched.RevisitPeriod[Table] * 1000000);
+        }
+
+        CS_AppData.Sched.SweepStarted[Table] = false;
+        CS_AppData.Sched.Cursor[Table]       = 0;
+
+        if (CS_AppData.Sched.Preempted)
+        {
+            CS_AppData.Sched.Preempted = false;
+
+            /* If the round robin's own table was the one due, the round robin simply moves on */
+            if (Table != CS_AppData.Sched.ResumeTable)
+            {
+                CS_AppData.HkPacket.Payload.CurrentCSTable      = CS_AppData.Sched.ResumeTable;
+                CS_AppData.HkPacket.Payload.CurrentEntryInTable = CS_AppData.Sched.Cursor[CS_AppData.Sched.ResumeTable];
+                Resumed                                         = true;
+            }
+        }
+    }
+
+    return Resumed;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that records a completed check of an entry          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_SchedEntryChecked(uint16 Table, uint32 *LastCheckTime, uint32 *DeadlineMisses)
+{
+    uint32 Now    = (uint32)(CS_BudgetGetTime() / 1000);
+    uint64 Period = 0;
+
+    if (Table < CS_NUM_TABLES)
+    {
+        Period = (uint64)CS_AppData.Sched.RevisitPeriod[Table] * 1000;
+    }
+
+    /* Unsigned subtraction copes with the millisecond time wrapping around */
+    if (Period != 0 && *LastCheckTime != 0 && (uint32)(Now - *LastCheckTime) > Period)
+    {
+        (*DeadlineMisses)++;
+        CS_AppData.HkPacket.Payload.DeadlineMissCounter++;
+    }
+
+    *LastCheckTime = Now;
+}
@@ -0,0 +1,135 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Deadline scheduling of background checksumming for the CFS Checksum (CS) Application
+ */
+#ifndef CS_SCHED_H
+#define CS_SCHED_H
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+#include "cs_msgdefs.h"
+
+/**************************************************************************
+ **
+ ** Type definitions
+ **
+ **************************************************************************/
+
+/**
+ *  \brief CS background deadline scheduler state
+ *
+ *  A sweep is one pass through every entry of one table type.  Times are
+ *  microseconds from #CS_BudgetGetTime.
+ */
+typedef struct
+{
+    uint32 RevisitPeriod[CS_NUM_TABLES]; /**< \brief Seconds allowed between checks of an entry, 0 for none */
+    uint64 SweepStart[CS_NUM_TABLES];    /**< \brief Time the current sweep of each table type started */
+    uint64 Deadline[CS_NUM_TABLES];      /**< \brief Time the current sweep must be done by, 0 before the first */
+    bool   SweepStarted[CS_NUM_TABLES];  /**< \brief true while a sweep of the table type is under way */
+    uint16 Cursor[CS_NUM_TABLES];        /**< \brief Entry a table type's sweep is up to while another runs */
+    bool   Preempted;                    /**< \brief true while a sweep due by its deadline has taken over */
+    uint16 ResumeTable;                  /**< \brief Table type the round robin goes back to when preempted */
+} CS_Sched_t;
+
+/**************************************************************************
+ **
+ ** Function prototypes
+ **
+ **************************************************************************/
+
+/**
+ * \brief Initializes the deadline scheduler
+ *
+ *  \par Description
+ *       Sets the revisit period of each table type to its platform
+ *       default and clears the sweep state, so every table type with a
+ *       revisit period is due straight away.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once during application initialization.
+ */
+void CS_SchedInit(void);
+
+/**
+ * \brief Picks the table type the background cycle works on next
+ *
+ *  \par Description
+ *       Table types with a revisit period are released for a sweep half a
+ *       period before the sweep's deadline.  Of the released table types,
+ *       the one with the earliest deadline takes over from the round robin
+ *       through the table types, which otherwise carries on as before.
+ *       The entry each table type is up to is kept, so a large region that
+ *       is taken over from resumes where it left off.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called before each background function in a cycle.  Does nothing
+ *       when no table type has a revisit period.
+ */
+void CS_SchedSelectTable(void);
+
+/**
+ * \brief Finishes the sweep of the current table type
+ *
+ *  \par Description
+ *       Sets the deadline of the table type's next sweep to the revisit
+ *       period after this sweep started, which keeps every entry within
+ *       the revisit period of its last check if sweeps meet their
+ *       deadlines.  If the sweep had taken over from the round robin, goes
+ *       back to the table type and entry the round robin was on.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by #CS_GoToNextTable before it moves on to the next table.
+ *
+ *  \return Boolean round robin resumed response
+ *  \retval true  The current table and entry were set back to those of
+ *                the round robin
+ *  \retval false The round robin moves on to the next table as usual
+ */
+bool CS_SchedTableDone(void);
+
+/**
+ * \brief Records a completed check of an entry
+ *
+ *  \par Description
+ *       If the table type has a revisit period and the entry was last
+ *       checked longer ago than that, counts a deadline miss for the entry
+ *       and in housekeeping telemetry.  Then records the time of this
+ *       check.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A LastCheckTime of 0 means the entry has not been checked since it
+ *       was last enabled, and is never a miss.
+ *
+ *  \param [in]     Table           The entry's table type, #CS_CFECORE
+ *                                  to #CS_APP_TABLE
+ *  \param [in,out] LastCheckTime   Milliseconds time of the entry's last
+ *                                  check
+ *  \param [in,out] DeadlineMisses  The entry's deadline miss count
+ */
+void CS_SchedEntryChecked(uint16 Table, uint32 *LastCheckTime, uint32 *DeadlineMisses);
+
+#endif
@@ -0,0 +1,348 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Single bit error location for the CFS Checksum (CS) Application
+ */
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+#include "cs_app.h"
+#include "cs_events.h"
+#include "cs_crc.h"
+#include "cs_algorithm.h"
+#include "cs_syndrome.h"
+
+/**************************************************************************
+ **
+ ** Type definitions
+ **
+ **************************************************************************/
+
+/* A reflected CRC, as computed by CS_CalculateCRC */
+typedef struct
+{
+    CFE_ES_CrcType_Enum_t TypeCRC;
+    uint32                Poly;   /* Reflected polynomial without its x^Width term */
+    uint32                Width;  /* Bits in the CRC */
+    uint32                Period; /* Order of x modulo the polynomial, so the distance at which syndromes repeat */
+} CS_SyndromeCrc_t;
+
+/**************************************************************************
+ **
+ ** Local data
+ **
+ **************************************************************************/
+
+/* Indexed like the lookup tables in CS_Syndrome_t */
+static const CS_SyndromeCrc_t CS_SyndromeCrcs[CS_SYNDROME_NUM_CRCS] = {
+    {CFE_ES_CrcType_CRC_16, 0xA001, 16, 32767},
+    {CFE_ES_CrcType_CRC_32, 0xEDB88320, 32, 0xFFFFFFFF},
+    {CS_CRC_TYPE_CRC_32C, 0x82F63B78, 32, 0x7FFFFFFF},
+};
+
+/* Indexed by the CS_CFECORE ... CS_APP_TABLE identifiers */
+static const char *const CS_SyndromeTableNames[CS_NUM_TABLES] = {"cFE Core", "OS",     "EEPROM",
+                                                                 "Memory",   "Tables", "App"};
+
+/**************************************************************************
+ **
+ ** Functions
+ **
+ **************************************************************************/
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that multiplies a reflected CRC value by x          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CS_SyndromeMultiplyX(const CS_SyndromeCrc_t *Crc, uint32 Value)
+{
+    return ((Value & 1) ? ((Value >> 1) ^ Crc->Poly) : (Value >> 1));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that divides a reflected CRC value by x             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CS_SyndromeDivideX(const CS_SyndromeCrc_t *Crc, uint32 Value)
+{
+    uint32 Top = (uint32)1 << (Crc->Width - 1);
+
+    /* The polynomial's x^0 term is the top bit, which a multiply by x never sets otherwise */
+    if (Value & Top)
+    {
+        Value = ((Value ^ Crc->Poly) << 1) | 1;
+    }
+    else
+    {
+        Value <<= 1;
+    }
+
+    return (Value & (Top | (Top - 1)));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that multiplies two reflected CRC values            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CS_SyndromeMultiply(const CS_SyndromeCrc_t *Crc, uint32 A, uint32 B)
+{
+    uint32 Mask    = (uint32)1 << (Crc->Width - 1);
+    uint32 Product = 0;
+
+    /* The top bit is the x^0 term */
+    while (Mask != 0)
+    {
+        if (A & Mask)
+        {
+            Product ^= B;
+        }
+
+        Mask >>= 1;
+        B = CS_SyndromeMultiplyX(Crc, B);
+    }
+
+    return Product;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that moves a step down into a heap of steps         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_SyndromeSiftDown(CS_SyndromeStep_t *Steps, uint32 Root, uint32 NumSteps)
+{
+    CS_SyndromeStep_t Temp;
+    uint32            Child = 0;
+
+    while (2 * Root + 1 < NumSteps)
+    {
+        Child = 2 * Root + 1;
+        if (Child + 1 < NumSteps && Steps[Child + 1].Syndrome > Steps[Child].Syndrome)
+        {
+            Child++;
+        }
+
+        if (Steps[Root].Syndrome >= Steps[Child].Syndrome)
+        {
+            break;
+        }
+
+        Temp         = Steps[Root];
+        Steps[Root]  = Steps[Child];
+        Steps[Child] = Temp;
+        Root         = Child;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that sorts a lookup table by syndrome               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_SyndromeSort(CS_SyndromeStep_t *Steps, uint32 NumSteps)
+{
+    CS_SyndromeStep_t Temp;
+    uint32            Index = NumSteps / 2;
+
+    while (Index > 0)
+    {
+        Index--;
+        CS_SyndromeSiftDown(Steps, Index, NumSteps);
+    }
+
+    for (Index = NumSteps - 1; Index > 0; Index--)
+    {
+        Temp         = Steps[0];
+        Steps[0]     = Steps[Index];
+        Steps[Index] = Temp;
+        CS_SyndromeSiftDown(Steps, 0, Index);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that looks a syndrome up in a lookup table          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static const CS_SyndromeStep_t *CS_SyndromeSearch(const CS_SyndromeStep_t *Steps, uint32 Syndrome)
+{
+    uint32 Low  = 0;
+    uint32 High = CS_SYNDROME_TABLE_SIZE;
+    uint32 Mid  = 0;
+
+    while (Low < High)
+    {
+        Mid = Low + (High - Low) / 2;
+
+        if (Steps[Mid].Syndrome < Syndrome)
+        {
+            Low = Mid + 1;
+        }
+        else
+        {
+            High = Mid;
+        }
+    }
+
+    return ((Low < CS_SYNDROME_TABLE_SIZE && Steps[Low].Syndrome == Syndrome) ? &Steps[Low] : NULL);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that builds the single bit error lookup tables      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_SyndromeInit(void)
+{
+    const CS_SyndromeCrc_t *Crc      = NULL;
+    CS_SyndromeStep_t *     Steps    = NULL;
+    uint32                  CrcIndex = 0;
+    uint32                  Index    = 0;
+    uint32                  Value    = 0;
+
+    for (CrcIndex = 0; CrcIndex < CS_SYNDROME_NUM_CRCS; CrcIndex++)
+    {
+        Crc   = &CS_SyndromeCrcs[CrcIndex];
+        Steps = CS_AppData.Syndrome.Steps[CrcIndex];
+
+        /* A flip in the last bit of a region leaves the polynomial itself as the syndrome */
+        Value = Crc->Poly;
+        for (Index = 0; Index < CS_SYNDROME_TABLE_SIZE; Index++)
+        {
+            Steps[Index].Syndrome = Value;
+            Steps[Index].Distance = Index;
+            Value                 = CS_SyndromeMultiplyX(Crc, Value);
+        }
+
+        CS_SyndromeSort(Steps, CS_SYNDROME_TABLE_SIZE);
+
+        /* Start from 1, which is the top bit */
+        Value = (uint32)1 << (Crc->Width - 1);
+        for (Index = 0; Index < CS_SYNDROME_TABLE_SIZE; Index++)
+        {
+            Value = CS_SyndromeDivideX(Crc, Value);
+        }
+
+        CS_AppData.Syndrome.GiantStep[CrcIndex] = Value;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that locates a single bit error from a CRC syndrome */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_SyndromeLocate(CFE_ES_CrcType_Enum_t TypeCRC, uint32 Expected, uint32 Computed, uint32 NumBytes,
+                       uint32 *ByteOffset, uint8 *BitNumber)
+{
+    const CS_SyndromeCrc_t * Crc      = NULL;
+    const CS_SyndromeStep_t *Step     = NULL;
+    uint32                   CrcIndex = 0;
+    uint32                   Syndrome = 0;
+    uint64                   NumBits  = (uint64)NumBytes * 8;
+    uint64                   Giant    = 0;
+    uint64                   Distance = 0;
+    bool                     Found    = false;
+
+    for (CrcIndex = 0; CrcIndex < CS_SYNDROME_NUM_CRCS; CrcIndex++)
+    {
+        if (CS_SyndromeCrcs[CrcIndex].TypeCRC == TypeCRC)
+        {
+            Crc = &CS_SyndromeCrcs[CrcIndex];
+            break;
+        }
+    }
+
+    if (Crc != NULL)
+    {
+        /* CRC-16 values are sign extended */
+        Syndrome = (Expected ^ Computed) & ((((uint32)1 << (Crc->Width - 1)) << 1) - 1);
+
+        /* Baby-step giant-step: the syndrome times x^(-Giant) is in the table once Giant passes the distance */
+        for (Giant = 0; Syndrome != 0 && !Found && Giant < NumBits; Giant += CS_SYNDROME_TABLE_SIZE)
+        {
+            Step = CS_SyndromeSearch(CS_AppData.Syndrome.Steps[CrcIndex], Syndrome);
+
+            if (Step != NULL)
+            {
+                Distance = Giant + Step->Distance;
+                Found    = true;
+            }
+
+            Syndrome = CS_SyndromeMultiply(Crc, Syndrome, CS_AppData.Syndrome.GiantStep[CrcIndex]);
+        }
+
+        /* Beyond the end of the region, or not the only bit in it that fits */
+        if (Found && (Distance >= NumBits || Distance + Crc->Period < NumBits))
+        {
+            Found = false;
+        }
+    }
+
+    if (Found)
+    {
+        *ByteOffset = NumBytes - 1 - (uint32)(Distance / 8);
+        *BitNumber  = 7 - (uint8)(Distance % 8);
+    }
+
+    return Found;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that reports a single bit error after a miscompare  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_SyndromeReport(uint16 Table, uint16 EntryID, uint16 Algorithm, cpuaddr StartAddress, uint32 NumBytes,
+                       uint32 Expected, uint32 Computed)
+{
+    CFE_ES_CrcType_Enum_t TypeCRC    = CS_GetAlgorithm(Algorithm)->TypeCRC;
+    uint32                ByteOffset = 0;
+    uint8                 BitNumber  = 0;
+    bool                  Located    = false;
+
+    if (TypeCRC != CFE_ES_CrcType_NONE && Table < CS_NUM_TABLES)
+    {
+        Located = CS_SyndromeLocate(TypeCRC, Expected, Computed, NumBytes, &ByteOffset, &BitNumber);
+    }
+
+    if (Located)
+    {
+        CS_AppData.HkPacket.Payload.BitErrorCounter++;
+        CS_AppData.HkPacket.Payload.LastBitErrorTable   = Table;
+        CS_AppData.HkPacket.Payload.LastBitErrorEntry   = EntryID;
+        CS_AppData.HkPacket.Payload.LastBitErrorBit     = BitNumber;
+        CS_AppData.HkPacket.Payload.LastBitErrorAddress = StartAddress + ByteOffset;
+
+        CFE_EVS_SendEvent(CS_SINGLE_BIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Single bit error: %s entry %d, address 0x%08X bit %d", CS_SyndromeTableNames[Table],
+                          EntryID, (unsigned int)(StartAddress + ByteOffset), BitNumber);
+    }
+
+    return Located;
+}
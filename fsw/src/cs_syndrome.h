@@ -0,0 +1,141 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Single bit error location for the CFS Checksum (CS) Application
+ */
+#ifndef CS_SYNDROME_H
+#define CS_SYNDROME_H
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+#include "cs_platform_cfg.h"
+
+/**************************************************************************
+ **
+ ** Macro definitions
+ **
+ **************************************************************************/
+
+/**
+ * \brief Number of CRC types single bit errors can be located for
+ *
+ * \par Description
+ *      CRC-16, CRC-32 and CRC-32C.
+ */
+#define CS_SYNDROME_NUM_CRCS 3
+
+/**************************************************************************
+ **
+ ** Type definitions
+ **
+ **************************************************************************/
+
+/**
+ *  \brief One precomputed step of a single bit error lookup table
+ */
+typedef struct
+{
+    uint32 Syndrome; /**< \brief Syndrome of a flip Distance bits from the end of a region */
+    uint32 Distance; /**< \brief Bits from the last bit of the region */
+} CS_SyndromeStep_t;
+
+/**
+ *  \brief CS single bit error lookup tables
+ *
+ *  The syndrome of a flipped bit d bits from the end of a region is
+ *  x^d times the syndrome of a flip in the last bit, modulo the CRC
+ *  polynomial.  Each table holds the first #CS_SYNDROME_TABLE_SIZE of
+ *  these, sorted by syndrome.
+ */
+typedef struct
+{
+    CS_SyndromeStep_t Steps[CS_SYNDROME_NUM_CRCS][CS_SYNDROME_TABLE_SIZE]; /**< \brief Sorted baby steps */
+    uint32            GiantStep[CS_SYNDROME_NUM_CRCS]; /**< \brief x^-CS_SYNDROME_TABLE_SIZE mod the polynomial */
+} CS_Syndrome_t;
+
+/**************************************************************************
+ **
+ ** Function prototypes
+ **
+ **************************************************************************/
+
+/**
+ * \brief Builds the single bit error lookup tables
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once during application initialization.
+ */
+void CS_SyndromeInit(void);
+
+/**
+ * \brief Locates a single bit error from a CRC miscompare
+ *
+ *  \par Description
+ *       The CRCs of two regions of the same length that differ in one
+ *       bit differ by a syndrome that depends only on the position of
+ *       the bit.  Searches the positions in the region for the one whose
+ *       syndrome is Expected XOR Computed, without reading the region.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Returns false if the CRC type is not supported, if no single bit
+ *       explains the difference, or if the region is longer than the CRC's
+ *       period and more than one bit would.  A multiple bit error can look
+ *       like a single bit error elsewhere in the region.
+ *
+ *  \param [in]  TypeCRC     CRC type of both values
+ *  \param [in]  Expected    CRC of the region as baselined
+ *  \param [in]  Computed    CRC of the region as it is now
+ *  \param [in]  NumBytes    Length of the region in bytes
+ *  \param [out] ByteOffset  Offset of the byte holding the flipped bit
+ *  \param [out] BitNumber   Number of the flipped bit, 0 the least significant
+ *
+ * \return true if the error was located
+ */
+bool CS_SyndromeLocate(CFE_ES_CrcType_Enum_t TypeCRC, uint32 Expected, uint32 Computed, uint32 NumBytes,
+                       uint32 *ByteOffset, uint8 *BitNumber);
+
+/**
+ * \brief Reports the location of a single bit error after a miscompare
+ *
+ *  \par Description
+ *       If the entry's algorithm is a supported CRC and
+ *       #CS_SyndromeLocate finds the bit, issues #CS_SINGLE_BIT_ERR_EID
+ *       and records the location in housekeeping telemetry.
+ *
+ *  \param [in] Table         CS_CFECORE, CS_OSCORE, CS_EEPROM_TABLE,
+ *                            CS_MEMORY_TABLE or CS_APP_TABLE
+ *  \param [in] EntryID       Entry that miscompared
+ *  \param [in] Algorithm     The entry's CS_ALGORITHM_... identifier
+ *  \param [in] StartAddress  Address of the entry's first byte
+ *  \param [in] NumBytes      Length of the entry in bytes
+ *  \param [in] Expected      The entry's baseline checksum
+ *  \param [in] Computed      The checksum that miscompared
+ *
+ * \return true if the error was located
+ */
+bool CS_SyndromeReport(uint16 Table, uint16 EntryID, uint16 Algorithm, cpuaddr StartAddress, uint32 NumBytes,
+                       uint32 Expected, uint32 Computed);
+
+#endif
@@ -46,7 +46,7 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CS_DisableTablesCmd(const CS_NoArgsCmd_t *CmdPtr)
 {
-        if (CS_CheckRecomputeOneshot() == false)
+        if (CS_CheckRecomputeTable(CS_TABLES_TABLE) == false)
         {
             CS_AppData.HkPacket.Payload.TablesCSState = CS_STATE_DISABLED;
             CS_ZeroTablesTempValues();
@@ -68,7 +68,7 @@ void CS_DisableTablesCmd(const CS_NoArgsCmd_t *CmdPtr)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CS_EnableTablesCmd(const CS_NoArgsCmd_t *CmdPtr)
 {
-        if (CS_CheckRecomputeOneshot() == false)
+        if (CS_CheckRecomputeTable(CS_TABLES_TABLE) == false)
         {
             CS_AppData.HkPacket.Payload.TablesCSState = CS_STATE_ENABLED;
 
@@ -126,42 +126,29 @@ void CS_ReportBaselineTablesCmd(const CS_TableNameCmd_t *CmdPtr)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CS_RecomputeBaselineTablesCmd(const CS_TableNameCmd_t *CmdPtr)
 {
-    CFE_ES_TaskId_t              ChildTaskID;
-    CFE_Status_t                 Status;
     CS_Res_Tables_Table_Entry_t *ResultsEntry;
     char                         Name[CFE_TBL_MAX_FULL_NAME_LEN];
 
-        if (CS_AppData.HkPacket.Payload.RecomputeInProgress == false && CS_AppData.HkPacket.Payload.OneShotInProgress == false)
-        {
             strncpy(Name, CmdPtr->Payload.Name, sizeof(Name) - 1);
             Name[sizeof(Name) - 1] = '\0';
 
             /* make sure the entry is a valid number and is defined in the table */
             if (CS_GetTableResTblEntryByName(&ResultsEntry, Name))
             {
-                /* There is no child task running right now, we can use it*/
-                CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
-
-                /* fill in child task variables */
-                CS_AppData.ChildTaskTable = CS_TABLES_TABLE;
-
-                CS_AppData.RecomputeTablesEntryPtr = ResultsEntry;
-
-                Status = CFE_ES_CreateChildTask(&ChildTaskID, CS_RECOMP_TABLES_TASK_NAME, CS_RecomputeTablesChildTask,
-                                                NULL, CFE_PLATFORM_ES_DEFAULT_STACK_SIZE, CS_CHILD_TASK_PRIORITY, 0);
-                if (Status == CFE_SUCCESS)
+                if (CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE, CS_TABLES_TABLE,
+                                           (uint16)(ResultsEntry - CS_AppData.ResTablesTblPtr)))
                 {
                     CFE_EVS_SendEvent(CS_RECOMPUTE_TABLES_STARTED_DBG_EID, CFE_EVS_EventType_DEBUG,
                                       "Recompute baseline of table %s started", Name);
                     CS_AppData.HkPacket.Payload.CmdCounter++;
                 }
-                else /* child task creation failed */
+                else
                 {
-                    CFE_EVS_SendEvent(CS_RECOMPUTE_TABLES_CREATE_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "Recompute baseline of table %s failed, CFE_ES_CreateChildTask returned: 0x%08X",
-                                      Name, (unsigned int)Status);
+                    /*send event that we can't queue another job right now */
+                    CFE_EVS_SendEvent(CS_RECOMPUTE_TABLES_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "Tables recompute baseline for table %s failed: job queue full or already queued",
+                                      Name);
                     CS_AppData.HkPacket.Payload.CmdErrCounter++;
-                    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
                 }
             }
             else
@@ -170,14 +157,6 @@ void CS_RecomputeBaselineTablesCmd(const CS_TableNameCmd_t *CmdPtr)
                                   "Tables recompute baseline failed, table %s not found", Name);
                 CS_AppData.HkPacket.Payload.CmdErrCounter++;
             }
-        }
-        else
-        {
-            /*send event that we can't start another task right now */
-            CFE_EVS_SendEvent(CS_RECOMPUTE_TABLES_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Tables recompute baseline for table %s failed: child task in use", Name);
-            CS_AppData.HkPacket.Payload.CmdErrCounter++;
-        }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -191,16 +170,18 @@ void CS_DisableNameTablesCmd(const CS_TableNameCmd_t *CmdPtr)
     CS_Def_Tables_Table_Entry_t *DefinitionEntry;
     char                         Name[CFE_TBL_MAX_FULL_NAME_LEN];
 
-        if (CS_CheckRecomputeOneshot() == false)
-        {
-            strncpy(Name, CmdPtr->Payload.Name, sizeof(Name) - 1);
-            Name[sizeof(Name) - 1] = '\0';
+        strncpy(Name, CmdPtr->Payload.Name, sizeof(Name) - 1);
+        Name[sizeof(Name) - 1] = '\0';
 
-            if (CS_GetTableResTblEntryByName(&ResultsEntry, Name))
+        if (CS_GetTableResTblEntryByName(&ResultsEntry, Name))
+        {
+            if (CS_CheckRecomputeEntry(CS_TABLES_TABLE, (uint16)(ResultsEntry - CS_AppData.ResTablesTblPtr)) == false)
             {
-                ResultsEntry->State             = CS_STATE_DISABLED;
-                ResultsEntry->TempChecksumValue = 0;
-                ResultsEntry->ByteOffset        = 0;
+                ResultsEntry->State         = CS_STATE_DISABLED;
+                ResultsEntry->ByteOffset    = 0;
+                ResultsEntry->LastCheckTime = 0;
+                CS_SetEnabledMapEntry(CS_AppData.TablesEnabledMap, CS_MAX_NUM_TABLES_TABLE_ENTRIES,
+                                      (uint16)(ResultsEntry - CS_AppData.ResTablesTblPtr), CS_STATE_DISABLED);
 
                 CFE_EVS_SendEvent(CS_DISABLE_TABLES_NAME_INF_EID, CFE_EVS_EventType_INFORMATION,
                                   "Checksumming of table %s is Disabled", Name);
@@ -219,13 +200,13 @@ void CS_DisableNameTablesCmd(const CS_TableNameCmd_t *CmdPtr)
 
                 CS_AppData.HkPacket.Payload.CmdCounter++;
             }
-            else
-            {
-                CFE_EVS_SendEvent(CS_DISABLE_TABLES_UNKNOWN_NAME_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "Tables disable table command failed, table %s not found", Name);
-                CS_AppData.HkPacket.Payload.CmdErrCounter++;
-            }
-        } /* end InProgress if */
+        }
+        else
+        {
+            CFE_EVS_SendEvent(CS_DISABLE_TABLES_UNKNOWN_NAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Tables disable table command failed, table %s not found", Name);
+            CS_AppData.HkPacket.Payload.CmdErrCounter++;
+        }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -239,14 +220,16 @@ void CS_EnableNameTablesCmd(const CS_TableNameCmd_t *CmdPtr)
     CS_Def_Tables_Table_Entry_t *DefinitionEntry;
     char                         Name[CFE_TBL_MAX_FULL_NAME_LEN];
 
-        if (CS_CheckRecomputeOneshot() == false)
-        {
-            strncpy(Name, CmdPtr->Payload.Name, sizeof(Name) - 1);
-            Name[sizeof(Name) - 1] = '\0';
+        strncpy(Name, CmdPtr->Payload.Name, sizeof(Name) - 1);
+        Name[sizeof(Name) - 1] = '\0';
 
-            if (CS_GetTableResTblEntryByName(&ResultsEntry, Name))
+        if (CS_GetTableResTblEntryByName(&ResultsEntry, Name))
+        {
+            if (CS_CheckRecomputeEntry(CS_TABLES_TABLE, (uint16)(ResultsEntry - CS_AppData.ResTablesTblPtr)) == false)
             {
                 ResultsEntry->State = CS_STATE_ENABLED;
+                CS_SetEnabledMapEntry(CS_AppData.TablesEnabledMap, CS_MAX_NUM_TABLES_TABLE_ENTRIES,
+                                      (uint16)(ResultsEntry - CS_AppData.ResTablesTblPtr), CS_STATE_ENABLED);
 
                 CFE_EVS_SendEvent(CS_ENABLE_TABLES_NAME_INF_EID, CFE_EVS_EventType_INFORMATION,
                                   "Checksumming of table %s is Enabled", Name);
@@ -265,11 +248,11 @@ void CS_EnableNameTablesCmd(const CS_TableNameCmd_t *CmdPtr)
 
                 CS_AppData.HkPacket.Payload.CmdCounter++;
             }
-            else
-            {
-                CFE_EVS_SendEvent(CS_ENABLE_TABLES_UNKNOWN_NAME_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "Tables enable table command failed, table %s not found", Name);
-                CS_AppData.HkPacket.Payload.CmdErrCounter++;
-            }
-        } /* end InProgress if */
+        }
+        else
+        {
+            CFE_EVS_SendEvent(CS_ENABLE_TABLES_UNKNOWN_NAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Tables enable table command failed, table %s not found", Name);
+            CS_AppData.HkPacket.Payload.CmdErrCounter++;
+        }
 }
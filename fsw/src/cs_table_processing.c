@@ -32,8 +32,39 @@
 #include "cs_events.h"
 #include "cs_tbldefs.h"
 #include "cs_utils.h"
+#include "cs_block.h"
+#include "cs_algorithm.h"
 #include <string.h>
 
+/*
+ * CS_TableInit registers each definition and results table as a single
+ * buffered table with room for the maximum number of entries
+ */
+CompileTimeAssert(CS_MAX_NUM_EEPROM_TABLE_ENTRIES * sizeof(CS_Def_EepromMemory_Table_Entry_t) <=
+                      CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE,
+                  CS_DefEepromTableTooLarge);
+CompileTimeAssert(CS_MAX_NUM_EEPROM_TABLE_ENTRIES * sizeof(CS_Res_EepromMemory_Table_Entry_t) <=
+                      CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE,
+                  CS_ResEepromTableTooLarge);
+CompileTimeAssert(CS_MAX_NUM_MEMORY_TABLE_ENTRIES * sizeof(CS_Def_EepromMemory_Table_Entry_t) <=
+                      CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE,
+                  CS_DefMemoryTableTooLarge);
+CompileTimeAssert(CS_MAX_NUM_MEMORY_TABLE_ENTRIES * sizeof(CS_Res_EepromMemory_Table_Entry_t) <=
+                      CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE,
+                  CS_ResMemoryTableTooLarge);
+CompileTimeAssert(CS_MAX_NUM_TABLES_TABLE_ENTRIES * sizeof(CS_Def_Tables_Table_Entry_t) <=
+                      CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE,
+                  CS_DefTablesTableTooLarge);
+CompileTimeAssert(CS_MAX_NUM_TABLES_TABLE_ENTRIES * sizeof(CS_Res_Tables_Table_Entry_t) <=
+                      CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE,
+                  CS_ResTablesTableTooLarge);
+CompileTimeAssert(CS_MAX_NUM_APP_TABLE_ENTRIES * sizeof(CS_Def_App_Table_Entry_t) <=
+                      CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE,
+                  CS_DefAppTableTooLarge);
+CompileTimeAssert(CS_MAX_NUM_APP_TABLE_ENTRIES * sizeof(CS_Res_App_Table_Entry_t) <=
+                      CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE,
+                  CS_ResAppTableTooLarge);
+
 /*************************************************************************
  **
  ** Local function prototypes
@@ -74,23 +105,37 @@ CFE_Status_t CS_ValidateEepromChecksumDefinitionTable(void *TblPtr)
             /* If the StateField is within this range, it's check if it's not empty. */
             if (StateField == CS_STATE_DISABLED || StateField == CS_STATE_ENABLED)
             {
-                Status = CFE_PSP_MemValidateRange(Address, Size, CFE_PSP_MEM_EEPROM);
-                if (Status != OS_SUCCESS)
+                if (OuterEntry->Algorithm >= CS_NUM_ALGORITHMS)
                 {
                     BadCount++;
                     if (Result != CS_TABLE_ERROR)
                     {
-                        CFE_EVS_SendEvent(CS_VAL_EEPROM_RANGE_ERR_EID, CFE_EVS_EventType_ERROR,
-                                          "EEPROM Table Validate: Illegal checksum range found in Entry ID %d, "
-                                          "CFE_PSP_MemValidateRange returned: 0x%08X",
-                                          (int)OuterLoop, (unsigned int)Status);
+                        CFE_EVS_SendEvent(CS_VAL_EEPROM_ALG_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "EEPROM Table Validate: Illegal Algorithm (0x%04X) found in Entry ID %d",
+                                          (unsigned short)OuterEntry->Algorithm, (int)OuterLoop);
                         Result = CS_TABLE_ERROR;
                     }
                 }
                 else
                 {
-                    /* Valid range for non-empty entry */
-                    GoodCount++;
+                    Status = CFE_PSP_MemValidateRange(Address, Size, CFE_PSP_MEM_EEPROM);
+                    if (Status != OS_SUCCESS)
+                    {
+                        BadCount++;
+                        if (Result != CS_TABLE_ERROR)
+                        {
+                            CFE_EVS_SendEvent(CS_VAL_EEPROM_RANGE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                              "EEPROM Table Validate: Illegal checksum range found in Entry ID %d, "
+                                              "CFE_PSP_MemValidateRange returned: 0x%08X",
+                                              (int)OuterLoop, (unsigned int)Status);
+                            Result = CS_TABLE_ERROR;
+                        }
+                    }
+                    else
+                    {
+                        /* Valid range for non-empty entry */
+                        GoodCount++;
+                    }
                 }
             }
             else
@@ -156,23 +201,37 @@ CFE_Status_t CS_ValidateMemoryChecksumDefinitionTable(void *TblPtr)
             /* If the StateField is within this range, check if it's not empty. */
             if (StateField == CS_STATE_DISABLED || StateField == CS_STATE_ENABLED)
             {
-                Status = CFE_PSP_MemValidateRange(Address, Size, CFE_PSP_MEM_ANY);
-                if (Status != OS_SUCCESS)
+                if (OuterEntry->Algorithm >= CS_NUM_ALGORITHMS)
                 {
                     BadCount++;
                     if (Result != CS_TABLE_ERROR)
                     {
-                        CFE_EVS_SendEvent(CS_VAL_MEMORY_RANGE_ERR_EID, CFE_EVS_EventType_ERROR,
-                                          "Memory Table Validate: Illegal checksum range found in Entry ID %d, "
-                                          "CFE_PSP_MemValidateRange returned: 0x%08X",
-                                          (int)OuterLoop, (unsigned int)Status);
+                        CFE_EVS_SendEvent(CS_VAL_MEMORY_ALG_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "Memory Table Validate: Illegal Algorithm (0x%04X) found in Entry ID %d",
+                                          (unsigned short)OuterEntry->Algorithm, (int)OuterLoop);
                         Result = CS_TABLE_ERROR;
                     }
                 }
                 else
                 {
-                    /* Valid range for non-empty entry */
-                    GoodCount++;
+                    Status = CFE_PSP_MemValidateRange(Address, Size, CFE_PSP_MEM_ANY);
+                    if (Status != OS_SUCCESS)
+                    {
+                        BadCount++;
+                        if (Result != CS_TABLE_ERROR)
+                        {
+                            CFE_EVS_SendEvent(CS_VAL_MEMORY_RANGE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                              "Memory Table Validate: Illegal checksum range found in Entry ID %d, "
+                                              "CFE_PSP_MemValidateRange returned: 0x%08X",
+                                              (int)OuterLoop, (unsigned int)Status);
+                            Result = CS_TABLE_ERROR;
+                        }
+                    }
+                    else
+                    {
+                        /* Valid range for non-empty entry */
+                        GoodCount++;
+                    }
                 }
             }
             else
@@ -215,7 +274,7 @@ CFE_Status_t CS_ValidateTablesChecksumDefinitionTable(void *TblPtr)
     CS_Def_Tables_Table_Entry_t *StartOfTable   = NULL;
     CS_Def_Tables_Table_Entry_t *OuterEntry     = NULL;
     int32                        OuterLoop      = 0;
-    int32                        InnerLoop      = 0;
+    uint16                       Duplicate      = 0;
     uint32                       StateField     = 0;
     int32                        GoodCount      = 0;
     int32                        BadCount       = 0;
@@ -224,6 +283,8 @@ CFE_Status_t CS_ValidateTablesChecksumDefinitionTable(void *TblPtr)
 
     StartOfTable = (CS_Def_Tables_Table_Entry_t *)TblPtr;
 
+    CS_BuildTablesNameIndex(CS_AppData.ValidateTablesNameIndex, StartOfTable);
+
     for (OuterLoop = 0; OuterLoop < CS_MAX_NUM_TABLES_TABLE_ENTRIES; OuterLoop++)
     {
         OuterEntry = &StartOfTable[OuterLoop];
@@ -237,36 +298,39 @@ CFE_Status_t CS_ValidateTablesChecksumDefinitionTable(void *TblPtr)
             if (((StateField == CS_STATE_EMPTY) || (StateField == CS_STATE_ENABLED) ||
                  (StateField == CS_STATE_DISABLED)))
             {
-                DuplicateFound = false;
-
                 /* Verify the name field is not duplicated */
-                for (InnerLoop = OuterLoop + 1; InnerLoop < CS_MAX_NUM_TABLES_TABLE_ENTRIES; InnerLoop++)
+                DuplicateFound = CS_FindTablesNameDuplicate(CS_AppData.ValidateTablesNameIndex, StartOfTable,
+                                                            (uint16)OuterLoop, &Duplicate);
+                if (DuplicateFound)
                 {
-                    if (strncmp(OuterEntry->Name, (&StartOfTable[InnerLoop])->Name, CFE_TBL_MAX_FULL_NAME_LEN) == 0)
-                    {
-                        if (DuplicateFound != true)
-                        {
-                            DuplicateFound = true;
-                            BadCount++;
-                        }
+                    BadCount++;
 
-                        if (Result != CS_TABLE_ERROR)
-                        {
-                            /* Duplicate name entry found */
-                            CFE_EVS_SendEvent(
-                                CS_VAL_TABLES_DEF_TBL_DUPL_ERR_EID, CFE_EVS_EventType_ERROR,
-                                "CS Tables Table Validate: Duplicate Name (%s) found at entries %d and %d",
-                                OuterEntry->Name, (int)InnerLoop, (int)OuterLoop);
+                    if (Result != CS_TABLE_ERROR)
+                    {
+                        /* Duplicate name entry found */
+                        CFE_EVS_SendEvent(CS_VAL_TABLES_DEF_TBL_DUPL_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "CS Tables Table Validate: Duplicate Name (%s) found at entries %d and %d",
+                                          OuterEntry->Name, (int)Duplicate, (int)OuterLoop);
 
-                            Result = CS_TABLE_ERROR;
-                        }
+                        Result = CS_TABLE_ERROR;
                     }
                 }
 
                 /* Increment success/empty counter if name wasn't duplicated */
                 if (DuplicateFound != true)
                 {
-                    if (StateField != CS_STATE_EMPTY)
+                    if (StateField != CS_STATE_EMPTY && OuterEntry->Algorithm >= CS_NUM_ALGORITHMS)
+                    {
+                        BadCount++;
+                        if (Result != CS_TABLE_ERROR)
+                        {
+                            CFE_EVS_SendEvent(CS_VAL_TABLES_ALG_ERR_EID, CFE_EVS_EventType_ERROR,
+                                              "CS Tables Table Validate: Illegal Algorithm (0x%04X) found with name %s",
+                                              (unsigned short)OuterEntry->Algorithm, OuterEntry->Name);
+                            Result = CS_TABLE_ERROR;
+                        }
+                    }
+                    else if (StateField != CS_STATE_EMPTY)
                     {
                         GoodCount++;
                     }
@@ -331,7 +395,7 @@ CFE_Status_t CS_ValidateAppChecksumDefinitionTable(void *TblPtr)
     CS_Def_App_Table_Entry_t *StartOfTable;
     CS_Def_App_Table_Entry_t *OuterEntry;
     int32                     OuterLoop;
-    int32                     InnerLoop;
+    uint16                    Duplicate = 0;
     uint32                    StateField;
     int32                     GoodCount  = 0;
     int32                     BadCount   = 0;
@@ -340,6 +404,8 @@ CFE_Status_t CS_ValidateAppChecksumDefinitionTable(void *TblPtr)
 
     StartOfTable = (CS_Def_App_Table_Entry_t *)TblPtr;
 
+    CS_BuildAppNameIndex(CS_AppData.ValidateAppNameIndex, StartOfTable);
+
     for (OuterLoop = 0; OuterLoop < CS_MAX_NUM_APP_TABLE_ENTRIES; OuterLoop++)
     {
         OuterEntry = &StartOfTable[OuterLoop];
@@ -363,35 +429,39 @@ CFE_Status_t CS_ValidateAppChecksumDefinitionTable(void *TblPtr)
             if (((StateField == CS_STATE_EMPTY) || (StateField == CS_STATE_ENABLED) ||
                  (StateField == CS_STATE_DISABLED)))
             {
-                DuplicateFound = false;
-
                 /* Verify the name field is not duplicated */
-                for (InnerLoop = 0; InnerLoop < OuterLoop; InnerLoop++)
+                DuplicateFound = CS_FindAppNameDuplicate(CS_AppData.ValidateAppNameIndex, StartOfTable,
+                                                         (uint16)OuterLoop, &Duplicate);
+                if (DuplicateFound)
                 {
-                    if (strcmp(OuterEntry->Name, StartOfTable[InnerLoop].Name) == 0)
-                    {
-                        if (DuplicateFound != true)
-                        {
-                            DuplicateFound = true;
-                            BadCount++;
-                        }
+                    BadCount++;
 
-                        if (Result != CS_TABLE_ERROR)
-                        {
-                            /* Duplicate name entry found */
-                            CFE_EVS_SendEvent(CS_VAL_APP_DEF_TBL_DUPL_ERR_EID, CFE_EVS_EventType_ERROR,
-                                              "CS Apps Table Validate: Duplicate Name (%s) found at entries %d and %d",
-                                              OuterEntry->Name, (int)InnerLoop, (int)OuterLoop);
+                    if (Result != CS_TABLE_ERROR)
+                    {
+                        /* Duplicate name entry found */
+                        CFE_EVS_SendEvent(CS_VAL_APP_DEF_TBL_DUPL_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "CS Apps Table Validate: Duplicate Name (%s) found at entries %d and %d",
+                                          OuterEntry->Name, (int)Duplicate, (int)OuterLoop);
 
-                            Result = CS_TABLE_ERROR;
-                        }
+                        Result = CS_TABLE_ERROR;
                     }
                 }
 
                 /* Increment success/empty counter if name wasn't duplicated */
                 if (DuplicateFound != true)
                 {
-                    if (StateField != CS_STATE_EMPTY)
+                    if (StateField != CS_STATE_EMPTY && OuterEntry->Algorithm >= CS_NUM_ALGORITHMS)
+                    {
+                        BadCount++;
+                        if (Result != CS_TABLE_ERROR)
+                        {
+                            CFE_EVS_SendEvent(CS_VAL_APP_ALG_ERR_EID, CFE_EVS_EventType_ERROR,
+                                              "CS Apps Table Validate: Illegal Algorithm (0x%04X) found with name %s",
+                                              (unsigned short)OuterEntry->Algorithm, OuterEntry->Name);
+                            Result = CS_TABLE_ERROR;
+                        }
+                    }
+                    else if (StateField != CS_STATE_EMPTY)
                     {
                         GoodCount++;
                     }
@@ -461,6 +531,8 @@ void CS_ProcessNewEepromMemoryDefinitionTable(const CS_Def_EepromMemory_Table_En
     uint16                             Loop                = 0;
     uint16                             NumRegionsInTable   = 0;
     uint16                             PreviousState       = CS_STATE_EMPTY;
+    uint32 *                           EnabledMap          = NULL;
+    bool                               StreamingTable      = false;
     char                               TableType[CS_TABLETYPE_NAME_SIZE];
 
     memcpy(&StartOfResultsTable, ResultsTblPtr, sizeof(StartOfResultsTable));
@@ -473,11 +545,15 @@ void CS_ProcessNewEepromMemoryDefinitionTable(const CS_Def_EepromMemory_Table_En
     {
         PreviousState                     = CS_AppData.HkPacket.Payload.EepromCSState;
         CS_AppData.HkPacket.Payload.EepromCSState = CS_STATE_DISABLED;
+        EnabledMap                        = CS_AppData.EepromEnabledMap;
+        StreamingTable                    = CS_EEPROM_STREAMING;
     }
     if (Table == CS_MEMORY_TABLE)
     {
         PreviousState                     = CS_AppData.HkPacket.Payload.MemoryCSState;
         CS_AppData.HkPacket.Payload.MemoryCSState = CS_STATE_DISABLED;
+        EnabledMap                        = CS_AppData.MemoryEnabledMap;
+        StreamingTable                    = CS_MEMORY_STREAMING;
     }
 
     for (Loop = 0; Loop < NumEntries; Loop++)
@@ -496,8 +572,19 @@ void CS_ProcessNewEepromMemoryDefinitionTable(const CS_Def_EepromMemory_Table_En
             ResultsEntry->NumBytesToChecksum = DefEntry->NumBytesToChecksum;
             ResultsEntry->ComparisonValue    = 0;
             ResultsEntry->ByteOffset         = 0;
-            ResultsEntry->TempChecksumValue  = 0;
+            ResultsEntry->LastCheckTime      = 0;
+            ResultsEntry->DeadlineMisses     = 0;
+            ResultsEntry->Algorithm          = DefEntry->Algorithm;
+            ResultsEntry->Streaming          = (DefEntry->Streaming == true || StreamingTable);
             ResultsEntry->StartAddress       = DefEntry->StartAddress;
+
+            if (DefEntry->HasExpectedValue == true)
+            {
+                /* Check against the expected value from the first pass instead of learning a baseline */
+                ResultsEntry->ComputedYet      = true;
+                ResultsEntry->ComparisonDigest = DefEntry->ExpectedValue;
+                ResultsEntry->ComparisonValue  = CS_DigestSummary(&DefEntry->ExpectedValue);
+            }
         }
         else
         {
@@ -506,11 +593,21 @@ void CS_ProcessNewEepromMemoryDefinitionTable(const CS_Def_EepromMemory_Table_En
             ResultsEntry->NumBytesToChecksum = 0;
             ResultsEntry->ComparisonValue    = 0;
             ResultsEntry->ByteOffset         = 0;
-            ResultsEntry->TempChecksumValue  = 0;
+            ResultsEntry->LastCheckTime      = 0;
+            ResultsEntry->DeadlineMisses     = 0;
+            ResultsEntry->Algorithm          = CS_ALGORITHM_DEFAULT;
+            ResultsEntry->Streaming          = false;
             ResultsEntry->StartAddress       = 0;
         }
+
+        if (EnabledMap != NULL)
+        {
+            CS_SetEnabledMapEntry(EnabledMap, NumEntries, Loop, ResultsEntry->State);
+        }
     }
 
+    CS_BlockTreeAllocate(Table, StartOfDefTable, StartOfResultsTable, NumEntries);
+
     /* Reset the table back to the original checksumming state */
     if (Table == CS_EEPROM_TABLE)
     {
@@ -575,6 +672,9 @@ void CS_ProcessNewTablesDefinitionTable(const CS_Def_Tables_Table_Entry_t *Defin
     PreviousState                     = CS_AppData.HkPacket.Payload.TablesCSState;
     CS_AppData.HkPacket.Payload.TablesCSState = CS_STATE_DISABLED;
 
+    /* Name lookups go through the index, so it has to match the new table */
+    CS_BuildTablesNameIndex(CS_AppData.TablesNameIndex, StartOfDefTable);
+
     /* Assume none of the CS tables are listed in the new Tables table */
     CS_AppData.EepResTablesTblPtr = NULL;
     CS_AppData.MemResTablesTblPtr = NULL;
@@ -700,12 +800,25 @@ void CS_ProcessNewTablesDefinitionTable(const CS_Def_Tables_Table_Entry_t *Defin
             ResultsEntry->NumBytesToChecksum = 0; /* this is unknown at this time */
             ResultsEntry->ComparisonValue    = 0;
             ResultsEntry->ByteOffset         = 0;
-            ResultsEntry->TempChecksumValue  = 0;
+            ResultsEntry->LastCheckTime      = 0;
+            ResultsEntry->DeadlineMisses     = 0;
+            ResultsEntry->Algorithm          = DefEntry->Algorithm;
             ResultsEntry->StartAddress       = 0; /* this is unknown at this time */
             ResultsEntry->TblHandle          = TableHandle;
+            ResultsEntry->InfoCached         = false;
+            ResultsEntry->Snapshot           = DefEntry->Snapshot;
+            ResultsEntry->SnapshotStale      = false;
             ResultsEntry->IsCSOwner          = Owned;
             CFE_SB_MessageStringGet(ResultsEntry->Name, DefEntry->Name, NULL, sizeof(ResultsEntry->Name),
                                     sizeof(DefEntry->Name));
+
+            if (DefEntry->HasExpectedValue == true)
+            {
+                /* Check against the expected value from the first pass instead of learning a baseline */
+                ResultsEntry->ComputedYet      = true;
+                ResultsEntry->ComparisonDigest = DefEntry->ExpectedValue;
+                ResultsEntry->ComparisonValue  = CS_DigestSummary(&DefEntry->ExpectedValue);
+            }
         }
         else
         {
@@ -714,12 +827,19 @@ void CS_ProcessNewTablesDefinitionTable(const CS_Def_Tables_Table_Entry_t *Defin
             ResultsEntry->NumBytesToChecksum = 0;
             ResultsEntry->ComparisonValue    = 0;
             ResultsEntry->ByteOffset         = 0;
-            ResultsEntry->TempChecksumValue  = 0;
+            ResultsEntry->LastCheckTime      = 0;
+            ResultsEntry->DeadlineMisses     = 0;
+            ResultsEntry->Algorithm          = CS_ALGORITHM_DEFAULT;
             ResultsEntry->StartAddress       = 0;
             ResultsEntry->TblHandle          = CFE_TBL_BAD_TABLE_HANDLE;
+            ResultsEntry->InfoCached         = false;
+            ResultsEntry->Snapshot           = false;
+            ResultsEntry->SnapshotStale      = false;
             ResultsEntry->IsCSOwner          = false;
             ResultsEntry->Name[0]            = '\0';
         }
+
+        CS_SetEnabledMapEntry(CS_AppData.TablesEnabledMap, CS_MAX_NUM_TABLES_TABLE_ENTRIES, Loop, ResultsEntry->State);
     }
 
     /* Reset the table back to the original checksumming state */
@@ -757,6 +877,9 @@ void CS_ProcessNewAppDefinitionTable(const CS_Def_App_Table_Entry_t *DefinitionT
     PreviousState                  = CS_AppData.HkPacket.Payload.AppCSState;
     CS_AppData.HkPacket.Payload.AppCSState = CS_STATE_DISABLED;
 
+    /* Name lookups go through the index, so it has to match the new table */
+    CS_BuildAppNameIndex(CS_AppData.AppNameIndex, StartOfDefTable);
+
     for (Loop = 0; Loop < CS_MAX_NUM_APP_TABLE_ENTRIES; Loop++)
     {
         DefEntry = &(StartOfDefTable[Loop]);
@@ -774,10 +897,21 @@ void CS_ProcessNewAppDefinitionTable(const CS_Def_App_Table_Entry_t *DefinitionT
             ResultsEntry->NumBytesToChecksum = 0; /* this is unknown at this time */
             ResultsEntry->ComparisonValue    = 0;
             ResultsEntry->ByteOffset         = 0;
-            ResultsEntry->TempChecksumValue  = 0;
+            ResultsEntry->LastCheckTime      = 0;
+            ResultsEntry->DeadlineMisses     = 0;
+            ResultsEntry->Algorithm          = DefEntry->Algorithm;
             ResultsEntry->StartAddress       = 0; /* this is unknown at this time */
+            ResultsEntry->ResourceID         = CFE_RESOURCEID_UNDEFINED;
             CFE_SB_MessageStringGet(ResultsEntry->Name, DefEntry->Name, NULL, sizeof(ResultsEntry->Name),
                                     sizeof(DefEntry->Name));
+
+            if (DefEntry->HasExpectedValue == true)
+            {
+                /* Check against the expected value from the first pass instead of learning a baseline */
+                ResultsEntry->ComputedYet      = true;
+                ResultsEntry->ComparisonDigest = DefEntry->ExpectedValue;
+                ResultsEntry->ComparisonValue  = CS_DigestSummary(&DefEntry->ExpectedValue);
+            }
         }
         else
         {
@@ -786,11 +920,16 @@ void CS_ProcessNewAppDefinitionTable(const CS_Def_App_Table_Entry_t *DefinitionT
             ResultsEntry->NumBytesToChecksum = 0;
             ResultsEntry->ComparisonValue    = 0;
             ResultsEntry->ByteOffset         = 0;
-            ResultsEntry->TempChecksumValue  = 0;
+            ResultsEntry->LastCheckTime      = 0;
+            ResultsEntry->DeadlineMisses     = 0;
+            ResultsEntry->Algorithm          = CS_ALGORITHM_DEFAULT;
             ResultsEntry->StartAddress       = 0;
+            ResultsEntry->ResourceID         = CFE_RESOURCEID_UNDEFINED;
 
             ResultsEntry->Name[0] = '\0';
         }
+
+        CS_SetEnabledMapEntry(CS_AppData.AppEnabledMap, CS_MAX_NUM_APP_TABLE_ENTRIES, Loop, ResultsEntry->State);
     }
 
     /* Reset the table back to the original checksumming state */
@@ -946,6 +1085,24 @@ CFE_Status_t CS_TableInit(CFE_TBL_Handle_t *DefinitionTableHandle, CFE_TBL_Handl
                 break;
         }
     }
+
+    /* Have Table Services say when the tables need managing, so routine
+     * table updates can skip them until then.  The results table is dump
+     * only, but a dump of it still needs managing.  Tables that cannot be
+     * notified are managed at every housekeeping request instead. */
+    if (Result == CFE_SUCCESS &&
+        CFE_TBL_NotifyByMessage(*DefinitionTableHandle, CFE_SB_ValueToMsgId(CS_CMD_MID), CS_MANAGE_TABLE_CC,
+                                Table) == CFE_SUCCESS &&
+        CFE_TBL_NotifyByMessage(*ResultsTableHandle, CFE_SB_ValueToMsgId(CS_CMD_MID), CS_MANAGE_TABLE_CC, Table) ==
+            CFE_SUCCESS)
+    {
+        CS_AppData.TableNotified |= CS_TABLE_BIT(Table);
+    }
+    else
+    {
+        CS_AppData.TableNotified &= ~CS_TABLE_BIT(Table);
+    }
+
     return Result;
 }
 
@@ -32,6 +32,11 @@
 #include "cs_events.h"
 #include "cs_compute.h"
 #include "cs_utils.h"
+#include "cs_budget.h"
+#include "cs_block.h"
+#include "cs_syndrome.h"
+#include "cs_sched.h"
+#include "cs_jobs.h"
 #include <string.h>
 
 /**************************************************************************
@@ -50,8 +55,8 @@ void CS_ZeroEepromTempValues(void)
 
     for (Loop = 0; Loop < CS_MAX_NUM_EEPROM_TABLE_ENTRIES; Loop++)
     {
-        CS_AppData.ResEepromTblPtr[Loop].TempChecksumValue = 0;
-        CS_AppData.ResEepromTblPtr[Loop].ByteOffset        = 0;
+        CS_AppData.ResEepromTblPtr[Loop].ByteOffset    = 0;
+        CS_AppData.ResEepromTblPtr[Loop].LastCheckTime = 0;
     }
 }
 
@@ -66,8 +71,8 @@ void CS_ZeroMemoryTempValues(void)
 
     for (Loop = 0; Loop < CS_MAX_NUM_MEMORY_TABLE_ENTRIES; Loop++)
     {
-        CS_AppData.ResMemoryTblPtr[Loop].TempChecksumValue = 0;
-        CS_AppData.ResMemoryTblPtr[Loop].ByteOffset        = 0;
+        CS_AppData.ResMemoryTblPtr[Loop].ByteOffset    = 0;
+        CS_AppData.ResMemoryTblPtr[Loop].LastCheckTime = 0;
     }
 }
 
@@ -82,8 +87,8 @@ void CS_ZeroTablesTempValues(void)
 
     for (Loop = 0; Loop < CS_MAX_NUM_TABLES_TABLE_ENTRIES; Loop++)
     {
-        CS_AppData.ResTablesTblPtr[Loop].TempChecksumValue = 0;
-        CS_AppData.ResTablesTblPtr[Loop].ByteOffset        = 0;
+        CS_AppData.ResTablesTblPtr[Loop].ByteOffset    = 0;
+        CS_AppData.ResTablesTblPtr[Loop].LastCheckTime = 0;
     }
 }
 
@@ -98,8 +103,8 @@ void CS_ZeroAppTempValues(void)
 
     for (Loop = 0; Loop < CS_MAX_NUM_APP_TABLE_ENTRIES; Loop++)
     {
-        CS_AppData.ResAppTblPtr[Loop].TempChecksumValue = 0;
-        CS_AppData.ResAppTblPtr[Loop].ByteOffset        = 0;
+        CS_AppData.ResAppTblPtr[Loop].ByteOffset    = 0;
+        CS_AppData.ResAppTblPtr[Loop].LastCheckTime = 0;
     }
 }
 
@@ -110,8 +115,8 @@ void CS_ZeroAppTempValues(void)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CS_ZeroCfeCoreTempValues(void)
 {
-    CS_AppData.CfeCoreCodeSeg.TempChecksumValue = 0;
-    CS_AppData.CfeCoreCodeSeg.ByteOffset        = 0;
+    CS_AppData.CfeCoreCodeSeg.ByteOffset    = 0;
+    CS_AppData.CfeCoreCodeSeg.LastCheckTime = 0;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -121,8 +126,8 @@ void CS_ZeroCfeCoreTempValues(void)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CS_ZeroOSTempValues(void)
 {
-    CS_AppData.OSCodeSeg.TempChecksumValue = 0;
-    CS_AppData.OSCodeSeg.ByteOffset        = 0;
+    CS_AppData.OSCodeSeg.ByteOffset    = 0;
+    CS_AppData.OSCodeSeg.LastCheckTime = 0;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -168,19 +173,203 @@ void CS_InitializeDefaultTables(void)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CS_GoToNextTable(void)
 {
-    if (CS_AppData.HkPacket.Payload.CurrentCSTable < (CS_NUM_TABLES - 1))
+    /* A sweep that took over from the round robin hands back to where it was */
+    if (CS_SchedTableDone() == false)
     {
-        CS_AppData.HkPacket.Payload.CurrentCSTable++;
+        if (CS_AppData.HkPacket.Payload.CurrentCSTable < (CS_NUM_TABLES - 1))
+        {
+            CS_AppData.HkPacket.Payload.CurrentCSTable++;
+        }
+        else
+        {
+            CS_AppData.HkPacket.Payload.CurrentCSTable = 0;
+            /* we are back to the beginning of the tables to checksum
+             we need to update the pass counter */
+            CS_AppData.HkPacket.Payload.PassCounter++;
+            CS_BudgetEndPass();
+        }
+
+        /* The next table may have been part way through when another took over */
+        CS_AppData.HkPacket.Payload.CurrentEntryInTable =
+            CS_AppData.Sched.Cursor[CS_AppData.HkPacket.Payload.CurrentCSTable];
     }
-    else
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Hash a name (FNV-1a)                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 CS_NameHash(const char *Name, size_t MaxLength)
+{
+    uint32 Hash  = 2166136261U;
+    size_t Index = 0;
+
+    while (Index < MaxLength && Name[Index] != '\0')
     {
-        CS_AppData.HkPacket.Payload.CurrentCSTable = 0;
-        /* we are back to the beginning of the tables to checksum
-         we need to update the pass counter */
-        CS_AppData.HkPacket.Payload.PassCounter++;
+        Hash ^= (uint8)Name[Index];
+        Hash *= 16777619U;
+        Index++;
     }
 
-    CS_AppData.HkPacket.Payload.CurrentEntryInTable = 0;
+    return Hash;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Add an entry to a name index                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_NameIndexAdd(uint32 *NameIndex, uint32 IndexSize, uint32 Hash, uint16 Entry)
+{
+    uint32 Slot  = Hash % IndexSize;
+    uint32 Probe = 0;
+
+    /* Linear probing, there is always a free slot since the index is twice the size of its table */
+    while (Probe < IndexSize && NameIndex[Slot] != 0)
+    {
+        Slot = (Slot + 1) % IndexSize;
+        Probe++;
+    }
+
+    if (Probe < IndexSize)
+    {
+        /* The top half of the slot holds the top half of the hash, so most
+           other names can be skipped without comparing strings */
+        NameIndex[Slot] = (Hash & CS_NAME_INDEX_HASH_MASK) | ((uint32)Entry + 1);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Get the next entry in a name index that might have a name    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_NameIndexNext(const uint32 *NameIndex, uint32 IndexSize, uint32 Hash, uint32 *Probe, uint16 *Entry)
+{
+    uint32 Slot  = 0;
+    bool   Found = false;
+
+    while (!Found && *Probe < IndexSize)
+    {
+        Slot = ((Hash % IndexSize) + *Probe) % IndexSize;
+
+        if (NameIndex[Slot] == 0)
+        {
+            /* The end of the probe sequence */
+            *Probe = IndexSize;
+        }
+        else
+        {
+            (*Probe)++;
+
+            if ((NameIndex[Slot] & CS_NAME_INDEX_HASH_MASK) == (Hash & CS_NAME_INDEX_HASH_MASK))
+            {
+                *Entry = (uint16)((NameIndex[Slot] & CS_NAME_INDEX_ENTRY_MASK) - 1);
+                Found  = true;
+            }
+        }
+    }
+
+    return Found;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Build the name index of a Tables definition table            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_BuildTablesNameIndex(uint32 *NameIndex, const CS_Def_Tables_Table_Entry_t *DefinitionTblPtr)
+{
+    uint16 Loop;
+
+    memset(NameIndex, 0, CS_TABLES_NAME_INDEX_SIZE * sizeof(NameIndex[0]));
+
+    for (Loop = 0; Loop < CS_MAX_NUM_TABLES_TABLE_ENTRIES; Loop++)
+    {
+        if (DefinitionTblPtr[Loop].Name[0] != '\0')
+        {
+            CS_NameIndexAdd(NameIndex, CS_TABLES_NAME_INDEX_SIZE,
+                            CS_NameHash(DefinitionTblPtr[Loop].Name, CFE_TBL_MAX_FULL_NAME_LEN), Loop);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Build the name index of an Apps definition table             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_BuildAppNameIndex(uint32 *NameIndex, const CS_Def_App_Table_Entry_t *DefinitionTblPtr)
+{
+    uint16 Loop;
+
+    memset(NameIndex, 0, CS_APP_NAME_INDEX_SIZE * sizeof(NameIndex[0]));
+
+    for (Loop = 0; Loop < CS_MAX_NUM_APP_TABLE_ENTRIES; Loop++)
+    {
+        if (DefinitionTblPtr[Loop].Name[0] != '\0')
+        {
+            CS_NameIndexAdd(NameIndex, CS_APP_NAME_INDEX_SIZE,
+                            CS_NameHash(DefinitionTblPtr[Loop].Name, OS_MAX_API_NAME), Loop);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Find the first later entry of a Tables definition table      */
+/* with the same name                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_FindTablesNameDuplicate(const uint32 *NameIndex, const CS_Def_Tables_Table_Entry_t *DefinitionTblPtr,
+                                uint16 Entry, uint16 *Duplicate)
+{
+    const char *Name      = DefinitionTblPtr[Entry].Name;
+    uint32      Hash      = CS_NameHash(Name, CFE_TBL_MAX_FULL_NAME_LEN);
+    uint32      Probe     = 0;
+    uint16      Candidate = 0;
+    bool        Found     = false;
+
+    while (CS_NameIndexNext(NameIndex, CS_TABLES_NAME_INDEX_SIZE, Hash, &Probe, &Candidate))
+    {
+        if (Candidate > Entry && (!Found || Candidate < *Duplicate) &&
+            strncmp(Name, DefinitionTblPtr[Candidate].Name, CFE_TBL_MAX_FULL_NAME_LEN) == 0)
+        {
+            *Duplicate = Candidate;
+            Found      = true;
+        }
+    }
+
+    return Found;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Find the first earlier entry of an Apps definition table     */
+/* with the same name                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_FindAppNameDuplicate(const uint32 *NameIndex, const CS_Def_App_Table_Entry_t *DefinitionTblPtr, uint16 Entry,
+                             uint16 *Duplicate)
+{
+    const char *Name      = DefinitionTblPtr[Entry].Name;
+    uint32      Hash      = CS_NameHash(Name, OS_MAX_API_NAME);
+    uint32      Probe     = 0;
+    uint16      Candidate = 0;
+    bool        Found     = false;
+
+    while (CS_NameIndexNext(NameIndex, CS_APP_NAME_INDEX_SIZE, Hash, &Probe, &Candidate))
+    {
+        if (Candidate < Entry && (!Found || Candidate < *Duplicate) &&
+            strncmp(Name, DefinitionTblPtr[Candidate].Name, OS_MAX_API_NAME) == 0)
+        {
+            *Duplicate = Candidate;
+            Found      = true;
+        }
+    }
+
+    return Found;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -190,24 +379,20 @@ void CS_GoToNextTable(void)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 bool CS_GetTableResTblEntryByName(CS_Res_Tables_Table_Entry_t **EntryPtr, const char *Name)
 {
-    CS_Res_Tables_Table_Entry_t *StartOfResultsTable = NULL;
-    CS_Res_Tables_Table_Entry_t *ResultsEntry        = NULL;
-    int32                        Loop;
-    uint16                       MaxEntries;
-    bool                         Status = false;
-
-    StartOfResultsTable = CS_AppData.ResTablesTblPtr;
-    MaxEntries          = CS_MAX_NUM_TABLES_TABLE_ENTRIES;
+    CS_Res_Tables_Table_Entry_t *ResultsEntry = NULL;
+    uint32                       Hash         = CS_NameHash(Name, CFE_TBL_MAX_FULL_NAME_LEN);
+    uint32                       Probe        = 0;
+    uint16                       Entry        = 0;
+    bool                         Status       = false;
 
-    for (Loop = 0; Loop < MaxEntries; Loop++)
+    while (!Status && CS_NameIndexNext(CS_AppData.TablesNameIndex, CS_TABLES_NAME_INDEX_SIZE, Hash, &Probe, &Entry))
     {
-        ResultsEntry = &StartOfResultsTable[Loop];
+        ResultsEntry = &CS_AppData.ResTablesTblPtr[Entry];
 
         if (strncmp(ResultsEntry->Name, Name, CFE_TBL_MAX_FULL_NAME_LEN) == 0 && ResultsEntry->State != CS_STATE_EMPTY)
         {
             Status    = true;
             *EntryPtr = ResultsEntry;
-            break;
         }
     }
     return Status;
@@ -220,25 +405,21 @@ bool CS_GetTableResTblEntryByName(CS_Res_Tables_Table_Entry_t **EntryPtr, const
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 bool CS_GetTableDefTblEntryByName(CS_Def_Tables_Table_Entry_t **EntryPtr, const char *Name)
 {
-    CS_Def_Tables_Table_Entry_t *StartOfDefinitionTable = NULL;
-    CS_Def_Tables_Table_Entry_t *DefinitionEntry        = NULL;
-    int32                        Loop;
-    uint16                       MaxEntries;
-    bool                         Status = false;
+    CS_Def_Tables_Table_Entry_t *DefinitionEntry = NULL;
+    uint32                       Hash            = CS_NameHash(Name, CFE_TBL_MAX_FULL_NAME_LEN);
+    uint32                       Probe           = 0;
+    uint16                       Entry           = 0;
+    bool                         Status          = false;
 
-    StartOfDefinitionTable = CS_AppData.DefTablesTblPtr;
-    MaxEntries             = CS_MAX_NUM_TABLES_TABLE_ENTRIES;
-
-    for (Loop = 0; Loop < MaxEntries; Loop++)
+    while (!Status && CS_NameIndexNext(CS_AppData.TablesNameIndex, CS_TABLES_NAME_INDEX_SIZE, Hash, &Probe, &Entry))
     {
-        DefinitionEntry = &StartOfDefinitionTable[Loop];
+        DefinitionEntry = &CS_AppData.DefTablesTblPtr[Entry];
 
         if (strncmp(DefinitionEntry->Name, Name, CFE_TBL_MAX_FULL_NAME_LEN) == 0 &&
             DefinitionEntry->State != CS_STATE_EMPTY)
         {
             Status    = true;
             *EntryPtr = DefinitionEntry;
-            break;
         }
     }
     return Status;
@@ -251,24 +432,20 @@ bool CS_GetTableDefTblEntryByName(CS_Def_Tables_Table_Entry_t **EntryPtr, const
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 bool CS_GetAppResTblEntryByName(CS_Res_App_Table_Entry_t **EntryPtr, const char *Name)
 {
-    CS_Res_App_Table_Entry_t *StartOfResultsTable = NULL;
-    CS_Res_App_Table_Entry_t *ResultsEntry        = NULL;
-    int32                     Loop;
-    uint16                    MaxEntries;
-    bool                      Status = false;
-
-    StartOfResultsTable = CS_AppData.ResAppTblPtr;
-    MaxEntries          = CS_MAX_NUM_APP_TABLE_ENTRIES;
+    CS_Res_App_Table_Entry_t *ResultsEntry = NULL;
+    uint32                    Hash         = CS_NameHash(Name, OS_MAX_API_NAME);
+    uint32                    Probe        = 0;
+    uint16                    Entry        = 0;
+    bool                      Status       = false;
 
-    for (Loop = 0; Loop < MaxEntries; Loop++)
+    while (!Status && CS_NameIndexNext(CS_AppData.AppNameIndex, CS_APP_NAME_INDEX_SIZE, Hash, &Probe, &Entry))
     {
-        ResultsEntry = &StartOfResultsTable[Loop];
+        ResultsEntry = &CS_AppData.ResAppTblPtr[Entry];
 
         if (strncmp(ResultsEntry->Name, Name, OS_MAX_API_NAME) == 0 && ResultsEntry->State != CS_STATE_EMPTY)
         {
             Status    = true;
             *EntryPtr = ResultsEntry;
-            break;
         }
     }
     return Status;
@@ -281,24 +458,20 @@ bool CS_GetAppResTblEntryByName(CS_Res_App_Table_Entry_t **EntryPtr, const char
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 bool CS_GetAppDefTblEntryByName(CS_Def_App_Table_Entry_t **EntryPtr, const char *Name)
 {
-    CS_Def_App_Table_Entry_t *StartOfDefinitionTable = NULL;
-    CS_Def_App_Table_Entry_t *DefinitionEntry        = NULL;
-    int32                     Loop;
-    uint16                    MaxEntries;
-    bool                      Status = false;
+    CS_Def_App_Table_Entry_t *DefinitionEntry = NULL;
+    uint32                    Hash            = CS_NameHash(Name, OS_MAX_API_NAME);
+    uint32                    Probe           = 0;
+    uint16                    Entry           = 0;
+    bool                      Status          = false;
 
-    StartOfDefinitionTable = CS_AppData.DefAppTblPtr;
-    MaxEntries             = CS_MAX_NUM_APP_TABLE_ENTRIES;
-
-    for (Loop = 0; Loop < MaxEntries; Loop++)
+    while (!Status && CS_NameIndexNext(CS_AppData.AppNameIndex, CS_APP_NAME_INDEX_SIZE, Hash, &Probe, &Entry))
     {
-        DefinitionEntry = &StartOfDefinitionTable[Loop];
+        DefinitionEntry = &CS_AppData.DefAppTblPtr[Entry];
 
         if (strncmp(DefinitionEntry->Name, Name, OS_MAX_API_NAME) == 0 && DefinitionEntry->State != CS_STATE_EMPTY)
         {
             Status    = true;
             *EntryPtr = DefinitionEntry;
-            break;
         }
     }
     return Status;
@@ -306,34 +479,156 @@ bool CS_GetAppDefTblEntryByName(CS_Def_App_Table_Entry_t **EntryPtr, const char
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* CS Get the next CS-enabled entry of this table                  */
+/* CS Count the trailing zero bits of a non-zero word              */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-bool CS_FindEnabledEepromEntry(uint16 *EnabledEntry)
+static uint32 CS_CountTrailingZeros(uint32 Bits)
 {
-    CS_Res_EepromMemory_Table_Entry_t *StartOfResultsTable = NULL;
-    CS_Res_EepromMemory_Table_Entry_t *ResultsEntry        = NULL;
-    bool                               EnabledEntries      = true;
+#if defined(__GNUC__)
+    return (uint32)__builtin_ctz(Bits);
+#else
+    uint32 Count = 0;
+
+    while ((Bits & 1) == 0)
+    {
+        Bits >>= 1;
+        Count++;
+    }
 
-    StartOfResultsTable = CS_AppData.ResEepromTblPtr;
+    return Count;
+#endif
+}
 
-    ResultsEntry = &StartOfResultsTable[CS_AppData.HkPacket.Payload.CurrentEntryInTable];
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Get the next set bit of a bit array at or after a bit        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool CS_FindNextSetBit(const uint32 *Words, uint32 NumWords, uint32 *Bit)
+{
+    uint32 Word  = *Bit / 32;
+    uint32 Bits  = 0;
+    bool   Found = false;
 
-    while (ResultsEntry->State != CS_STATE_ENABLED)
+    if (Word < NumWords)
     {
-        CS_AppData.HkPacket.Payload.CurrentEntryInTable++;
+        /* Ignore the bits before this one */
+        Bits = Words[Word] & (0xFFFFFFFFU << (*Bit % 32));
 
-        if (CS_AppData.HkPacket.Payload.CurrentEntryInTable >= CS_MAX_NUM_EEPROM_TABLE_ENTRIES)
+        while (Bits == 0 && ++Word < NumWords)
+        {
+            Bits = Words[Word];
+        }
+
+        if (Bits != 0)
+        {
+            *Bit  = (Word * 32) + CS_CountTrailingZeros(Bits);
+            Found = true;
+        }
+    }
+
+    return Found;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Update the bit of an entry in an enabled entry map           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_SetEnabledMapEntry(uint32 *EnabledMap, uint16 NumEntries, uint16 Entry, uint16 State)
+{
+    uint32 *Summary = EnabledMap;
+    uint32 *Bits    = &EnabledMap[CS_ENABLED_MAP_SUMMARY_WORDS(NumEntries)];
+    uint32  Word    = Entry / 32;
+
+    if (State == CS_STATE_ENABLED)
+    {
+        Bits[Word] |= (1U << (Entry % 32));
+    }
+    else
+    {
+        Bits[Word] &= ~(1U << (Entry % 32));
+    }
+
+    /* The summary bit says whether any entry of the word is enabled */
+    if (Bits[Word] != 0)
+    {
+        Summary[Word / 32] |= (1U << (Word % 32));
+    }
+    else
+    {
+        Summary[Word / 32] &= ~(1U << (Word % 32));
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Get the next set bit of an enabled entry map                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_FindNextEnabledMapEntry(const uint32 *EnabledMap, uint16 NumEntries, uint16 *Entry)
+{
+    const uint32 *Summary = EnabledMap;
+    const uint32 *Bits    = &EnabledMap[CS_ENABLED_MAP_SUMMARY_WORDS(NumEntries)];
+    uint32        Bit     = *Entry;
+    uint32        Word    = 0;
+    bool          Found   = false;
+
+    if (*Entry < NumEntries)
+    {
+        /* Try the rest of the entry's own word before going to the summary */
+        Word  = Bit % 32;
+        Found = CS_FindNextSetBit(&Bits[Bit / 32], 1, &Word);
+
+        if (Found)
+        {
+            Bit = ((Bit / 32) * 32) + Word;
+        }
+        else
         {
-            /* we reached the end no more enabled entries */
-            EnabledEntries = false;
-            break;
+            Word  = (Bit / 32) + 1;
+            Found = CS_FindNextSetBit(Summary, CS_ENABLED_MAP_SUMMARY_WORDS(NumEntries), &Word);
+            if (Found)
+            {
+                Bit = Word * 32;
+                CS_FindNextSetBit(Bits, CS_ENABLED_MAP_BIT_WORDS(NumEntries), &Bit);
+            }
         }
 
-        ResultsEntry = &StartOfResultsTable[CS_AppData.HkPacket.Payload.CurrentEntryInTable];
-    } /* end while */
+        Found = (Found && Bit < NumEntries);
+    }
 
-    *EnabledEntry = CS_AppData.HkPacket.Payload.CurrentEntryInTable;
+    *Entry = (uint16)(Found ? Bit : NumEntries);
+
+    return Found;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Get the next CS-enabled entry of this table                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_FindEnabledEepromEntry(uint16 *EnabledEntry)
+{
+    uint16 Entry          = CS_AppData.HkPacket.Payload.CurrentEntryInTable;
+    bool   EnabledEntries = false;
+
+    while (!EnabledEntries &&
+           CS_FindNextEnabledMapEntry(CS_AppData.EepromEnabledMap, CS_MAX_NUM_EEPROM_TABLE_ENTRIES, &Entry))
+    {
+        /* An entry a recompute owns waits until the recompute is reported */
+        EnabledEntries =
+            (CS_AppData.ResEepromTblPtr[Entry].State == CS_STATE_ENABLED && !CS_JobsEntryBusy(CS_EEPROM_TABLE, Entry));
+
+        if (!EnabledEntries)
+        {
+            Entry++;
+        }
+    }
+
+    CS_AppData.HkPacket.Payload.CurrentEntryInTable = Entry;
+
+    *EnabledEntry = Entry;
 
     return EnabledEntries;
 }
@@ -345,28 +640,25 @@ bool CS_FindEnabledEepromEntry(uint16 *EnabledEntry)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 bool CS_FindEnabledMemoryEntry(uint16 *EnabledEntry)
 {
-    CS_Res_EepromMemory_Table_Entry_t *StartOfResultsTable = NULL;
-    CS_Res_EepromMemory_Table_Entry_t *ResultsEntry        = NULL;
-    bool                               EnabledEntries      = true;
+    uint16 Entry          = CS_AppData.HkPacket.Payload.CurrentEntryInTable;
+    bool   EnabledEntries = false;
 
-    StartOfResultsTable = CS_AppData.ResMemoryTblPtr;
-    ResultsEntry        = &StartOfResultsTable[CS_AppData.HkPacket.Payload.CurrentEntryInTable];
-
-    while (ResultsEntry->State != CS_STATE_ENABLED)
+    while (!EnabledEntries &&
+           CS_FindNextEnabledMapEntry(CS_AppData.MemoryEnabledMap, CS_MAX_NUM_MEMORY_TABLE_ENTRIES, &Entry))
     {
-        CS_AppData.HkPacket.Payload.CurrentEntryInTable++;
+        /* An entry a recompute owns waits until the recompute is reported */
+        EnabledEntries =
+            (CS_AppData.ResMemoryTblPtr[Entry].State == CS_STATE_ENABLED && !CS_JobsEntryBusy(CS_MEMORY_TABLE, Entry));
 
-        if (CS_AppData.HkPacket.Payload.CurrentEntryInTable >= CS_MAX_NUM_MEMORY_TABLE_ENTRIES)
+        if (!EnabledEntries)
         {
-            /* we reached the end no more enabled entries */
-            EnabledEntries = false;
-            break;
+            Entry++;
         }
+    }
 
-        ResultsEntry = &StartOfResultsTable[CS_AppData.HkPacket.Payload.CurrentEntryInTable];
-    } /* end while */
+    CS_AppData.HkPacket.Payload.CurrentEntryInTable = Entry;
 
-    *EnabledEntry = CS_AppData.HkPacket.Payload.CurrentEntryInTable;
+    *EnabledEntry = Entry;
 
     return EnabledEntries;
 }
@@ -378,33 +670,29 @@ bool CS_FindEnabledMemoryEntry(uint16 *EnabledEntry)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 bool CS_FindEnabledTablesEntry(uint16 *EnabledEntry)
 {
-    CS_Res_Tables_Table_Entry_t *StartOfResultsTable = NULL;
-    CS_Res_Tables_Table_Entry_t *ResultsEntry        = NULL;
-    bool                         EnabledEntries      = true;
-
-    StartOfResultsTable = CS_AppData.ResTablesTblPtr;
-    ResultsEntry        = &StartOfResultsTable[CS_AppData.HkPacket.Payload.CurrentEntryInTable];
+    uint16 Entry          = CS_AppData.HkPacket.Payload.CurrentEntryInTable;
+    bool   EnabledEntries = false;
 
-    while (ResultsEntry->State != CS_STATE_ENABLED)
+    while (!EnabledEntries &&
+           CS_FindNextEnabledMapEntry(CS_AppData.TablesEnabledMap, CS_MAX_NUM_TABLES_TABLE_ENTRIES, &Entry))
     {
-        CS_AppData.HkPacket.Payload.CurrentEntryInTable++;
+        /* An entry a recompute owns waits until the recompute is reported */
+        EnabledEntries =
+            (CS_AppData.ResTablesTblPtr[Entry].State == CS_STATE_ENABLED && !CS_JobsEntryBusy(CS_TABLES_TABLE, Entry));
 
-        if (CS_AppData.HkPacket.Payload.CurrentEntryInTable >= CS_MAX_NUM_TABLES_TABLE_ENTRIES)
+        if (!EnabledEntries)
         {
-            /* we reached the end no more enabled entries */
-            EnabledEntries = false;
-
-            break;
+            Entry++;
         }
+    }
 
-        ResultsEntry = &StartOfResultsTable[CS_AppData.HkPacket.Payload.CurrentEntryInTable];
-
-    } /* end while */
+    CS_AppData.HkPacket.Payload.CurrentEntryInTable = Entry;
 
-    *EnabledEntry = CS_AppData.HkPacket.Payload.CurrentEntryInTable;
+    *EnabledEntry = Entry;
 
     return EnabledEntries;
 }
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* CS Get the next CS-enabled entry of this table                  */
@@ -412,29 +700,25 @@ bool CS_FindEnabledTablesEntry(uint16 *EnabledEntry)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 bool CS_FindEnabledAppEntry(uint16 *EnabledEntry)
 {
-    CS_Res_App_Table_Entry_t *StartOfResultsTable = NULL;
-    CS_Res_App_Table_Entry_t *ResultsEntry        = NULL;
-    bool                      EnabledEntries      = true;
-
-    StartOfResultsTable = CS_AppData.ResAppTblPtr;
-    ResultsEntry        = &StartOfResultsTable[CS_AppData.HkPacket.Payload.CurrentEntryInTable];
+    uint16 Entry          = CS_AppData.HkPacket.Payload.CurrentEntryInTable;
+    bool   EnabledEntries = false;
 
-    while (ResultsEntry->State != CS_STATE_ENABLED)
+    while (!EnabledEntries &&
+           CS_FindNextEnabledMapEntry(CS_AppData.AppEnabledMap, CS_MAX_NUM_APP_TABLE_ENTRIES, &Entry))
     {
-        CS_AppData.HkPacket.Payload.CurrentEntryInTable++;
+        /* An entry a recompute owns waits until the recompute is reported */
+        EnabledEntries =
+            (CS_AppData.ResAppTblPtr[Entry].State == CS_STATE_ENABLED && !CS_JobsEntryBusy(CS_APP_TABLE, Entry));
 
-        if (CS_AppData.HkPacket.Payload.CurrentEntryInTable >= CS_MAX_NUM_APP_TABLE_ENTRIES)
+        if (!EnabledEntries)
         {
-            /* we reached the end no more enabled entries */
-            EnabledEntries = false;
-            break;
+            Entry++;
         }
+    }
 
-        ResultsEntry = &StartOfResultsTable[CS_AppData.HkPacket.Payload.CurrentEntryInTable];
-
-    } /* end while */
+    CS_AppData.HkPacket.Payload.CurrentEntryInTable = Entry;
 
-    *EnabledEntry = CS_AppData.HkPacket.Payload.CurrentEntryInTable;
+    *EnabledEntry = Entry;
 
     return EnabledEntries;
 }
@@ -486,17 +770,16 @@ bool CS_BackgroundCfeCore(void)
     {
         ResultsEntry = &CS_AppData.CfeCoreCodeSeg;
 
-        /* Check if the code segment state is enabled (could be disabled for
-           a ground-commanded recompute) */
-        if (ResultsEntry->State == CS_STATE_ENABLED)
+        /* Check if the code segment state is enabled, and that a ground-commanded
+         recompute does not own it */
+        if (ResultsEntry->State == CS_STATE_ENABLED && !CS_JobsEntryBusy(CS_CFECORE, 0))
         {
             /* If we complete an entry's checksum, this function will update it for us */
-            Status = CS_ComputeEepromMemory(ResultsEntry, &ComputedCSValue, &DoneWithEntry);
+            Status = CS_ComputeEepromMemory(ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL);
 
-            /* We need to avoid the case of finishing a table, moving on to the next one
-             and computing an entry in that table, since it could put us above the
-             maximum bytes per cycle */
-            DoneWithCycle = true;
+            /* The rest of the cycle's budget goes to the next table, unless this
+             entry used it up */
+            DoneWithCycle = (DoneWithEntry == false || CS_BudgetCycleSpent());
 
             if (Status == CS_ERROR)
             {
@@ -507,10 +790,14 @@ bool CS_BackgroundCfeCore(void)
                 CFE_EVS_SendEvent(CS_CFECORE_MISCOMPARE_ERR_EID, CFE_EVS_EventType_ERROR,
                                   "Checksum Failure: cFE Core, Expected: 0x%08X, Calculated: 0x%08X",
                                   (unsigned int)(ResultsEntry->ComparisonValue), (unsigned int)ComputedCSValue);
+
+                CS_SyndromeReport(CS_CFECORE, 0, ResultsEntry->Algorithm, ResultsEntry->StartAddress,
+                                  ResultsEntry->NumBytesToChecksum, ResultsEntry->ComparisonValue, ComputedCSValue);
             }
 
             if (DoneWithEntry == true)
             {
+                CS_SchedEntryChecked(CS_CFECORE, &ResultsEntry->LastCheckTime, &ResultsEntry->DeadlineMisses);
                 CS_AppData.HkPacket.Payload.CurrentEntryInTable++;
             }
 
@@ -553,17 +840,16 @@ bool CS_BackgroundOS(void)
     {
         ResultsEntry = &CS_AppData.OSCodeSeg;
 
-        /* Check if the code segment state is enabled (could be disabled for
-         a ground-commanded recompute) */
-        if (ResultsEntry->State == CS_STATE_ENABLED)
+        /* Check if the code segment state is enabled, and that a ground-commanded
+         recompute does not own it */
+        if (ResultsEntry->State == CS_STATE_ENABLED && !CS_JobsEntryBusy(CS_OSCORE, 0))
         {
             /* If we complete an entry's checksum, this function will update it for us */
-            Status = CS_ComputeEepromMemory(ResultsEntry, &ComputedCSValue, &DoneWithEntry);
+            Status = CS_ComputeEepromMemory(ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL);
 
-            /* We need to avoid the case of finishing a table, moving on to the next one
-             and computing an entry in that table, since it could put us above the
-             maximum bytes per cycle */
-            DoneWithCycle = true;
+            /* The rest of the cycle's budget goes to the next table, unless this
+             entry used it up */
+            DoneWithCycle = (DoneWithEntry == false || CS_BudgetCycleSpent());
 
             if (Status == CS_ERROR)
             {
@@ -573,10 +859,14 @@ bool CS_BackgroundOS(void)
                 CFE_EVS_SendEvent(CS_OS_MISCOMPARE_ERR_EID, CFE_EVS_EventType_ERROR,
                                   "Checksum Failure: OS code segment, Expected: 0x%08X, Calculated: 0x%08X",
                                   (unsigned int)(ResultsEntry->ComparisonValue), (unsigned int)ComputedCSValue);
+
+                CS_SyndromeReport(CS_OSCORE, 0, ResultsEntry->Algorithm, ResultsEntry->StartAddress,
+                                  ResultsEntry->NumBytesToChecksum, ResultsEntry->ComparisonValue, ComputedCSValue);
             }
 
             if (DoneWithEntry == true)
             {
+                CS_SchedEntryChecked(CS_OSCORE, &ResultsEntry->LastCheckTime, &ResultsEntry->DeadlineMisses);
                 CS_AppData.HkPacket.Payload.CurrentEntryInTable++;
             }
 
@@ -620,19 +910,18 @@ bool CS_BackgroundEeprom(void)
 
     if (CS_AppData.HkPacket.Payload.EepromCSState == CS_STATE_ENABLED)
     {
-        if (CS_FindEnabledEepromEntry(&CurrEntry) == true)
+        /* Keep going through enabled entries while the cycle has budget left */
+        while (DoneWithCycle == false && CS_FindEnabledEepromEntry(&CurrEntry) == true)
         {
             /* we found an enabled entry to checksum */
             StartOfResultsTable = CS_AppData.ResEepromTblPtr;
             ResultsEntry        = &StartOfResultsTable[CurrEntry];
 
             /* If we complete an entry's checksum, this function will update it for us */
-            Status = CS_ComputeEepromMemory(ResultsEntry, &ComputedCSValue, &DoneWithEntry);
+            Status = CS_ComputeEepromMemory(ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL);
 
-            /* We need to avoid the case of finishing a table, moving on to the next one
-             and computing an entry in that table, since it could put us above the
-             maximum bytes per cycle */
-            DoneWithCycle = true;
+            /* An entry left part way through only stops where the budget ran out */
+            DoneWithCycle = (DoneWithEntry == false || CS_BudgetCycleSpent());
 
             if (Status == CS_ERROR)
             {
@@ -644,10 +933,15 @@ bool CS_BackgroundEeprom(void)
                                   "Checksum Failure: Entry %d in EEPROM Table, Expected: 0x%08X, Calculated: 0x%08X",
                                   CurrEntry, (unsigned int)(ResultsEntry->ComparisonValue),
                                   (unsigned int)ComputedCSValue);
+
+                CS_BlockTreeReportMiscompare(ResultsEntry);
+                CS_SyndromeReport(CS_EEPROM_TABLE, CurrEntry, ResultsEntry->Algorithm, ResultsEntry->StartAddress,
+                                  ResultsEntry->NumBytesToChecksum, ResultsEntry->ComparisonValue, ComputedCSValue);
             }
 
             if (DoneWithEntry == true)
             {
+                CS_SchedEntryChecked(CS_EEPROM_TABLE, &ResultsEntry->LastCheckTime, &ResultsEntry->DeadlineMisses);
                 CS_AppData.HkPacket.Payload.CurrentEntryInTable++;
             }
         }
@@ -693,21 +987,18 @@ bool CS_BackgroundMemory(void)
 
     if (CS_AppData.HkPacket.Payload.MemoryCSState == CS_STATE_ENABLED)
     {
-        /* If we complete an entry's checksum, this function will update it for us */
-
-        if (CS_FindEnabledMemoryEntry(&CurrEntry) == true)
+        /* Keep going through enabled entries while the cycle has budget left */
+        while (DoneWithCycle == false && CS_FindEnabledMemoryEntry(&CurrEntry) == true)
         {
             /* we found an enabled entry to checksum */
             StartOfResultsTable = CS_AppData.ResMemoryTblPtr;
             ResultsEntry        = &StartOfResultsTable[CurrEntry];
 
             /* If we complete an entry's checksum, this function will update it for us */
-            Status = CS_ComputeEepromMemory(ResultsEntry, &ComputedCSValue, &DoneWithEntry);
+            Status = CS_ComputeEepromMemory(ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL);
 
-            /* We need to avoid the case of finishing a table, moving on to the next one
-             and computing an entry in that table, since it could put us above the
-             maximum bytes per cycle */
-            DoneWithCycle = true;
+            /* An entry left part way through only stops where the budget ran out */
+            DoneWithCycle = (DoneWithEntry == false || CS_BudgetCycleSpent());
 
             if (Status == CS_ERROR)
             {
@@ -719,21 +1010,23 @@ bool CS_BackgroundMemory(void)
                                   "Checksum Failure: Entry %d in Memory Table, Expected: 0x%08X, Calculated: 0x%08X",
                                   CurrEntry, (unsigned int)(ResultsEntry->ComparisonValue),
                                   (unsigned int)ComputedCSValue);
+
+                CS_BlockTreeReportMiscompare(ResultsEntry);
+                CS_SyndromeReport(CS_MEMORY_TABLE, CurrEntry, ResultsEntry->Algorithm, ResultsEntry->StartAddress,
+                                  ResultsEntry->NumBytesToChecksum, ResultsEntry->ComparisonValue, ComputedCSValue);
             }
 
             if (DoneWithEntry == true)
             {
+                CS_SchedEntryChecked(CS_MEMORY_TABLE, &ResultsEntry->LastCheckTime, &ResultsEntry->DeadlineMisses);
                 CS_AppData.HkPacket.Payload.CurrentEntryInTable++;
             }
-
-            if (CS_AppData.HkPacket.Payload.CurrentEntryInTable >= CS_MAX_NUM_MEMORY_TABLE_ENTRIES)
-            {
-                /* We are done with this table */
-                CS_GoToNextTable();
-            }
         }
-        else /* since there aren't any enabled entries in this table, go to the next one */
+
+        /* Also true when there aren't any more enabled entries in this table */
+        if (CS_AppData.HkPacket.Payload.CurrentEntryInTable >= CS_MAX_NUM_MEMORY_TABLE_ENTRIES)
         {
+            /* We are done with this table */
             CS_GoToNextTable();
         }
     }
@@ -762,21 +1055,21 @@ bool CS_BackgroundTables(void)
 
     if (CS_AppData.HkPacket.Payload.TablesCSState == CS_STATE_ENABLED)
     {
-        /* If we complete an entry's checksum, this function will update it for us */
-
-        if (CS_FindEnabledTablesEntry(&CurrEntry) == true)
+        /* Keep going through enabled entries while the cycle has budget left, so
+           many small tables are done in one cycle */
+        while (DoneWithCycle == false && CS_FindEnabledTablesEntry(&CurrEntry) == true)
         {
             /* we found an enabled entry to checksum */
 
             StartOfTablesResultsTable = CS_AppData.ResTablesTblPtr;
             TablesResultsEntry        = &StartOfTablesResultsTable[CurrEntry];
 
-            Status = CS_ComputeTables(TablesResultsEntry, &ComputedCSValue, &DoneWithEntry);
+            /* If we complete an entry's checksum, this function will update it for us */
+            Status = CS_ComputeTables(TablesResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL);
 
-            /* We need to avoid the case of finishing a table, moving on to the next one
-             and computing an entry in that table, since  it could put us above the
-             maximum bytes per cycle */
-            DoneWithCycle = true;
+            /* An entry left part way through only stops where the budget ran out, or
+               where the table could not be read */
+            DoneWithCycle = (DoneWithEntry == false || CS_BudgetCycleSpent());
 
             if (Status == CS_ERROR)
             {
@@ -800,17 +1093,16 @@ bool CS_BackgroundTables(void)
 
             if (DoneWithEntry == true)
             {
+                CS_SchedEntryChecked(CS_TABLES_TABLE, &TablesResultsEntry->LastCheckTime,
+                                     &TablesResultsEntry->DeadlineMisses);
                 CS_AppData.HkPacket.Payload.CurrentEntryInTable++;
             }
-
-            if (CS_AppData.HkPacket.Payload.CurrentEntryInTable >= CS_MAX_NUM_TABLES_TABLE_ENTRIES)
-            {
-                /* We are done with this table */
-                CS_GoToNextTable();
-            }
         }
-        else /* since there aren't any enabled entries in this table, go to the next one */
+
+        /* Also true when there aren't any more enabled entries in this table */
+        if (CS_AppData.HkPacket.Payload.CurrentEntryInTable >= CS_MAX_NUM_TABLES_TABLE_ENTRIES)
         {
+            /* We are done with this table */
             CS_GoToNextTable();
         }
     }
@@ -839,7 +1131,8 @@ bool CS_BackgroundApp(void)
 
     if (CS_AppData.HkPacket.Payload.AppCSState == CS_STATE_ENABLED)
     {
-        if (CS_FindEnabledAppEntry(&CurrEntry) == true)
+        /* Keep going through enabled entries while the cycle has budget left */
+        while (DoneWithCycle == false && CS_FindEnabledAppEntry(&CurrEntry) == true)
         {
             /* we found an enabled entry to checksum */
 
@@ -847,12 +1140,11 @@ bool CS_BackgroundApp(void)
             AppResultsEntry        = &StartOfAppResultsTable[CurrEntry];
 
             /* If we complete an entry's checksum, this function will update it for us */
-            Status = CS_ComputeApp(AppResultsEntry, &ComputedCSValue, &DoneWithEntry);
+            Status = CS_ComputeApp(AppResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL);
 
-            /* We need to avoid the case of finishing a table, moving on to the next one
-             and computing an entry in that table, since it could put us above the
-             maximum bytes per cycle */
-            DoneWithCycle = true;
+            /* An entry left part way through only stops where the budget ran out, or
+               where the app could not be read */
+            DoneWithCycle = (DoneWithEntry == false || CS_BudgetCycleSpent());
 
             if (Status == CS_ERROR)
             {
@@ -863,6 +1155,10 @@ bool CS_BackgroundApp(void)
                                   "Checksum Failure: Application %s, Expected: 0x%08X, Calculated: 0x%08X",
                                   AppResultsEntry->Name, (unsigned int)(AppResultsEntry->ComparisonValue),
                                   (unsigned int)ComputedCSValue);
+
+                CS_SyndromeReport(CS_APP_TABLE, CurrEntry, AppResultsEntry->Algorithm, AppResultsEntry->StartAddress,
+                                  AppResultsEntry->NumBytesToChecksum, AppResultsEntry->ComparisonValue,
+                                  ComputedCSValue);
             }
 
             if (Status == CS_ERR_NOT_FOUND)
@@ -875,17 +1171,16 @@ bool CS_BackgroundApp(void)
 
             if (DoneWithEntry == true)
             {
+                CS_SchedEntryChecked(CS_APP_TABLE, &AppResultsEntry->LastCheckTime,
+                                     &AppResultsEntry->DeadlineMisses);
                 CS_AppData.HkPacket.Payload.CurrentEntryInTable++;
             }
-
-            if (CS_AppData.HkPacket.Payload.CurrentEntryInTable >= CS_MAX_NUM_APP_TABLE_ENTRIES)
-            {
-                /* We are done with this table */
-                CS_GoToNextTable();
-            }
         }
-        else /* since there aren't any enabled entries in this table, go to the next one */
+
+        /* Also true when there aren't any more enabled entries in this table */
+        if (CS_AppData.HkPacket.Payload.CurrentEntryInTable >= CS_MAX_NUM_APP_TABLE_ENTRIES)
         {
+            /* We are done with this table */
             CS_GoToNextTable();
         }
     }
@@ -906,10 +1201,43 @@ void CS_ResetTablesTblResultEntry(CS_Res_Tables_Table_Entry_t *TablesTblResultEn
     /* Ptr will be NULL if this CS table is not listed in the CS Tables table */
     if (TablesTblResultEntry != (CS_Res_Tables_Table_Entry_t *)NULL)
     {
-        TablesTblResultEntry->ByteOffset        = 0;
-        TablesTblResultEntry->TempChecksumValue = 0;
-        TablesTblResultEntry->ComputedYet       = false;
+        TablesTblResultEntry->ByteOffset  = 0;
+        TablesTblResultEntry->ComputedYet = false;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check whether a table is due for a routine update               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool CS_TableManageDue(uint16 Table)
+{
+    uint32 Bit  = CS_TABLE_BIT(Table);
+    bool   Due  = false;
+    bool   Busy = false;
+
+    /* The block trees are used by EEPROM and Memory recomputes */
+    if (Table == CS_BLOCK_TABLE)
+    {
+        Busy = (CS_JobsBusy(CS_EEPROM_TABLE) || CS_JobsBusy(CS_MEMORY_TABLE));
+    }
+    else
+    {
+        Busy = CS_JobsBusy(Table);
     }
+
+    /* Tables registered for Table Services notification are managed only
+     * after a notification; the rest are managed every cycle.  While a
+     * recompute is using the table it is not managed, and any pending
+     * notification is kept until the recompute is done */
+    if (!Busy && ((CS_AppData.TableManagePending & Bit) != 0 || (CS_AppData.TableNotified & Bit) == 0))
+    {
+        CS_AppData.TableManagePending &= ~Bit;
+        Due = true;
+    }
+
+    return Due;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -922,8 +1250,7 @@ CFE_Status_t CS_HandleRoutineTableUpdates(void)
     CFE_Status_t Result    = CFE_SUCCESS;
     CFE_Status_t ErrorCode = CFE_SUCCESS;
 
-    if (!((CS_AppData.HkPacket.Payload.RecomputeInProgress == true) && (CS_AppData.HkPacket.Payload.OneShotInProgress == false) &&
-          (CS_AppData.ChildTaskTable == CS_EEPROM_TABLE)))
+    if (CS_TableManageDue(CS_EEPROM_TABLE))
     {
         Result = CS_HandleTableUpdate((void *)&CS_AppData.DefEepromTblPtr, (void *)&CS_AppData.ResEepromTblPtr,
                                       CS_AppData.DefEepromTableHandle, CS_AppData.ResEepromTableHandle, CS_EEPROM_TABLE,
@@ -939,8 +1266,7 @@ CFE_Status_t CS_HandleRoutineTableUpdates(void)
         }
     }
 
-    if (!((CS_AppData.HkPacket.Payload.RecomputeInProgress == true) && (CS_AppData.HkPacket.Payload.OneShotInProgress == false) &&
-          (CS_AppData.ChildTaskTable == CS_MEMORY_TABLE)))
+    if (CS_TableManageDue(CS_MEMORY_TABLE))
     {
         Result = CS_HandleTableUpdate((void *)&CS_AppData.DefMemoryTblPtr, (void *)&CS_AppData.ResMemoryTblPtr,
                                       CS_AppData.DefMemoryTableHandle, CS_AppData.ResMemoryTableHandle, CS_MEMORY_TABLE,
@@ -959,8 +1285,7 @@ CFE_Status_t CS_HandleRoutineTableUpdates(void)
         }
     }
 
-    if (!((CS_AppData.HkPacket.Payload.RecomputeInProgress == true) && (CS_AppData.HkPacket.Payload.OneShotInProgress == false) &&
-          (CS_AppData.ChildTaskTable == CS_APP_TABLE)))
+    if (CS_TableManageDue(CS_APP_TABLE))
     {
         Result = CS_HandleTableUpdate((void *)&CS_AppData.DefAppTblPtr, (void *)&CS_AppData.ResAppTblPtr,
                                       CS_AppData.DefAppTableHandle, CS_AppData.ResAppTableHandle, CS_APP_TABLE,
@@ -978,8 +1303,7 @@ CFE_Status_t CS_HandleRoutineTableUpdates(void)
         }
     }
 
-    if (!((CS_AppData.HkPacket.Payload.RecomputeInProgress == true) && (CS_AppData.HkPacket.Payload.OneShotInProgress == false) &&
-          (CS_AppData.ChildTaskTable == CS_TABLES_TABLE)))
+    if (CS_TableManageDue(CS_TABLES_TABLE))
     {
         Result = CS_HandleTableUpdate((void *)&CS_AppData.DefTablesTblPtr, (void *)&CS_AppData.ResTablesTblPtr,
                                       CS_AppData.DefTablesTableHandle, CS_AppData.ResTablesTableHandle, CS_TABLES_TABLE,
@@ -998,6 +1322,11 @@ CFE_Status_t CS_HandleRoutineTableUpdates(void)
         }
     }
 
+    if (CS_TableManageDue(CS_BLOCK_TABLE))
+    {
+        CS_BlockTreeManage();
+    }
+
     return ErrorCode;
 }
 
@@ -1029,14 +1358,31 @@ CFE_Status_t CS_AttemptTableReshare(CS_Res_Tables_Table_Entry_t *ResultsEntry, C
     return Result;
 }
 
-bool CS_CheckRecomputeOneshot(void)
+bool CS_CheckRecomputeTable(uint16 Table)
+{
+    bool Result = false;
+
+    if (CS_JobsBusy(Table))
+    {
+        CFE_EVS_SendEvent(CS_CMD_COMPUTE_PROG_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Cannot perform command. Recompute in progress for table type %d.", Table);
+
+        CS_AppData.HkPacket.Payload.CmdErrCounter++;
+
+        Result = true;
+    }
+    return Result;
+}
+
+bool CS_CheckRecomputeEntry(uint16 Table, uint16 EntryID)
 {
     bool Result = false;
 
-    if (CS_AppData.HkPacket.Payload.RecomputeInProgress == true || CS_AppData.HkPacket.Payload.OneShotInProgress == true)
+    if (CS_JobsEntryBusy(Table, EntryID))
     {
         CFE_EVS_SendEvent(CS_CMD_COMPUTE_PROG_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "Cannot perform command. Recompute or oneshot in progress.");
+                          "Cannot perform command. Recompute in progress for table type %d entry %d.", Table,
+                          EntryID);
 
         CS_AppData.HkPacket.Payload.CmdErrCounter++;
 
@@ -32,11 +32,22 @@
 #include "cfe.h"
 #include "cs_tbldefs.h"
 
+/**
+ * \name Name index slot fields
+ *
+ * A name index slot holds 0 when empty, otherwise the top half of the
+ * name's hash and the entry number plus one.
+ * \{
+ */
+#define CS_NAME_INDEX_HASH_MASK  0xFFFF0000U
+#define CS_NAME_INDEX_ENTRY_MASK 0x0000FFFFU
+/**\}*/
+
 /**
  * \brief Zeros out temporary checksum values of EEPROM table entries
  *
  *  \par Description
- *       Zeros the TempChecksumValue and the byte offset for every entry
+ *       Zeros the byte offset, which restarts the checksum, for every entry
  *       in the table. This allows all entries in the table to have their
  *       checksum started 'fresh'.
  *
@@ -49,7 +60,7 @@ void CS_ZeroEepromTempValues(void);
  * \brief Zeros out temporary checksum values of Memory table entries
  *
  *  \par Description
- *       Zeros the TempChecksumValue and the byte offset for every entry
+ *       Zeros the byte offset, which restarts the checksum, for every entry
  *       in the table. This allows all entries in the table to have their
  *       checksum started 'fresh'.
  *
@@ -62,7 +73,7 @@ void CS_ZeroMemoryTempValues(void);
  * \brief Zeros out temporary checksum values of Tables table entries
  *
  *  \par Description
- *       Zeros the TempChecksumValue and the byte offset for every entry
+ *       Zeros the byte offset, which restarts the checksum, for every entry
  *       in the table. This allows all entries in the table to have their
  *       checksum started 'fresh'.
  *
@@ -75,7 +86,7 @@ void CS_ZeroTablesTempValues(void);
  * \brief Zeros out temporary checksum values of App table entries
  *
  *  \par Description
- *       Zeros the TempChecksumValue and the byte offset for every entry
+ *       Zeros the byte offset, which restarts the checksum, for every entry
  *       in the table. This allows all entries in the table to have their
  *       checksum started 'fresh'.
  *
@@ -88,7 +99,7 @@ void CS_ZeroAppTempValues(void);
  * \brief Zeros out temporary checksum values of the cFE Core
  *
  *  \par Description
- *       Zeros the TempChecksumValue and the byte offset for the cFE core.
+ *       Zeros the byte offset, which restarts the checksum, for the cFE core.
  *       This allows the cFE core checksum to be started 'fresh'.
  *
  *  \par Assumptions, External Events, and Notes:
@@ -100,7 +111,7 @@ void CS_ZeroCfeCoreTempValues(void);
  * \brief Zeros out temporary checksum values of the OS code segment
  *
  *  \par Description
- *       Zeros the TempChecksumValue and the byte offset for the OS.
+ *       Zeros the byte offset, which restarts the checksum, for the OS.
  *       This allows the OS checksum to be started 'fresh'.
  *
  *  \par Assumptions, External Events, and Notes:
@@ -132,6 +143,117 @@ void CS_InitializeDefaultTables(void);
  */
 void CS_GoToNextTable(void);
 
+/**
+ * \brief Hashes a name
+ *
+ *  \par Description
+ *       Computes the 32 bit FNV-1a hash of the name, up to its terminator
+ *       or MaxLength characters.  The hash does not change from one build
+ *       or platform to the next.
+ *
+ *  \param [in]   Name          The name to hash
+ *  \param [in]   MaxLength     The size of the name field
+ *
+ *  \return The hash of the name
+ */
+uint32 CS_NameHash(const char *Name, size_t MaxLength);
+
+/**
+ * \brief Adds an entry to a name index
+ *
+ *  \par Description
+ *       Puts the entry in the first free slot at or after the slot the
+ *       hash selects.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The index has more slots than its table has entries.
+ *
+ *  \param [in,out] NameIndex   The slots of the index
+ *  \param [in]     IndexSize   The number of slots in the index
+ *  \param [in]     Hash        The #CS_NameHash of the entry's name
+ *  \param [in]     Entry       The entry number
+ */
+void CS_NameIndexAdd(uint32 *NameIndex, uint32 IndexSize, uint32 Hash, uint16 Entry);
+
+/**
+ * \brief Gets the next entry of a name index that might have a name
+ *
+ *  \par Description
+ *       Continues along the slots the hash selects and returns the next
+ *       entry whose hash matches in its top half.  The caller compares
+ *       the name of each entry returned, since different names can share
+ *       a hash.
+ *
+ *  \param [in]     NameIndex   The slots of the index
+ *  \param [in]     IndexSize   The number of slots in the index
+ *  \param [in]     Hash        The #CS_NameHash of the name to find
+ *  \param [in,out] Probe       Set to 0 before the first call
+ *  \param [out]    Entry       The entry number, if the function returns true
+ *
+ *  \return Boolean entry found response
+ *  \retval true  An entry that might have the name was found
+ *  \retval false There are no more entries that might have the name
+ */
+bool CS_NameIndexNext(const uint32 *NameIndex, uint32 IndexSize, uint32 Hash, uint32 *Probe, uint16 *Entry);
+
+/**
+ * \brief Builds the name index of a Tables definition table
+ *
+ *  \par Description
+ *       Clears the index and adds every entry of the table with a name,
+ *       whatever its state.
+ *
+ *  \param [out]  NameIndex         #CS_TABLES_NAME_INDEX_SIZE slots
+ *  \param [in]   DefinitionTblPtr  The Tables definition table
+ */
+void CS_BuildTablesNameIndex(uint32 *NameIndex, const CS_Def_Tables_Table_Entry_t *DefinitionTblPtr);
+
+/**
+ * \brief Builds the name index of an Apps definition table
+ *
+ *  \par Description
+ *       Clears the index and adds every entry of the table with a name,
+ *       whatever its state.
+ *
+ *  \param [out]  NameIndex         #CS_APP_NAME_INDEX_SIZE slots
+ *  \param [in]   DefinitionTblPtr  The Apps definition table
+ */
+void CS_BuildAppNameIndex(uint32 *NameIndex, const CS_Def_App_Table_Entry_t *DefinitionTblPtr);
+
+/**
+ * \brief Finds a later Tables definition entry with the same name
+ *
+ *  \param [in]   NameIndex         Index built by #CS_BuildTablesNameIndex
+ *                                  from the same table
+ *  \param [in]   DefinitionTblPtr  The Tables definition table
+ *  \param [in]   Entry             The entry whose name to look for
+ *  \param [out]  Duplicate         The first entry after Entry with the
+ *                                  same name, if the function returns true
+ *
+ *  \return Boolean duplicate found response
+ *  \retval true  A later entry has the same name
+ *  \retval false No later entry has the same name
+ */
+bool CS_FindTablesNameDuplicate(const uint32 *NameIndex, const CS_Def_Tables_Table_Entry_t *DefinitionTblPtr,
+                                uint16 Entry, uint16 *Duplicate);
+
+/**
+ * \brief Finds an earlier Apps definition entry with the same name
+ *
+ *  \param [in]   NameIndex         Index built by #CS_BuildAppNameIndex
+ *                                  from the same table
+ *  \param [in]   DefinitionTblPtr  The Apps definition table
+ *  \param [in]   Entry             The entry whose name to look for
+ *  \param [out]  Duplicate         The first entry with the same name,
+ *                                  if the function returns true
+ *
+ *  \return Boolean duplicate found response
+ *  \retval true  An earlier entry has the same name
+ *  \retval false No earlier entry has the same name
+ */
+bool CS_FindAppNameDuplicate(const uint32 *NameIndex, const CS_Def_App_Table_Entry_t *DefinitionTblPtr, uint16 Entry,
+                             uint16 *Duplicate);
+
 /**
  * \brief Gets a pointer to the results entry given a table name
  *
@@ -141,7 +263,8 @@ void CS_GoToNextTable(void);
  *       a pointer to the entry through a parameter.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       Only the entries in the name index built by #CS_BuildTablesNameIndex
+ *       when the table was processed are looked at.
  *
  *  \param [in]   Name          The name associated with the entry we want
  *                              to find.  Calling function ensures this is
@@ -167,7 +290,8 @@ bool CS_GetTableResTblEntryByName(CS_Res_Tables_Table_Entry_t **EntryPtr, const
  *       a pointer to the entry through a parameter.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       Only the entries in the name index built by #CS_BuildTablesNameIndex
+ *       when the table was processed are looked at.
  *
  *  \param [in]   Name          The name associated with the entry we want
  *                              to find.  Calling function ensures this is
@@ -193,7 +317,8 @@ bool CS_GetTableDefTblEntryByName(CS_Def_Tables_Table_Entry_t **EntryPtr, const
  *       a pointer to the entry through a parameter.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       Only the entries in the name index built by #CS_BuildAppNameIndex
+ *       when the table was processed are looked at.
  *
  *  \param [in]    Name         The name associated with the entry we want
  *                              to find.  Calling function ensures this is
@@ -219,7 +344,8 @@ bool CS_GetAppResTblEntryByName(CS_Res_App_Table_Entry_t **EntryPtr, const char
  *       a pointer to the entry through a parameter.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       Only the entries in the name index built by #CS_BuildAppNameIndex
+ *       when the table was processed are looked at.
  *
  *  \param [in]    Name         The name associated with the entry we want
  *                              to find.  Calling function ensures this is
@@ -236,6 +362,50 @@ bool CS_GetAppResTblEntryByName(CS_Res_App_Table_Entry_t **EntryPtr, const char
  */
 bool CS_GetAppDefTblEntryByName(CS_Def_App_Table_Entry_t **EntryPtr, const char *Name);
 
+/**
+ * \brief Updates the bit of an entry in an enabled entry map
+ *
+ *  \par Description
+ *       Sets the entry's bit if the state is #CS_STATE_ENABLED, and
+ *       clears it otherwise, then updates the summary bit of the word
+ *       holding it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by the commands and table processing that enable and
+ *       disable results table entries.  An entry disabled only for a
+ *       while, such as during a recompute, keeps its bit, so the entry's
+ *       state is still checked before it is used.
+ *
+ *  \param [in,out] EnabledMap  The map of the entry's table, of
+ *                              #CS_ENABLED_MAP_WORDS(NumEntries) words
+ *  \param [in]     NumEntries  The number of entries in the table
+ *  \param [in]     Entry       The entry number
+ *  \param [in]     State       The entry's new state
+ */
+void CS_SetEnabledMapEntry(uint32 *EnabledMap, uint16 NumEntries, uint16 Entry, uint16 State);
+
+/**
+ * \brief Gets the next set bit of an enabled entry map
+ *
+ *  \par Description
+ *       Looks at the rest of Entry's word first.  If no later entry of
+ *       that word is enabled, finds the next non-zero word from the
+ *       summary bits and counts its trailing zeros to find the entry, so
+ *       the cost depends on the number of summary words and not on the
+ *       number of entries skipped.
+ *
+ *  \param [in]     EnabledMap  The map of the table
+ *  \param [in]     NumEntries  The number of entries in the table
+ *  \param [in,out] Entry       The entry to start from.  Set to the next
+ *                              enabled entry, or to NumEntries if there
+ *                              are none.
+ *
+ *  \return Boolean entry found response
+ *  \retval true  An entry was found in the map
+ *  \retval false No entry was found in the map
+ */
+bool CS_FindNextEnabledMapEntry(const uint32 *EnabledMap, uint16 NumEntries, uint16 *Entry);
+
 /**
  * \brief Find an enabled EEPROM entry
  *
@@ -244,7 +414,8 @@ bool CS_GetAppDefTblEntryByName(CS_Def_App_Table_Entry_t **EntryPtr, const char
  *       the table to find an enabled entry.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       Only the entries set in the table's enabled entry map are read.
+ *       Entries a recompute owns are skipped, see #CS_JobsEntryBusy.
  *
  *  \param [in]      EnabledEntry   A pointer to a uint16 that will be
  *                                  assigned an enabled entry ID, if
@@ -268,7 +439,8 @@ bool CS_FindEnabledEepromEntry(uint16 *EnabledEntry);
  *       the table to find an enabled entry.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       Only the entries set in the table's enabled entry map are read.
+ *       Entries a recompute owns are skipped, see #CS_JobsEntryBusy.
  *
  *  \param [in]      EnabledEntry   A pointer to a uint16 that will be
  *                                  assigned an enabled entry ID, if
@@ -292,7 +464,8 @@ bool CS_FindEnabledMemoryEntry(uint16 *EnabledEntry);
  *       the table to find an enabled entry.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       Only the entries set in the table's enabled entry map are read.
+ *       Entries a recompute owns are skipped, see #CS_JobsEntryBusy.
  *
  *  \param [in]      EnabledEntry   A pointer to a uint16 that will be
  *                                  assigned an enabled entry ID, if
@@ -316,7 +489,8 @@ bool CS_FindEnabledTablesEntry(uint16 *EnabledEntry);
  *       the table to find an enabled entry.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       Only the entries set in the table's enabled entry map are read.
+ *       Entries a recompute owns are skipped, see #CS_JobsEntryBusy.
  *
  *  \param [in]      EnabledEntry   A pointer to a uint16 that will be
  *                                  assigned an enabled entry ID, if
@@ -363,14 +537,17 @@ bool CS_VerifyCmdLength(const CFE_MSG_Message_t *msg, size_t ExpectedLength);
  * \brief Compute a background check cycle on the OS
  *
  *  \par Description
- *       This routine will try and complete a cycle of background checking
+ *       This routine will try and complete a cycle of background checking,
+ *       leaving what is left of the cycle's budget for the next
+ *       table.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       #CS_BudgetStartCycle has been called for this cycle.
  *
- *  \return Boolean checksum performed response
- *  \retval true  Checksum was done
- *  \retval false Checksum was not done
+ *  \return Boolean cycle finished response
+ *  \retval true  The cycle's budget is used up, or an entry was left
+ *                 unfinished
+ *  \retval false There is budget left for the next table
  */
 bool CS_BackgroundOS(void);
 
@@ -378,14 +555,17 @@ bool CS_BackgroundOS(void);
  * \brief Compute a background check cycle on the cFE Core
  *
  *  \par Description
- *       This routine will try and complete a cycle of background checking
+ *       This routine will try and complete a cycle of background checking,
+ *       leaving what is left of the cycle's budget for the next
+ *       table.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       #CS_BudgetStartCycle has been called for this cycle.
  *
- *  \return Boolean checksum performed response
- *  \retval true  Checksum was done
- *  \retval false Checksum was not done
+ *  \return Boolean cycle finished response
+ *  \retval true  The cycle's budget is used up, or an entry was left
+ *                 unfinished
+ *  \retval false There is budget left for the next table
  */
 bool CS_BackgroundCfeCore(void);
 
@@ -393,14 +573,17 @@ bool CS_BackgroundCfeCore(void);
  * \brief Compute a background check cycle on EEPROM
  *
  *  \par Description
- *       This routine will try and complete a cycle of background checking
+ *       This routine will try and complete a cycle of background checking,
+ *       going on to the next enabled entry for as long as the cycle's
+ *       budget lasts.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       #CS_BudgetStartCycle has been called for this cycle.
  *
- *  \return Boolean checksum performed response
- *  \retval true  Checksum was done
- *  \retval false Checksum was not done
+ *  \return Boolean cycle finished response
+ *  \retval true  The cycle's budget is used up, or an entry was left
+ *                 unfinished
+ *  \retval false There is budget left for the next table
  */
 bool CS_BackgroundEeprom(void);
 
@@ -408,14 +591,17 @@ bool CS_BackgroundEeprom(void);
  * \brief Compute a background check cycle on the Memory
  *
  *  \par Description
- *       This routine will try and complete a cycle of background checking
+ *       This routine will try and complete a cycle of background checking,
+ *       going on to the next enabled entry for as long as the cycle's
+ *       budget lasts.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       #CS_BudgetStartCycle has been called for this cycle.
  *
- *  \return Boolean checksum performed response
- *  \retval true  Checksum was done
- *  \retval false Checksum was not done
+ *  \return Boolean cycle finished response
+ *  \retval true  The cycle's budget is used up, or an entry was left
+ *                 unfinished
+ *  \retval false There is budget left for the next table
  */
 bool CS_BackgroundMemory(void);
 
@@ -423,14 +609,17 @@ bool CS_BackgroundMemory(void);
  * \brief Compute a background check cycle on Tables
  *
  *  \par Description
- *       This routine will try and complete a cycle of background checking
+ *       This routine will try and complete a cycle of background checking,
+ *       going on to the next enabled entry for as long as the cycle's
+ *       budget lasts.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       #CS_BudgetStartCycle has been called for this cycle.
  *
- *  \return Boolean checksum performed response
- *  \retval true  Checksum was done
- *  \retval false Checksum was not done
+ *  \return Boolean cycle finished response
+ *  \retval true  The cycle's budget is used up, or an entry was left
+ *                 unfinished
+ *  \retval false There is budget left for the next table
  */
 bool CS_BackgroundTables(void);
 
@@ -438,14 +627,17 @@ bool CS_BackgroundTables(void);
  * \brief Compute a background check cycle on Apps
  *
  *  \par Description
- *       This routine will try and complete a cycle of background checking
+ *       This routine will try and complete a cycle of background checking,
+ *       going on to the next enabled entry for as long as the cycle's
+ *       budget lasts.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       #CS_BudgetStartCycle has been called for this cycle.
  *
- *  \return Boolean checksum performed response
- *  \retval true  Checksum was done
- *  \retval false Checksum was not done
+ *  \return Boolean cycle finished response
+ *  \retval true  The cycle's budget is used up, or an entry was left
+ *                 unfinished
+ *  \retval false There is budget left for the next table
  */
 bool CS_BackgroundApp(void);
 
@@ -457,7 +649,7 @@ bool CS_BackgroundApp(void);
  *       must have their checksums recomputed when any of their entries
  *       have their enable/disable state flags modified.
  *
- *       This function will set ByteOffset and TempChecksumValue to zero,
+ *       This function will set ByteOffset to zero,
  *       and ComputedYet to false for the specifified CS tables table entry.
  *
  *  \par Assumptions, External Events, and Notes:
@@ -469,13 +661,16 @@ void CS_ResetTablesTblResultEntry(CS_Res_Tables_Table_Entry_t *TablesTblResultEn
  * \brief Update All CS Tables
  *
  *  \par Description
- *       Updates all CS tables if no recompute is happening on that table.
+ *       Updates all CS tables if no recompute is happening on that table,
+ *       including the block results table.
  *
  *       This is called as part of the regular housekeeping cycle or
- *       at the wakeup interval if no housekeeping request is received.
+ *       at the wakeup interval if no housekeeping request is received,
+ *       and when Table Services sends #CS_MANAGE_TABLE_CC.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       Tables registered for Table Services notification are only
+ *       updated after a notification, see #CS_AppData_t.TableNotified.
  *
  * \return Execution status, see \ref CFEReturnCodes
  * \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
@@ -500,6 +695,35 @@ CFE_Status_t CS_HandleRoutineTableUpdates(void);
 CFE_Status_t CS_AttemptTableReshare(CS_Res_Tables_Table_Entry_t *ResultsEntry, CFE_TBL_Handle_t *LocalTblHandle,
                                     CFE_TBL_Info_t *TblInfo, cpuaddr *LocalAddress, int32 *ResultGetInfo);
 
-bool CS_CheckRecomputeOneshot(void);
+/**
+ * \brief Rejects a command that would change a table type being recomputed
+ *
+ *  \par Description
+ *       Sends an event and counts a command error if a recompute of any
+ *       entry of the table type is queued or running.
+ *
+ *  \param [in]  Table  Table type, #CS_CFECORE to #CS_APP_TABLE
+ *
+ *  \return Boolean rejected response
+ *  \retval true  The command was rejected
+ *  \retval false The command may go ahead
+ */
+bool CS_CheckRecomputeTable(uint16 Table);
+
+/**
+ * \brief Rejects a command that would change an entry being recomputed
+ *
+ *  \par Description
+ *       Sends an event and counts a command error if a recompute owns the
+ *       entry, see #CS_JobsEntryBusy.
+ *
+ *  \param [in]  Table    Table type, #CS_CFECORE to #CS_APP_TABLE
+ *  \param [in]  EntryID  Entry in the table
+ *
+ *  \return Boolean rejected response
+ *  \retval true  The command was rejected
+ *  \retval false The command may go ahead
+ */
+bool CS_CheckRecomputeEntry(uint16 Table, uint16 EntryID);
 
 #endif
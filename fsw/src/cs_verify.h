@@ -67,10 +67,30 @@
 #error CS_MAX_NUM_TABLES_TABLE_ENTRIES must be at least 1!
 #endif
 
+#if (CS_MAX_NUM_TABLES_TABLE_ENTRIES > 65535)
+#error CS_MAX_NUM_TABLES_TABLE_ENTRIES cannot be greater than 65535!
+#endif
+
 #if (CS_MAX_NUM_APP_TABLE_ENTRIES < 1)
 #error CS_MAX_NUM_APP_TABLE_ENTRIES must be at least 1!
 #endif
 
+#if (CS_MAX_NUM_APP_TABLE_ENTRIES > 65535)
+#error CS_MAX_NUM_APP_TABLE_ENTRIES cannot be greater than 65535!
+#endif
+
+#if (CS_BLOCK_TREE_LEAF_SIZE < 64)
+#error CS_BLOCK_TREE_LEAF_SIZE must be at least 64!
+#endif
+
+#if (CS_MAX_NUM_BLOCK_TREES < 1)
+#error CS_MAX_NUM_BLOCK_TREES must be at least 1!
+#endif
+
+#if (CS_MAX_NUM_BLOCK_NODES < 3)
+#error CS_MAX_NUM_BLOCK_NODES must be at least 3!
+#endif
+
 #if (CS_DEFAULT_BYTES_PER_CYCLE > 0xFFFFFFFF)
 #error CS_DEFAULT_BYTES_PER_CYCLE cannot be greater than 0xFFFFFFFF!
 #endif
@@ -79,6 +99,43 @@
 #error CS_DEFAULT_BYTES_PER_CYCLE cannot be less than 0!
 #endif
 
+#if (CS_MIN_TIME_BUDGET < 1)
+#error CS_MIN_TIME_BUDGET must be at least 1!
+#endif
+
+#if (CS_MAX_TIME_BUDGET < CS_MIN_TIME_BUDGET)
+#error CS_MAX_TIME_BUDGET cannot be less than CS_MIN_TIME_BUDGET!
+#endif
+
+#if (CS_DEFAULT_TIME_BUDGET != 0) && \
+    ((CS_DEFAULT_TIME_BUDGET < CS_MIN_TIME_BUDGET) || (CS_DEFAULT_TIME_BUDGET > CS_MAX_TIME_BUDGET))
+#error CS_DEFAULT_TIME_BUDGET must be 0 or between CS_MIN_TIME_BUDGET and CS_MAX_TIME_BUDGET!
+#endif
+
+#if (CS_TIME_BUDGET_CHUNK_SIZE < 1)
+#error CS_TIME_BUDGET_CHUNK_SIZE must be at least 1!
+#endif
+
+#if (CS_YIELD_BLOCK_SIZE < 1)
+#error CS_YIELD_BLOCK_SIZE must be at least 1!
+#endif
+
+#if (CS_DEFAULT_YIELD_INTERVAL > 0xFFFFFFFF)
+#error CS_DEFAULT_YIELD_INTERVAL cannot be greater than 0xFFFFFFFF!
+#endif
+
+#if (CS_CRC_SLICE_WIDTH != 8) && (CS_CRC_SLICE_WIDTH != 16)
+#error CS_CRC_SLICE_WIDTH must be either 8 or 16!
+#endif
+
+#if (CS_CACHE_LINE_SIZE < 1) || ((CS_CACHE_LINE_SIZE & (CS_CACHE_LINE_SIZE - 1)) != 0)
+#error CS_CACHE_LINE_SIZE must be a power of two!
+#endif
+
+#if (CS_STREAM_BLOCK_SIZE < CS_CACHE_LINE_SIZE) || ((CS_STREAM_BLOCK_SIZE % CS_CACHE_LINE_SIZE) != 0)
+#error CS_STREAM_BLOCK_SIZE must be a multiple of CS_CACHE_LINE_SIZE!
+#endif
+
 #if (CS_CHILD_TASK_PRIORITY < 1)
 #error CS_CHILD_TASK_PRIORITY must be greater than 0!
 #endif
@@ -87,8 +144,86 @@
 #error CS_CHILD_TASK_PRIORITY cannot be greater than 255!
 #endif
 
-#if (CS_DEFAULT_ALGORITHM != CFE_MISSION_ES_DEFAULT_CRC && CS_DEFAULT_ALGORITHM != CFE_ES_CRC_16)
-#error CS_DEFAULT_ALGORITHM is limited to either CFE_MISSION_ES_DEFAULT_CRC or CFE_ES_CRC_16!
+#if (CS_DEFAULT_JOB_RATE > 0xFFFFFFFF)
+#error CS_DEFAULT_JOB_RATE cannot be greater than 0xFFFFFFFF!
+#endif
+
+#if (CS_DEFAULT_JOB_BURST < 1) || (CS_DEFAULT_JOB_BURST > 0xFFFFFFFF)
+#error CS_DEFAULT_JOB_BURST must be between 1 and 0xFFFFFFFF!
+#endif
+
+#if (CS_JOB_LOW_PRIORITY < 1) || (CS_JOB_LOW_PRIORITY > 255)
+#error CS_JOB_LOW_PRIORITY must be between 1 and 255!
+#endif
+
+#if (CS_NUM_JOB_TASKS < 1) || (CS_NUM_JOB_TASKS > 8)
+#error CS_NUM_JOB_TASKS must be between 1 and 8!
+#endif
+
+#if (CS_JOB_QUEUE_DEPTH < 1) || (CS_JOB_QUEUE_DEPTH > 255)
+#error CS_JOB_QUEUE_DEPTH must be between 1 and 255!
+#endif
+
+#if (CS_BKGND_MIN_SHARE < 1) || (CS_BKGND_MIN_SHARE > 100)
+#error CS_BKGND_MIN_SHARE must be between 1 and 100!
+#endif
+
+#if (CS_CRC_HW_ACCELERATION != true) && (CS_CRC_HW_ACCELERATION != false)
+#error CS_CRC_HW_ACCELERATION must be either true or false!
+#endif
+
+#if (CS_SYNDROME_TABLE_SIZE < 16) || (CS_SYNDROME_TABLE_SIZE > 32767)
+#error CS_SYNDROME_TABLE_SIZE must be between 16 and 32767!
+#endif
+
+#if (CS_NUM_WORKER_TASKS < 0) || (CS_NUM_WORKER_TASKS > 8)
+#error CS_NUM_WORKER_TASKS must be between 0 and 8!
+#endif
+
+#if (CS_WORKER_TASK_PRIORITY < 1)
+#error CS_WORKER_TASK_PRIORITY must be greater than 0!
+#endif
+
+#if (CS_WORKER_TASK_PRIORITY > 255)
+#error CS_WORKER_TASK_PRIORITY cannot be greater than 255!
+#endif
+
+#if (CS_WORKER_STRIPE_SIZE < 1024)
+#error CS_WORKER_STRIPE_SIZE must be at least 1024!
 #endif
 
+#if (CS_WORKER_MAX_STRIPES < 2) || (CS_WORKER_MAX_STRIPES > 256)
+#error CS_WORKER_MAX_STRIPES must be between 2 and 256!
+#endif
+
+#if (CS_NUM_WORKER_TASKS > 0) && (CS_DEFAULT_BYTES_PER_CYCLE < 2 * CS_WORKER_STRIPE_SIZE)
+#error CS_DEFAULT_BYTES_PER_CYCLE must be at least 2 * CS_WORKER_STRIPE_SIZE when CS_NUM_WORKER_TASKS is not 0!
+#endif
+
+#if (CS_WORKER_TIMEOUT < 1)
+#error CS_WORKER_TIMEOUT must be greater than 0!
+#endif
+
+#if (CS_BASELINE_SAVE_PERIOD < 1)
+#error CS_BASELINE_SAVE_PERIOD must be greater than 0!
+#endif
+
+#if (CS_ADOPT_TABLE_SERVICES_CRC != true) && (CS_ADOPT_TABLE_SERVICES_CRC != false)
+#error CS_ADOPT_TABLE_SERVICES_CRC must be either true or false!
+#endif
+
+#if (CS_TABLE_SNAPSHOT_SIZE < 1)
+#error CS_TABLE_SNAPSHOT_SIZE must be greater than 0!
+#endif
+
+/*
+ * Removed check of:
+ *  CS_DEFAULT_ALGORITHM != CFE_MISSION_ES_DEFAULT_CRC && CS_DEFAULT_ALGORITHM != CFE_ES_CRC_16
+ *
+ * The cFE CRC types are enumeration constants, which the preprocessor
+ * evaluates as 0, so the check could never fail.  It would however reject
+ * CS_CRC_TYPE_CRC_32C, which is a plain integer.  CS_CalculateCRC returns
+ * 0 for any algorithm it does not implement.
+ */
+
 #endif
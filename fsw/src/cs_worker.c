@@ -0,0 +1,331 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   The CFS Checksum (CS) Application's checksum worker pool
+ */
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+#include "cs_app.h"
+#include <string.h>
+#include <stdio.h>
+#include "cs_events.h"
+#include "cs_algorithm.h"
+#include "cs_worker.h"
+
+/**************************************************************************
+ **
+ ** Functions
+ **
+ **************************************************************************/
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that starts the checksum worker pool                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_WorkerPoolInit(void)
+{
+    CS_WorkerPool_t *Pool = &CS_AppData.WorkerPool;
+#if (CS_NUM_WORKER_TASKS > 0)
+    int32  Status = OS_SUCCESS;
+    uint32 i      = 0;
+    char   TaskName[CFE_MISSION_MAX_API_LEN];
+#endif
+
+    memset(Pool, 0, sizeof(*Pool));
+
+#if (CS_NUM_WORKER_TASKS > 0)
+    Status = OS_MutSemCreate(&Pool->DispatchMutexId, CS_WORKER_DISPATCH_SEM_NAME, 0);
+
+    if (Status == OS_SUCCESS)
+    {
+        Status = OS_MutSemCreate(&Pool->MutexId, CS_WORKER_MUTEX_SEM_NAME, 0);
+    }
+
+    if (Status == OS_SUCCESS)
+    {
+        Status = OS_CountSemCreate(&Pool->WorkSemId, CS_WORKER_WORK_SEM_NAME, 0, 0);
+    }
+
+    if (Status == OS_SUCCESS)
+    {
+        Status = OS_BinSemCreate(&Pool->DoneSemId, CS_WORKER_DONE_SEM_NAME, 0, 0);
+    }
+
+    if (Status != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(CS_WORKER_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Worker pool semaphore create failed, RC = 0x%08X", (unsigned int)Status);
+        return;
+    }
+
+    for (i = 0; i < CS_NUM_WORKER_TASKS; i++)
+    {
+        snprintf(TaskName, sizeof(TaskName), "%s%u", CS_WORKER_TASK_NAME, (unsigned int)i);
+
+        Status = CFE_ES_CreateChildTask(&Pool->TaskId[Pool->NumWorkers], TaskName, CS_WorkerTask, NULL,
+                                        CFE_PLATFORM_ES_DEFAULT_STACK_SIZE, CS_WORKER_TASK_PRIORITY, 0);
+
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(CS_WORKER_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Worker task %d create failed, CFE_ES_CreateChildTask returned: 0x%08X",
+                              (int)i, (unsigned int)Status);
+            break;
+        }
+
+        Pool->NumWorkers++;
+    }
+
+    Pool->Active = (Pool->NumWorkers > 0);
+#endif /* #if (CS_NUM_WORKER_TASKS > 0) */
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that checksums memory in the calling task           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_WorkerChecksumUpdate(uint16 AlgorithmId, CS_ChecksumContext_t *Context, const void *DataPtr,
+                                    size_t DataLength, bool Streaming)
+{
+    if (Streaming)
+    {
+        CS_ChecksumUpdateStreaming(AlgorithmId, Context, DataPtr, DataLength);
+    }
+    else
+    {
+        CS_ChecksumUpdate(AlgorithmId, Context, DataPtr, DataLength);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that checksums stripes until none are left          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_WorkerProcessStripes(void)
+{
+    CS_WorkerPool_t     *Pool         = &CS_AppData.WorkerPool;
+    bool                 Claimed      = true;
+    uint32               JobId        = 0;
+    uint32               Stripe       = 0;
+    cpuaddr              StripeAddr   = 0;
+    size_t               StripeLength = 0;
+    uint16               Algorithm    = CS_ALGORITHM_DEFAULT;
+    bool                 Streaming    = false;
+    CS_ChecksumContext_t StripeContext;
+
+    while (Claimed)
+    {
+        OS_MutSemTake(Pool->MutexId);
+
+        Claimed = (Pool->NextStripe < Pool->NumStripes);
+
+        if (Claimed)
+        {
+            Stripe     = Pool->NextStripe++;
+            JobId      = Pool->JobId;
+            Algorithm  = Pool->Algorithm;
+            Streaming  = Pool->Streaming;
+            StripeAddr = Pool->Base + (Stripe * Pool->StripeSize);
+
+            /* The last stripe gets whatever is left over */
+            StripeLength = Pool->Length - (Stripe * Pool->StripeSize);
+            if (StripeLength > Pool->StripeSize)
+            {
+                StripeLength = Pool->StripeSize;
+            }
+        }
+
+        OS_MutSemGive(Pool->MutexId);
+
+        if (Claimed)
+        {
+            CS_ChecksumInit(Algorithm, &StripeContext);
+            CS_WorkerChecksumUpdate(Algorithm, &StripeContext, (void *)StripeAddr, StripeLength, Streaming);
+
+            OS_MutSemTake(Pool->MutexId);
+
+            /* A job that timed out has a new JobId, so a late result is dropped */
+            if (JobId == Pool->JobId)
+            {
+                Pool->StripeContext[Stripe] = StripeContext;
+                Pool->StripesDone++;
+
+                if (Pool->StripesDone == Pool->NumStripes)
+                {
+                    OS_BinSemGive(Pool->DoneSemId);
+                }
+            }
+
+            OS_MutSemGive(Pool->MutexId);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that continues a checksum using the worker pool     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_WorkerPoolChecksumUpdate(uint16 AlgorithmId, CS_ChecksumContext_t *Context, const void *DataPtr,
+                                 size_t DataLength, bool Streaming)
+{
+    CS_WorkerPool_t *Pool         = &CS_AppData.WorkerPool;
+    size_t           StripeSize   = CS_WORKER_STRIPE_SIZE;
+    size_t           Remaining    = 0;
+    size_t           StripeLength = 0;
+    uint32           NumStripes   = 0;
+    uint32           NumWakeups   = 0;
+    uint32           i            = 0;
+    int32            Status       = OS_SUCCESS;
+    bool             UsedWorkers  = false;
+    bool             Striped      = false;
+
+    if (CS_WorkerPoolStripes(AlgorithmId, Context, DataLength))
+    {
+        OS_MutSemTake(Pool->DispatchMutexId);
+
+        /* Another task may have disabled the pool while we waited */
+        if (Pool->Active)
+        {
+            UsedWorkers = true;
+
+            if (DataLength > StripeSize * CS_WORKER_MAX_STRIPES)
+            {
+                StripeSize = (DataLength + CS_WORKER_MAX_STRIPES - 1) / CS_WORKER_MAX_STRIPES;
+            }
+            StripeSize = (StripeSize + CS_WORKER_STRIPE_ALIGN - 1) & ~((size_t)CS_WORKER_STRIPE_ALIGN - 1);
+            NumStripes = (DataLength + StripeSize - 1) / StripeSize;
+
+            OS_MutSemTake(Pool->MutexId);
+            Pool->JobId++;
+            Pool->Base        = (cpuaddr)DataPtr;
+            Pool->Length      = DataLength;
+            Pool->Algorithm   = AlgorithmId;
+            Pool->Streaming   = Streaming;
+            Pool->StripeSize  = StripeSize;
+            Pool->NumStripes  = NumStripes;
+            Pool->NextStripe  = 0;
+            Pool->StripesDone = 0;
+            OS_MutSemGive(Pool->MutexId);
+
+            /* The calling task takes stripes too, so it needs at most one fewer worker than stripes */
+            NumWakeups = ((Pool->NumWorkers < NumStripes - 1) ? Pool->NumWorkers : NumStripes - 1);
+            for (i = 0; i < NumWakeups; i++)
+            {
+                OS_CountSemGive(Pool->WorkSemId);
+            }
+
+            CS_WorkerProcessStripes();
+
+            Status = OS_BinSemTimedWait(Pool->DoneSemId, CS_WORKER_TIMEOUT);
+
+            if (Status == OS_SUCCESS)
+            {
+                Striped = true;
+
+                /* Merge the stripes in address order */
+                Remaining = DataLength;
+                for (i = 0; i < NumStripes; i++)
+                {
+                    StripeLength = ((Remaining < StripeSize) ? Remaining : StripeSize);
+                    CS_ChecksumCombine(AlgorithmId, Context, &Pool->StripeContext[i], StripeLength);
+                    Remaining -= StripeLength;
+                }
+            }
+            else
+            {
+                /* Abandon the job and stop using the workers */
+                OS_MutSemTake(Pool->MutexId);
+                Pool->Active = false;
+                Pool->JobId++;
+                Pool->NextStripe = Pool->NumStripes;
+                OS_MutSemGive(Pool->MutexId);
+
+                CFE_EVS_SendEvent(CS_WORKER_TIMEOUT_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Worker pool job timed out, RC = 0x%08X, worker pool disabled",
+                                  (unsigned int)Status);
+
+                CS_WorkerChecksumUpdate(AlgorithmId, Context, DataPtr, DataLength, Streaming);
+            }
+        }
+
+        OS_MutSemGive(Pool->DispatchMutexId);
+    }
+
+    if (!UsedWorkers)
+    {
+        CS_WorkerChecksumUpdate(AlgorithmId, Context, DataPtr, DataLength, Streaming);
+    }
+
+    return Striped;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that checks whether the worker pool would stripe a  */
+/* region                                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_WorkerPoolStripes(uint16 AlgorithmId, const CS_ChecksumContext_t *Context, size_t DataLength)
+{
+    return (CS_AppData.WorkerPool.Active && DataLength >= CS_WORKER_MIN_STRIPED_LENGTH &&
+            CS_ChecksumCanCombine(AlgorithmId, Context));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that returns the number of tasks sharing each job   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 CS_WorkerPoolLanes(void)
+{
+    uint32 Lanes = 1;
+
+    if (CS_AppData.WorkerPool.Active)
+    {
+        Lanes += CS_AppData.WorkerPool.NumWorkers;
+    }
+
+    return Lanes;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS worker pool child task                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_WorkerTask(void)
+{
+    while (OS_CountSemTake(CS_AppData.WorkerPool.WorkSemId) == OS_SUCCESS)
+    {
+        CS_WorkerProcessStripes();
+    }
+
+    CFE_ES_ExitChildTask();
+}
@@ -0,0 +1,230 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Checksum worker pool for the CFS Checksum (CS) Application
+ */
+#ifndef CS_WORKER_H
+#define CS_WORKER_H
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+#include "cs_platform_cfg.h"
+#include "cs_tbldefs.h"
+
+/**************************************************************************
+ **
+ ** Macro definitions
+ **
+ **************************************************************************/
+
+/**
+ * \name CS Worker Pool Semaphore Names
+ * \{
+ */
+#define CS_WORKER_DISPATCH_SEM_NAME "CS_WrkDispatch"
+#define CS_WORKER_MUTEX_SEM_NAME    "CS_WrkMutex"
+#define CS_WORKER_WORK_SEM_NAME     "CS_WrkWork"
+#define CS_WORKER_DONE_SEM_NAME     "CS_WrkDone"
+/**\}*/
+
+/**
+ * \brief Size of the worker task ID array
+ *
+ * \par Description
+ *      At least one element so the array is legal when the worker pool
+ *      is configured out.
+ */
+#if (CS_NUM_WORKER_TASKS > 0)
+#define CS_WORKER_TASK_ARRAY_SIZE CS_NUM_WORKER_TASKS
+#else
+#define CS_WORKER_TASK_ARRAY_SIZE 1
+#endif
+
+/**
+ * \brief Stripe sizes are rounded up to a multiple of this many bytes
+ *
+ * \par Description
+ *      Keeps every stripe but the last a whole number of Fletcher-64 words.
+ */
+#define CS_WORKER_STRIPE_ALIGN 8
+
+/**
+ * \brief Shortest region the worker pool stripes
+ *
+ * \par Description
+ *      Shorter regions are checksummed by the calling task.
+ */
+#define CS_WORKER_MIN_STRIPED_LENGTH (2 * (size_t)CS_WORKER_STRIPE_SIZE)
+
+/**************************************************************************
+ **
+ ** Type definitions
+ **
+ **************************************************************************/
+
+/**
+ *  \brief CS worker pool state
+ *
+ *  The job fields describe the region currently being checksummed.  They
+ *  are written by the dispatching task and read by the workers, always
+ *  under MutexId.  Stripes are handed out from NextStripe in order, so a
+ *  worker that finishes early simply claims the next unclaimed stripe.
+ */
+typedef struct
+{
+    bool   Active;     /**< \brief true when jobs are handed to the workers */
+    uint32 NumWorkers; /**< \brief Number of worker tasks running */
+
+    CFE_ES_TaskId_t TaskId[CS_WORKER_TASK_ARRAY_SIZE]; /**< \brief Worker task IDs */
+
+    osal_id_t DispatchMutexId; /**< \brief Serializes tasks submitting jobs */
+    osal_id_t MutexId;         /**< \brief Protects the job fields */
+    osal_id_t WorkSemId;       /**< \brief Counting semaphore that wakes the workers */
+    osal_id_t DoneSemId;       /**< \brief Given when the last stripe of a job is done */
+
+    uint32  JobId;       /**< \brief Incremented for each job so late workers can be ignored */
+    cpuaddr Base;        /**< \brief Start address of the job */
+    size_t  Length;      /**< \brief Length of the job in bytes */
+    uint16  Algorithm;   /**< \brief Checksum algorithm of the job, a CS_ALGORITHM_... value */
+    bool    Streaming;   /**< \brief true to checksum the stripes with #CS_ChecksumUpdateStreaming */
+    size_t  StripeSize;  /**< \brief Bytes per stripe; the last stripe may be shorter */
+    uint32  NumStripes;  /**< \brief Number of stripes in the job */
+    uint32  NextStripe;  /**< \brief Next stripe to be claimed */
+    uint32  StripesDone; /**< \brief Number of stripes finished */
+
+    CS_ChecksumContext_t StripeContext[CS_WORKER_MAX_STRIPES]; /**< \brief Checksum of each stripe, started fresh */
+} CS_WorkerPool_t;
+
+/**************************************************************************
+ **
+ ** Function prototypes
+ **
+ **************************************************************************/
+
+/**
+ * \brief Starts the checksum worker pool
+ *
+ *  \par Description
+ *       Creates the worker pool semaphores and #CS_NUM_WORKER_TASKS worker
+ *       child tasks at #CS_WORKER_TASK_PRIORITY.  If only some of the
+ *       workers can be created the pool runs with those.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once during application initialization.  When
+ *       #CS_NUM_WORKER_TASKS is 0, or nothing could be created, the pool
+ *       stays inactive and #CS_WorkerPoolChecksumUpdate behaves exactly like
+ *       #CS_ChecksumUpdate.  Tasks are not pinned to processors; OSAL has no
+ *       affinity control, so placement is left to the OS scheduler.
+ */
+void CS_WorkerPoolInit(void);
+
+/**
+ * \brief Checksums worker pool stripes until none are left
+ *
+ *  \par Description
+ *       Repeatedly claims the next unclaimed stripe of the current job,
+ *       computes its checksum, and records the result.  The task that finishes
+ *       the last stripe of a job gives the done semaphore.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Run by the worker tasks and by the task that submitted the job.
+ *       Results for a job that has been abandoned are discarded.
+ */
+void CS_WorkerProcessStripes(void);
+
+/**
+ * \brief Adds a block of memory to a checksum using the worker pool
+ *
+ *  \par Description
+ *       Splits the region into stripes, has the worker tasks and the
+ *       calling task checksum them concurrently, and merges the stripe
+ *       checksums into Context with #CS_ChecksumCombine.  The result is
+ *       identical to #CS_ChecksumUpdate for the same arguments.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Regions shorter than two stripes, algorithms whose checksums
+ *       cannot be combined, or any region while the pool is inactive, are
+ *       checksummed directly by the calling task.  If the workers do not
+ *       finish within #CS_WORKER_TIMEOUT the pool is disabled and the
+ *       region is checksummed by the calling task.
+ *
+ *  \param [in]     AlgorithmId  Algorithm the context was started with
+ *  \param [in,out] Context      Context started by #CS_ChecksumInit
+ *  \param [in]     DataPtr      Pointer to the start of the memory
+ *  \param [in]     DataLength   Number of bytes to add
+ *  \param [in]     Streaming    true to read the memory with
+ *                               #CS_ChecksumUpdateStreaming
+ *
+ * \return true if the pool's tasks shared the region, false if the
+ *         calling task checksummed all of it
+ */
+bool CS_WorkerPoolChecksumUpdate(uint16 AlgorithmId, CS_ChecksumContext_t *Context, const void *DataPtr,
+                                 size_t DataLength, bool Streaming);
+
+/**
+ * \brief Whether the worker pool would stripe a region
+ *
+ *  \par Description
+ *       Returns true while the pool is active for regions of at least two
+ *       #CS_WORKER_STRIPE_SIZE stripes, if the algorithm's checksums can
+ *       be combined from where Context is.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] AlgorithmId  Algorithm the context was started with
+ *  \param [in] Context      Context the region would be added to
+ *  \param [in] DataLength   Number of bytes in the region
+ *
+ * \return true if #CS_WorkerPoolChecksumUpdate would stripe the region
+ */
+bool CS_WorkerPoolStripes(uint16 AlgorithmId, const CS_ChecksumContext_t *Context, size_t DataLength);
+
+/**
+ * \brief Number of tasks that checksum a worker pool job
+ *
+ *  \par Description
+ *       Returns the number of workers plus the calling task while the pool
+ *       is active, otherwise 1.  Used to scale the bytes checksummed per
+ *       cycle so a cycle takes about the same time with or without the pool,
+ *       when the scaled bytes are enough for #CS_WorkerPoolStripes.
+ *
+ * \return Number of tasks sharing each job
+ */
+uint32 CS_WorkerPoolLanes(void);
+
+/**
+ * \brief Worker pool child task
+ *
+ *  \par Description
+ *       Waits for jobs and checksums stripes until the job has no
+ *       unclaimed stripes left, then waits again.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Exits when its semaphore is deleted.
+ */
+void CS_WorkerTask(void);
+
+#endif
@@ -0,0 +1,267 @@
+#!/usr/bin/env python3
+#
+# NASA Docket No. GSC-18,915-1, and identified as "cFS Checksum
+# Application version 2.5.1"
+#
+# Copyright (c) 2021 United States Government as represented by the
+# Administrator of the National Aeronautics and Space Administration.
+# All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License"); you may
+# not use this file except in compliance with the License. You may obtain
+# a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+"""Computes CS expected values from build outputs.
+
+Writes a header of CS_Digest_t initializers that the CS definition tables
+use for their ExpectedValue fields, so that the first pass over an entry is
+checked against the image that was built rather than learning whatever is
+in memory.
+
+Each non-blank line of the spec file not starting with '#' is
+
+    NAME ALGORITHM SOURCE
+
+NAME      becomes the CS_EXPECTED_VALUE_<NAME> macro
+ALGORITHM crc16, crc32, crc32c, crc64, fletcher64, sha256 or default; it
+          must match the Algorithm of the definition table entry
+SOURCE    bin:PATH[@OFFSET[+LENGTH]]  bytes of a raw image
+          elf:PATH:SECTION            contents of an ELF section
+          tbl:PATH                    data of a cFE table image (.tbl)
+
+Offsets and lengths may be given in decimal or with a 0x prefix.  Relative
+paths are relative to the spec file.
+"""
+
+import argparse
+import hashlib
+import os
+import struct
+import sys
+
+CS_MAX_DIGEST_SIZE = 32
+
+# Size of the CFE_FS_Header_t and CFE_TBL_File_Hdr_t ahead of a table image's data
+CFE_FS_HEADER_SIZE = 64
+CFE_TBL_FILE_HEADER_SIZE = 52
+
+
+def _crc_table(poly, width):
+    table = []
+    for i in range(256):
+        crc = i
+        for _ in range(8):
+            crc = (crc >> 1) ^ poly if crc & 1 else crc >> 1
+        table.append(crc & ((1 << width) - 1))
+    return table
+
+
+_CRC16_TABLE = _crc_table(0xA001, 16)
+_CRC32_TABLE = _crc_table(0xEDB88320, 32)
+_CRC32C_TABLE = _crc_table(0x82F63B78, 32)
+_CRC64_TABLE = _crc_table(0xC96C5795D7870F42, 64)
+
+
+def _reflected_crc(data, table, init, xorout, mask):
+    crc = init
+    for byte in data:
+        crc = table[(crc ^ byte) & 0xFF] ^ (crc >> 8)
+    return (crc ^ xorout) & mask
+
+
+def crc16(data):
+    # CS reports the 16 bit CRC sign extended to 32 bits
+    crc = _reflected_crc(data, _CRC16_TABLE, 0, 0, 0xFFFF)
+    if crc & 0x8000:
+        crc |= 0xFFFF0000
+    return crc.to_bytes(4, "big")
+
+
+def crc32(data):
+    return _reflected_crc(data, _CRC32_TABLE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF).to_bytes(4, "big")
+
+
+def crc32c(data):
+    return _reflected_crc(data, _CRC32C_TABLE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF).to_bytes(4, "big")
+
+
+def crc64(data):
+    mask = 0xFFFFFFFFFFFFFFFF
+    return _reflected_crc(data, _CRC64_TABLE, mask, mask, mask).to_bytes(8, "big")
+
+
+def fletcher64(data):
+    # Little endian 32 bit words, the last one zero padded
+    modulus = 0xFFFFFFFF
+    padded = bytes(data) + bytes(-len(data) % 4)
+    sum1 = 0
+    sum2 = 0
+    for (word,) in struct.iter_unpack("<I", padded):
+        sum1 = (sum1 + word) % modulus
+        sum2 = (sum2 + sum1) % modulus
+    return ((sum2 << 32) | sum1).to_bytes(8, "big")
+
+
+def sha256(data):
+    return hashlib.sha256(data).digest()
+
+
+ALGORITHMS = {
+    "crc16": crc16,
+    "crc32": crc32,
+    "crc32c": crc32c,
+    "crc64": crc64,
+    "fletcher64": fletcher64,
+    "sha256": sha256,
+}
+
+
+def _number(text):
+    return int(text, 0)
+
+
+def _read_bin(path, region):
+    with open(path, "rb") as f:
+        data = f.read()
+    if region is None:
+        return data
+    offset, _, length = region.partition("+")
+    start = _number(offset)
+    end = len(data) if not length else start + _number(length)
+    if start > len(data) or end > len(data):
+        raise ValueError("%s is only %d bytes" % (path, len(data)))
+    return data[start:end]
+
+
+def _read_elf(path, section):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"\x7fELF":
+        raise ValueError("%s is not an ELF file" % path)
+    is64 = data[4] == 2
+    order = "<" if data[5] == 1 else ">"
+    if is64:
+        shoff, = struct.unpack_from(order + "Q", data, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(order + "HHH", data, 0x3A)
+        header = order + "IIQQQQIIQQ"
+    else:
+        shoff, = struct.unpack_from(order + "I", data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(order + "HHH", data, 0x2E)
+        header = order + "IIIIIIIIII"
+    sections = [struct.unpack_from(header, data, shoff + i * shentsize) for i in range(shnum)]
+    names = sections[shstrndx][4]
+    for sh_name, sh_type, _, _, sh_offset, sh_size, _, _, _, _ in sections:
+        name = data[names + sh_name:data.index(b"\0", names + sh_name)].decode()
+        if name == section:
+            if sh_type == 8:  # SHT_NOBITS has no contents in the file
+                raise ValueError("section %s of %s has no contents" % (section, path))
+            return data[sh_offset:sh_offset + sh_size]
+    raise ValueError("%s has no section %s" % (path, section))
+
+
+def _read_tbl(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    _, offset, num_bytes = struct.unpack_from(">III", data, CFE_FS_HEADER_SIZE)
+    if offset != 0:
+        raise ValueError("%s is a partial table image" % path)
+    start = CFE_FS_HEADER_SIZE + CFE_TBL_FILE_HEADER_SIZE
+    if start + num_bytes > len(data):
+        raise ValueError("%s is truncated" % path)
+    return data[start:start + num_bytes]
+
+
+def source_path(source, base):
+    kind, _, rest = source.partition(":")
+    if kind == "bin":
+        return os.path.join(base, rest.partition("@")[0])
+    if kind == "elf":
+        return os.path.join(base, rest.rpartition(":")[0])
+    if kind == "tbl":
+        return os.path.join(base, rest)
+    raise ValueError("unknown source %s" % source)
+
+
+def read_source(source, base):
+    kind, _, rest = source.partition(":")
+    if kind == "bin":
+        path, _, region = rest.partition("@")
+        return _read_bin(os.path.join(base, path), region or None)
+    if kind == "elf":
+        path, _, section = rest.rpartition(":")
+        return _read_elf(os.path.join(base, path), section)
+    if kind == "tbl":
+        return _read_tbl(os.path.join(base, rest))
+    raise ValueError("unknown source %s" % source)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("spec", help="file listing the expected values to compute")
+    parser.add_argument("output", nargs="?", help="header to write")
+    parser.add_argument("--default-algorithm", default="crc16", choices=sorted(ALGORITHMS),
+                        help="algorithm CS_ALGORITHM_DEFAULT maps to on the target (default crc16)")
+    parser.add_argument("--list-images", action="store_true",
+                        help="print the files the spec reads, one per line, instead of writing the header")
+    args = parser.parse_args()
+    if args.output is None and not args.list_images:
+        parser.error("the output header is required")
+
+    base = os.path.dirname(os.path.abspath(args.spec))
+    lines = []
+    with open(args.spec) as f:
+        for number, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            try:
+                name, algorithm, source = line.split(None, 2)
+                if args.list_images:
+                    print(source_path(source, base))
+                    continue
+                if algorithm == "default":
+                    algorithm = args.default_algorithm
+                if algorithm not in ALGORITHMS:
+                    raise ValueError("unknown algorithm %s" % algorithm)
+                digest = ALGORITHMS[algorithm](read_source(source, base))
+            except (OSError, ValueError, struct.error) as err:
+                sys.exit("%s:%d: %s" % (args.spec, number, err))
+            digest = digest.ljust(CS_MAX_DIGEST_SIZE, b"\0")
+            lines.append("/* %s of %s */" % (algorithm, source))
+            lines.append("#define CS_EXPECTED_VALUE_%s \\" % name.upper())
+            lines.append("    {                     \\")
+            lines.append("        {                 \\")
+            for i in range(0, CS_MAX_DIGEST_SIZE, 8):
+                lines.append("            " + ", ".join("0x%02X" % b for b in digest[i:i + 8]) + ", \\")
+            lines.append("        }                 \\")
+            lines.append("    }")
+            lines.append("")
+
+    if args.list_images:
+        return
+
+    header = [
+        "/* Generated by cs_expected_values.py from %s, do not edit */" % os.path.basename(args.spec),
+        "",
+        "/*",
+        " * Set .HasExpectedValue = true and .ExpectedValue = CS_EXPECTED_VALUE_<NAME>",
+        " * in a CS definition table entry.  Values for applications only hold if",
+        " * the code the app loads is the same as the file they were computed from.",
+        " */",
+        "#ifndef CS_EXPECTED_VALUES_H",
+        "#define CS_EXPECTED_VALUES_H",
+        "",
+    ]
+    with open(args.output, "w") as f:
+        f.write("\n".join(header + lines + ["#endif", ""]))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,423 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cs_algorithm.h"
+#include "cs_crc.h"
+#include "cs_test_utils.h"
+#include <string.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* cs_algorithm_tests globals */
+static uint8 CS_Test_AlgorithmBuffer[70000];
+
+/*
+ * Function Definitions
+ */
+
+static void CS_Test_FillBuffer(void)
+{
+    uint32 i;
+
+    for (i = 0; i < sizeof(CS_Test_AlgorithmBuffer); i++)
+    {
+        CS_Test_AlgorithmBuffer[i] = (uint8)((i * 131) + (i >> 8) + 7);
+    }
+}
+
+/*
+ * Word-at-a-time Fletcher-64 reference, reducing after every word
+ */
+static uint64 CS_Test_ReferenceFletcher64(const uint8 *Data, size_t Length)
+{
+    uint64 Sum1 = 0;
+    uint64 Sum2 = 0;
+    uint32 Word;
+    size_t i;
+
+    for (i = 0; i < Length; i += 4)
+    {
+        Word = Data[i];
+        Word |= (i + 1 < Length) ? ((uint32)Data[i + 1] << 8) : 0;
+        Word |= (i + 2 < Length) ? ((uint32)Data[i + 2] << 16) : 0;
+        Word |= (i + 3 < Length) ? ((uint32)Data[i + 3] << 24) : 0;
+
+        Sum1 = (Sum1 + Word) % 0xFFFFFFFF;
+        Sum2 = (Sum2 + Sum1) % 0xFFFFFFFF;
+    }
+
+    return (Sum2 << 32) | Sum1;
+}
+
+static uint64 CS_Test_DigestToUint64(const CS_Digest_t *Digest)
+{
+    uint64 Value = 0;
+    uint32 i;
+
+    for (i = 0; i < 8; i++)
+    {
+        Value = (Value << 8) | Digest->Bytes[i];
+    }
+
+    return Value;
+}
+
+static void CS_Test_ChecksumAll(uint16 AlgorithmId, const void *DataPtr, size_t DataLength, CS_Digest_t *Digest)
+{
+    CS_ChecksumContext_t Context;
+
+    CS_ChecksumInit(AlgorithmId, &Context);
+    CS_ChecksumUpdate(AlgorithmId, &Context, DataPtr, DataLength);
+    CS_ChecksumFinal(AlgorithmId, &Context, Digest);
+}
+
+static void CS_Test_ChecksumChunked(uint16 AlgorithmId, const uint8 *DataPtr, size_t DataLength, CS_Digest_t *Digest)
+{
+    static const size_t  ChunkSizes[] = {1, 3, 7, 64, 65, 2, 1000, 4097};
+    CS_ChecksumContext_t Context;
+    size_t               Offset = 0;
+    size_t               Length = 0;
+    uint32               i      = 0;
+
+    CS_ChecksumInit(AlgorithmId, &Context);
+
+    while (Offset < DataLength)
+    {
+        Length = ChunkSizes[i++ % (sizeof(ChunkSizes) / sizeof(ChunkSizes[0]))];
+        if (Length > DataLength - Offset)
+        {
+            Length = DataLength - Offset;
+        }
+
+        CS_ChecksumUpdate(AlgorithmId, &Context, &DataPtr[Offset], Length);
+        Offset += Length;
+    }
+
+    CS_ChecksumFinal(AlgorithmId, &Context, Digest);
+}
+
+static void CS_Test_AssertSha256(const char *Message, const char *ExpectedHex)
+{
+    CS_Digest_t Digest;
+    char        DigestHex[(CS_MAX_DIGEST_SIZE * 2) + 1];
+    uint32      i;
+
+    CS_Test_ChecksumAll(CS_ALGORITHM_SHA_256, Message, strlen(Message), &Digest);
+
+    for (i = 0; i < CS_MAX_DIGEST_SIZE; i++)
+    {
+        snprintf(&DigestHex[i * 2], 3, "%02x", Digest.Bytes[i]);
+    }
+
+    UtAssert_STRINGBUF_EQ(DigestHex, sizeof(DigestHex), ExpectedHex, sizeof(DigestHex));
+}
+
+void CS_GetAlgorithm_Test_InvalidIsDefault(void)
+{
+    /* Execute the function being tested */
+    UtAssert_ADDRESS_EQ(CS_GetAlgorithm(CS_NUM_ALGORITHMS), CS_GetAlgorithm(CS_ALGORITHM_DEFAULT));
+    UtAssert_ADDRESS_EQ(CS_GetAlgorithm(0xFFFF), CS_GetAlgorithm(CS_ALGORITHM_DEFAULT));
+
+    /* Verify results */
+    UtAssert_INT32_EQ(CS_GetAlgorithm(CS_ALGORITHM_DEFAULT)->TypeCRC, CS_DEFAULT_ALGORITHM);
+    UtAssert_UINT32_EQ(CS_GetAlgorithm(CS_ALGORITHM_SHA_256)->DigestSize, CS_MAX_DIGEST_SIZE);
+}
+
+void CS_ChecksumFinal_Test_Crc(void)
+{
+    CS_ChecksumContext_t Context;
+    CS_Digest_t          Digest;
+    uint32               i;
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_CalculateCRC), 0x12345678);
+
+    /* Execute the function being tested */
+    CS_ChecksumInit(CS_ALGORITHM_CRC_32, &Context);
+    CS_ChecksumUpdate(CS_ALGORITHM_CRC_32, &Context, CS_Test_AlgorithmBuffer, 10);
+    UtAssert_UINT32_EQ(CS_ChecksumFinal(CS_ALGORITHM_CRC_32, &Context, &Digest), 0x12345678);
+
+    /* Verify results: the digest is big-endian and zero-filled */
+    UtAssert_STUB_COUNT(CS_CalculateCRC, 1);
+    UtAssert_UINT32_EQ(Digest.Bytes[0], 0x12);
+    UtAssert_UINT32_EQ(Digest.Bytes[3], 0x78);
+
+    for (i = 4; i < CS_MAX_DIGEST_SIZE; i++)
+    {
+        UtAssert_UINT32_EQ(Digest.Bytes[i], 0);
+    }
+}
+
+void CS_ChecksumCombine_Test_Crc(void)
+{
+    CS_ChecksumContext_t ContextA;
+    CS_ChecksumContext_t ContextB;
+
+    memset(&ContextA, 0, sizeof(ContextA));
+    memset(&ContextB, 0, sizeof(ContextB));
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_CrcCombine), 0x5678);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(CS_ChecksumCanCombine(CS_ALGORITHM_CRC_16, &ContextA));
+    CS_ChecksumCombine(CS_ALGORITHM_CRC_16, &ContextA, &ContextB, 10);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_CrcCombine, 1);
+    UtAssert_UINT32_EQ(ContextA.Crc, 0x5678);
+}
+
+void CS_ChecksumCombine_Test_Crc64(void)
+{
+    CS_ChecksumContext_t ContextA;
+    CS_ChecksumContext_t ContextB;
+
+    /* Execute the function being tested */
+    CS_ChecksumInit(CS_ALGORITHM_CRC_64, &ContextA);
+    CS_ChecksumInit(CS_ALGORITHM_CRC_64, &ContextB);
+    CS_ChecksumUpdate(CS_ALGORITHM_CRC_64, &ContextB, CS_Test_AlgorithmBuffer, 10);
+    UtAssert_BOOL_TRUE(CS_ChecksumCanCombine(CS_ALGORITHM_CRC_64, &ContextA));
+    CS_ChecksumCombine(CS_ALGORITHM_CRC_64, &ContextA, &ContextB, 10);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_CalculateCRC64, 1);
+    UtAssert_STUB_COUNT(CS_Crc64Combine, 1);
+    UtAssert_STUB_COUNT(CS_CalculateCRC, 0);
+}
+
+void CS_ChecksumFinal_Test_Fletcher64KnownValues(void)
+{
+    CS_Digest_t Digest;
+
+    /* Execute the function being tested */
+    CS_Test_ChecksumAll(CS_ALGORITHM_FLETCHER_64, "abcde", 5, &Digest);
+    UtAssert_True(CS_Test_DigestToUint64(&Digest) == 0xC8C6C527646362C6ULL, "Fletcher-64 of \"abcde\"");
+
+    CS_Test_ChecksumAll(CS_ALGORITHM_FLETCHER_64, "abcdef", 6, &Digest);
+    UtAssert_True(CS_Test_DigestToUint64(&Digest) == 0xC8C72B276463C8C6ULL, "Fletcher-64 of \"abcdef\"");
+
+    CS_Test_ChecksumAll(CS_ALGORITHM_FLETCHER_64, "abcdefgh", 8, &Digest);
+    UtAssert_True(CS_Test_DigestToUint64(&Digest) == 0x312E2B28CCCAC8C6ULL, "Fletcher-64 of \"abcdefgh\"");
+}
+
+void CS_ChecksumFinal_Test_Fletcher64MatchesReference(void)
+{
+    CS_Digest_t Digest;
+    size_t      Length;
+
+    CS_Test_FillBuffer();
+
+    /* Long enough that the sums are folded part way through */
+    for (Length = sizeof(CS_Test_AlgorithmBuffer) - 3; Length <= sizeof(CS_Test_AlgorithmBuffer); Length++)
+    {
+        /* Execute the function being tested */
+        CS_Test_ChecksumChunked(CS_ALGORITHM_FLETCHER_64, CS_Test_AlgorithmBuffer, Length, &Digest);
+
+        /* Verify results */
+        UtAssert_True(CS_Test_DigestToUint64(&Digest) ==
+                          CS_Test_ReferenceFletcher64(CS_Test_AlgorithmBuffer, Length),
+                      "Fletcher-64 of %lu bytes matches reference", (unsigned long)Length);
+    }
+}
+
+void CS_ChecksumCombine_Test_Fletcher64(void)
+{
+    CS_ChecksumContext_t ContextA;
+    CS_ChecksumContext_t ContextB;
+    CS_Digest_t          Combined;
+    CS_Digest_t          Expected;
+
+    CS_Test_FillBuffer();
+
+    CS_Test_ChecksumAll(CS_ALGORITHM_FLETCHER_64, CS_Test_AlgorithmBuffer, 40001, &Expected);
+
+    CS_ChecksumInit(CS_ALGORITHM_FLETCHER_64, &ContextA);
+    CS_ChecksumInit(CS_ALGORITHM_FLETCHER_64, &ContextB);
+    CS_ChecksumUpdate(CS_ALGORITHM_FLETCHER_64, &ContextA, CS_Test_AlgorithmBuffer, 20000);
+    CS_ChecksumUpdate(CS_ALGORITHM_FLETCHER_64, &ContextB, &CS_Test_AlgorithmBuffer[20000], 20001);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(CS_ChecksumCanCombine(CS_ALGORITHM_FLETCHER_64, &ContextA));
+    CS_ChecksumCombine(CS_ALGORITHM_FLETCHER_64, &ContextA, &ContextB, 20001);
+    CS_ChecksumFinal(CS_ALGORITHM_FLETCHER_64, &ContextA, &Combined);
+
+    /* Verify results */
+    UtAssert_MemCmp(&Combined, &Expected, sizeof(Combined), "Combined Fletcher-64 matches sequential");
+}
+
+void CS_ChecksumCanCombine_Test_Fletcher64PartialWord(void)
+{
+    CS_ChecksumContext_t Context;
+
+    CS_ChecksumInit(CS_ALGORITHM_FLETCHER_64, &Context);
+    CS_ChecksumUpdate(CS_ALGORITHM_FLETCHER_64, &Context, CS_Test_AlgorithmBuffer, 6);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(CS_ChecksumCanCombine(CS_ALGORITHM_FLETCHER_64, &Context));
+}
+
+void CS_ChecksumFinal_Test_Sha256KnownValues(void)
+{
+    /* Execute the function being tested */
+    CS_Test_AssertSha256("", "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    CS_Test_AssertSha256("abc", "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+
+    /* 56 bytes, so the length needs a second padding block */
+    CS_Test_AssertSha256("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+                         "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+}
+
+void CS_ChecksumUpdate_Test_Incremental(void)
+{
+    CS_Digest_t Whole;
+    CS_Digest_t Chunked;
+    uint16      AlgorithmId;
+
+    CS_Test_FillBuffer();
+
+    for (AlgorithmId = CS_ALGORITHM_FLETCHER_64; AlgorithmId < CS_NUM_ALGORITHMS; AlgorithmId++)
+    {
+        /* Execute the function being tested */
+        CS_Test_ChecksumAll(AlgorithmId, CS_Test_AlgorithmBuffer, 10001, &Whole);
+        CS_Test_ChecksumChunked(AlgorithmId, CS_Test_AlgorithmBuffer, 10001, &Chunked);
+
+        /* Verify results */
+        UtAssert_MemCmp(&Whole, &Chunked, sizeof(Whole), "Algorithm %u chunked matches one-shot",
+                        (unsigned int)AlgorithmId);
+    }
+}
+
+void CS_ChecksumUpdateStreaming_Test(void)
+{
+    static const size_t  Lengths[] = {0, 1, CS_STREAM_BLOCK_SIZE - 1, (3 * CS_STREAM_BLOCK_SIZE) + 7};
+    CS_ChecksumContext_t Context;
+    CS_Digest_t          Whole;
+    CS_Digest_t          Streamed;
+    uint16               AlgorithmId;
+    uint32               i;
+
+    CS_Test_FillBuffer();
+
+    for (AlgorithmId = CS_ALGORITHM_CRC_16; AlgorithmId < CS_NUM_ALGORITHMS; AlgorithmId++)
+    {
+        for (i = 0; i < sizeof(Lengths) / sizeof(Lengths[0]); i++)
+        {
+            /* Execute the function being tested: an unaligned start crosses every block boundary */
+            CS_ChecksumInit(AlgorithmId, &Context);
+            CS_ChecksumUpdateStreaming(AlgorithmId, &Context, &CS_Test_AlgorithmBuffer[3], Lengths[i]);
+            CS_ChecksumFinal(AlgorithmId, &Context, &Streamed);
+
+            CS_Test_ChecksumAll(AlgorithmId, &CS_Test_AlgorithmBuffer[3], Lengths[i], &Whole);
+
+            /* Verify results */
+            UtAssert_MemCmp(&Whole, &Streamed, sizeof(Whole), "Algorithm %u streaming %u bytes matches",
+                            (unsigned int)AlgorithmId, (unsigned int)Lengths[i]);
+        }
+    }
+}
+
+void CS_ChecksumCombine_Test_Sha256(void)
+{
+    CS_ChecksumContext_t ContextA;
+    CS_ChecksumContext_t ContextB;
+    CS_ChecksumContext_t Saved;
+
+    CS_ChecksumInit(CS_ALGORITHM_SHA_256, &ContextA);
+    CS_ChecksumInit(CS_ALGORITHM_SHA_256, &ContextB);
+    CS_ChecksumUpdate(CS_ALGORITHM_SHA_256, &ContextA, "abc", 3);
+    Saved = ContextA;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(CS_ChecksumCanCombine(CS_ALGORITHM_SHA_256, &ContextA));
+    CS_ChecksumCombine(CS_ALGORITHM_SHA_256, &ContextA, &ContextB, 0);
+
+    /* Verify results: combining is not supported, so nothing changes */
+    UtAssert_MemCmp(&ContextA, &Saved, sizeof(Saved), "SHA-256 context unchanged");
+}
+
+void CS_ChecksumFromCrc_Test(void)
+{
+    static const uint8   Data[] = "123456789";
+    CS_ChecksumContext_t Context;
+    CS_Digest_t          Computed;
+    CS_Digest_t          Digest;
+    uint32               Crc;
+
+    CS_ChecksumInit(CS_ALGORITHM_CRC_16, &Context);
+    CS_ChecksumUpdate(CS_ALGORITHM_CRC_16, &Context, Data, 9);
+    Crc = CS_ChecksumFinal(CS_ALGORITHM_CRC_16, &Context, &Computed);
+
+    /* The same digest as computing the CRC */
+    memset(&Digest, 0xFF, sizeof(Digest));
+    UtAssert_BOOL_TRUE(CS_ChecksumFromCrc(CS_ALGORITHM_CRC_16, CFE_ES_CrcType_CRC_16, Crc, &Digest));
+    UtAssert_MemCmp(&Digest, &Computed, sizeof(Digest), "CRC-16 digest matches");
+
+    /* Other algorithms are left alone */
+    memset(&Digest, 0xFF, sizeof(Digest));
+    UtAssert_BOOL_FALSE(CS_ChecksumFromCrc(CS_ALGORITHM_CRC_32, CFE_ES_CrcType_CRC_16, Crc, &Digest));
+    UtAssert_BOOL_FALSE(CS_ChecksumFromCrc(CS_ALGORITHM_CRC_32C, CFE_ES_CrcType_CRC_16, Crc, &Digest));
+    UtAssert_BOOL_FALSE(CS_ChecksumFromCrc(CS_ALGORITHM_SHA_256, CFE_ES_CrcType_CRC_16, Crc, &Digest));
+    UtAssert_BOOL_FALSE(CS_ChecksumFromCrc(CS_ALGORITHM_CRC_64, CFE_ES_CrcType_NONE, Crc, &Digest));
+    UtAssert_UINT32_EQ(Digest.Bytes[0], 0xFF);
+}
+
+void CS_DigestSummary_Test(void)
+{
+    CS_Digest_t Digest;
+
+    memset(&Digest, 0, sizeof(Digest));
+    Digest.Bytes[0] = 0x12;
+    Digest.Bytes[1] = 0x34;
+    Digest.Bytes[2] = 0x56;
+    Digest.Bytes[3] = 0x78;
+    Digest.Bytes[4] = 0x9A;
+
+    UtAssert_UINT32_EQ(CS_DigestSummary(&Digest), 0x12345678);
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(CS_GetAlgorithm_Test_InvalidIsDefault, CS_Test_Setup, CS_Test_TearDown,
+               "CS_GetAlgorithm_Test_InvalidIsDefault");
+    UtTest_Add(CS_ChecksumFinal_Test_Crc, CS_Test_Setup, CS_Test_TearDown, "CS_ChecksumFinal_Test_Crc");
+    UtTest_Add(CS_ChecksumCombine_Test_Crc, CS_Test_Setup, CS_Test_TearDown, "CS_ChecksumCombine_Test_Crc");
+    UtTest_Add(CS_ChecksumCombine_Test_Crc64, CS_Test_Setup, CS_Test_TearDown, "CS_ChecksumCombine_Test_Crc64");
+    UtTest_Add(CS_ChecksumFinal_Test_Fletcher64KnownValues, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ChecksumFinal_Test_Fletcher64KnownValues");
+    UtTest_Add(CS_ChecksumFinal_Test_Fletcher64MatchesReference, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ChecksumFinal_Test_Fletcher64MatchesReference");
+    UtTest_Add(CS_ChecksumCombine_Test_Fletcher64, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ChecksumCombine_Test_Fletcher64");
+    UtTest_Add(CS_ChecksumCanCombine_Test_Fletcher64PartialWord, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ChecksumCanCombine_Test_Fletcher64PartialWord");
+    UtTest_Add(CS_ChecksumFinal_Test_Sha256KnownValues, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ChecksumFinal_Test_Sha256KnownValues");
+    UtTest_Add(CS_ChecksumUpdate_Test_Incremental, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ChecksumUpdate_Test_Incremental");
+    UtTest_Add(CS_ChecksumUpdateStreaming_Test, CS_Test_Setup, CS_Test_TearDown, "CS_ChecksumUpdateStreaming_Test");
+    UtTest_Add(CS_ChecksumCombine_Test_Sha256, CS_Test_Setup, CS_Test_TearDown, "CS_ChecksumCombine_Test_Sha256");
+    UtTest_Add(CS_DigestSummary_Test, CS_Test_Setup, CS_Test_TearDown, "CS_DigestSummary_Test");
+    UtTest_Add(CS_ChecksumFromCrc_Test, CS_Test_Setup, CS_Test_TearDown, "CS_ChecksumFromCrc_Test");
+}
@@ -106,18 +106,19 @@ void CS_DisableAppCmd_Test(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_DisableAppCmd_Test_OneShot(void)
+void CS_DisableAppCmd_Test_RecomputeInProgress(void)
 {
     CS_NoArgsCmd_t CmdPacket;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
 
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeTable), 1, true);
 
     /* Execute the function being tested */
     CS_DisableAppCmd(&CmdPacket);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(CS_CheckRecomputeTable, 1);
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 0, "CS_AppData.HkPacket.Payload.CmdCounter == 0");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -160,18 +161,19 @@ void CS_EnableAppCmd_Test(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_EnableAppCmd_Test_OneShot(void)
+void CS_EnableAppCmd_Test_RecomputeInProgress(void)
 {
     CS_NoArgsCmd_t CmdPacket;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
 
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeTable), 1, true);
 
     /* Execute the function being tested */
     CS_EnableAppCmd(&CmdPacket);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(CS_CheckRecomputeTable, 1);
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 0, "CS_AppData.HkPacket.Payload.CmdCounter == 0");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -304,32 +306,35 @@ void CS_ReportBaselineAppCmd_Test_OneShot(void)
     int32           strCmpResult;
     char            ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "App recompute baseline for app %%s failed: child task in use");
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Recompute baseline of app %%s started");
 
     strncpy(CmdPacket.Payload.Name, "App1", OS_MAX_API_NAME);
-    strncpy(CS_AppData.ResAppTblPtr->Name, "App2", OS_MAX_API_NAME);
+    strncpy(CS_AppData.ResAppTblPtr->Name, "App1", OS_MAX_API_NAME);
 
+    /* A OneShot in progress does not keep the recompute from being queued */
     CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
     CS_AppData.HkPacket.Payload.OneShotInProgress   = true;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-
-    /* Execute the function being tested */
-    CS_RecomputeBaselineAppCmd(&CmdPacket);
     UT_SetDeferredRetcode(UT_KEY(CS_GetAppResTblEntryByName), 1, true);
     UT_SetHandlerFunction(UT_KEY(CS_GetAppResTblEntryByName), CS_APP_CMDS_TEST_CS_GetAppResTblEntryByNameHandler1,
                           NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitRecompute), true);
+
+    /* Execute the function being tested */
+    CS_RecomputeBaselineAppCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_APP_CHDTASK_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_APP_STARTED_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_True(CS_AppData.HkPacket.Payload.CmdErrCounter == 1, "CS_AppData.HkPacket.Payload.CmdErrCounter == 1");
+    UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
+
+    UtAssert_STUB_COUNT(CS_JobsSubmitRecompute, 1);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -354,7 +359,7 @@ void CS_RecomputeBaselineAppCmd_Test_Nominal(void)
     CS_AppData.ResAppTblPtr->State = 1;
 
     /* Set to generate event message CS_RECOMPUTE_APP_STARTED_DBG_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitRecompute), true);
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
     UT_SetDeferredRetcode(UT_KEY(CS_GetAppResTblEntryByName), 1, true);
@@ -365,8 +370,7 @@ void CS_RecomputeBaselineAppCmd_Test_Nominal(void)
     CS_RecomputeBaselineAppCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_True(CS_AppData.ResAppTblPtr == CS_AppData.RecomputeAppEntryPtr,
-                  "CS_AppData.ResAppTblPtr == CS_AppData.RecomputeAppEntryPtr");
+    UtAssert_STUB_COUNT(CS_JobsSubmitRecompute, 1);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_APP_STARTED_DBG_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
@@ -385,14 +389,14 @@ void CS_RecomputeBaselineAppCmd_Test_Nominal(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_RecomputeBaselineAppCmd_Test_CreateChildTaskError(void)
+void CS_RecomputeBaselineAppCmd_Test_JobNotQueued(void)
 {
     CS_AppNameCmd_t CmdPacket;
     int32           strCmpResult;
     char            ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Recompute baseline of app %%s failed, CFE_ES_CreateChildTask returned: 0x%%08X");
+             "App recompute baseline for app %%s failed: job queue full or already queued");
 
     strncpy(CmdPacket.Payload.Name, "App1", OS_MAX_API_NAME);
     strncpy(CS_AppData.ResAppTblPtr->Name, "App1", OS_MAX_API_NAME);
@@ -402,8 +406,8 @@ void CS_RecomputeBaselineAppCmd_Test_CreateChildTaskError(void)
     /* Needed to make subfunction CS_GetAppResTblEntryByName behave properly */
     CS_AppData.ResAppTblPtr->State = 1;
 
-    /* Set to generate event message CS_RECOMPUTE_APP_CREATE_CHDTASK_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, -1);
+    /* Set to generate event message CS_RECOMPUTE_APP_CHDTASK_ERR_EID */
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitRecompute), false);
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
     UT_SetDeferredRetcode(UT_KEY(CS_GetAppResTblEntryByName), 1, true);
@@ -414,10 +418,9 @@ void CS_RecomputeBaselineAppCmd_Test_CreateChildTaskError(void)
     CS_RecomputeBaselineAppCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_True(CS_AppData.ResAppTblPtr == CS_AppData.RecomputeAppEntryPtr,
-                  "CS_AppData.ResAppTblPtr == CS_AppData.RecomputeAppEntryPtr");
+    UtAssert_STUB_COUNT(CS_JobsSubmitRecompute, 1);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_APP_CREATE_CHDTASK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_APP_CHDTASK_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
@@ -477,31 +480,32 @@ void CS_RecomputeBaselineAppCmd_Test_RecomputeInProgress(void)
     int32           strCmpResult;
     char            ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "App recompute baseline for app %%s failed: child task in use");
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Recompute baseline of app %%s started");
 
     strncpy(CmdPacket.Payload.Name, "App1", OS_MAX_API_NAME);
-    strncpy(CS_AppData.ResAppTblPtr->Name, "App2", OS_MAX_API_NAME);
+    strncpy(CS_AppData.ResAppTblPtr->Name, "App1", OS_MAX_API_NAME);
 
+    /* A recompute of another entry does not keep this one from being queued */
     CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-
-    /* Execute the function being tested */
-    CS_RecomputeBaselineAppCmd(&CmdPacket);
     UT_SetDeferredRetcode(UT_KEY(CS_GetAppResTblEntryByName), 1, true);
     UT_SetHandlerFunction(UT_KEY(CS_GetAppResTblEntryByName), CS_APP_CMDS_TEST_CS_GetAppResTblEntryByNameHandler1,
                           NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitRecompute), true);
+
+    /* Execute the function being tested */
+    CS_RecomputeBaselineAppCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_APP_CHDTASK_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_APP_STARTED_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_True(CS_AppData.HkPacket.Payload.CmdErrCounter == 1, "CS_AppData.HkPacket.Payload.CmdErrCounter == 1");
+    UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -528,7 +532,6 @@ void CS_DisableNameAppCmd_Test_Nominal(void)
     CS_AppData.DefAppTblPtr->State = 1;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, false);
     UT_SetDeferredRetcode(UT_KEY(CS_GetAppResTblEntryByName), 1, true);
     UT_SetHandlerFunction(UT_KEY(CS_GetAppResTblEntryByName), CS_APP_CMDS_TEST_CS_GetAppResTblEntryByNameHandler1,
                           NULL);
@@ -549,6 +552,8 @@ void CS_DisableNameAppCmd_Test_Nominal(void)
 
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
+    UtAssert_STUB_COUNT(CS_SetEnabledMapEntry, 1);
+
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -651,18 +656,22 @@ void CS_DisableNameAppCmd_Test_UnknownNameError(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_DisableNameAppCmd_Test_OneShot(void)
+void CS_DisableNameAppCmd_Test_RecomputeInProgress(void)
 {
     CS_AppNameCmd_t CmdPacket;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
 
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_GetAppResTblEntryByName), 1, true);
+    UT_SetHandlerFunction(UT_KEY(CS_GetAppResTblEntryByName), CS_APP_CMDS_TEST_CS_GetAppResTblEntryByNameHandler1,
+                          NULL);
+    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeEntry), 1, true);
 
     /* Execute the function being tested */
     CS_DisableNameAppCmd(&CmdPacket);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(CS_CheckRecomputeEntry, 1);
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 0, "CS_AppData.HkPacket.Payload.CmdCounter == 0");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -690,7 +699,6 @@ void CS_EnableNameAppCmd_Test_Nominal(void)
     CS_AppData.DefAppTblPtr->State = 1;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, false);
     UT_SetDeferredRetcode(UT_KEY(CS_GetAppResTblEntryByName), 1, true);
     UT_SetHandlerFunction(UT_KEY(CS_GetAppResTblEntryByName), CS_APP_CMDS_TEST_CS_GetAppResTblEntryByNameHandler1,
                           NULL);
@@ -711,6 +719,8 @@ void CS_EnableNameAppCmd_Test_Nominal(void)
 
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
+    UtAssert_STUB_COUNT(CS_SetEnabledMapEntry, 1);
+
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -792,7 +802,6 @@ void CS_EnableNameAppCmd_Test_UnknownNameError(void)
     CS_AppData.ResAppTblPtr->State = CS_STATE_EMPTY;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, false);
     UT_SetDeferredRetcode(UT_KEY(CS_GetAppResTblEntryByName), 1, false);
 
     /* Execute the function being tested */
@@ -814,18 +823,22 @@ void CS_EnableNameAppCmd_Test_UnknownNameError(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_EnableNameAppCmd_Test_OneShot(void)
+void CS_EnableNameAppCmd_Test_RecomputeInProgress(void)
 {
     CS_AppNameCmd_t CmdPacket;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
 
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_GetAppResTblEntryByName), 1, true);
+    UT_SetHandlerFunction(UT_KEY(CS_GetAppResTblEntryByName), CS_APP_CMDS_TEST_CS_GetAppResTblEntryByNameHandler1,
+                          NULL);
+    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeEntry), 1, true);
 
     /* Execute the function being tested */
     CS_EnableNameAppCmd(&CmdPacket);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(CS_CheckRecomputeEntry, 1);
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 0, "CS_AppData.HkPacket.Payload.CmdCounter == 0");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -837,10 +850,12 @@ void CS_EnableNameAppCmd_Test_OneShot(void)
 void UtTest_Setup(void)
 {
     UtTest_Add(CS_DisableAppCmd_Test, CS_Test_Setup, CS_Test_TearDown, "CS_DisableAppCmd_Test");
-    UtTest_Add(CS_DisableAppCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown, "CS_DisableAppCmd_Test_OneShot");
+    UtTest_Add(CS_DisableAppCmd_Test_RecomputeInProgress, CS_Test_Setup, CS_Test_TearDown,
+               "CS_DisableAppCmd_Test_RecomputeInProgress");
 
     UtTest_Add(CS_EnableAppCmd_Test, CS_Test_Setup, CS_Test_TearDown, "CS_EnableAppCmd_Test");
-    UtTest_Add(CS_EnableAppCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown, "CS_EnableAppCmd_Test_OneShot");
+    UtTest_Add(CS_EnableAppCmd_Test_RecomputeInProgress, CS_Test_Setup, CS_Test_TearDown,
+               "CS_EnableAppCmd_Test_RecomputeInProgress");
 
     UtTest_Add(CS_ReportBaselineAppCmd_Test_Baseline, CS_Test_Setup, CS_Test_TearDown,
                "CS_ReportBaselineAppCmd_Test_Baseline");
@@ -853,8 +868,8 @@ void UtTest_Setup(void)
 
     UtTest_Add(CS_RecomputeBaselineAppCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineAppCmd_Test_Nominal");
-    UtTest_Add(CS_RecomputeBaselineAppCmd_Test_CreateChildTaskError, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeBaselineAppCmd_Test_CreateChildTaskError");
+    UtTest_Add(CS_RecomputeBaselineAppCmd_Test_JobNotQueued, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeBaselineAppCmd_Test_JobNotQueued");
     UtTest_Add(CS_RecomputeBaselineAppCmd_Test_UnknownNameError, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineAppCmd_Test_UnknownNameError");
     UtTest_Add(CS_RecomputeBaselineAppCmd_Test_RecomputeInProgress, CS_Test_Setup, CS_Test_TearDown,
@@ -865,12 +880,14 @@ void UtTest_Setup(void)
                "CS_DisableNameAppCmd_Test_UpdateAppsDefinitionTableError");
     UtTest_Add(CS_DisableNameAppCmd_Test_UnknownNameError, CS_Test_Setup, CS_Test_TearDown,
                "CS_DisableNameAppCmd_Test_UnknownNameError");
-    UtTest_Add(CS_DisableNameAppCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown, "CS_DisableNameAppCmd_Test_OneShot");
+    UtTest_Add(CS_DisableNameAppCmd_Test_RecomputeInProgress, CS_Test_Setup, CS_Test_TearDown,
+               "CS_DisableNameAppCmd_Test_RecomputeInProgress");
 
     UtTest_Add(CS_EnableNameAppCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown, "CS_EnableNameAppCmd_Test_Nominal");
     UtTest_Add(CS_EnableNameAppCmd_Test_UpdateAppsDefinitionTableError, CS_Test_Setup, CS_Test_TearDown,
                "CS_EnableNameAppCmd_Test_UpdateAppsDefinitionTableError");
     UtTest_Add(CS_EnableNameAppCmd_Test_UnknownNameError, CS_Test_Setup, CS_Test_TearDown,
                "CS_EnableNameAppCmd_Test_UnknownNameError");
-    UtTest_Add(CS_EnableNameAppCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown, "CS_EnableNameAppCmd_Test_OneShot");
+    UtTest_Add(CS_EnableNameAppCmd_Test_RecomputeInProgress, CS_Test_Setup, CS_Test_TearDown,
+               "CS_EnableNameAppCmd_Test_RecomputeInProgress");
 }
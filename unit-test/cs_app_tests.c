@@ -33,6 +33,7 @@
 #include "cs_version.h"
 #include "cs_init.h"
 #include "cs_utils.h"
+#include "cs_crc.h"
 #include "cs_test_utils.h"
 #include <unistd.h>
 #include <stdlib.h>
@@ -519,6 +520,12 @@ void CS_AppInit_Test_Nominal(void)
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
+
+    UtAssert_STUB_COUNT(CS_CrcInit, 1);
+    UtAssert_STUB_COUNT(CS_SyndromeInit, 1);
+    UtAssert_STUB_COUNT(CS_WorkerPoolInit, 1);
+    UtAssert_STUB_COUNT(CS_BudgetInit, 1);
+    UtAssert_STUB_COUNT(CS_BaselineInit, 1);
 }
 
 void CS_AppInit_Test_NominalPowerOnReset(void)
@@ -881,8 +888,6 @@ void CS_AppPipe_Test_TableUpdateErrors(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_SEND_HK_MID);
     MsgSize   = sizeof(CS_NoArgsCmd_t);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -894,6 +899,8 @@ void CS_AppPipe_Test_TableUpdateErrors(void)
     /* Verify results */
     UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
 
+    UtAssert_STUB_COUNT(CS_BaselineUpdate, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -910,8 +917,6 @@ void CS_AppPipe_Test_BackgroundCycle(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_BACKGROUND_CYCLE_MID);
     MsgSize   = sizeof(CS_NoArgsCmd_t);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -938,8 +943,6 @@ void CS_AppPipe_Test_NoopCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_NOOP_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -967,8 +970,6 @@ void CS_AppPipe_Test_ResetCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_RESET_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -996,8 +997,6 @@ void CS_AppPipe_Test_OneShotCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ONE_SHOT_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1025,8 +1024,6 @@ void CS_AppPipe_Test_CancelOneShotCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_CANCEL_ONE_SHOT_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1054,8 +1051,6 @@ void CS_AppPipe_Test_EnableAllCSCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_ALL_CS_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1083,8 +1078,6 @@ void CS_AppPipe_Test_DisableAllCSCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_ALL_CS_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1112,8 +1105,6 @@ void CS_AppPipe_Test_EnableCfeCoreCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_CFE_CORE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1141,8 +1132,6 @@ void CS_AppPipe_Test_DisableCfeCoreCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_CFE_CORE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1170,8 +1159,6 @@ void CS_AppPipe_Test_ReportBaselineCfeCoreCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_REPORT_BASELINE_CFE_CORE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1199,8 +1186,6 @@ void CS_AppPipe_Test_RecomputeBaselineCfeCoreCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_RECOMPUTE_BASELINE_CFE_CORE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1228,8 +1213,6 @@ void CS_AppPipe_Test_EnableOSCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_OS_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1257,8 +1240,6 @@ void CS_AppPipe_Test_DisableOSCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_OS_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1286,8 +1267,6 @@ void CS_AppPipe_Test_ReportBaselineOSCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_REPORT_BASELINE_OS_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1315,8 +1294,6 @@ void CS_AppPipe_Test_RecomputeBaselineOSCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_RECOMPUTE_BASELINE_OS_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1344,8 +1321,6 @@ void CS_AppPipe_Test_EnableEepromCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_EEPROM_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1373,8 +1348,6 @@ void CS_AppPipe_Test_DisableEepromCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_EEPROM_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1402,8 +1375,6 @@ void CS_AppPipe_Test_ReportBaselineEntryIDEepromCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_REPORT_BASELINE_EEPROM_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1431,8 +1402,6 @@ void CS_AppPipe_Test_RecomputeBaselineEepromCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_RECOMPUTE_BASELINE_EEPROM_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1460,8 +1429,6 @@ void CS_AppPipe_Test_EnableEntryIDEepromCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_ENTRY_EEPROM_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1489,8 +1456,6 @@ void CS_AppPipe_Test_DisableEntryIDEepromCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_ENTRY_EEPROM_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1518,8 +1483,6 @@ void CS_AppPipe_Test_GetEntryIDEepromCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_GET_ENTRY_ID_EEPROM_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1547,8 +1510,6 @@ void CS_AppPipe_Test_EnableMemoryCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_MEMORY_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1576,8 +1537,6 @@ void CS_AppPipe_Test_DisableMemoryCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_MEMORY_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1605,8 +1564,6 @@ void CS_AppPipe_Test_ReportBaselineEntryIDMemoryCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_REPORT_BASELINE_MEMORY_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1634,8 +1591,6 @@ void CS_AppPipe_Test_RecomputeBaselineMemoryCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_RECOMPUTE_BASELINE_MEMORY_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1663,8 +1618,6 @@ void CS_AppPipe_Test_EnableEntryIDMemoryCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_ENTRY_MEMORY_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1692,8 +1645,6 @@ void CS_AppPipe_Test_DisableEntryIDMemoryCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_ENTRY_MEMORY_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1721,8 +1672,6 @@ void CS_AppPipe_Test_GetEntryIDMemoryCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_GET_ENTRY_ID_MEMORY_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1750,8 +1699,6 @@ void CS_AppPipe_Test_EnableTablesCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_TABLES_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1779,8 +1726,6 @@ void CS_AppPipe_Test_DisableTablesCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_TABLES_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1808,8 +1753,6 @@ void CS_AppPipe_Test_ReportBaselineTablesCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_REPORT_BASELINE_TABLE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1837,8 +1780,6 @@ void CS_AppPipe_Test_RecomputeBaselineTablesCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_RECOMPUTE_BASELINE_TABLE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1866,8 +1807,6 @@ void CS_AppPipe_Test_EnableNameTablesCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_NAME_TABLE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1895,8 +1834,6 @@ void CS_AppPipe_Test_DisableNameTablesCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_NAME_TABLE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1924,8 +1861,6 @@ void CS_AppPipe_Test_EnableAppCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_APPS_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1953,8 +1888,6 @@ void CS_AppPipe_Test_DisableAppCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_APPS_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1982,8 +1915,6 @@ void CS_AppPipe_Test_ReportBaselineAppCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_REPORT_BASELINE_APP_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -2011,8 +1942,6 @@ void CS_AppPipe_Test_RecomputeBaselineAppCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_RECOMPUTE_BASELINE_APP_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -2040,8 +1969,6 @@ void CS_AppPipe_Test_EnableNameAppCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_NAME_APP_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -2069,8 +1996,6 @@ void CS_AppPipe_Test_DisableNameAppCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_NAME_APP_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -2089,6 +2014,33 @@ void CS_AppPipe_Test_DisableNameAppCmd(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_AppPipe_Test_RecomputeAllCmd(void)
+{
+    CFE_Status_t      Result;
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId;
+    CFE_MSG_FcnCode_t FcnCode;
+
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+
+    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    FcnCode   = CS_RECOMPUTE_ALL_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+
+    /* Execute the function being tested */
+    Result = CS_AppPipe(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
 void CS_AppPipe_Test_InvalidCCError(void)
 {
     CFE_Status_t      Result;
@@ -2103,8 +2055,6 @@ void CS_AppPipe_Test_InvalidCCError(void)
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "Invalid ground command code: ID = 0x%%08lX, CC = %%d");
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = 99;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -2142,8 +2092,6 @@ void CS_AppPipe_Test_InvalidMIDError(void)
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Invalid command pipe message ID: 0x%%08lX");
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_INVALID_MSG_ID;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -2526,6 +2474,74 @@ void CS_ProcessCmd_CancelOneShotCmd_Test(void)
     UtAssert_STUB_COUNT(CS_CancelOneShotCmd, 1);
 }
 
+void CS_ProcessCmd_SetTimeBudgetCmd_Test(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode = CS_SET_TIME_BUDGET_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_SetTimeBudgetCmd, 1);
+}
+
+void CS_ProcessCmd_SetRevisitPeriodCmd_Test(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode = CS_SET_REVISIT_PERIOD_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_SetRevisitPeriodCmd, 1);
+}
+
+void CS_ProcessCmd_SetJobRateCmd_Test(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = CS_SET_JOB_RATE_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_SetJobRateCmd, 1);
+}
+
+void CS_ProcessCmd_ManageTableCmd_Test(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = CS_MANAGE_TABLE_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_ManageTableCmd, 1);
+}
+
 void CS_ProcessCmd_DisableTablesCmd_Test(void)
 {
     UT_CmdBuf_t       CmdBuf;
@@ -3206,6 +3222,74 @@ void CS_ProcessCmd_CancelOneShotCmd_Test_VerifyError(void)
     UtAssert_STUB_COUNT(CS_CancelOneShotCmd, 0);
 }
 
+void CS_ProcessCmd_SetTimeBudgetCmd_Test_VerifyError(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode = CS_SET_TIME_BUDGET_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, false);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_SetTimeBudgetCmd, 0);
+}
+
+void CS_ProcessCmd_SetRevisitPeriodCmd_Test_VerifyError(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode = CS_SET_REVISIT_PERIOD_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, false);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_SetRevisitPeriodCmd, 0);
+}
+
+void CS_ProcessCmd_SetJobRateCmd_Test_VerifyError(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = CS_SET_JOB_RATE_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, false);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_SetJobRateCmd, 0);
+}
+
+void CS_ProcessCmd_ManageTableCmd_Test_VerifyError(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = CS_MANAGE_TABLE_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, false);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_ManageTableCmd, 0);
+}
+
 void CS_ProcessCmd_DisableTablesCmd_Test_VerifyError(void)
 {
     UT_CmdBuf_t       CmdBuf;
@@ -3790,6 +3874,7 @@ void UtTest_Setup(void)
                "CS_AppPipe_Test_RecomputeBaselineAppCmd");
     UtTest_Add(CS_AppPipe_Test_EnableNameAppCmd, CS_Test_Setup, CS_Test_TearDown, "CS_AppPipe_Test_EnableNameAppCmd");
     UtTest_Add(CS_AppPipe_Test_DisableNameAppCmd, CS_Test_Setup, CS_Test_TearDown, "CS_AppPipe_Test_DisableNameAppCmd");
+    UtTest_Add(CS_AppPipe_Test_RecomputeAllCmd, CS_Test_Setup, CS_Test_TearDown, "CS_AppPipe_Test_RecomputeAllCmd");
     UtTest_Add(CS_AppPipe_Test_InvalidCCError, CS_Test_Setup, CS_Test_TearDown, "CS_AppPipe_Test_InvalidCCError");
     UtTest_Add(CS_AppPipe_Test_InvalidMIDError, CS_Test_Setup, CS_Test_TearDown, "CS_AppPipe_Test_InvalidMIDError");
 
@@ -3828,6 +3913,14 @@ void UtTest_Setup(void)
                "CS_ProcessCmd_OneShotCmd_Test");
     UtTest_Add(CS_ProcessCmd_CancelOneShotCmd_Test, CS_Test_Setup, CS_Test_TearDown,
                "CS_ProcessCmd_CancelOneShotCmd_Test");
+    UtTest_Add(CS_ProcessCmd_SetTimeBudgetCmd_Test, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_SetTimeBudgetCmd_Test");
+    UtTest_Add(CS_ProcessCmd_SetRevisitPeriodCmd_Test, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_SetRevisitPeriodCmd_Test");
+    UtTest_Add(CS_ProcessCmd_SetJobRateCmd_Test, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_SetJobRateCmd_Test");
+    UtTest_Add(CS_ProcessCmd_ManageTableCmd_Test, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_ManageTableCmd_Test");
     UtTest_Add(CS_ProcessCmd_DisableTablesCmd_Test, CS_Test_Setup, CS_Test_TearDown,
                "CS_ProcessCmd_DisableTablesCmd_Test");
     UtTest_Add(CS_ProcessCmd_EnableTablesCmd_Test, CS_Test_Setup, CS_Test_TearDown,
@@ -3909,6 +4002,14 @@ void UtTest_Setup(void)
                "CS_ProcessCmd_OneShotCmd_Test_VerifyError");
     UtTest_Add(CS_ProcessCmd_CancelOneShotCmd_Test_VerifyError, CS_Test_Setup, CS_Test_TearDown,
                "CS_ProcessCmd_CancelOneShotCmd_Test_VerifyError");
+    UtTest_Add(CS_ProcessCmd_SetTimeBudgetCmd_Test_VerifyError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_SetTimeBudgetCmd_Test_VerifyError");
+    UtTest_Add(CS_ProcessCmd_SetRevisitPeriodCmd_Test_VerifyError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_SetRevisitPeriodCmd_Test_VerifyError");
+    UtTest_Add(CS_ProcessCmd_SetJobRateCmd_Test_VerifyError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_SetJobRateCmd_Test_VerifyError");
+    UtTest_Add(CS_ProcessCmd_ManageTableCmd_Test_VerifyError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_ManageTableCmd_Test_VerifyError");
     UtTest_Add(CS_ProcessCmd_DisableTablesCmd_Test_VerifyError, CS_Test_Setup, CS_Test_TearDown,
                "CS_ProcessCmd_DisableTablesCmd_Test_VerifyError");
     UtTest_Add(CS_ProcessCmd_EnableTablesCmd_Test_VerifyError, CS_Test_Setup, CS_Test_TearDown,
@@ -0,0 +1,466 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cs_app.h"
+#include "cs_events.h"
+#include "cs_crc.h"
+#include "cs_jobs.h"
+#include "cs_baseline.h"
+#include "cs_test_utils.h"
+#include <string.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#define UT_VALID_CDSID CFE_ES_CDSHANDLE_C(CFE_RESOURCEID_WRAP(1))
+
+/* Value every CS_CalculateCRC call returns, so every identity and the store CRC match */
+#define CS_BASELINE_TEST_CRC 0x1234
+
+/* Index of the first EEPROM record */
+#define CS_BASELINE_TEST_EEPROM_RECORD 2
+
+/* Baselines the CFE_ES_RestoreFromCDS handler copies out */
+static CS_BaselineStore_t CS_BASELINE_TEST_Store;
+
+void CS_BASELINE_TEST_CFE_ES_RestoreFromCDS_Handler(void *UserObj, UT_EntryKey_t FuncKey,
+                                                    const UT_StubContext_t *Context)
+{
+    void *RestoreToMemory = UT_Hook_GetArgValueByName(Context, "RestoreToMemory", void *);
+
+    memcpy(RestoreToMemory, &CS_BASELINE_TEST_Store, sizeof(CS_BASELINE_TEST_Store));
+}
+
+void CS_BASELINE_TEST_SetupStore(void)
+{
+    memset(&CS_BASELINE_TEST_Store, 0, sizeof(CS_BASELINE_TEST_Store));
+
+    CS_BASELINE_TEST_Store.Version    = CS_BASELINE_VERSION;
+    CS_BASELINE_TEST_Store.NumRecords = CS_BASELINE_NUM_RECORDS;
+    CS_BASELINE_TEST_Store.Crc        = CS_BASELINE_TEST_CRC;
+    CS_BASELINE_TEST_Store.Records[CS_BASELINE_TEST_EEPROM_RECORD].ComputedYet = true;
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_CalculateCRC), CS_BASELINE_TEST_CRC);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RegisterCDS), 1, CFE_ES_CDS_ALREADY_EXISTS);
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_RestoreFromCDS), CS_BASELINE_TEST_CFE_ES_RestoreFromCDS_Handler, NULL);
+}
+
+void CS_BaselineInit_Test_New(void)
+{
+    CS_AppData.Baseline.SaveCount = 3;
+
+    /* Execute the function being tested */
+    CS_BaselineInit();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_RegisterCDS, 1);
+    UtAssert_STUB_COUNT(CFE_ES_RestoreFromCDS, 0);
+    UtAssert_BOOL_FALSE(CS_AppData.Baseline.Restored);
+    UtAssert_UINT32_EQ(CS_AppData.Baseline.SaveCount, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_BaselineInit_Test_Restore(void)
+{
+    CS_BASELINE_TEST_SetupStore();
+
+    /* Execute the function being tested */
+    CS_BaselineInit();
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(CS_AppData.Baseline.Restored);
+    UtAssert_UINT32_EQ(CS_AppData.Baseline.Store.Records[CS_BASELINE_TEST_EEPROM_RECORD].ComputedYet, true);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_BaselineInit_Test_WrongVersion(void)
+{
+    CS_BASELINE_TEST_SetupStore();
+    CS_BASELINE_TEST_Store.Version = CS_BASELINE_VERSION + 1;
+
+    /* Execute the function being tested */
+    CS_BaselineInit();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(CS_AppData.Baseline.Restored);
+    UtAssert_UINT32_EQ(CS_AppData.Baseline.Store.Records[CS_BASELINE_TEST_EEPROM_RECORD].ComputedYet, false);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_BASELINE_CDS_INVALID_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void CS_BaselineInit_Test_WrongNumRecords(void)
+{
+    CS_BASELINE_TEST_SetupStore();
+    CS_BASELINE_TEST_Store.NumRecords = CS_BASELINE_NUM_RECORDS - 1;
+
+    /* Execute the function being tested */
+    CS_BaselineInit();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(CS_AppData.Baseline.Restored);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_BASELINE_CDS_INVALID_INF_EID);
+}
+
+void CS_BaselineInit_Test_WrongCrc(void)
+{
+    CS_BASELINE_TEST_SetupStore();
+    CS_BASELINE_TEST_Store.Crc = CS_BASELINE_TEST_CRC + 1;
+
+    /* Execute the function being tested */
+    CS_BaselineInit();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(CS_AppData.Baseline.Restored);
+    UtAssert_UINT32_EQ(CS_AppData.Baseline.Store.Records[CS_BASELINE_TEST_EEPROM_RECORD].ComputedYet, false);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_BASELINE_CDS_INVALID_INF_EID);
+}
+
+void CS_BaselineInit_Test_RestoreError(void)
+{
+    CS_BASELINE_TEST_SetupStore();
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RestoreFromCDS), 1, -1);
+
+    /* Execute the function being tested */
+    CS_BaselineInit();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(CS_AppData.Baseline.Restored);
+    UtAssert_UINT32_EQ(CS_AppData.Baseline.Store.Records[CS_BASELINE_TEST_EEPROM_RECORD].ComputedYet, false);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_BASELINE_CDS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_BaselineInit_Test_RegisterError(void)
+{
+    CS_AppData.Baseline.DataStoreHandle = UT_VALID_CDSID;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RegisterCDS), 1, -1);
+
+    /* Execute the function being tested */
+    CS_BaselineInit();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(CS_AppData.Baseline.DataStoreHandle));
+    UtAssert_BOOL_FALSE(CS_AppData.Baseline.Restored);
+    UtAssert_STUB_COUNT(CFE_ES_RestoreFromCDS, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_BASELINE_CDS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_BaselineRestore_Test_Eeprom(void)
+{
+    CS_BaselineRecord_t *Records = &CS_AppData.Baseline.Store.Records[CS_BASELINE_TEST_EEPROM_RECORD];
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_CalculateCRC), CS_BASELINE_TEST_CRC);
+    CS_AppData.Baseline.Restored = true;
+
+    /* Entry 0 is empty, entry 1 matches its record and entry 2 now covers different memory */
+    CS_AppData.ResEepromTblPtr[1].State              = CS_STATE_ENABLED;
+    CS_AppData.ResEepromTblPtr[1].NumBytesToChecksum = 1000;
+    CS_AppData.ResEepromTblPtr[2].State              = CS_STATE_ENABLED;
+
+    Records[0].Identity    = CS_BASELINE_TEST_CRC;
+    Records[0].ComputedYet = true;
+
+    Records[1].Identity                  = CS_BASELINE_TEST_CRC;
+    Records[1].ComputedYet               = true;
+    Records[1].ComparisonValue           = 0x11223344;
+    Records[1].ComparisonDigest.Bytes[0] = 0x11;
+    Records[1].ByteOffset                = 100;
+    Records[1].TempChecksumContext.Crc   = 0x55;
+
+    Records[2].Identity    = CS_BASELINE_TEST_CRC + 1;
+    Records[2].ComputedYet = true;
+
+    /* Execute the function being tested */
+    CS_BaselineRestore(CS_EEPROM_TABLE);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.ResEepromTblPtr[0].ComputedYet, false);
+
+    UtAssert_UINT32_EQ(CS_AppData.ResEepromTblPtr[1].ComputedYet, true);
+    UtAssert_UINT32_EQ(CS_AppData.ResEepromTblPtr[1].ComparisonValue, 0x11223344);
+    UtAssert_UINT32_EQ(CS_AppData.ResEepromTblPtr[1].ComparisonDigest.Bytes[0], 0x11);
+    UtAssert_UINT32_EQ(CS_AppData.ResEepromTblPtr[1].ByteOffset, 100);
+    UtAssert_UINT32_EQ(CS_AppData.ResEepromTblPtr[1].TempChecksumContext.Crc, 0x55);
+
+    UtAssert_UINT32_EQ(CS_AppData.ResEepromTblPtr[2].ComputedYet, false);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_BASELINE_RESTORE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void CS_BaselineRestore_Test_ExpectedValue(void)
+{
+    CS_BaselineRecord_t *Record = &CS_AppData.Baseline.Store.Records[CS_BASELINE_TEST_EEPROM_RECORD];
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_CalculateCRC), CS_BASELINE_TEST_CRC);
+    CS_AppData.Baseline.Restored = true;
+
+    /* The definition table gives entry 0 its baseline */
+    CS_AppData.DefEepromTblPtr[0].HasExpectedValue   = true;
+    CS_AppData.ResEepromTblPtr[0].State              = CS_STATE_ENABLED;
+    CS_AppData.ResEepromTblPtr[0].NumBytesToChecksum = 1000;
+    CS_AppData.ResEepromTblPtr[0].ComputedYet        = true;
+    CS_AppData.ResEepromTblPtr[0].ComparisonValue    = 0xAABBCCDD;
+
+    Record->Identity        = CS_BASELINE_TEST_CRC;
+    Record->ComputedYet     = true;
+    Record->ComparisonValue = 0x11223344;
+    Record->ByteOffset      = 100;
+
+    /* Execute the function being tested */
+    CS_BaselineRestore(CS_EEPROM_TABLE);
+
+    /* Verify results: the expected value stays, the unfinished checksum is restored */
+    UtAssert_UINT32_EQ(CS_AppData.ResEepromTblPtr[0].ComputedYet, true);
+    UtAssert_UINT32_EQ(CS_AppData.ResEepromTblPtr[0].ComparisonValue, 0xAABBCCDD);
+    UtAssert_UINT32_EQ(CS_AppData.ResEepromTblPtr[0].ByteOffset, 100);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_BASELINE_RESTORE_INF_EID);
+}
+
+void CS_BaselineRestore_Test_BlockTree(void)
+{
+    CS_BaselineRecord_t *Record =
+        &CS_AppData.Baseline.Store.Records[CS_BASELINE_TEST_EEPROM_RECORD + CS_MAX_NUM_EEPROM_TABLE_ENTRIES];
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_CalculateCRC), CS_BASELINE_TEST_CRC);
+    CS_AppData.Baseline.Restored = true;
+
+    CS_AppData.ResMemoryTblPtr[0].State              = CS_STATE_ENABLED;
+    CS_AppData.ResMemoryTblPtr[0].NumBytesToChecksum = 1000;
+    CS_AppData.ResMemoryTblPtr[0].BlockTree          = 1;
+
+    Record->Identity        = CS_BASELINE_TEST_CRC;
+    Record->ComputedYet     = true;
+    Record->ComparisonValue = 0x11223344;
+    Record->ByteOffset      = 100;
+
+    /* Execute the function being tested */
+    CS_BaselineRestore(CS_MEMORY_TABLE);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.ResMemoryTblPtr[0].ComputedYet, true);
+    UtAssert_UINT32_EQ(CS_AppData.ResMemoryTblPtr[0].ComparisonValue, 0x11223344);
+    UtAssert_UINT32_EQ(CS_AppData.ResMemoryTblPtr[0].ByteOffset, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_BASELINE_RESTORE_INF_EID);
+}
+
+void CS_BaselineRestore_Test_InProgress(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(CS_CalculateCRC), CS_BASELINE_TEST_CRC);
+    CS_AppData.Baseline.Restored = true;
+
+    CS_AppData.CfeCoreCodeSeg.State              = CS_STATE_ENABLED;
+    CS_AppData.CfeCoreCodeSeg.NumBytesToChecksum = 1000;
+
+    CS_AppData.Baseline.Store.Records[0].Identity   = CS_BASELINE_TEST_CRC;
+    CS_AppData.Baseline.Store.Records[0].ByteOffset = 200;
+
+    /* An offset past the end of the OS code segment is not restored */
+    CS_AppData.OSCodeSeg.State                      = CS_STATE_ENABLED;
+    CS_AppData.OSCodeSeg.NumBytesToChecksum         = 1000;
+    CS_AppData.Baseline.Store.Records[1].Identity   = CS_BASELINE_TEST_CRC;
+    CS_AppData.Baseline.Store.Records[1].ByteOffset = 1000;
+
+    /* Execute the function being tested */
+    CS_BaselineRestore(CS_CFECORE);
+    CS_BaselineRestore(CS_OSCORE);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.CfeCoreCodeSeg.ComputedYet, false);
+    UtAssert_UINT32_EQ(CS_AppData.CfeCoreCodeSeg.ByteOffset, 200);
+    UtAssert_UINT32_EQ(CS_AppData.OSCodeSeg.ByteOffset, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_BASELINE_RESTORE_INF_EID);
+}
+
+void CS_BaselineRestore_Test_NotRestored(void)
+{
+    CS_AppData.CfeCoreCodeSeg.State                  = CS_STATE_ENABLED;
+    CS_AppData.Baseline.Store.Records[0].ComputedYet = true;
+
+    /* Execute the function being tested */
+    CS_BaselineRestore(CS_CFECORE);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.CfeCoreCodeSeg.ComputedYet, false);
+    UtAssert_STUB_COUNT(CS_CalculateCRC, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_BaselineRestore_Test_NoResults(void)
+{
+    CS_AppData.Baseline.Restored = true;
+    CS_AppData.ResMemoryTblPtr   = NULL;
+
+    /* Execute the function being tested */
+    CS_BaselineRestore(CS_MEMORY_TABLE);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_CalculateCRC, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_BaselineSave_Test_Nominal(void)
+{
+    CS_BaselineRecord_t *Record = &CS_AppData.Baseline.Store.Records[CS_BASELINE_TEST_EEPROM_RECORD + 1];
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_CalculateCRC), CS_BASELINE_TEST_CRC);
+    CS_AppData.Baseline.DataStoreHandle = UT_VALID_CDSID;
+
+    CS_AppData.ResEepromTblPtr[1].ComputedYet               = true;
+    CS_AppData.ResEepromTblPtr[1].ComparisonValue           = 0x11223344;
+    CS_AppData.ResEepromTblPtr[1].ComparisonDigest.Bytes[0] = 0x11;
+    CS_AppData.ResEepromTblPtr[1].ByteOffset                = 100;
+    CS_AppData.ResEepromTblPtr[1].TempChecksumContext.Crc   = 0x55;
+
+    /* Execute the function being tested */
+    CS_BaselineSave();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Record->Identity, CS_BASELINE_TEST_CRC);
+    UtAssert_UINT32_EQ(Record->ComputedYet, true);
+    UtAssert_UINT32_EQ(Record->ComparisonValue, 0x11223344);
+    UtAssert_UINT32_EQ(Record->ComparisonDigest.Bytes[0], 0x11);
+    UtAssert_UINT32_EQ(Record->ByteOffset, 100);
+    UtAssert_UINT32_EQ(Record->TempChecksumContext.Crc, 0x55);
+
+    UtAssert_UINT32_EQ(CS_AppData.Baseline.Store.Version, CS_BASELINE_VERSION);
+    UtAssert_UINT32_EQ(CS_AppData.Baseline.Store.NumRecords, CS_BASELINE_NUM_RECORDS);
+    UtAssert_UINT32_EQ(CS_AppData.Baseline.Store.Crc, CS_BASELINE_TEST_CRC);
+
+    UtAssert_STUB_COUNT(CS_JobsEntryBusy, CS_BASELINE_NUM_RECORDS);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_BaselineSave_Test_Busy(void)
+{
+    CS_BaselineRecord_t *Record = &CS_AppData.Baseline.Store.Records[CS_BASELINE_TEST_EEPROM_RECORD];
+
+    CS_AppData.Baseline.DataStoreHandle = UT_VALID_CDSID;
+
+    Record->ComputedYet                       = true;
+    CS_AppData.ResEepromTblPtr[0].ComputedYet = false;
+    CS_AppData.ResEepromTblPtr[1].ComputedYet = true;
+
+    /* The first EEPROM entry, after the two code segments, is owned by a recompute */
+    UT_SetDeferredRetcode(UT_KEY(CS_JobsEntryBusy), 3, true);
+
+    /* Execute the function being tested */
+    CS_BaselineSave();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Record[0].ComputedYet, true);
+    UtAssert_UINT32_EQ(Record[1].ComputedYet, true);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+}
+
+void CS_BaselineSave_Test_CopyError(void)
+{
+    CS_AppData.Baseline.DataStoreHandle = UT_VALID_CDSID;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CopyToCDS), 1, -1);
+
+    /* Execute the function being tested */
+    CS_BaselineSave();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(CS_AppData.Baseline.DataStoreHandle));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_BASELINE_CDS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_BaselineSave_Test_NoHandle(void)
+{
+    /* Execute the function being tested */
+    CS_BaselineSave();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_JobsEntryBusy, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+}
+
+void CS_BaselineUpdate_Test(void)
+{
+    uint32 i;
+
+    CS_AppData.Baseline.DataStoreHandle = UT_VALID_CDSID;
+
+    /* Execute the function being tested */
+    for (i = 1; i < CS_BASELINE_SAVE_PERIOD; i++)
+    {
+        CS_BaselineUpdate();
+    }
+
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+
+    CS_BaselineUpdate();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    UtAssert_UINT32_EQ(CS_AppData.Baseline.SaveCount, 0);
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(CS_BaselineInit_Test_New, CS_Test_Setup, CS_Test_TearDown, "CS_BaselineInit_Test_New");
+    UtTest_Add(CS_BaselineInit_Test_Restore, CS_Test_Setup, CS_Test_TearDown, "CS_BaselineInit_Test_Restore");
+    UtTest_Add(CS_BaselineInit_Test_WrongVersion, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BaselineInit_Test_WrongVersion");
+    UtTest_Add(CS_BaselineInit_Test_WrongNumRecords, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BaselineInit_Test_WrongNumRecords");
+    UtTest_Add(CS_BaselineInit_Test_WrongCrc, CS_Test_Setup, CS_Test_TearDown, "CS_BaselineInit_Test_WrongCrc");
+    UtTest_Add(CS_BaselineInit_Test_RestoreError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BaselineInit_Test_RestoreError");
+    UtTest_Add(CS_BaselineInit_Test_RegisterError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BaselineInit_Test_RegisterError");
+    UtTest_Add(CS_BaselineRestore_Test_Eeprom, CS_Test_Setup, CS_Test_TearDown, "CS_BaselineRestore_Test_Eeprom");
+    UtTest_Add(CS_BaselineRestore_Test_ExpectedValue, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BaselineRestore_Test_ExpectedValue");
+    UtTest_Add(CS_BaselineRestore_Test_BlockTree, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BaselineRestore_Test_BlockTree");
+    UtTest_Add(CS_BaselineRestore_Test_InProgress, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BaselineRestore_Test_InProgress");
+    UtTest_Add(CS_BaselineRestore_Test_NotRestored, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BaselineRestore_Test_NotRestored");
+    UtTest_Add(CS_BaselineRestore_Test_NoResults, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BaselineRestore_Test_NoResults");
+    UtTest_Add(CS_BaselineSave_Test_Nominal, CS_Test_Setup, CS_Test_TearDown, "CS_BaselineSave_Test_Nominal");
+    UtTest_Add(CS_BaselineSave_Test_Busy, CS_Test_Setup, CS_Test_TearDown, "CS_BaselineSave_Test_Busy");
+    UtTest_Add(CS_BaselineSave_Test_CopyError, CS_Test_Setup, CS_Test_TearDown, "CS_BaselineSave_Test_CopyError");
+    UtTest_Add(CS_BaselineSave_Test_NoHandle, CS_Test_Setup, CS_Test_TearDown, "CS_BaselineSave_Test_NoHandle");
+    UtTest_Add(CS_BaselineUpdate_Test, CS_Test_Setup, CS_Test_TearDown, "CS_BaselineUpdate_Test");
+}
@@ -0,0 +1,837 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cs_app.h"
+#include "cs_events.h"
+#include "cs_crc.h"
+#include "cs_algorithm.h"
+#include "cs_block.h"
+#include "cs_test_utils.h"
+#include <string.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* Four leaves, the last one short */
+#define CS_BLOCK_TEST_NUM_BYTES  (3 * CS_BLOCK_TREE_LEAF_SIZE + 100)
+#define CS_BLOCK_TEST_NUM_LEAVES 4
+#define CS_BLOCK_TEST_NUM_NODES  11
+
+static CS_Res_Block_Table_t CS_BLOCK_TEST_Table;
+static CS_Algorithm_t       CS_BLOCK_TEST_Algorithm;
+
+/* One registry entry for each CS_GetAlgorithm call a test makes */
+static const CS_Algorithm_t *CS_BLOCK_TEST_AlgorithmPtrs[8];
+
+void CS_BLOCK_TEST_CFE_TBL_GetAddressHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void **TblPtr = UT_Hook_GetArgValueByName(Context, "TblPtr", void **);
+
+    *TblPtr = UserObj;
+}
+
+void CS_BLOCK_TEST_SetupAlgorithm(CFE_ES_CrcType_Enum_t TypeCRC)
+{
+    uint32 i;
+
+    memset(&CS_BLOCK_TEST_Algorithm, 0, sizeof(CS_BLOCK_TEST_Algorithm));
+    CS_BLOCK_TEST_Algorithm.TypeCRC = TypeCRC;
+
+    for (i = 0; i < sizeof(CS_BLOCK_TEST_AlgorithmPtrs) / sizeof(CS_BLOCK_TEST_AlgorithmPtrs[0]); i++)
+    {
+        CS_BLOCK_TEST_AlgorithmPtrs[i] = &CS_BLOCK_TEST_Algorithm;
+    }
+
+    UT_SetDataBuffer(UT_KEY(CS_GetAlgorithm), CS_BLOCK_TEST_AlgorithmPtrs, sizeof(CS_BLOCK_TEST_AlgorithmPtrs), false);
+}
+
+/* Sets up EEPROM entry 0 with tree 1 covering the test memory */
+void CS_BLOCK_TEST_SetupTree(CS_Res_EepromMemory_Table_Entry_t *ResultsEntry)
+{
+    CS_Res_BlockTree_t   *Tree      = &CS_BLOCK_TEST_Table.Trees[0];
+
+    memset(&CS_BLOCK_TEST_Table, 0, sizeof(CS_BLOCK_TEST_Table));
+    CS_AppData.ResBlockTblPtr = &CS_BLOCK_TEST_Table;
+
+    memset(ResultsEntry, 0, sizeof(*ResultsEntry));
+    ResultsEntry->State              = CS_STATE_ENABLED;
+    ResultsEntry->StartAddress       = 0x10000;
+    ResultsEntry->NumBytesToChecksum = CS_BLOCK_TEST_NUM_BYTES;
+    ResultsEntry->Algorithm          = CS_ALGORITHM_CRC_32;
+    ResultsEntry->BlockTree          = 1;
+
+    Tree->State     = CS_STATE_ENABLED;
+    Tree->Table     = CS_EEPROM_TABLE;
+    Tree->EntryID   = 0;
+    Tree->TypeCRC   = CFE_ES_CrcType_CRC_32;
+    Tree->NumLeaves = CS_BLOCK_TEST_NUM_LEAVES;
+    Tree->NumNodes  = CS_BLOCK_TEST_NUM_NODES;
+    Tree->FirstNode = 5;
+
+    CS_BLOCK_TEST_SetupAlgorithm(CFE_ES_CrcType_CRC_32);
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_CalculateCRC), 0x11);
+}
+
+void CS_BlockTreeInit_Test_Nominal(void)
+{
+    memset(&CS_BLOCK_TEST_Table, 0xFF, sizeof(CS_BLOCK_TEST_Table));
+    UT_SetHandlerFunction(UT_KEY(CFE_TBL_GetAddress), CS_BLOCK_TEST_CFE_TBL_GetAddressHandler, &CS_BLOCK_TEST_Table);
+
+    /* Execute the function being tested */
+    CS_BlockTreeInit();
+
+    /* Verify results */
+    UtAssert_ADDRESS_EQ(CS_AppData.ResBlockTblPtr, &CS_BLOCK_TEST_Table);
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Trees[0].State, CS_STATE_EMPTY);
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Nodes[CS_MAX_NUM_BLOCK_NODES - 1], 0);
+
+    UtAssert_STUB_COUNT(CFE_TBL_Register, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_NotifyByMessage, 1);
+    UtAssert_UINT32_EQ(CS_AppData.TableNotified, CS_TABLE_BIT(CS_BLOCK_TABLE));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_BlockTreeInit_Test_NotifyError(void)
+{
+    CS_AppData.TableNotified = CS_TABLE_BIT(CS_BLOCK_TABLE);
+    UT_SetHandlerFunction(UT_KEY(CFE_TBL_GetAddress), CS_BLOCK_TEST_CFE_TBL_GetAddressHandler, &CS_BLOCK_TEST_Table);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_NotifyByMessage), 1, -1);
+
+    /* Execute the function being tested */
+    CS_BlockTreeInit();
+
+    /* Verify results */
+    UtAssert_ADDRESS_EQ(CS_AppData.ResBlockTblPtr, &CS_BLOCK_TEST_Table);
+    UtAssert_UINT32_EQ(CS_AppData.TableNotified, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_BlockTreeInit_Test_RegisterError(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Table initialization failed for block trees: 0x%%08X");
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 1, -1);
+
+    /* Execute the function being tested */
+    CS_BlockTreeInit();
+
+    /* Verify results */
+    UtAssert_NULL(CS_AppData.ResBlockTblPtr);
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_INIT_BLOCK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_BlockTreeInit_Test_GetAddressError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_ERR_NEVER_LOADED);
+
+    /* Execute the function being tested */
+    CS_BlockTreeInit();
+
+    /* Verify results */
+    UtAssert_NULL(CS_AppData.ResBlockTblPtr);
+    UtAssert_STUB_COUNT(CFE_TBL_NotifyByMessage, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_INIT_BLOCK_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_BlockTreeManage_Test_Nominal(void)
+{
+    CS_AppData.ResBlockTblPtr      = &CS_BLOCK_TEST_Table;
+    CS_AppData.ResBlockTableHandle = 7;
+    UT_SetHandlerFunction(UT_KEY(CFE_TBL_GetAddress), CS_BLOCK_TEST_CFE_TBL_GetAddressHandler, &CS_BLOCK_TEST_Table);
+
+    /* Execute the function being tested */
+    CS_BlockTreeManage();
+
+    /* Verify results: the table is managed so a pending dump is done */
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 1);
+    UtAssert_ADDRESS_EQ(CS_AppData.ResBlockTblPtr, &CS_BLOCK_TEST_Table);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_BlockTreeManage_Test_GetAddressError(void)
+{
+    CS_AppData.ResBlockTblPtr = &CS_BLOCK_TEST_Table;
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_ERR_NEVER_LOADED);
+
+    /* Execute the function being tested */
+    CS_BlockTreeManage();
+
+    /* Verify results */
+    UtAssert_NULL(CS_AppData.ResBlockTblPtr);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_UPDATE_BLOCK_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_BlockTreeManage_Test_NoTable(void)
+{
+    CS_AppData.ResBlockTblPtr = NULL;
+
+    /* Execute the function being tested */
+    CS_BlockTreeManage();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_BlockTreeNumNodes_Test(void)
+{
+    /* The current leaves, then every level of the baseline tree */
+    UtAssert_UINT32_EQ(CS_BlockTreeNumNodes(0), 0);
+    UtAssert_UINT32_EQ(CS_BlockTreeNumNodes(1), 2);
+    UtAssert_UINT32_EQ(CS_BlockTreeNumNodes(2), 5);
+    UtAssert_UINT32_EQ(CS_BlockTreeNumNodes(4), CS_BLOCK_TEST_NUM_NODES);
+    UtAssert_UINT32_EQ(CS_BlockTreeNumNodes(5), 16);
+}
+
+void CS_BlockTreeAllocate_Test_Nominal(void)
+{
+    CS_Def_EepromMemory_Table_Entry_t DefTable[4];
+    CS_Res_EepromMemory_Table_Entry_t ResTable[4];
+
+    memset(DefTable, 0, sizeof(DefTable));
+    memset(ResTable, 0, sizeof(ResTable));
+    memset(&CS_BLOCK_TEST_Table, 0, sizeof(CS_BLOCK_TEST_Table));
+    CS_AppData.ResBlockTblPtr = &CS_BLOCK_TEST_Table;
+
+    /* Non-CRC algorithms get CRC-32 leaves */
+    CS_BLOCK_TEST_SetupAlgorithm(CFE_ES_CrcType_NONE);
+
+    DefTable[0].State              = CS_STATE_ENABLED;
+    DefTable[0].NumBytesToChecksum = CS_BLOCK_TEST_NUM_BYTES;
+    DefTable[0].BlockTree          = true;
+
+    DefTable[1].State              = CS_STATE_ENABLED;
+    DefTable[1].NumBytesToChecksum = CS_BLOCK_TEST_NUM_BYTES;
+    DefTable[1].BlockTree          = false;
+    ResTable[1].BlockTree          = 5;
+
+    DefTable[2].State              = CS_STATE_EMPTY;
+    DefTable[2].NumBytesToChecksum = CS_BLOCK_TEST_NUM_BYTES;
+    DefTable[2].BlockTree          = true;
+
+    DefTable[3].State              = CS_STATE_DISABLED;
+    DefTable[3].NumBytesToChecksum = CS_BLOCK_TREE_LEAF_SIZE;
+    DefTable[3].BlockTree          = true;
+
+    /* Execute the function being tested */
+    CS_BlockTreeAllocate(CS_EEPROM_TABLE, DefTable, ResTable, 4);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(ResTable[0].BlockTree, 1);
+    UtAssert_UINT32_EQ(ResTable[1].BlockTree, 0);
+    UtAssert_UINT32_EQ(ResTable[2].BlockTree, 0);
+    UtAssert_UINT32_EQ(ResTable[3].BlockTree, 2);
+
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Trees[0].State, CS_STATE_ENABLED);
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Trees[0].Table, CS_EEPROM_TABLE);
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Trees[0].EntryID, 0);
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Trees[0].TypeCRC, CFE_ES_CrcType_CRC_32);
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Trees[0].NumLeaves, CS_BLOCK_TEST_NUM_LEAVES);
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Trees[0].NumNodes, CS_BLOCK_TEST_NUM_NODES);
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Trees[0].FirstNode, 0);
+    UtAssert_BOOL_FALSE(CS_BLOCK_TEST_Table.Trees[0].ComputedYet);
+
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Trees[1].EntryID, 3);
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Trees[1].NumLeaves, 1);
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Trees[1].NumNodes, 2);
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Trees[1].FirstNode, CS_BLOCK_TEST_NUM_NODES);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_BlockTreeAllocate_Test_ReplacesTable(void)
+{
+    CS_Def_EepromMemory_Table_Entry_t DefTable[1];
+    CS_Res_EepromMemory_Table_Entry_t ResTable[1];
+
+    memset(DefTable, 0, sizeof(DefTable));
+    memset(ResTable, 0, sizeof(ResTable));
+    memset(&CS_BLOCK_TEST_Table, 0, sizeof(CS_BLOCK_TEST_Table));
+    CS_AppData.ResBlockTblPtr = &CS_BLOCK_TEST_Table;
+
+    CS_BLOCK_TEST_SetupAlgorithm(CFE_ES_CrcType_CRC_16);
+
+    /* The old EEPROM tree goes, the Memory tree stays where it is */
+    CS_BLOCK_TEST_Table.Trees[0].State     = CS_STATE_ENABLED;
+    CS_BLOCK_TEST_Table.Trees[0].Table     = CS_EEPROM_TABLE;
+    CS_BLOCK_TEST_Table.Trees[0].FirstNode = 0;
+    CS_BLOCK_TEST_Table.Trees[0].NumNodes  = 100;
+    CS_BLOCK_TEST_Table.Trees[1].State     = CS_STATE_ENABLED;
+    CS_BLOCK_TEST_Table.Trees[1].Table     = CS_MEMORY_TABLE;
+    CS_BLOCK_TEST_Table.Trees[1].FirstNode = 0;
+    CS_BLOCK_TEST_Table.Trees[1].NumNodes  = 20;
+
+    DefTable[0].State              = CS_STATE_ENABLED;
+    DefTable[0].NumBytesToChecksum = CS_BLOCK_TEST_NUM_BYTES;
+    DefTable[0].BlockTree          = true;
+
+    /* Execute the function being tested */
+    CS_BlockTreeAllocate(CS_EEPROM_TABLE, DefTable, ResTable, 1);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(ResTable[0].BlockTree, 1);
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Trees[0].FirstNode, 20);
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Trees[0].NumNodes, CS_BLOCK_TEST_NUM_NODES);
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Trees[0].TypeCRC, CFE_ES_CrcType_CRC_16);
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Trees[1].State, CS_STATE_ENABLED);
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Trees[1].Table, CS_MEMORY_TABLE);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_BlockTreeAllocate_Test_NoTrees(void)
+{
+    CS_Def_EepromMemory_Table_Entry_t DefTable[1];
+    CS_Res_EepromMemory_Table_Entry_t ResTable[1];
+    uint16                            Loop;
+    int32                             strCmpResult;
+    char                              ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "%%s entry %%d: No room for a block tree of %%u nodes");
+
+    memset(DefTable, 0, sizeof(DefTable));
+    memset(ResTable, 0, sizeof(ResTable));
+    memset(&CS_BLOCK_TEST_Table, 0, sizeof(CS_BLOCK_TEST_Table));
+    CS_AppData.ResBlockTblPtr = &CS_BLOCK_TEST_Table;
+
+    for (Loop = 0; Loop < CS_MAX_NUM_BLOCK_TREES; Loop++)
+    {
+        CS_BLOCK_TEST_Table.Trees[Loop].State = CS_STATE_ENABLED;
+        CS_BLOCK_TEST_Table.Trees[Loop].Table = CS_MEMORY_TABLE;
+    }
+
+    DefTable[0].State              = CS_STATE_ENABLED;
+    DefTable[0].NumBytesToChecksum = CS_BLOCK_TEST_NUM_BYTES;
+    DefTable[0].BlockTree          = true;
+
+    /* Execute the function being tested */
+    CS_BlockTreeAllocate(CS_EEPROM_TABLE, DefTable, ResTable, 1);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(ResTable[0].BlockTree, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_BLOCK_TREE_ALLOC_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_BlockTreeAllocate_Test_NoNodes(void)
+{
+    CS_Def_EepromMemory_Table_Entry_t DefTable[2];
+    CS_Res_EepromMemory_Table_Entry_t ResTable[2];
+    uint32                            NumLeaves = 1;
+
+    memset(DefTable, 0, sizeof(DefTable));
+    memset(ResTable, 0, sizeof(ResTable));
+    memset(&CS_BLOCK_TEST_Table, 0, sizeof(CS_BLOCK_TEST_Table));
+    CS_AppData.ResBlockTblPtr = &CS_BLOCK_TEST_Table;
+
+    CS_BLOCK_TEST_SetupAlgorithm(CFE_ES_CrcType_CRC_32);
+
+    /* The first tree takes as many nodes as a tree can, leaving too few for the second */
+    while (CS_BlockTreeNumNodes(NumLeaves + 1) <= CS_MAX_NUM_BLOCK_NODES)
+    {
+        NumLeaves++;
+    }
+
+    DefTable[0].State              = CS_STATE_ENABLED;
+    DefTable[0].NumBytesToChecksum = NumLeaves * CS_BLOCK_TREE_LEAF_SIZE;
+    DefTable[0].BlockTree          = true;
+    DefTable[1].State              = CS_STATE_ENABLED;
+    DefTable[1].NumBytesToChecksum = 8 * CS_BLOCK_TREE_LEAF_SIZE;
+    DefTable[1].BlockTree          = true;
+
+    /* Execute the function being tested */
+    CS_BlockTreeAllocate(CS_MEMORY_TABLE, DefTable, ResTable, 2);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(ResTable[0].BlockTree, 1);
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Trees[0].NumLeaves, NumLeaves);
+    UtAssert_UINT32_EQ(ResTable[1].BlockTree, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_BLOCK_TREE_ALLOC_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_BlockTreeAllocate_Test_NoTable(void)
+{
+    CS_Def_EepromMemory_Table_Entry_t DefTable[1];
+    CS_Res_EepromMemory_Table_Entry_t ResTable[1];
+
+    memset(DefTable, 0, sizeof(DefTable));
+    memset(ResTable, 0, sizeof(ResTable));
+
+    DefTable[0].State              = CS_STATE_ENABLED;
+    DefTable[0].NumBytesToChecksum = CS_BLOCK_TEST_NUM_BYTES;
+    DefTable[0].BlockTree          = true;
+    ResTable[0].BlockTree          = 1;
+
+    /* Execute the function being tested */
+    CS_BlockTreeAllocate(CS_EEPROM_TABLE, DefTable, ResTable, 1);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(ResTable[0].BlockTree, 0);
+    UtAssert_STUB_COUNT(CS_GetAlgorithm, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_BlockTreeUpdate_Test_Baseline(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    CS_Res_BlockTree_t *              Tree  = &CS_BLOCK_TEST_Table.Trees[0];
+    uint32 *                          Nodes = &CS_BLOCK_TEST_Table.Nodes[5];
+    uint32                            Node;
+
+    CS_BLOCK_TEST_SetupTree(&ResultsEntry);
+
+    /* Execute the function being tested, splitting the second leaf across two cycles */
+    CS_BlockTreeUpdate(&ResultsEntry, 0, CS_BLOCK_TREE_LEAF_SIZE + 10);
+
+    UtAssert_UINT32_EQ(Tree->ByteOffset, CS_BLOCK_TREE_LEAF_SIZE + 10);
+    UtAssert_UINT32_EQ(Tree->LeafCrc, 0x11);
+    UtAssert_BOOL_FALSE(Tree->CurrentValid);
+    UtAssert_STUB_COUNT(CS_CalculateCRC, 2);
+
+    CS_BlockTreeUpdate(&ResultsEntry, CS_BLOCK_TREE_LEAF_SIZE + 10,
+                       CS_BLOCK_TEST_NUM_BYTES - (CS_BLOCK_TREE_LEAF_SIZE + 10));
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(Tree->ComputedYet);
+    UtAssert_BOOL_TRUE(Tree->CurrentValid);
+    UtAssert_UINT32_EQ(Tree->FailedLeaves, 0);
+    UtAssert_UINT32_EQ(Tree->ByteOffset, CS_BLOCK_TEST_NUM_BYTES);
+
+    /* The rest of the four leaves, then two parents and the root */
+    UtAssert_STUB_COUNT(CS_CalculateCRC, 8);
+
+    for (Node = 0; Node < CS_BLOCK_TEST_NUM_NODES; Node++)
+    {
+        UtAssert_UINT32_EQ(Nodes[Node], 0x11);
+    }
+
+    /* Nothing outside the tree is touched */
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Nodes[4], 0);
+    UtAssert_UINT32_EQ(CS_BLOCK_TEST_Table.Nodes[5 + CS_BLOCK_TEST_NUM_NODES], 0);
+}
+
+void CS_BlockTreeUpdate_Test_Miscompare(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    CS_Res_BlockTree_t *              Tree  = &CS_BLOCK_TEST_Table.Trees[0];
+    uint32 *                          Nodes = &CS_BLOCK_TEST_Table.Nodes[5];
+
+    CS_BLOCK_TEST_SetupTree(&ResultsEntry);
+
+    CS_BlockTreeUpdate(&ResultsEntry, 0, CS_BLOCK_TEST_NUM_BYTES);
+    ResultsEntry.ComputedYet = true;
+
+    /* The third and fourth blocks changed */
+    UT_SetDeferredRetcode(UT_KEY(CS_CalculateCRC), 3, 0x22);
+    UT_SetDeferredRetcode(UT_KEY(CS_CalculateCRC), 1, 0x33);
+
+    /* Execute the function being tested */
+    CS_BlockTreeUpdate(&ResultsEntry, 0, CS_BLOCK_TEST_NUM_BYTES);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(Tree->CurrentValid);
+    UtAssert_UINT32_EQ(Tree->FailedLeaves, 2);
+    UtAssert_UINT32_EQ(Tree->FirstFailedLeaf, 2);
+    UtAssert_UINT32_EQ(Nodes[1], 0x11);
+    UtAssert_UINT32_EQ(Nodes[2], 0x22);
+    UtAssert_UINT32_EQ(Nodes[3], 0x33);
+
+    /* The baseline is kept */
+    UtAssert_UINT32_EQ(Nodes[CS_BLOCK_TEST_NUM_LEAVES + 2], 0x11);
+    UtAssert_UINT32_EQ(Nodes[CS_BLOCK_TEST_NUM_LEAVES + 3], 0x11);
+
+    /* A new pass starts clean */
+    CS_BlockTreeUpdate(&ResultsEntry, 0, 1);
+
+    UtAssert_BOOL_FALSE(Tree->CurrentValid);
+    UtAssert_UINT32_EQ(Tree->FailedLeaves, 0);
+    UtAssert_UINT32_EQ(Tree->ByteOffset, 1);
+}
+
+void CS_BlockTreeUpdate_Test_OffsetMismatch(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    CS_Res_BlockTree_t *              Tree = &CS_BLOCK_TEST_Table.Trees[0];
+
+    CS_BLOCK_TEST_SetupTree(&ResultsEntry);
+
+    /* Execute the function being tested */
+    CS_BlockTreeUpdate(&ResultsEntry, 100, 10);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Tree->ByteOffset, 0);
+    UtAssert_STUB_COUNT(CS_CalculateCRC, 0);
+}
+
+void CS_BlockTreeUpdate_Test_NoTree(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+
+    CS_BLOCK_TEST_SetupTree(&ResultsEntry);
+    ResultsEntry.BlockTree = 0;
+
+    /* Execute the function being tested */
+    CS_BlockTreeUpdate(&ResultsEntry, 0, 10);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_CalculateCRC, 0);
+
+    /* A freed tree is no tree */
+    ResultsEntry.BlockTree               = 1;
+    CS_BLOCK_TEST_Table.Trees[0].State = CS_STATE_EMPTY;
+
+    CS_BlockTreeUpdate(&ResultsEntry, 0, 10);
+
+    UtAssert_STUB_COUNT(CS_CalculateCRC, 0);
+
+    /* As is a missing table */
+    CS_BLOCK_TEST_Table.Trees[0].State = CS_STATE_ENABLED;
+    CS_AppData.ResBlockTblPtr          = NULL;
+
+    CS_BlockTreeUpdate(&ResultsEntry, 0, 10);
+
+    UtAssert_STUB_COUNT(CS_CalculateCRC, 0);
+}
+
+void CS_BlockTreeReportMiscompare_Test_Nominal(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    CS_Res_BlockTree_t *              Tree = &CS_BLOCK_TEST_Table.Trees[0];
+    int32                             strCmpResult;
+    char                              ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "%%s entry %%d: %%u of %%u blocks miscompared, first at 0x%%08X");
+
+    CS_BLOCK_TEST_SetupTree(&ResultsEntry);
+    Tree->CurrentValid    = true;
+    Tree->FailedLeaves    = 2;
+    Tree->FirstFailedLeaf = 1;
+
+    /* Execute the function being tested */
+    CS_BlockTreeReportMiscompare(&ResultsEntry);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_BLOCK_MISCOMPARE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_BlockTreeReportMiscompare_Test_NoReport(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    CS_Res_BlockTree_t *              Tree = &CS_BLOCK_TEST_Table.Trees[0];
+
+    CS_BLOCK_TEST_SetupTree(&ResultsEntry);
+
+    /* Every block matched */
+    Tree->CurrentValid = true;
+    Tree->FailedLeaves = 0;
+    CS_BlockTreeReportMiscompare(&ResultsEntry);
+
+    /* The pass did not follow the leaves from the start */
+    Tree->CurrentValid = false;
+    Tree->FailedLeaves = 1;
+    CS_BlockTreeReportMiscompare(&ResultsEntry);
+
+    /* No tree */
+    Tree->CurrentValid     = true;
+    ResultsEntry.BlockTree = 0;
+    CS_BlockTreeReportMiscompare(&ResultsEntry);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_BlockTreeInvalidate_Test_Nominal(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    CS_Res_BlockTree_t *              Tree = &CS_BLOCK_TEST_Table.Trees[0];
+
+    CS_BLOCK_TEST_SetupTree(&ResultsEntry);
+
+    CS_BlockTreeUpdate(&ResultsEntry, 0, CS_BLOCK_TEST_NUM_BYTES);
+    ResultsEntry.ComputedYet = true;
+
+    UT_SetDeferredRetcode(UT_KEY(CS_CalculateCRC), 1, 0x22);
+    CS_BlockTreeUpdate(&ResultsEntry, 0, CS_BLOCK_TREE_LEAF_SIZE);
+
+    /* Execute the function being tested */
+    CS_BlockTreeInvalidate(CS_EEPROM_TABLE, 0, false);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(Tree->CurrentValid);
+    UtAssert_UINT32_EQ(Tree->ByteOffset, 0);
+    UtAssert_UINT32_EQ(Tree->FailedLeaves, 0);
+
+    /* The rest of the pass no longer adds to the leaves */
+    CS_BlockTreeUpdate(&ResultsEntry, CS_BLOCK_TREE_LEAF_SIZE, CS_BLOCK_TEST_NUM_BYTES - CS_BLOCK_TREE_LEAF_SIZE);
+    UtAssert_BOOL_FALSE(Tree->CurrentValid);
+    UtAssert_UINT32_EQ(Tree->ByteOffset, 0);
+}
+
+void CS_BlockTreeInvalidate_Test_OtherEntries(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    CS_Res_BlockTree_t *              Tree = &CS_BLOCK_TEST_Table.Trees[0];
+
+    CS_BLOCK_TEST_SetupTree(&ResultsEntry);
+    Tree->EntryID = 2;
+
+    CS_BlockTreeUpdate(&ResultsEntry, 0, CS_BLOCK_TEST_NUM_BYTES);
+
+    /* Execute the function being tested */
+    CS_BlockTreeInvalidate(CS_EEPROM_TABLE, 1, false);
+    CS_BlockTreeInvalidate(CS_MEMORY_TABLE, 2, true);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(Tree->CurrentValid);
+
+    /* Recomputing the whole table drops every tree of the table */
+    CS_BlockTreeInvalidate(CS_EEPROM_TABLE, 0, true);
+    UtAssert_BOOL_FALSE(Tree->CurrentValid);
+
+    /* Without the block results table there is nothing to drop */
+    CS_AppData.ResBlockTblPtr = NULL;
+    CS_BlockTreeInvalidate(CS_EEPROM_TABLE, 0, true);
+}
+
+void CS_BlockTreeRecompute_Test_Nominal(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    CS_Res_BlockTree_t *              Tree            = &CS_BLOCK_TEST_Table.Trees[0];
+    uint32 *                          Nodes           = &CS_BLOCK_TEST_Table.Nodes[5];
+    uint32                            ComputedCSValue = 0;
+    CS_Job_t                          Job;
+
+    memset(&Job, 0, sizeof(Job));
+    CS_BLOCK_TEST_SetupTree(&ResultsEntry);
+
+    CS_BlockTreeUpdate(&ResultsEntry, 0, CS_BLOCK_TEST_NUM_BYTES);
+    ResultsEntry.ComputedYet = true;
+
+    /* A pass started after the recompute was requested finds two changed blocks */
+    UT_SetDeferredRetcode(UT_KEY(CS_CalculateCRC), 3, 0x22);
+    UT_SetDeferredRetcode(UT_KEY(CS_CalculateCRC), 1, 0x33);
+    CS_BlockTreeUpdate(&ResultsEntry, 0, CS_BLOCK_TEST_NUM_BYTES);
+
+    /* The recompute child task starts the entry over */
+    ResultsEntry.ComputedYet = false;
+    ResultsEntry.ByteOffset  = 0;
+
+    UT_ResetState(UT_KEY(CS_CalculateCRC));
+    UT_SetDefaultReturnValue(UT_KEY(CS_CalculateCRC), 0x44);
+    UT_SetDefaultReturnValue(UT_KEY(CS_ChecksumFinal), 0x12345678);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(CS_BlockTreeRecompute(&ResultsEntry, &ComputedCSValue, &Job));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(ComputedCSValue, 0x12345678);
+    UtAssert_UINT32_EQ(ResultsEntry.ComparisonValue, 0x12345678);
+    UtAssert_BOOL_TRUE(ResultsEntry.ComputedYet);
+    UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 0);
+    UtAssert_UINT32_EQ(Tree->FailedLeaves, 0);
+
+    /* The changed blocks take the leaves of the pass, only the two nodes above each are hashed */
+    UtAssert_STUB_COUNT(CS_CalculateCRC, 4);
+    UtAssert_UINT32_EQ(Nodes[CS_BLOCK_TEST_NUM_LEAVES + 0], 0x11);
+    UtAssert_UINT32_EQ(Nodes[CS_BLOCK_TEST_NUM_LEAVES + 1], 0x11);
+    UtAssert_UINT32_EQ(Nodes[CS_BLOCK_TEST_NUM_LEAVES + 2], 0x22);
+    UtAssert_UINT32_EQ(Nodes[CS_BLOCK_TEST_NUM_LEAVES + 3], 0x33);
+    UtAssert_UINT32_EQ(Nodes[8], 0x11);
+    UtAssert_UINT32_EQ(Nodes[9], 0x44);
+    UtAssert_UINT32_EQ(Nodes[10], 0x44);
+
+    /* The checksum is the combination of every block */
+    UtAssert_STUB_COUNT(CS_ChecksumInit, 1);
+    UtAssert_STUB_COUNT(CS_ChecksumCombine, CS_BLOCK_TEST_NUM_LEAVES);
+    UtAssert_STUB_COUNT(CS_ChecksumFinal, 1);
+
+    /* No memory is read, so nothing is paced or charged */
+    UtAssert_STUB_COUNT(CS_JobsPace, 0);
+    UtAssert_STUB_COUNT(CS_BudgetJobCharge, 0);
+
+    /* The job task sends no events, the job carries the counts to CS_JobsDrain */
+    UtAssert_UINT32_EQ(Job.NumBlocks, CS_BLOCK_TEST_NUM_LEAVES);
+    UtAssert_UINT32_EQ(Job.NumBlocksRehashed, 2);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_BlockTreeRecompute_Test_Reverify(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    uint32 *                          Nodes           = &CS_BLOCK_TEST_Table.Nodes[5];
+    uint32                            ComputedCSValue = 0;
+    CS_Job_t                          Job;
+
+    memset(&Job, 0, sizeof(Job));
+    CS_BLOCK_TEST_SetupTree(&ResultsEntry);
+
+    CS_BlockTreeUpdate(&ResultsEntry, 0, CS_BLOCK_TEST_NUM_BYTES);
+    ResultsEntry.ComputedYet = true;
+
+    /* The last pass found the second block changed before the recompute was requested */
+    UT_SetDeferredRetcode(UT_KEY(CS_CalculateCRC), 2, 0x22);
+    CS_BlockTreeUpdate(&ResultsEntry, 0, CS_BLOCK_TEST_NUM_BYTES);
+    CS_BlockTreeInvalidate(CS_EEPROM_TABLE, 0, false);
+
+    ResultsEntry.ComputedYet = false;
+    ResultsEntry.ByteOffset  = 0;
+
+    /* Since then the second block was restored and the last one written */
+    UT_ResetState(UT_KEY(CS_CalculateCRC));
+    UT_SetDefaultReturnValue(UT_KEY(CS_CalculateCRC), 0x11);
+    UT_SetDeferredRetcode(UT_KEY(CS_CalculateCRC), 4, 0x44);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(CS_BlockTreeRecompute(&ResultsEntry, &ComputedCSValue, &Job));
+
+    /* Verify results: every block is read again, only the last one is rehashed */
+    UtAssert_STUB_COUNT(CS_CalculateCRC, CS_BLOCK_TEST_NUM_LEAVES + 2);
+    UtAssert_UINT32_EQ(Nodes[CS_BLOCK_TEST_NUM_LEAVES + 1], 0x11);
+    UtAssert_UINT32_EQ(Nodes[CS_BLOCK_TEST_NUM_LEAVES + 3], 0x44);
+
+    /* Each block read is paced and charged to the job */
+    UtAssert_STUB_COUNT(CS_JobsPace, CS_BLOCK_TEST_NUM_LEAVES);
+    UtAssert_STUB_COUNT(CS_BudgetJobCharge, CS_BLOCK_TEST_NUM_LEAVES);
+
+    UtAssert_UINT32_EQ(Job.NumBlocks, CS_BLOCK_TEST_NUM_LEAVES);
+    UtAssert_UINT32_EQ(Job.NumBlocksRehashed, 1);
+}
+
+void CS_BlockTreeRecompute_Test_NotAvailable(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    CS_Res_BlockTree_t *              Tree            = &CS_BLOCK_TEST_Table.Trees[0];
+    uint32                            ComputedCSValue = 0;
+    CS_Job_t                          Job;
+
+    memset(&Job, 0, sizeof(Job));
+    CS_BLOCK_TEST_SetupTree(&ResultsEntry);
+
+    CS_BlockTreeUpdate(&ResultsEntry, 0, CS_BLOCK_TEST_NUM_BYTES);
+    ResultsEntry.ComputedYet = true;
+
+    /* The algorithm's CRC does not match the leaves */
+    CS_BLOCK_TEST_Algorithm.TypeCRC = CFE_ES_CrcType_NONE;
+    UtAssert_BOOL_FALSE(CS_BlockTreeRecompute(&ResultsEntry, &ComputedCSValue, &Job));
+
+    /* No baseline tree */
+    CS_BLOCK_TEST_Algorithm.TypeCRC = CFE_ES_CrcType_CRC_32;
+    Tree->ComputedYet               = false;
+    UtAssert_BOOL_FALSE(CS_BlockTreeRecompute(&ResultsEntry, &ComputedCSValue, &Job));
+
+    /* No tree at all */
+    Tree->ComputedYet      = true;
+    ResultsEntry.BlockTree = 0;
+    UtAssert_BOOL_FALSE(CS_BlockTreeRecompute(&ResultsEntry, &ComputedCSValue, &Job));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(ComputedCSValue, 0);
+    UtAssert_STUB_COUNT(CS_ChecksumFinal, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(CS_BlockTreeInit_Test_Nominal, CS_Test_Setup, CS_Test_TearDown, "CS_BlockTreeInit_Test_Nominal");
+    UtTest_Add(CS_BlockTreeInit_Test_RegisterError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BlockTreeInit_Test_RegisterError");
+    UtTest_Add(CS_BlockTreeInit_Test_NotifyError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BlockTreeInit_Test_NotifyError");
+    UtTest_Add(CS_BlockTreeInit_Test_GetAddressError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BlockTreeInit_Test_GetAddressError");
+    UtTest_Add(CS_BlockTreeManage_Test_Nominal, CS_Test_Setup, CS_Test_TearDown, "CS_BlockTreeManage_Test_Nominal");
+    UtTest_Add(CS_BlockTreeManage_Test_GetAddressError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BlockTreeManage_Test_GetAddressError");
+    UtTest_Add(CS_BlockTreeManage_Test_NoTable, CS_Test_Setup, CS_Test_TearDown, "CS_BlockTreeManage_Test_NoTable");
+    UtTest_Add(CS_BlockTreeNumNodes_Test, CS_Test_Setup, CS_Test_TearDown, "CS_BlockTreeNumNodes_Test");
+    UtTest_Add(CS_BlockTreeAllocate_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BlockTreeAllocate_Test_Nominal");
+    UtTest_Add(CS_BlockTreeAllocate_Test_ReplacesTable, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BlockTreeAllocate_Test_ReplacesTable");
+    UtTest_Add(CS_BlockTreeAllocate_Test_NoTrees, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BlockTreeAllocate_Test_NoTrees");
+    UtTest_Add(CS_BlockTreeAllocate_Test_NoNodes, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BlockTreeAllocate_Test_NoNodes");
+    UtTest_Add(CS_BlockTreeAllocate_Test_NoTable, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BlockTreeAllocate_Test_NoTable");
+    UtTest_Add(CS_BlockTreeUpdate_Test_Baseline, CS_Test_Setup, CS_Test_TearDown, "CS_BlockTreeUpdate_Test_Baseline");
+    UtTest_Add(CS_BlockTreeUpdate_Test_Miscompare, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BlockTreeUpdate_Test_Miscompare");
+    UtTest_Add(CS_BlockTreeUpdate_Test_OffsetMismatch, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BlockTreeUpdate_Test_OffsetMismatch");
+    UtTest_Add(CS_BlockTreeUpdate_Test_NoTree, CS_Test_Setup, CS_Test_TearDown, "CS_BlockTreeUpdate_Test_NoTree");
+    UtTest_Add(CS_BlockTreeReportMiscompare_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BlockTreeReportMiscompare_Test_Nominal");
+    UtTest_Add(CS_BlockTreeReportMiscompare_Test_NoReport, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BlockTreeReportMiscompare_Test_NoReport");
+    UtTest_Add(CS_BlockTreeInvalidate_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BlockTreeInvalidate_Test_Nominal");
+    UtTest_Add(CS_BlockTreeInvalidate_Test_OtherEntries, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BlockTreeInvalidate_Test_OtherEntries");
+    UtTest_Add(CS_BlockTreeRecompute_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BlockTreeRecompute_Test_Nominal");
+    UtTest_Add(CS_BlockTreeRecompute_Test_Reverify, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BlockTreeRecompute_Test_Reverify");
+    UtTest_Add(CS_BlockTreeRecompute_Test_NotAvailable, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BlockTreeRecompute_Test_NotAvailable");
+}
@@ -0,0 +1,862 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cs_app.h"
+#include "cs_events.h"
+#include "cs_algorithm.h"
+#include "cs_worker.h"
+#include "cs_budget.h"
+#include "cs_test_utils.h"
+#include <string.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* Fake timebase in ticks, advanced by a step on every read */
+static uint64 CS_BUDGET_TEST_Clock;
+static uint64 CS_BUDGET_TEST_Step;
+
+void CS_BUDGET_TEST_CFE_PSP_Get_TimebaseHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32 *Tbu = (uint32 *)UT_Hook_GetArgValueByName(Context, "Tbu", uint32 *);
+    uint32 *Tbl = (uint32 *)UT_Hook_GetArgValueByName(Context, "Tbl", uint32 *);
+
+    *Tbu = (uint32)(CS_BUDGET_TEST_Clock >> 32);
+    *Tbl = (uint32)CS_BUDGET_TEST_Clock;
+
+    CS_BUDGET_TEST_Clock += CS_BUDGET_TEST_Step;
+}
+
+/* What the job tasks have used since the last cycle */
+static uint32 CS_BUDGET_TEST_JobBytes;
+static uint32 CS_BUDGET_TEST_JobTime;
+
+void CS_BUDGET_TEST_CS_JobsCollectChargesHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32 *Bytes = (uint32 *)UT_Hook_GetArgValueByName(Context, "Bytes", uint32 *);
+    uint32 *Time  = (uint32 *)UT_Hook_GetArgValueByName(Context, "Time", uint32 *);
+
+    *Bytes = CS_BUDGET_TEST_JobBytes;
+    *Time  = CS_BUDGET_TEST_JobTime;
+}
+
+void CS_BUDGET_TEST_SetupJobCharges(uint32 Bytes, uint32 Time)
+{
+    CS_BUDGET_TEST_JobBytes = Bytes;
+    CS_BUDGET_TEST_JobTime  = Time;
+
+    UT_SetHandlerFunction(UT_KEY(CS_JobsCollectCharges), CS_BUDGET_TEST_CS_JobsCollectChargesHandler, NULL);
+}
+
+/* Whether the worker pool was last asked to stream */
+static bool CS_BUDGET_TEST_PoolStreaming;
+
+void CS_BUDGET_TEST_CS_WorkerPoolChecksumUpdateHandler(void *UserObj, UT_EntryKey_t FuncKey,
+                                                       const UT_StubContext_t *Context)
+{
+    CS_BUDGET_TEST_PoolStreaming = UT_Hook_GetArgValueByName(Context, "Streaming", bool);
+}
+
+/* The algorithm the worker pool was last asked to stripe for */
+static uint16 CS_BUDGET_TEST_StripesAlgorithm;
+
+void CS_BUDGET_TEST_CS_WorkerPoolStripesHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CS_BUDGET_TEST_StripesAlgorithm = UT_Hook_GetArgValueByName(Context, "AlgorithmId", uint16);
+}
+
+void CS_BUDGET_TEST_SetupClock(uint64 Start, uint64 Step)
+{
+    CS_BUDGET_TEST_Clock = Start;
+    CS_BUDGET_TEST_Step  = Step;
+
+    /* One tick per microsecond */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_GetTimerTicksPerSecond), 1000000);
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_Get_Timebase), CS_BUDGET_TEST_CFE_PSP_Get_TimebaseHandler, NULL);
+}
+
+void CS_BudgetInit_Test(void)
+{
+    CS_AppData.HkPacket.Payload.TimeBudget       = 1;
+    CS_AppData.HkPacket.Payload.TargetPassPeriod = 1;
+    CS_AppData.HkPacket.Payload.LastPassTime     = 1;
+    CS_AppData.Budget.PassTimed                  = true;
+    CS_AppData.Budget.PassStart                  = 1;
+
+    /* Execute the function being tested */
+    CS_BudgetInit();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.TimeBudget, CS_DEFAULT_TIME_BUDGET);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.TargetPassPeriod, CS_DEFAULT_TARGET_PASS_PERIOD);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastPassTime, 0);
+    UtAssert_BOOL_FALSE(CS_AppData.Budget.PassTimed);
+    UtAssert_UINT32_EQ(CS_AppData.Budget.PassStart, 0);
+    UtAssert_UINT32_EQ(CS_AppData.Budget.YieldInterval, CS_DEFAULT_YIELD_INTERVAL);
+}
+
+void CS_BudgetGetTime_Test_Nominal(void)
+{
+    CS_BUDGET_TEST_SetupClock(0x100000005, 0);
+
+    /* Execute the function being tested */
+    UtAssert_True(CS_BudgetGetTime() == 0x100000005, "CS_BudgetGetTime() == 0x100000005");
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_PSP_Get_Timebase, 1);
+}
+
+void CS_BudgetGetTime_Test_Fraction(void)
+{
+    CS_BUDGET_TEST_SetupClock(10, 0);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_GetTimerTicksPerSecond), 3);
+
+    /* Execute the function being tested */
+    UtAssert_True(CS_BudgetGetTime() == 3333333, "CS_BudgetGetTime() == 3333333");
+}
+
+void CS_BudgetGetTime_Test_NoTickRate(void)
+{
+    /* Execute the function being tested */
+    UtAssert_True(CS_BudgetGetTime() == 0, "CS_BudgetGetTime() == 0");
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_PSP_Get_Timebase, 0);
+}
+
+void CS_BudgetStartCycle_Test(void)
+{
+    CS_BUDGET_TEST_SetupClock(1000, 500);
+
+    /* Execute the function being tested */
+    CS_BudgetStartCycle();
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(CS_AppData.Budget.PassTimed);
+    UtAssert_UINT32_EQ(CS_AppData.Budget.CycleStart, 1000);
+    UtAssert_UINT32_EQ(CS_AppData.Budget.RunStart, 1000);
+    UtAssert_UINT32_EQ(CS_AppData.Budget.PassStart, 1000);
+
+    /* The pass keeps its start on later cycles */
+    CS_BudgetStartCycle();
+
+    UtAssert_UINT32_EQ(CS_AppData.Budget.CycleStart, 1500);
+    UtAssert_UINT32_EQ(CS_AppData.Budget.PassStart, 1000);
+}
+
+void CS_BudgetStartCycle_Test_BytesLeft(void)
+{
+    CS_AppData.MaxBytesPerCycle = 4096;
+
+    /* Execute the function being tested */
+    CS_BudgetStartCycle();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.Budget.BytesLeft, 4096);
+}
+
+void CS_BudgetStartCycle_Test_JobShare(void)
+{
+    CS_AppData.MaxBytesPerCycle            = 4000;
+    CS_AppData.HkPacket.Payload.TimeBudget = 1000;
+
+    /* Jobs used less than their share of the last cycle */
+    CS_BUDGET_TEST_SetupJobCharges(1000, 100);
+
+    /* Execute the function being tested */
+    CS_BudgetStartCycle();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.Budget.BytesLeft, 3000);
+    UtAssert_UINT32_EQ(CS_AppData.Budget.JobTime, 100);
+    UtAssert_STUB_COUNT(CS_JobsCollectCharges, 1);
+}
+
+void CS_BudgetStartCycle_Test_BackgroundShare(void)
+{
+    CS_AppData.MaxBytesPerCycle            = 4000;
+    CS_AppData.HkPacket.Payload.TimeBudget = 1000;
+
+    /* Jobs used more than the whole of the last cycle */
+    CS_BUDGET_TEST_SetupJobCharges(100000, 100000);
+
+    /* Execute the function being tested */
+    CS_BudgetStartCycle();
+
+    /* Verify results: background checking keeps its share */
+    UtAssert_UINT32_EQ(CS_AppData.Budget.BytesLeft, (4000 * CS_BKGND_MIN_SHARE) / 100);
+    UtAssert_UINT32_EQ(CS_AppData.Budget.JobTime, 1000 - (1000 * CS_BKGND_MIN_SHARE) / 100);
+}
+
+void CS_BudgetCycleSpent_Test_ByteLimit(void)
+{
+    CS_AppData.HkPacket.Payload.TimeBudget = 0;
+
+    /* Execute the function being tested */
+    CS_AppData.Budget.BytesLeft = 1;
+    UtAssert_BOOL_FALSE(CS_BudgetCycleSpent());
+
+    CS_AppData.Budget.BytesLeft = 0;
+    UtAssert_BOOL_TRUE(CS_BudgetCycleSpent());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_PSP_Get_Timebase, 0);
+}
+
+void CS_BudgetCycleSpent_Test_TimeBudget(void)
+{
+    CS_BUDGET_TEST_SetupClock(0, 60);
+    CS_AppData.HkPacket.Payload.TimeBudget = 100;
+    CS_AppData.Budget.CycleStart           = 0;
+    CS_AppData.Budget.BytesLeft            = 0;
+
+    /* Execute the function being tested: the clock reads 0, then 60, then 120 */
+    UtAssert_BOOL_FALSE(CS_BudgetCycleSpent());
+    UtAssert_BOOL_FALSE(CS_BudgetCycleSpent());
+    UtAssert_BOOL_TRUE(CS_BudgetCycleSpent());
+}
+
+void CS_BudgetCycleSpent_Test_JobTime(void)
+{
+    CS_BUDGET_TEST_SetupClock(0, 60);
+    CS_AppData.HkPacket.Payload.TimeBudget = 100;
+    CS_AppData.Budget.CycleStart           = 0;
+    CS_AppData.Budget.JobTime              = 50;
+
+    /* Execute the function being tested: the clock reads 0, then 60 */
+    UtAssert_BOOL_FALSE(CS_BudgetCycleSpent());
+    UtAssert_BOOL_TRUE(CS_BudgetCycleSpent());
+}
+
+void CS_BudgetChecksumUpdate_Test_ByteLimit(void)
+{
+    CS_ChecksumContext_t Context;
+
+    CS_AppData.HkPacket.Payload.TimeBudget = 0;
+    CS_AppData.Budget.BytesLeft            = 100;
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000, 10, 4, false, false, NULL), 4);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.Budget.BytesLeft, 96);
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 1);
+    UtAssert_STUB_COUNT(CS_WorkerPoolChecksumUpdate, 0);
+    UtAssert_STUB_COUNT(CFE_PSP_Get_Timebase, 0);
+}
+
+void CS_BudgetChecksumUpdate_Test_BytesLeft(void)
+{
+    CS_ChecksumContext_t Context;
+
+    CS_AppData.HkPacket.Payload.TimeBudget = 0;
+    CS_AppData.Budget.BytesLeft            = 3;
+
+    /* Execute the function being tested: earlier entries used most of the cycle */
+    UtAssert_UINT32_EQ(CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000, 10, 4, false, false, NULL), 3);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.Budget.BytesLeft, 0);
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 1);
+}
+
+void CS_BudgetChecksumUpdate_Test_BytesLeftWorkerPool(void)
+{
+    CS_ChecksumContext_t Context;
+
+    CS_AppData.HkPacket.Payload.TimeBudget = 0;
+    CS_AppData.Budget.BytesLeft            = 3;
+
+    /* Worker pool with two workers plus the calling task, striping every block */
+    UT_SetDefaultReturnValue(UT_KEY(CS_WorkerPoolLanes), 3);
+    UT_SetDefaultReturnValue(UT_KEY(CS_WorkerPoolStripes), true);
+    UT_SetDefaultReturnValue(UT_KEY(CS_WorkerPoolChecksumUpdate), true);
+
+    /* Execute the function being tested: each lane gets the bytes left */
+    UtAssert_UINT32_EQ(CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000, 100, 12, true, false, NULL), 9);
+    UtAssert_UINT32_EQ(CS_AppData.Budget.BytesLeft, 0);
+
+    /* A short entry is charged what each lane did */
+    CS_AppData.Budget.BytesLeft = 3;
+    UtAssert_UINT32_EQ(CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000, 4, 12, true, false, NULL), 4);
+    UtAssert_UINT32_EQ(CS_AppData.Budget.BytesLeft, 1);
+}
+
+void CS_BudgetChecksumUpdate_Test_WorkerPoolNoStripes(void)
+{
+    CS_ChecksumContext_t Context;
+
+    CS_AppData.HkPacket.Payload.TimeBudget = 0;
+    CS_AppData.Budget.BytesLeft            = 100;
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_WorkerPoolLanes), 3);
+
+    /* Execute the function being tested: the lanes' bytes are too few to stripe */
+    UtAssert_UINT32_EQ(CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000, 100, 12, true, false, NULL), 12);
+
+    /* Verify results: the calling task did the bytes alone */
+    UtAssert_UINT32_EQ(CS_AppData.Budget.BytesLeft, 88);
+    UtAssert_STUB_COUNT(CS_WorkerPoolStripes, 1);
+
+    /* A chunk the pool ends up not striping is charged in full */
+    UT_SetDefaultReturnValue(UT_KEY(CS_WorkerPoolStripes), true);
+    UtAssert_UINT32_EQ(CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000, 100, 12, true, false, NULL), 36);
+    UtAssert_UINT32_EQ(CS_AppData.Budget.BytesLeft, 52);
+}
+
+void CS_BudgetChecksumUpdate_Test_WorkerPoolCannotCombine(void)
+{
+    CS_ChecksumContext_t Context;
+
+    CS_AppData.HkPacket.Payload.TimeBudget = 0;
+    CS_AppData.Budget.BytesLeft            = 100;
+
+    /* The pool does not stripe algorithms whose checksums cannot be combined */
+    UT_SetDefaultReturnValue(UT_KEY(CS_WorkerPoolLanes), 3);
+    UT_SetHandlerFunction(UT_KEY(CS_WorkerPoolStripes), CS_BUDGET_TEST_CS_WorkerPoolStripesHandler, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CS_WorkerPoolStripes), false);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(CS_BudgetChecksumUpdate(CS_ALGORITHM_SHA_256, &Context, 0x1000, 100, 12, true, false, NULL), 12);
+
+    /* Verify results: one lane, charged in full */
+    UtAssert_UINT32_EQ(CS_BUDGET_TEST_StripesAlgorithm, CS_ALGORITHM_SHA_256);
+    UtAssert_UINT32_EQ(CS_AppData.Budget.BytesLeft, 88);
+    UtAssert_STUB_COUNT(CS_WorkerPoolChecksumUpdate, 1);
+}
+
+void CS_BudgetChecksumUpdate_Test_ByteLimitWorkerPool(void)
+{
+    CS_ChecksumContext_t Context;
+
+    CS_AppData.HkPacket.Payload.TimeBudget = 0;
+    CS_AppData.Budget.BytesLeft            = 100;
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000, 3, 4, true, false, NULL), 3);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 0);
+    UtAssert_STUB_COUNT(CS_WorkerPoolChecksumUpdate, 1);
+}
+
+void CS_BudgetChecksumUpdate_Test_Streaming(void)
+{
+    CS_ChecksumContext_t Context;
+
+    CS_AppData.HkPacket.Payload.TimeBudget = 0;
+    CS_AppData.Budget.BytesLeft            = 100;
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000, 10, 4, false, true, NULL), 4);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_ChecksumUpdateStreaming, 1);
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 0);
+
+    /* The worker pool is told to stream */
+    CS_BUDGET_TEST_PoolStreaming = false;
+    UT_SetHandlerFunction(UT_KEY(CS_WorkerPoolChecksumUpdate), CS_BUDGET_TEST_CS_WorkerPoolChecksumUpdateHandler,
+                          NULL);
+    UtAssert_UINT32_EQ(CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000, 10, 4, true, true, NULL), 4);
+
+    UtAssert_STUB_COUNT(CS_WorkerPoolChecksumUpdate, 1);
+    UtAssert_STUB_COUNT(CS_ChecksumUpdateStreaming, 1);
+    UtAssert_BOOL_TRUE(CS_BUDGET_TEST_PoolStreaming);
+}
+
+void CS_BudgetChecksumUpdate_Test_BudgetSpent(void)
+{
+    CS_ChecksumContext_t Context;
+
+    CS_BUDGET_TEST_SetupClock(0, 60);
+    CS_AppData.HkPacket.Payload.TimeBudget = 100;
+    CS_AppData.Budget.CycleStart           = 0;
+
+    /* Execute the function being tested: the clock reads 0, 60 then 120 after each chunk */
+    UtAssert_UINT32_EQ(CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000, 100000, 4, false, false, NULL),
+                       3 * CS_TIME_BUDGET_CHUNK_SIZE);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 3);
+}
+
+void CS_BudgetChecksumUpdate_Test_EndOfEntry(void)
+{
+    CS_ChecksumContext_t Context;
+
+    CS_BUDGET_TEST_SetupClock(0, 1);
+    CS_AppData.HkPacket.Payload.TimeBudget = 100;
+    CS_AppData.Budget.CycleStart           = 0;
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000,
+                                               CS_TIME_BUDGET_CHUNK_SIZE + 5, 4, false, false, NULL),
+                       CS_TIME_BUDGET_CHUNK_SIZE + 5);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 2);
+}
+
+void CS_BudgetChecksumUpdate_Test_AlreadyOverBudget(void)
+{
+    CS_ChecksumContext_t Context;
+
+    CS_BUDGET_TEST_SetupClock(5000, 0);
+    CS_AppData.HkPacket.Payload.TimeBudget = 100;
+    CS_AppData.Budget.CycleStart           = 0;
+
+    /* Execute the function being tested: one chunk is always done */
+    UtAssert_UINT32_EQ(CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000, 100000, 4, false, false, NULL),
+                       CS_TIME_BUDGET_CHUNK_SIZE);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 1);
+}
+
+void CS_BudgetChecksumUpdate_Test_WorkerPool(void)
+{
+    CS_ChecksumContext_t Context;
+
+    CS_BUDGET_TEST_SetupClock(5000, 0);
+    CS_AppData.HkPacket.Payload.TimeBudget = 100;
+    CS_AppData.Budget.CycleStart           = 0;
+
+    /* Worker pool with two workers plus the calling task */
+    UT_SetDefaultReturnValue(UT_KEY(CS_WorkerPoolLanes), 3);
+
+    /* Execute the function being tested: the pool would not stripe the chunk */
+    UtAssert_UINT32_EQ(CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000, 10 * CS_WORKER_STRIPE_SIZE, 4,
+                                               true, false, NULL),
+                       CS_TIME_BUDGET_CHUNK_SIZE);
+
+    /* The chunk grows until the pool stripes it */
+    UT_SetDefaultReturnValue(UT_KEY(CS_WorkerPoolStripes), true);
+    UtAssert_UINT32_EQ(CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000, 10 * CS_WORKER_STRIPE_SIZE, 4,
+                                               true, false, NULL),
+                       ((CS_WORKER_MIN_STRIPED_LENGTH + 2) / 3) * 3);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_WorkerPoolChecksumUpdate, 2);
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 0);
+}
+
+void CS_BudgetChecksumUpdate_Test_JobWorkerPool(void)
+{
+    CS_ChecksumContext_t Context;
+    CS_Job_t             Job;
+
+    memset(&Job, 0, sizeof(Job));
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_WorkerPoolLanes), 3);
+    UT_SetDefaultReturnValue(UT_KEY(CS_WorkerPoolStripes), true);
+
+    /* Execute the function being tested: the grown chunk is not cut short by MaxBytes */
+    UtAssert_UINT32_EQ(CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000, 10 * CS_WORKER_STRIPE_SIZE, 4,
+                                               true, false, &Job),
+                       ((CS_WORKER_MIN_STRIPED_LENGTH + 2) / 3) * 3);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_WorkerPoolChecksumUpdate, 1);
+    UtAssert_STUB_COUNT(CS_JobsPace, 1);
+}
+
+void CS_BudgetChecksumUpdate_Test_Job(void)
+{
+    CS_ChecksumContext_t Context;
+    CS_Job_t             Job;
+
+    memset(&Job, 0, sizeof(Job));
+
+    CS_BUDGET_TEST_SetupClock(0, 1);
+    CS_AppData.HkPacket.Payload.TimeBudget = 100;
+    CS_AppData.Budget.BytesLeft            = 2;
+
+    /* Execute the function being tested: neither the cycle's time budget nor its bytes apply */
+    UtAssert_UINT32_EQ(
+        CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000, 100000, 4, false, false, &Job), 4);
+
+    /* Verify results: the clock reads 0 before the chunk and 1 after */
+    UtAssert_UINT32_EQ(CS_AppData.Budget.BytesLeft, 2);
+    UtAssert_UINT32_EQ(Job.BytesCharged, 4);
+    UtAssert_UINT32_EQ(Job.TimeCharged, 1);
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 1);
+    UtAssert_STUB_COUNT(CS_JobsPace, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_Get_Timebase, 2);
+}
+
+void CS_BudgetChecksumUpdate_Test_JobChunks(void)
+{
+    CS_ChecksumContext_t Context;
+    CS_Job_t             Job;
+
+    memset(&Job, 0, sizeof(Job));
+
+    /* Execute the function being tested: up to MaxBytes, paced a chunk at a time */
+    UtAssert_UINT32_EQ(CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000, 100000,
+                                               CS_TIME_BUDGET_CHUNK_SIZE * 2 + 10, false, false, &Job),
+                       CS_TIME_BUDGET_CHUNK_SIZE * 2 + 10);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Job.BytesCharged, CS_TIME_BUDGET_CHUNK_SIZE * 2 + 10);
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 3);
+    UtAssert_STUB_COUNT(CS_JobsPace, 3);
+
+    /* The entry ends before MaxBytes */
+    UtAssert_UINT32_EQ(CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000, 10,
+                                               CS_TIME_BUDGET_CHUNK_SIZE * 2 + 10, false, false, &Job),
+                       10);
+    UtAssert_STUB_COUNT(CS_JobsPace, 4);
+}
+
+void CS_BudgetChecksumUpdate_Test_Yield(void)
+{
+    CS_ChecksumContext_t Context;
+
+    CS_BUDGET_TEST_SetupClock(0, 60);
+    CS_AppData.HkPacket.Payload.TimeBudget = 0;
+    CS_AppData.Budget.BytesLeft            = 100000;
+    CS_AppData.Budget.YieldInterval        = 100;
+
+    /* Execute the function being tested: the clock reads 0, 60, 120 then 240 after each block */
+    UtAssert_UINT32_EQ(CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000, 100000,
+                                               CS_YIELD_BLOCK_SIZE * 3 + 5, false, false, NULL),
+                       CS_YIELD_BLOCK_SIZE * 3 + 5);
+
+    /* Verify results: one yield after the third block, from 120 to 180 */
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 4);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_UINT32_EQ(CS_AppData.Budget.CycleStart, 60);
+    UtAssert_UINT32_EQ(CS_AppData.Budget.RunStart, 180);
+    UtAssert_UINT32_EQ(CS_AppData.Budget.BytesLeft, 100000 - (CS_YIELD_BLOCK_SIZE * 3 + 5));
+}
+
+void CS_BudgetChecksumUpdate_Test_YieldWorkerPool(void)
+{
+    CS_ChecksumContext_t Context;
+    uint32               BlockSize = 2 * CS_YIELD_BLOCK_SIZE;
+
+    CS_BUDGET_TEST_SetupClock(0, 0);
+    CS_AppData.HkPacket.Payload.TimeBudget = 0;
+    CS_AppData.Budget.BytesLeft            = 0xFFFFFFFF;
+    CS_AppData.Budget.YieldInterval        = 100;
+
+    /* Worker pool with one worker plus the calling task */
+    UT_SetDefaultReturnValue(UT_KEY(CS_WorkerPoolLanes), 2);
+    UT_SetDefaultReturnValue(UT_KEY(CS_WorkerPoolStripes), true);
+
+    /* Blocks are a yield block per lane, but no shorter than the pool stripes */
+    if (BlockSize < CS_WORKER_MIN_STRIPED_LENGTH)
+    {
+        BlockSize = CS_WORKER_MIN_STRIPED_LENGTH;
+    }
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(
+        CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000, 0xFFFFFFFF, BlockSize, true, false, NULL),
+        2 * BlockSize);
+
+    /* Verify results: no time passes, so there is no yield */
+    UtAssert_STUB_COUNT(CS_WorkerPoolChecksumUpdate, 2);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+}
+
+void CS_BudgetChecksumUpdate_Test_YieldJob(void)
+{
+    CS_ChecksumContext_t Context;
+    CS_Job_t             Job;
+
+    memset(&Job, 0, sizeof(Job));
+
+    CS_BUDGET_TEST_SetupClock(0, 1000);
+    CS_AppData.Budget.YieldInterval = 1;
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(
+        CS_BudgetChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, 0x1000, 100000, 4, false, false, &Job), 4);
+
+    /* Verify results: jobs are paced by their token buckets and never yield here */
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 1);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+}
+
+void CS_BudgetJobCharge_Test(void)
+{
+    CS_Job_t Job;
+
+    memset(&Job, 0, sizeof(Job));
+
+    Job.BytesCharged = 10;
+    Job.TimeCharged  = 20;
+
+    CS_BUDGET_TEST_SetupClock(150, 0);
+
+    /* Execute the function being tested */
+    CS_BudgetJobCharge(&Job, 5, 100);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Job.BytesCharged, 15);
+    UtAssert_UINT32_EQ(Job.TimeCharged, 70);
+}
+
+void CS_BudgetEndPass_Test_NotTimed(void)
+{
+    CS_BUDGET_TEST_SetupClock(7000000, 0);
+    CS_AppData.HkPacket.Payload.TimeBudget       = 1000;
+    CS_AppData.HkPacket.Payload.TargetPassPeriod = 10;
+
+    /* Execute the function being tested */
+    CS_BudgetEndPass();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastPassTime, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.TimeBudget, 1000);
+    UtAssert_BOOL_TRUE(CS_AppData.Budget.PassTimed);
+    UtAssert_UINT32_EQ(CS_AppData.Budget.PassStart, 7000000);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_BudgetEndPass_Test_NoTarget(void)
+{
+    CS_BUDGET_TEST_SetupClock(5000000, 0);
+    CS_AppData.HkPacket.Payload.TimeBudget       = 1000;
+    CS_AppData.HkPacket.Payload.TargetPassPeriod = 0;
+    CS_AppData.Budget.PassTimed                  = true;
+
+    /* Execute the function being tested */
+    CS_BudgetEndPass();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastPassTime, 5000);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.TimeBudget, 1000);
+    UtAssert_UINT32_EQ(CS_AppData.Budget.PassStart, 5000000);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_BudgetEndPass_Test_ByteLimit(void)
+{
+    CS_BUDGET_TEST_SetupClock(5000000, 0);
+    CS_AppData.HkPacket.Payload.TimeBudget       = 0;
+    CS_AppData.HkPacket.Payload.TargetPassPeriod = 10;
+    CS_AppData.Budget.PassTimed                  = true;
+
+    /* Execute the function being tested */
+    CS_BudgetEndPass();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastPassTime, 5000);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.TimeBudget, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_BudgetEndPass_Test_OnTarget(void)
+{
+    CS_BUDGET_TEST_SetupClock(10000000, 0);
+    CS_AppData.HkPacket.Payload.TimeBudget       = 1000;
+    CS_AppData.HkPacket.Payload.TargetPassPeriod = 10;
+    CS_AppData.Budget.PassTimed                  = true;
+
+    /* Execute the function being tested */
+    CS_BudgetEndPass();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.TimeBudget, 1000);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_BudgetEndPass_Test_ScaleUp(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Pass took %%u ms, time budget adjusted from %%u to %%u usec");
+
+    CS_BUDGET_TEST_SetupClock(16000000, 0);
+    CS_AppData.HkPacket.Payload.TimeBudget       = 1000;
+    CS_AppData.HkPacket.Payload.TargetPassPeriod = 10;
+    CS_AppData.Budget.PassTimed                  = true;
+    CS_AppData.Budget.PassStart                  = 1000000;
+
+    /* Execute the function being tested */
+    CS_BudgetEndPass();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastPassTime, 15000);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.TimeBudget, 1500);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_TIME_BUDGET_ADJ_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_BudgetEndPass_Test_ScaleDown(void)
+{
+    CS_BUDGET_TEST_SetupClock(8000000, 0);
+    CS_AppData.HkPacket.Payload.TimeBudget       = 1000;
+    CS_AppData.HkPacket.Payload.TargetPassPeriod = 10;
+    CS_AppData.Budget.PassTimed                  = true;
+
+    /* Execute the function being tested */
+    CS_BudgetEndPass();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.TimeBudget, 800);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_BudgetEndPass_Test_LimitUp(void)
+{
+    CS_BUDGET_TEST_SetupClock(100000000, 0);
+    CS_AppData.HkPacket.Payload.TimeBudget       = 1000;
+    CS_AppData.HkPacket.Payload.TargetPassPeriod = 10;
+    CS_AppData.Budget.PassTimed                  = true;
+
+    /* Execute the function being tested */
+    CS_BudgetEndPass();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.TimeBudget, 1000 * CS_BUDGET_MAX_ADJUST);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_BudgetEndPass_Test_LimitDown(void)
+{
+    CS_BUDGET_TEST_SetupClock(1000000, 0);
+    CS_AppData.HkPacket.Payload.TimeBudget       = 1000;
+    CS_AppData.HkPacket.Payload.TargetPassPeriod = 10;
+    CS_AppData.Budget.PassTimed                  = true;
+
+    /* Execute the function being tested */
+    CS_BudgetEndPass();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.TimeBudget, 1000 / CS_BUDGET_MAX_ADJUST);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_BudgetEndPass_Test_MaxBudget(void)
+{
+    CS_BUDGET_TEST_SetupClock(20000000, 0);
+    CS_AppData.HkPacket.Payload.TimeBudget       = CS_MAX_TIME_BUDGET;
+    CS_AppData.HkPacket.Payload.TargetPassPeriod = 10;
+    CS_AppData.Budget.PassTimed                  = true;
+
+    /* Execute the function being tested */
+    CS_BudgetEndPass();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.TimeBudget, CS_MAX_TIME_BUDGET);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_BudgetEndPass_Test_MinBudget(void)
+{
+    CS_BUDGET_TEST_SetupClock(5000000, 0);
+    CS_AppData.HkPacket.Payload.TimeBudget       = CS_MIN_TIME_BUDGET + 1;
+    CS_AppData.HkPacket.Payload.TargetPassPeriod = 10;
+    CS_AppData.Budget.PassTimed                  = true;
+
+    /* Execute the function being tested */
+    CS_BudgetEndPass();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.TimeBudget, CS_MIN_TIME_BUDGET);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(CS_BudgetInit_Test, CS_Test_Setup, CS_Test_TearDown, "CS_BudgetInit_Test");
+    UtTest_Add(CS_BudgetGetTime_Test_Nominal, CS_Test_Setup, CS_Test_TearDown, "CS_BudgetGetTime_Test_Nominal");
+    UtTest_Add(CS_BudgetGetTime_Test_Fraction, CS_Test_Setup, CS_Test_TearDown, "CS_BudgetGetTime_Test_Fraction");
+    UtTest_Add(CS_BudgetGetTime_Test_NoTickRate, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetGetTime_Test_NoTickRate");
+    UtTest_Add(CS_BudgetStartCycle_Test, CS_Test_Setup, CS_Test_TearDown, "CS_BudgetStartCycle_Test");
+    UtTest_Add(CS_BudgetStartCycle_Test_BytesLeft, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetStartCycle_Test_BytesLeft");
+    UtTest_Add(CS_BudgetStartCycle_Test_JobShare, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetStartCycle_Test_JobShare");
+    UtTest_Add(CS_BudgetStartCycle_Test_BackgroundShare, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetStartCycle_Test_BackgroundShare");
+    UtTest_Add(CS_BudgetCycleSpent_Test_ByteLimit, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetCycleSpent_Test_ByteLimit");
+    UtTest_Add(CS_BudgetCycleSpent_Test_TimeBudget, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetCycleSpent_Test_TimeBudget");
+    UtTest_Add(CS_BudgetCycleSpent_Test_JobTime, CS_Test_Setup, CS_Test_TearDown, "CS_BudgetCycleSpent_Test_JobTime");
+    UtTest_Add(CS_BudgetChecksumUpdate_Test_ByteLimit, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetChecksumUpdate_Test_ByteLimit");
+    UtTest_Add(CS_BudgetChecksumUpdate_Test_ByteLimitWorkerPool, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetChecksumUpdate_Test_ByteLimitWorkerPool");
+    UtTest_Add(CS_BudgetChecksumUpdate_Test_BytesLeft, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetChecksumUpdate_Test_BytesLeft");
+    UtTest_Add(CS_BudgetChecksumUpdate_Test_BytesLeftWorkerPool, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetChecksumUpdate_Test_BytesLeftWorkerPool");
+    UtTest_Add(CS_BudgetChecksumUpdate_Test_WorkerPoolNoStripes, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetChecksumUpdate_Test_WorkerPoolNoStripes");
+    UtTest_Add(CS_BudgetChecksumUpdate_Test_WorkerPoolCannotCombine, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetChecksumUpdate_Test_WorkerPoolCannotCombine");
+    UtTest_Add(CS_BudgetChecksumUpdate_Test_Streaming, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetChecksumUpdate_Test_Streaming");
+    UtTest_Add(CS_BudgetChecksumUpdate_Test_BudgetSpent, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetChecksumUpdate_Test_BudgetSpent");
+    UtTest_Add(CS_BudgetChecksumUpdate_Test_EndOfEntry, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetChecksumUpdate_Test_EndOfEntry");
+    UtTest_Add(CS_BudgetChecksumUpdate_Test_AlreadyOverBudget, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetChecksumUpdate_Test_AlreadyOverBudget");
+    UtTest_Add(CS_BudgetChecksumUpdate_Test_WorkerPool, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetChecksumUpdate_Test_WorkerPool");
+    UtTest_Add(CS_BudgetChecksumUpdate_Test_Job, CS_Test_Setup, CS_Test_TearDown, "CS_BudgetChecksumUpdate_Test_Job");
+    UtTest_Add(CS_BudgetChecksumUpdate_Test_JobWorkerPool, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetChecksumUpdate_Test_JobWorkerPool");
+    UtTest_Add(CS_BudgetChecksumUpdate_Test_JobChunks, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetChecksumUpdate_Test_JobChunks");
+    UtTest_Add(CS_BudgetChecksumUpdate_Test_Yield, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetChecksumUpdate_Test_Yield");
+    UtTest_Add(CS_BudgetChecksumUpdate_Test_YieldWorkerPool, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetChecksumUpdate_Test_YieldWorkerPool");
+    UtTest_Add(CS_BudgetChecksumUpdate_Test_YieldJob, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetChecksumUpdate_Test_YieldJob");
+    UtTest_Add(CS_BudgetJobCharge_Test, CS_Test_Setup, CS_Test_TearDown, "CS_BudgetJobCharge_Test");
+    UtTest_Add(CS_BudgetEndPass_Test_NotTimed, CS_Test_Setup, CS_Test_TearDown, "CS_BudgetEndPass_Test_NotTimed");
+    UtTest_Add(CS_BudgetEndPass_Test_NoTarget, CS_Test_Setup, CS_Test_TearDown, "CS_BudgetEndPass_Test_NoTarget");
+    UtTest_Add(CS_BudgetEndPass_Test_ByteLimit, CS_Test_Setup, CS_Test_TearDown, "CS_BudgetEndPass_Test_ByteLimit");
+    UtTest_Add(CS_BudgetEndPass_Test_OnTarget, CS_Test_Setup, CS_Test_TearDown, "CS_BudgetEndPass_Test_OnTarget");
+    UtTest_Add(CS_BudgetEndPass_Test_ScaleUp, CS_Test_Setup, CS_Test_TearDown, "CS_BudgetEndPass_Test_ScaleUp");
+    UtTest_Add(CS_BudgetEndPass_Test_ScaleDown, CS_Test_Setup, CS_Test_TearDown, "CS_BudgetEndPass_Test_ScaleDown");
+    UtTest_Add(CS_BudgetEndPass_Test_LimitUp, CS_Test_Setup, CS_Test_TearDown, "CS_BudgetEndPass_Test_LimitUp");
+    UtTest_Add(CS_BudgetEndPass_Test_LimitDown, CS_Test_Setup, CS_Test_TearDown, "CS_BudgetEndPass_Test_LimitDown");
+    UtTest_Add(CS_BudgetEndPass_Test_MaxBudget, CS_Test_Setup, CS_Test_TearDown, "CS_BudgetEndPass_Test_MaxBudget");
+    UtTest_Add(CS_BudgetEndPass_Test_MinBudget, CS_Test_Setup, CS_Test_TearDown, "CS_BudgetEndPass_Test_MinBudget");
+}
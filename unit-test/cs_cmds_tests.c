@@ -96,6 +96,8 @@ void CS_ResetCmd_Test(void)
     CS_AppData.HkPacket.Payload.CfeCoreCSErrCounter = 7;
     CS_AppData.HkPacket.Payload.OSCSErrCounter      = 8;
     CS_AppData.HkPacket.Payload.PassCounter         = 9;
+    CS_AppData.HkPacket.Payload.BitErrorCounter     = 10;
+    CS_AppData.HkPacket.Payload.DeadlineMissCounter = 11;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
 
@@ -112,6 +114,8 @@ void CS_ResetCmd_Test(void)
     UtAssert_True(CS_AppData.HkPacket.Payload.CfeCoreCSErrCounter == 0, "CS_AppData.HkPacket.Payload.CfeCoreCSErrCounter == 0");
     UtAssert_True(CS_AppData.HkPacket.Payload.OSCSErrCounter == 0, "CS_AppData.HkPacket.Payload.OSCSErrCounter == 0");
     UtAssert_True(CS_AppData.HkPacket.Payload.PassCounter == 0, "CS_AppData.HkPacket.Payload.PassCounter == 0");
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.BitErrorCounter, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.DeadlineMissCounter, 0);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RESET_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
@@ -177,11 +181,6 @@ void CS_BackgroundCheckCycle_Test_BackgroundInProgress(void)
     CFE_SB_MsgId_t    TestMsgId;
     CFE_MSG_FcnCode_t FcnCode;
     size_t            MsgSize;
-    int32             strCmpResult;
-    char              ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Skipping background cycle. Recompute or oneshot in progress.");
 
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     MsgSize   = sizeof(CS_NoArgsCmd_t);
@@ -194,7 +193,7 @@ void CS_BackgroundCheckCycle_Test_BackgroundInProgress(void)
     CS_AppData.HkPacket.Payload.ChecksumState  = CS_STATE_ENABLED;
     CS_AppData.HkPacket.Payload.CurrentCSTable = CS_CFECORE;
     CS_AppData.HkPacket.Payload.CfeCoreCSState = CS_STATE_ENABLED;
-    CS_AppData.CfeCoreCodeSeg.State    = CS_STATE_ENABLED;
+    CS_AppData.CfeCoreCodeSeg.State            = CS_STATE_ENABLED;
 
     CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
 
@@ -204,18 +203,11 @@ void CS_BackgroundCheckCycle_Test_BackgroundInProgress(void)
     /* Execute the function being tested */
     CS_BackgroundCheckCycle(&CmdPacket);
 
-    /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_BKGND_COMPUTE_PROG_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    /* Verify results: background checking carries on during a recompute */
+    UtAssert_STUB_COUNT(CS_BudgetStartCycle, 1);
+    UtAssert_STUB_COUNT(CS_BackgroundCfeCore, 1);
 
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
 void CS_BackgroundCheckCycle_Test_BackgroundCfeCore(void)
@@ -245,6 +237,8 @@ void CS_BackgroundCheckCycle_Test_BackgroundCfeCore(void)
     CS_BackgroundCheckCycle(&CmdPacket);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(CS_BudgetStartCycle, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -439,6 +433,7 @@ void CS_BackgroundCheckCycle_Test_Default(void)
     UtAssert_True(CS_AppData.HkPacket.Payload.CurrentCSTable == 0, "CS_AppData.HkPacket.Payload.CurrentCSTable == 0");
     UtAssert_True(CS_AppData.HkPacket.Payload.CurrentEntryInTable == 0, "CS_AppData.HkPacket.Payload.CurrentEntryInTable == 0");
     UtAssert_True(CS_AppData.HkPacket.Payload.PassCounter == 1, "CS_AppData.HkPacket.Payload.PassCounter == 1");
+    UtAssert_STUB_COUNT(CS_BudgetEndPass, 1);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -483,11 +478,6 @@ void CS_BackgroundCheckCycle_Test_OneShot(void)
     CFE_SB_MsgId_t    TestMsgId;
     CFE_MSG_FcnCode_t FcnCode;
     size_t            MsgSize;
-    int32             strCmpResult;
-    char              ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Skipping background cycle. Recompute or oneshot in progress.");
 
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     MsgSize   = sizeof(CS_NoArgsCmd_t);
@@ -500,7 +490,7 @@ void CS_BackgroundCheckCycle_Test_OneShot(void)
     CS_AppData.HkPacket.Payload.ChecksumState  = CS_STATE_ENABLED;
     CS_AppData.HkPacket.Payload.CurrentCSTable = CS_CFECORE;
     CS_AppData.HkPacket.Payload.CfeCoreCSState = CS_STATE_ENABLED;
-    CS_AppData.CfeCoreCodeSeg.State    = CS_STATE_ENABLED;
+    CS_AppData.CfeCoreCodeSeg.State            = CS_STATE_ENABLED;
 
     CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
     CS_AppData.HkPacket.Payload.OneShotInProgress   = true;
@@ -511,18 +501,11 @@ void CS_BackgroundCheckCycle_Test_OneShot(void)
     /* Execute the function being tested */
     CS_BackgroundCheckCycle(&CmdPacket);
 
-    /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_BKGND_COMPUTE_PROG_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    /* Verify results: background checking carries on during a OneShot */
+    UtAssert_STUB_COUNT(CS_BudgetStartCycle, 1);
+    UtAssert_STUB_COUNT(CS_BackgroundCfeCore, 1);
 
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
 void CS_BackgroundCheckCycle_Test_EndOfList(void)
@@ -889,17 +872,13 @@ void CS_RecomputeBaselineCfeCoreCmd_Test_Nominal(void)
     CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitRecompute), true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineCfeCoreCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_True(CS_AppData.HkPacket.Payload.RecomputeInProgress == true, "CS_AppData.HkPacket.Payload.RecomputeInProgress == true");
-    UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == false, "CS_AppData.HkPacket.Payload.OneShotInProgress == false");
-    UtAssert_True(CS_AppData.ChildTaskTable == CS_CFECORE, "CS_AppData.ChildTaskTable == CS_CFECORE");
-    UtAssert_True(CS_AppData.ChildTaskEntryID == 0, "CS_AppData.ChildTaskEntryID == 0");
-    UtAssert_True(CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.CfeCoreCodeSeg,
-                  "CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.CfeCoreCodeSeg");
+    UtAssert_STUB_COUNT(CS_JobsSubmitRecompute, 1);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_CFECORE_STARTED_DBG_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
@@ -916,57 +895,17 @@ void CS_RecomputeBaselineCfeCoreCmd_Test_Nominal(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_RecomputeBaselineCfeCoreCmd_Test_CreateChildTaskError(void)
+void CS_RecomputeBaselineCfeCoreCmd_Test_JobNotQueued(void)
 {
     CS_NoArgsCmd_t CmdPacket;
     int32          strCmpResult;
     char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Recompute cFE core failed, CFE_ES_CreateChildTask returned: 0x%%08X");
+             "Recompute cFE core failed: job queue full or recompute already queued");
 
-    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
-
-    /* Set to generate error message CS_RECOMPUTE_CFECORE_CREATE_CHDTASK_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, -1);
-
-    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-
-    /* Execute the function being tested */
-    CS_RecomputeBaselineCfeCoreCmd(&CmdPacket);
-
-    /* Verify results */
-    UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == false, "CS_AppData.HkPacket.Payload.OneShotInProgress == false");
-    UtAssert_True(CS_AppData.ChildTaskTable == CS_CFECORE, "CS_AppData.ChildTaskTable == CS_CFECORE");
-    UtAssert_True(CS_AppData.ChildTaskEntryID == 0, "CS_AppData.ChildTaskEntryID == 0");
-    UtAssert_True(CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.CfeCoreCodeSeg,
-                  "CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.CfeCoreCodeSeg");
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_CFECORE_CREATE_CHDTASK_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
-
-    UtAssert_True(CS_AppData.HkPacket.Payload.CmdErrCounter == 1, "CS_AppData.HkPacket.Payload.CmdErrCounter == 1");
-    UtAssert_True(CS_AppData.HkPacket.Payload.RecomputeInProgress == false, "CS_AppData.HkPacket.Payload.RecomputeInProgress == false");
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
-}
-
-void CS_RecomputeBaselineCfeCoreCmd_Test_ChildTaskError(void)
-{
-    CS_NoArgsCmd_t CmdPacket;
-    int32          strCmpResult;
-    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Recompute cFE core failed: child task in use");
-
-    CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
+    /* Set to generate error message CS_RECOMPUTE_CFECORE_CHDTASK_ERR_EID */
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitRecompute), false);
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
 
@@ -995,26 +934,28 @@ void CS_RecomputeBaselineCfeCoreCmd_Test_OneShot(void)
     int32          strCmpResult;
     char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Recompute cFE core failed: child task in use");
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Recompute of cFE core started");
 
     CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
 
+    /* A OneShot in progress does not keep the recompute from being queued */
     CS_AppData.HkPacket.Payload.OneShotInProgress = true;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitRecompute), true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineCfeCoreCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_CFECORE_CHDTASK_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_CFECORE_STARTED_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_True(CS_AppData.HkPacket.Payload.CmdErrCounter == 1, "CS_AppData.HkPacket.Payload.CmdErrCounter == 1");
+    UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -1033,17 +974,13 @@ void CS_RecomputeBaselineOSCmd_Test_Nominal(void)
     CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitRecompute), true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineOSCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_True(CS_AppData.HkPacket.Payload.RecomputeInProgress == true, "CS_AppData.HkPacket.Payload.RecomputeInProgress == true");
-    UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == false, "CS_AppData.HkPacket.Payload.OneShotInProgress == false");
-    UtAssert_True(CS_AppData.ChildTaskTable == CS_OSCORE, "CS_AppData.ChildTaskTable == CS_OSCORE");
-    UtAssert_True(CS_AppData.ChildTaskEntryID == 0, "CS_AppData.OSCodeSeg == 0");
-    UtAssert_True(CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.OSCodeSeg,
-                  "CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.OSCodeSeg");
+    UtAssert_STUB_COUNT(CS_JobsSubmitRecompute, 1);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_OS_STARTED_DBG_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
@@ -1060,58 +997,17 @@ void CS_RecomputeBaselineOSCmd_Test_Nominal(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_RecomputeBaselineOSCmd_Test_CreateChildTaskError(void)
+void CS_RecomputeBaselineOSCmd_Test_JobNotQueued(void)
 {
     CS_NoArgsCmd_t CmdPacket;
     int32          strCmpResult;
     char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Recompute OS code segment failed, CFE_ES_CreateChildTask returned: 0x%%08X");
+             "Recompute OS code segment failed: job queue full or recompute already queued");
 
-    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
-
-    /* Set to generate error message CS_RECOMPUTE_OS_CREATE_CHDTASK_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, -1);
-
-    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-
-    /* Execute the function being tested */
-    CS_RecomputeBaselineOSCmd(&CmdPacket);
-
-    /* Verify results */
-    UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == false, "CS_AppData.HkPacket.Payload.OneShotInProgress == false");
-    UtAssert_True(CS_AppData.ChildTaskTable == CS_OSCORE, "CS_AppData.ChildTaskTable == CS_OSCORE");
-    UtAssert_True(CS_AppData.ChildTaskEntryID == 0, "CS_AppData.OSCodeSeg == 0");
-    UtAssert_True(CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.OSCodeSeg,
-                  "CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.OSCodeSeg");
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_OS_CREATE_CHDTASK_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
-
-    UtAssert_True(CS_AppData.HkPacket.Payload.CmdErrCounter == 1, "CS_AppData.HkPacket.Payload.CmdErrCounter == 1");
-    UtAssert_True(CS_AppData.HkPacket.Payload.RecomputeInProgress == false, "CS_AppData.HkPacket.Payload.RecomputeInProgress == false");
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
-}
-
-void CS_RecomputeBaselineOSCmd_Test_ChildTaskError(void)
-{
-    CS_NoArgsCmd_t CmdPacket;
-    int32          strCmpResult;
-    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Recompute OS code segment failed: child task in use");
-
-    CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
+    /* Set to generate error message CS_RECOMPUTE_OS_CHDTASK_ERR_EID */
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitRecompute), false);
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
 
@@ -1140,27 +1036,28 @@ void CS_RecomputeBaselineOSCmd_Test_OneShot(void)
     int32          strCmpResult;
     char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Recompute OS code segment failed: child task in use");
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Recompute of OS code segment started");
 
     CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
 
+    /* A OneShot in progress does not keep the recompute from being queued */
     CS_AppData.HkPacket.Payload.OneShotInProgress = true;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitRecompute), true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineOSCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_OS_CHDTASK_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_OS_STARTED_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_True(CS_AppData.HkPacket.Payload.CmdErrCounter == 1, "CS_AppData.HkPacket.Payload.CmdErrCounter == 1");
+    UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -1185,13 +1082,13 @@ void CS_OneShotCmd_Test_Nominal(void)
     CS_AppData.MaxBytesPerCycle             = 8;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitOneShot), true);
 
     /* Execute the function being tested */
     CS_OneShotCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_True(CS_AppData.HkPacket.Payload.RecomputeInProgress == false, "CS_AppData.HkPacket.Payload.RecomputeInProgress == false");
-    UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == true, "CS_AppData.HkPacket.Payload.OneShotInProgress == true");
+    UtAssert_STUB_COUNT(CS_JobsSubmitOneShot, 1);
 
     UtAssert_True(CS_AppData.HkPacket.Payload.LastOneShotAddress == CmdPacket.Payload.Address,
                   "CS_AppData.HkPacket.Payload.LastOneShotAddress == CmdPacket.Payload.Address");
@@ -1208,7 +1105,6 @@ void CS_OneShotCmd_Test_Nominal(void)
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_DEFINED(CS_AppData.ChildTaskID));
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -1234,13 +1130,13 @@ void CS_OneShotCmd_Test_MaxBytesPerCycleNonZero(void)
     CS_AppData.MaxBytesPerCycle             = 8;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitOneShot), true);
 
     /* Execute the function being tested */
     CS_OneShotCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_True(CS_AppData.HkPacket.Payload.RecomputeInProgress == false, "CS_AppData.HkPacket.Payload.RecomputeInProgress == false");
-    UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == true, "CS_AppData.HkPacket.Payload.OneShotInProgress == true");
+    UtAssert_STUB_COUNT(CS_JobsSubmitOneShot, 1);
 
     UtAssert_True(CS_AppData.HkPacket.Payload.LastOneShotAddress == CmdPacket.Payload.Address,
                   "CS_AppData.HkPacket.Payload.LastOneShotAddress == CmdPacket.Payload.Address");
@@ -1257,7 +1153,6 @@ void CS_OneShotCmd_Test_MaxBytesPerCycleNonZero(void)
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_DEFINED(CS_AppData.ChildTaskID));
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -1266,60 +1161,16 @@ void CS_OneShotCmd_Test_MaxBytesPerCycleNonZero(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_OneShotCmd_Test_CreateChildTaskError(void)
-{
-    CS_OneShotCmd_t CmdPacket;
-    int32           strCmpResult;
-    char            ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
-    memset(&CmdPacket, 0, sizeof(CmdPacket));
-
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "OneShot checkum failed, CFE_ES_CreateChildTask returned: 0x%%08X");
-
-    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
-
-    /* Set to generate error message CS_RECOMPUTE_OS_CREATE_CHDTASK_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, -1);
-
-    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-
-    /* Execute the function being tested */
-    CS_OneShotCmd(&CmdPacket);
-
-    /* Verify results */
-    UtAssert_True(CS_AppData.HkPacket.Payload.LastOneShotAddress == CmdPacket.Payload.Address,
-                  "CS_AppData.HkPacket.Payload.LastOneShotAddress == CmdPacket.Payload.Address");
-    UtAssert_True(CS_AppData.HkPacket.Payload.LastOneShotSize == CmdPacket.Payload.Size,
-                  "CS_AppData.HkPacket.Payload.LastOneShotSize == CmdPacket.Payload.Size");
-    UtAssert_True(CS_AppData.HkPacket.Payload.LastOneShotChecksum == 0, "CS_AppData.HkPacket.Payload.LastOneShotChecksum == 0");
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_ONESHOT_CREATE_CHDTASK_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
-
-    UtAssert_True(CS_AppData.HkPacket.Payload.CmdErrCounter == 1, "CS_AppData.HkPacket.Payload.CmdErrCounter == 1");
-    UtAssert_True(CS_AppData.HkPacket.Payload.RecomputeInProgress == false, "CS_AppData.HkPacket.Payload.RecomputeInProgress == false");
-    UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == false, "CS_AppData.HkPacket.Payload.OneShotInProgress == false");
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
-}
-
-void CS_OneShotCmd_Test_ChildTaskError(void)
+void CS_OneShotCmd_Test_JobNotQueued(void)
 {
     CS_OneShotCmd_t CmdPacket;
     int32           strCmpResult;
     char            ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "OneShot checksum failed: child task in use");
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "OneShot checksum failed: job queue full");
 
-    CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
+    /* Set to generate error message CS_ONESHOT_CHDTASK_ERR_EID */
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitOneShot), false);
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
 
@@ -1383,26 +1234,29 @@ void CS_OneShotCmd_Test_OneShot(void)
     int32           strCmpResult;
     char            ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "OneShot checksum failed: child task in use");
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "OneShot checksum started on address: 0x%%08X, size: %%d");
 
     CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
 
+    /* Another OneShot in progress does not keep this one from being queued */
     CS_AppData.HkPacket.Payload.OneShotInProgress = true;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitOneShot), true);
 
     /* Execute the function being tested */
     CS_OneShotCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_ONESHOT_CHDTASK_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_ONESHOT_STARTED_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_True(CS_AppData.HkPacket.Payload.CmdErrCounter == 1, "CS_AppData.HkPacket.Payload.CmdErrCounter == 1");
+    UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -1423,14 +1277,13 @@ void CS_CancelOneShotCmd_Test_Nominal(void)
     CS_AppData.HkPacket.Payload.OneShotInProgress   = true;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsCancelOneShots), true);
 
     /* Execute the function being tested */
     CS_CancelOneShotCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(CS_AppData.ChildTaskID));
-    UtAssert_True(CS_AppData.HkPacket.Payload.RecomputeInProgress == false, "CS_AppData.HkPacket.Payload.RecomputeInProgress == false");
-    UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == false, "CS_AppData.HkPacket.Payload.OneShotInProgress == false");
+    UtAssert_STUB_COUNT(CS_JobsCancelOneShots, 1);
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_ONESHOT_CANCELLED_INF_EID);
@@ -1446,20 +1299,20 @@ void CS_CancelOneShotCmd_Test_Nominal(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_CancelOneShotCmd_Test_DeleteChildTaskError(void)
+void CS_CancelOneShotCmd_Test_NoChildTaskError(void)
 {
     CS_NoArgsCmd_t CmdPacket;
     int32          strCmpResult;
     char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Cancel OneShot checksum failed, CFE_ES_DeleteChildTask returned:  0x%%08X");
+             "Cancel OneShot checksum failed. No OneShot active");
 
-    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
-    CS_AppData.HkPacket.Payload.OneShotInProgress   = true;
+    CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
+    CS_AppData.HkPacket.Payload.OneShotInProgress   = false;
 
-    /* Set to generate error message CS_ONESHOT_CANCEL_DELETE_CHDTASK_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_DeleteChildTask), 1, -1);
+    /* Set to generate error message CS_ONESHOT_CANCEL_NO_CHDTASK_ERR_EID */
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsCancelOneShots), false);
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
 
@@ -1467,7 +1320,7 @@ void CS_CancelOneShotCmd_Test_DeleteChildTaskError(void)
     CS_CancelOneShotCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_ONESHOT_CANCEL_DELETE_CHDTASK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_ONESHOT_CANCEL_NO_CHDTASK_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
@@ -1482,7 +1335,7 @@ void CS_CancelOneShotCmd_Test_DeleteChildTaskError(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_CancelOneShotCmd_Test_NoChildTaskError(void)
+void CS_CancelOneShotCmd_Test_OneShot(void)
 {
     CS_NoArgsCmd_t CmdPacket;
     int32          strCmpResult;
@@ -1491,11 +1344,11 @@ void CS_CancelOneShotCmd_Test_NoChildTaskError(void)
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "Cancel OneShot checksum failed. No OneShot active");
 
-    CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
+    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
     CS_AppData.HkPacket.Payload.OneShotInProgress   = false;
 
     /* Set to generate error message CS_ONESHOT_CANCEL_NO_CHDTASK_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_DeleteChildTask), 1, -1);
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsCancelOneShots), false);
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
 
@@ -1518,40 +1371,331 @@ void CS_CancelOneShotCmd_Test_NoChildTaskError(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_CancelOneShotCmd_Test_OneShot(void)
+void CS_SetTimeBudgetCmd_Test_Nominal(void)
 {
-    CS_NoArgsCmd_t CmdPacket;
-    int32          strCmpResult;
-    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    CS_SetTimeBudgetCmd_t CmdPacket;
+    int32                 strCmpResult;
+    char                  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Cancel OneShot checksum failed. No OneShot active");
+             "Time budget set to %%u usec, target pass period %%u seconds");
 
-    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
-    CS_AppData.HkPacket.Payload.OneShotInProgress   = false;
+    CmdPacket.Payload.TimeBudget       = CS_MIN_TIME_BUDGET;
+    CmdPacket.Payload.TargetPassPeriod = 60;
+    CS_AppData.Budget.PassTimed        = true;
 
-    /* Set to generate error message CS_ONESHOT_CANCEL_NO_CHDTASK_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_DeleteChildTask), 1, -1);
+    /* Execute the function being tested */
+    CS_SetTimeBudgetCmd(&CmdPacket);
 
-    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.TimeBudget, CS_MIN_TIME_BUDGET);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.TargetPassPeriod, 60);
+    UtAssert_BOOL_FALSE(CS_AppData.Budget.PassTimed);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_TIME_BUDGET_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_SetTimeBudgetCmd_Test_ByteLimit(void)
+{
+    CS_SetTimeBudgetCmd_t CmdPacket;
+
+    CS_AppData.HkPacket.Payload.TimeBudget = CS_MAX_TIME_BUDGET;
+
+    CmdPacket.Payload.TimeBudget       = 0;
+    CmdPacket.Payload.TargetPassPeriod = 0;
 
     /* Execute the function being tested */
-    CS_CancelOneShotCmd(&CmdPacket);
+    CS_SetTimeBudgetCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_ONESHOT_CANCEL_NO_CHDTASK_ERR_EID);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.TimeBudget, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_TIME_BUDGET_INF_EID);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_SetTimeBudgetCmd_Test_TooSmall(void)
+{
+    CS_SetTimeBudgetCmd_t CmdPacket;
+    int32                 strCmpResult;
+    char                  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Set time budget failed, budget %%u usec is not 0 or in %%u to %%u");
+
+    CS_AppData.HkPacket.Payload.TimeBudget = 1000;
+
+    CmdPacket.Payload.TimeBudget       = CS_MIN_TIME_BUDGET - 1;
+    CmdPacket.Payload.TargetPassPeriod = 60;
+
+    /* Execute the function being tested */
+    CS_SetTimeBudgetCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.TimeBudget, 1000);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.TargetPassPeriod, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_TIME_BUDGET_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_True(CS_AppData.HkPacket.Payload.CmdErrCounter == 1, "CS_AppData.HkPacket.Payload.CmdErrCounter == 1");
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+void CS_SetTimeBudgetCmd_Test_TooLarge(void)
+{
+    CS_SetTimeBudgetCmd_t CmdPacket;
 
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
+    CmdPacket.Payload.TimeBudget       = CS_MAX_TIME_BUDGET + 1;
+    CmdPacket.Payload.TargetPassPeriod = 60;
+
+    /* Execute the function being tested */
+    CS_SetTimeBudgetCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.TimeBudget, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_TIME_BUDGET_ERR_EID);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_SetRevisitPeriodCmd_Test_Nominal(void)
+{
+    CS_SetRevisitPeriodCmd_t CmdPacket;
+    int32                    strCmpResult;
+    char                     ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Revisit period of table type %%d set to %%u seconds");
+
+    CmdPacket.Payload.Table                    = CS_MEMORY_TABLE;
+    CmdPacket.Payload.RevisitPeriod            = 30;
+    CS_AppData.Sched.Deadline[CS_MEMORY_TABLE] = 1;
+
+    /* Execute the function being tested */
+    CS_SetRevisitPeriodCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.Sched.RevisitPeriod[CS_MEMORY_TABLE], 30);
+    UtAssert_UINT32_EQ(CS_AppData.Sched.Deadline[CS_MEMORY_TABLE], 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_REVISIT_PERIOD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_SetRevisitPeriodCmd_Test_InvalidTable(void)
+{
+    CS_SetRevisitPeriodCmd_t CmdPacket;
+
+    CmdPacket.Payload.Table         = CS_NUM_TABLES;
+    CmdPacket.Payload.RevisitPeriod = 30;
+
+    /* Execute the function being tested */
+    CS_SetRevisitPeriodCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_REVISIT_PERIOD_ERR_EID);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_SetJobRateCmd_Test_Nominal(void)
+{
+    CS_SetJobRateCmd_t CmdPacket;
+    int32              strCmpResult;
+    char               ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Job rate set to %%u bytes per second, burst %%u bytes");
+
+    CmdPacket.Payload.BytesPerSecond = 1000000;
+    CmdPacket.Payload.BurstBytes     = 65536;
+
+    /* Execute the function being tested */
+    CS_SetJobRateCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.JobRate, 1000000);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.JobBurst, 65536);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_JOB_RATE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_SetJobRateCmd_Test_Unlimited(void)
+{
+    CS_SetJobRateCmd_t CmdPacket;
+
+    CmdPacket.Payload.BytesPerSecond = 0;
+    CmdPacket.Payload.BurstBytes     = 0;
+
+    /* Execute the function being tested */
+    CS_SetJobRateCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.JobRate, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_JOB_RATE_INF_EID);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_SetJobRateCmd_Test_InvalidBurst(void)
+{
+    CS_SetJobRateCmd_t CmdPacket;
+
+    CS_AppData.HkPacket.Payload.JobRate  = 100;
+    CS_AppData.HkPacket.Payload.JobBurst = 100;
+    CmdPacket.Payload.BytesPerSecond     = 1000;
+    CmdPacket.Payload.BurstBytes         = 0;
+
+    /* Execute the function being tested */
+    CS_SetJobRateCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.JobRate, 100);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.JobBurst, 100);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_JOB_RATE_ERR_EID);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_ManageTableCmd_Test_Nominal(void)
+{
+    CS_ManageTableCmd_t CmdPacket;
+
+    CmdPacket.Payload.Parameter = CS_TABLES_TABLE;
+
+    /* Execute the function being tested */
+    CS_ManageTableCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.TableManagePending, CS_TABLE_BIT(CS_TABLES_TABLE));
+    UtAssert_STUB_COUNT(CS_HandleRoutineTableUpdates, 1);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_ManageTableCmd_Test_BlockTable(void)
+{
+    CS_ManageTableCmd_t CmdPacket;
+
+    CmdPacket.Payload.Parameter = CS_BLOCK_TABLE;
+
+    /* Execute the function being tested */
+    CS_ManageTableCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.TableManagePending, CS_TABLE_BIT(CS_BLOCK_TABLE));
+    UtAssert_STUB_COUNT(CS_HandleRoutineTableUpdates, 1);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_ManageTableCmd_Test_InvalidTable(void)
+{
+    CS_ManageTableCmd_t CmdPacket;
+
+    CmdPacket.Payload.Parameter = CS_OSCORE;
+
+    /* Execute the function being tested */
+    CS_ManageTableCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.TableManagePending, 0);
+    UtAssert_STUB_COUNT(CS_HandleRoutineTableUpdates, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_MANAGE_TABLE_ERR_EID);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_RecomputeAllCmd_Test_Nominal(void)
+{
+    CS_RecomputeAllCmd_t CmdPacket;
+
+    CmdPacket.Payload.Table = CS_MEMORY_TABLE;
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitRecompute), true);
+
+    /* Execute the function being tested */
+    CS_RecomputeAllCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_JobsSubmitRecompute, 1);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_ALL_STARTED_DBG_EID);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_RecomputeAllCmd_Test_JobNotQueued(void)
+{
+    CS_RecomputeAllCmd_t CmdPacket;
+
+    CmdPacket.Payload.Table = CS_MEMORY_TABLE;
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitRecompute), false);
+
+    /* Execute the function being tested */
+    CS_RecomputeAllCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_JobsSubmitRecompute, 1);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_ALL_CHDTASK_ERR_EID);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_RecomputeAllCmd_Test_InvalidTable(void)
+{
+    CS_RecomputeAllCmd_t CmdPacket;
+
+    CmdPacket.Payload.Table = CS_NUM_TABLES;
+
+    /* Execute the function being tested */
+    CS_RecomputeAllCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_JobsSubmitRecompute, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_ALL_INVALID_ERR_EID);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
 void UtTest_Setup(void)
@@ -1609,36 +1753,51 @@ void UtTest_Setup(void)
 
     UtTest_Add(CS_RecomputeBaselineCfeCoreCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineCfeCoreCmd_Test_Nominal");
-    UtTest_Add(CS_RecomputeBaselineCfeCoreCmd_Test_CreateChildTaskError, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeBaselineCfeCoreCmd_Test_CreateChildTaskError");
-    UtTest_Add(CS_RecomputeBaselineCfeCoreCmd_Test_ChildTaskError, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeBaselineCfeCoreCmd_Test_ChildTaskError");
+    UtTest_Add(CS_RecomputeBaselineCfeCoreCmd_Test_JobNotQueued, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeBaselineCfeCoreCmd_Test_JobNotQueued");
     UtTest_Add(CS_RecomputeBaselineCfeCoreCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineCfeCoreCmd_Test_OneShot");
 
     UtTest_Add(CS_RecomputeBaselineOSCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineOSCmd_Test_Nominal");
-    UtTest_Add(CS_RecomputeBaselineOSCmd_Test_CreateChildTaskError, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeBaselineOSCmd_Test_CreateChildTaskError");
-    UtTest_Add(CS_RecomputeBaselineOSCmd_Test_ChildTaskError, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeBaselineOSCmd_Test_ChildTaskError");
+    UtTest_Add(CS_RecomputeBaselineOSCmd_Test_JobNotQueued, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeBaselineOSCmd_Test_JobNotQueued");
     UtTest_Add(CS_RecomputeBaselineOSCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineOSCmd_Test_OneShot");
 
     UtTest_Add(CS_OneShotCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown, "CS_OneShotCmd_Test_Nominal");
     UtTest_Add(CS_OneShotCmd_Test_MaxBytesPerCycleNonZero, CS_Test_Setup, CS_Test_TearDown,
                "CS_OneShotCmd_Test_MaxBytesPerCycleNonZero");
-    UtTest_Add(CS_OneShotCmd_Test_CreateChildTaskError, CS_Test_Setup, CS_Test_TearDown,
-               "CS_OneShotCmd_Test_CreateChildTaskError");
-    UtTest_Add(CS_OneShotCmd_Test_ChildTaskError, CS_Test_Setup, CS_Test_TearDown, "CS_OneShotCmd_Test_ChildTaskError");
+    UtTest_Add(CS_OneShotCmd_Test_JobNotQueued, CS_Test_Setup, CS_Test_TearDown, "CS_OneShotCmd_Test_JobNotQueued");
     UtTest_Add(CS_OneShotCmd_Test_MemValidateRangeError, CS_Test_Setup, CS_Test_TearDown,
                "CS_OneShotCmd_Test_MemValidateRangeError");
     UtTest_Add(CS_OneShotCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown, "CS_OneShotCmd_Test_OneShot");
 
     UtTest_Add(CS_CancelOneShotCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown, "CS_CancelOneShotCmd_Test_Nominal");
-    UtTest_Add(CS_CancelOneShotCmd_Test_DeleteChildTaskError, CS_Test_Setup, CS_Test_TearDown,
-               "CS_CancelOneShotCmd_Test_DeleteChildTaskError");
     UtTest_Add(CS_CancelOneShotCmd_Test_NoChildTaskError, CS_Test_Setup, CS_Test_TearDown,
                "CS_CancelOneShotCmd_Test_NoChildTaskError");
     UtTest_Add(CS_CancelOneShotCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown, "CS_CancelOneShotCmd_Test_OneShot");
+    UtTest_Add(CS_SetTimeBudgetCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown, "CS_SetTimeBudgetCmd_Test_Nominal");
+    UtTest_Add(CS_SetTimeBudgetCmd_Test_ByteLimit, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SetTimeBudgetCmd_Test_ByteLimit");
+    UtTest_Add(CS_SetTimeBudgetCmd_Test_TooSmall, CS_Test_Setup, CS_Test_TearDown, "CS_SetTimeBudgetCmd_Test_TooSmall");
+    UtTest_Add(CS_SetTimeBudgetCmd_Test_TooLarge, CS_Test_Setup, CS_Test_TearDown, "CS_SetTimeBudgetCmd_Test_TooLarge");
+    UtTest_Add(CS_SetRevisitPeriodCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SetRevisitPeriodCmd_Test_Nominal");
+    UtTest_Add(CS_SetRevisitPeriodCmd_Test_InvalidTable, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SetRevisitPeriodCmd_Test_InvalidTable");
+    UtTest_Add(CS_SetJobRateCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown, "CS_SetJobRateCmd_Test_Nominal");
+    UtTest_Add(CS_SetJobRateCmd_Test_Unlimited, CS_Test_Setup, CS_Test_TearDown, "CS_SetJobRateCmd_Test_Unlimited");
+    UtTest_Add(CS_SetJobRateCmd_Test_InvalidBurst, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SetJobRateCmd_Test_InvalidBurst");
+    UtTest_Add(CS_ManageTableCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown, "CS_ManageTableCmd_Test_Nominal");
+    UtTest_Add(CS_ManageTableCmd_Test_BlockTable, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ManageTableCmd_Test_BlockTable");
+    UtTest_Add(CS_ManageTableCmd_Test_InvalidTable, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ManageTableCmd_Test_InvalidTable");
+    UtTest_Add(CS_RecomputeAllCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown, "CS_RecomputeAllCmd_Test_Nominal");
+    UtTest_Add(CS_RecomputeAllCmd_Test_JobNotQueued, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeAllCmd_Test_JobNotQueued");
+    UtTest_Add(CS_RecomputeAllCmd_Test_InvalidTable, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeAllCmd_Test_InvalidTable");
 }
@@ -27,6 +27,11 @@
 #include "cs_events.h"
 #include "cs_version.h"
 #include "cs_utils.h"
+#include "cs_crc.h"
+#include "cs_budget.h"
+#include "cs_algorithm.h"
+#include "cs_worker.h"
+#include "cs_block.h"
 #include "cs_test_utils.h"
 #include <unistd.h>
 #include <stdlib.h>
@@ -69,6 +74,21 @@ void CS_COMPUTE_TEST_CFE_TBL_ShareHandler(void *UserObj, UT_EntryKey_t FuncKey,
     *TblHandlePtr = 99;
 }
 
+void CS_COMPUTE_TEST_CFE_TBL_GetAddressHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void **TblPtr = (void **)UT_Hook_GetArgValueByName(Context, "TblPtr", void **);
+
+    *TblPtr = UserObj;
+}
+
+void CS_COMPUTE_TEST_CFE_TBL_GetInfoHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_TBL_Info_t *TblInfoPtr = (CFE_TBL_Info_t *)UT_Hook_GetArgValueByName(Context, "TblInfoPtr", CFE_TBL_Info_t *);
+
+    memset(TblInfoPtr, 0, sizeof(*TblInfoPtr));
+    TblInfoPtr->Size = *(size_t *)UserObj;
+}
+
 void CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler1(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
     CFE_ES_AppInfo_t *AppInfo =
@@ -79,6 +99,13 @@ void CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler1(void *UserObj, UT_EntryKey_t F
     AppInfo->AddressesAreValid = true;
 }
 
+void CS_COMPUTE_TEST_CFE_ES_GetAppIDByNameHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_ES_AppId_t *AppIdPtr = UT_Hook_GetArgValueByName(Context, "AppIdPtr", CFE_ES_AppId_t *);
+
+    *AppIdPtr = *(CFE_ES_AppId_t *)UserObj;
+}
+
 void CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler2(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
     CFE_ES_AppInfo_t *AppInfo =
@@ -87,6 +114,14 @@ void CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler2(void *UserObj, UT_EntryKey_t F
     AppInfo->AddressesAreValid = false;
 }
 
+void CS_COMPUTE_TEST_CS_GetDefTblEntryByNameHandler(void *UserObj, UT_EntryKey_t FuncKey,
+                                                    const UT_StubContext_t *Context)
+{
+    void **EntryPtr = (void **)UT_Hook_GetArgValueByName(Context, "EntryPtr", void **);
+
+    *EntryPtr = UserObj;
+}
+
 void CS_ComputeEepromMemory_Test_Nominal(void)
 {
     CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
@@ -101,15 +136,17 @@ void CS_ComputeEepromMemory_Test_Nominal(void)
     ResultsEntry.ComputedYet = true;
 
     ResultsEntry.ComparisonValue = 1;
+    ResultsEntry.ComparisonDigest.Bytes[3] = 1;
 
     /* Set to fail condition "NewChecksumValue != ResultsEntry -> ComparisonValue" */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 1);
+    UT_SetDefaultReturnValue(UT_KEY(CS_ChecksumFinal), 1);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_TRUE(DoneWithEntry);
+    UtAssert_STUB_COUNT(CS_BlockTreeUpdate, 1);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
@@ -128,12 +165,13 @@ void CS_ComputeEepromMemory_Test_Error(void)
     ResultsEntry.ComputedYet = true;
 
     ResultsEntry.ComparisonValue = 5;
+    ResultsEntry.ComparisonDigest.Bytes[3] = 5;
 
     /* Set to satisfy condition "NewChecksumValue != ResultsEntry -> ComparisonValue" */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 1);
+    UT_SetDefaultReturnValue(UT_KEY(CS_ChecksumFinal), 1);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERROR);
+    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CS_ERROR);
 
     /* Verify results */
     UtAssert_BOOL_TRUE(DoneWithEntry);
@@ -155,10 +193,10 @@ void CS_ComputeEepromMemory_Test_FirstTimeThrough(void)
     ResultsEntry.ComputedYet = false;
 
     /* ComputedCSValue and ResultsEntry.ComparisonValue will be set to value returned by this function */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFinal), 1, 1);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_TRUE(DoneWithEntry);
@@ -167,7 +205,6 @@ void CS_ComputeEepromMemory_Test_FirstTimeThrough(void)
     UtAssert_UINT32_EQ(ResultsEntry.ComparisonValue, 1);
     UtAssert_UINT32_EQ(ComputedCSValue, 1);
     UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 0);
-    UtAssert_UINT32_EQ(ResultsEntry.TempChecksumValue, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
@@ -185,15 +222,62 @@ void CS_ComputeEepromMemory_Test_NotFinished(void)
 
     ResultsEntry.ComputedYet = false;
 
-    /* ComputedCSValue and ResultsEntry.TempChecksumValue will be set to value returned by this function */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
-
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 1);
-    UtAssert_UINT32_EQ(ResultsEntry.TempChecksumValue, 1);
+    UtAssert_STUB_COUNT(CS_ChecksumFinal, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_ComputeEepromMemory_Test_WorkerLanes(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    uint32                            ComputedCSValue = 0;
+    bool                              DoneWithEntry   = false;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.NumBytesToChecksum = 10;
+    CS_AppData.MaxBytesPerCycle     = 2;
+
+    /* Worker pool with two workers plus the calling task */
+    UT_SetDefaultReturnValue(UT_KEY(CS_WorkerPoolLanes), 3);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
+
+    /* Verify results: the byte limit is passed as is, the budget scales it only when the pool stripes */
+    UtAssert_BOOL_FALSE(DoneWithEntry);
+    UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 2);
+    UtAssert_STUB_COUNT(CS_BudgetChecksumUpdate, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_ComputeEepromMemory_Test_TimeBudget(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    uint32                            ComputedCSValue = 0;
+    bool                              DoneWithEntry   = false;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.NumBytesToChecksum = 10;
+    CS_AppData.MaxBytesPerCycle     = 2;
+
+    /* The time budget allowed more than the byte limit */
+    UT_SetDefaultReturnValue(UT_KEY(CS_BudgetChecksumUpdate), 8);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(DoneWithEntry);
+    UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 8);
+    UtAssert_STUB_COUNT(CS_BudgetChecksumUpdate, 1);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
@@ -218,7 +302,7 @@ void CS_ComputeTables_Test_TableNeverLoaded(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_ERR_NEVER_LOADED);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERR_NOT_FOUND);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CS_ERR_NOT_FOUND);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -258,7 +342,7 @@ void CS_ComputeTables_Test_TableUnregisteredAndNeverLoaded(void)
     UT_SetDeferredRetcode(UT_KEY(CS_AttemptTableReshare), 1, -1);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERR_NOT_FOUND);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CS_ERR_NOT_FOUND);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -303,7 +387,7 @@ void CS_ComputeTables_Test_ResultShareNotSuccess(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_ERR_UNREGISTERED);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERR_NOT_FOUND);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CS_ERR_NOT_FOUND);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -343,7 +427,7 @@ void CS_ComputeTables_Test_TblInfoUpdated(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -354,7 +438,46 @@ void CS_ComputeTables_Test_TblInfoUpdated(void)
     UtAssert_BOOL_FALSE(ResultsEntry.ComputedYet);
     UtAssert_UINT32_EQ(ResultsEntry.ComparisonValue, 0);
     UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 0);
-    UtAssert_UINT32_EQ(ResultsEntry.TempChecksumValue, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_ComputeTables_Test_CachedInfo(void)
+{
+    CS_Res_Tables_Table_Entry_t ResultsEntry;
+    uint32                      ComputedCSValue = 0;
+    bool                        DoneWithEntry   = false;
+    CFE_TBL_Info_t              TblInfo;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+    memset(&TblInfo, 0, sizeof(TblInfo));
+
+    ResultsEntry.TblHandle          = 99;
+    ResultsEntry.InfoCached         = true;
+    ResultsEntry.NumBytesToChecksum = 5;
+    CS_AppData.MaxBytesPerCycle     = 5;
+
+    TblInfo.Size = 7;
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetInfo), &TblInfo, sizeof(TblInfo), false);
+
+    /* Execute the function being tested, with the same table image as last time */
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(DoneWithEntry);
+    UtAssert_BOOL_TRUE(ResultsEntry.InfoCached);
+    UtAssert_UINT32_EQ(ResultsEntry.NumBytesToChecksum, 5);
+    UtAssert_STUB_COUNT(CFE_TBL_GetInfo, 0);
+    UtAssert_STUB_COUNT(CFE_TBL_Share, 0);
+
+    /* A new table image reads the size again */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
+
+    UtAssert_BOOL_TRUE(ResultsEntry.InfoCached);
+    UtAssert_UINT32_EQ(ResultsEntry.NumBytesToChecksum, 7);
+    UtAssert_STUB_COUNT(CFE_TBL_GetInfo, 1);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
@@ -384,7 +507,7 @@ void CS_ComputeTables_Test_GetInfoResult(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -395,7 +518,6 @@ void CS_ComputeTables_Test_GetInfoResult(void)
     UtAssert_BOOL_FALSE(ResultsEntry.ComputedYet);
     UtAssert_UINT32_EQ(ResultsEntry.ComparisonValue, 0);
     UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 0);
-    UtAssert_UINT32_EQ(ResultsEntry.TempChecksumValue, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
@@ -417,6 +539,7 @@ void CS_ComputeTables_Test_CSError(void)
     ResultsEntry.ComputedYet = true;
 
     ResultsEntry.ComparisonValue = 1;
+    ResultsEntry.ComparisonDigest.Bytes[3] = 1;
 
     /* Sets TblInfo.Size = 5 and returns CFE_SUCCESS */
     TblInfo.Size = 5;
@@ -428,10 +551,10 @@ void CS_ComputeTables_Test_CSError(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
 
     /* Set to fail condition "NewChecksumValue != ResultsEntry -> ComparisonValue" */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 2);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFinal), 1, 2);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERROR);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CS_ERROR);
 
     /* Verify results */
     UtAssert_BOOL_TRUE(DoneWithEntry);
@@ -440,7 +563,6 @@ void CS_ComputeTables_Test_CSError(void)
     UtAssert_UINT32_EQ(ResultsEntry.StartAddress, 0);
     UtAssert_UINT32_EQ(ComputedCSValue, 2);
     UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 0);
-    UtAssert_UINT32_EQ(ResultsEntry.TempChecksumValue, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
@@ -462,6 +584,7 @@ void CS_ComputeTables_Test_NominalBadTableHandle(void)
     ResultsEntry.ComputedYet = true;
 
     ResultsEntry.ComparisonValue = 2;
+    ResultsEntry.ComparisonDigest.Bytes[3] = 2;
 
     /* Sets ResultsEntry->TblHandle to 99 and returns CFE_SUCCESS */
     UT_SetHandlerFunction(UT_KEY(CFE_TBL_Share), CS_COMPUTE_TEST_CFE_TBL_ShareHandler, NULL);
@@ -476,10 +599,10 @@ void CS_ComputeTables_Test_NominalBadTableHandle(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
 
     /* Set to fail condition "NewChecksumValue != ResultsEntry -> ComparisonValue" */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 2);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFinal), 1, 2);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_TRUE(DoneWithEntry);
@@ -490,7 +613,6 @@ void CS_ComputeTables_Test_NominalBadTableHandle(void)
     UtAssert_UINT32_EQ(ResultsEntry.StartAddress, 0);
     UtAssert_UINT32_EQ(ComputedCSValue, 2);
     UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 0);
-    UtAssert_UINT32_EQ(ResultsEntry.TempChecksumValue, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
@@ -512,6 +634,7 @@ void CS_ComputeTables_Test_FirstTimeThrough(void)
     ResultsEntry.ComputedYet = false;
 
     ResultsEntry.ComparisonValue = 2;
+    ResultsEntry.ComparisonDigest.Bytes[3] = 2;
 
     /* Sets ResultsEntry->TblHandle to 99 and returns CFE_SUCCESS */
     UT_SetHandlerFunction(UT_KEY(CFE_TBL_Share), CS_COMPUTE_TEST_CFE_TBL_ShareHandler, NULL);
@@ -526,10 +649,10 @@ void CS_ComputeTables_Test_FirstTimeThrough(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
 
     /* Set to cause ResultsEntry->ComparisonValue to be set to 3 */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 3);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFinal), 1, 3);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_TRUE(DoneWithEntry);
@@ -537,6 +660,7 @@ void CS_ComputeTables_Test_FirstTimeThrough(void)
     UtAssert_INT32_EQ(ResultsEntry.TblHandle, 99);
 
     UtAssert_UINT32_EQ(ResultsEntry.NumBytesToChecksum, 5);
+    UtAssert_BOOL_TRUE(ResultsEntry.InfoCached);
     UtAssert_UINT32_EQ(ResultsEntry.StartAddress, 0);
 
     UtAssert_BOOL_TRUE(ResultsEntry.ComputedYet);
@@ -544,11 +668,238 @@ void CS_ComputeTables_Test_FirstTimeThrough(void)
 
     UtAssert_UINT32_EQ(ComputedCSValue, 3);
     UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 0);
-    UtAssert_UINT32_EQ(ResultsEntry.TempChecksumValue, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void CS_ComputeTables_Test_TableServicesCrc(void)
+{
+    CS_Res_Tables_Table_Entry_t ResultsEntry;
+    uint32                      ComputedCSValue = 0;
+    bool                        DoneWithEntry   = false;
+    CFE_TBL_Info_t              TblInfo;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+    memset(&TblInfo, 0, sizeof(TblInfo));
+
+    ResultsEntry.TblHandle      = 99;
+    ResultsEntry.InfoCached     = true;
+    CS_AppData.MaxBytesPerCycle = 5;
+
+    TblInfo.Size            = 5;
+    TblInfo.Crc             = 0x1234;
+    TblInfo.TableLoadedOnce = true;
+
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetInfo), &TblInfo, sizeof(TblInfo), false);
+
+    /* The table was just updated, but not again before the entry is finished */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFinal), 1, 0x1234);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(DoneWithEntry);
+    UtAssert_BOOL_TRUE(ResultsEntry.ComputedYet);
+    UtAssert_UINT32_EQ(ResultsEntry.ComparisonValue, 0x1234);
+    UtAssert_UINT32_EQ(ResultsEntry.ComparisonDigest.Bytes[2], 0x12);
+    UtAssert_UINT32_EQ(ResultsEntry.ComparisonDigest.Bytes[3], 0x34);
+    UtAssert_UINT32_EQ(ComputedCSValue, 0x1234);
+    UtAssert_STUB_COUNT(CS_ChecksumFromCrc, 1);
+
+    /* The first pass checks the table against the Table Services CRC */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFinal), 1, 0x4321);
+
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CS_ERROR);
+
+    UtAssert_BOOL_TRUE(DoneWithEntry);
+    UtAssert_UINT32_EQ(ResultsEntry.ComparisonValue, 0x1234);
+    UtAssert_UINT32_EQ(ComputedCSValue, 0x4321);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_ComputeTables_Test_TableServicesCrcNotUsed(void)
+{
+    CS_Res_Tables_Table_Entry_t ResultsEntry;
+    uint32                      ComputedCSValue = 0;
+    bool                        DoneWithEntry   = false;
+    CFE_TBL_Info_t              TblInfo;
+    CS_Job_t                    Job;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+    memset(&TblInfo, 0, sizeof(TblInfo));
+    memset(&Job, 0, sizeof(Job));
+
+    ResultsEntry.TblHandle      = 99;
+    CS_AppData.MaxBytesPerCycle = 5;
+
+    TblInfo.Size            = 5;
+    TblInfo.Crc             = 0x1234;
+    TblInfo.TableLoadedOnce = true;
+
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetInfo), &TblInfo, sizeof(TblInfo), false);
+
+    /* The entry uses a different algorithm, so the first pass computes the baseline */
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFromCrc), 1, false);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFinal), 1, 3);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(DoneWithEntry);
+    UtAssert_BOOL_TRUE(ResultsEntry.ComputedYet);
+    UtAssert_UINT32_EQ(ResultsEntry.ComparisonValue, 3);
+    UtAssert_STUB_COUNT(CS_ChecksumFromCrc, 1);
+
+    /* A recompute takes on the value it computes */
+    ResultsEntry.ComputedYet = false;
+    ResultsEntry.InfoCached  = false;
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFinal), 1, 4);
+
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, &Job), CFE_SUCCESS);
+
+    UtAssert_UINT32_EQ(ResultsEntry.ComparisonValue, 4);
+    UtAssert_STUB_COUNT(CS_ChecksumFromCrc, 1);
+
+    /* Dump-only tables are not loaded, so there is no CRC to use */
+    ResultsEntry.ComputedYet = false;
+    ResultsEntry.InfoCached  = false;
+    TblInfo.DumpOnly         = true;
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetInfo), &TblInfo, sizeof(TblInfo), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFinal), 1, 5);
+
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
+
+    UtAssert_UINT32_EQ(ResultsEntry.ComparisonValue, 5);
+    UtAssert_STUB_COUNT(CS_ChecksumFromCrc, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_ComputeTables_Test_Snapshot(void)
+{
+    CS_Res_Tables_Table_Entry_t ResultsEntry;
+    uint32                      ComputedCSValue = 0;
+    bool                        DoneWithEntry   = false;
+    uint8                       Table[8]        = {1, 2, 3, 4, 5, 6, 7, 8};
+    size_t                      TableSize       = sizeof(Table);
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.TblHandle                 = 99;
+    ResultsEntry.Snapshot                  = true;
+    ResultsEntry.InfoCached                = true;
+    ResultsEntry.NumBytesToChecksum        = sizeof(Table);
+    ResultsEntry.ComputedYet               = true;
+    ResultsEntry.ComparisonValue           = 3;
+    ResultsEntry.ComparisonDigest.Bytes[3] = 3;
+    CS_AppData.MaxBytesPerCycle            = 4;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_TBL_GetAddress), CS_COMPUTE_TEST_CFE_TBL_GetAddressHandler, Table);
+    UT_SetHandlerFunction(UT_KEY(CFE_TBL_GetInfo), CS_COMPUTE_TEST_CFE_TBL_GetInfoHandler, &TableSize);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(DoneWithEntry);
+    UtAssert_ADDRESS_EQ(CS_AppData.SnapshotOwner, &ResultsEntry);
+    UtAssert_MemCmp(CS_AppData.TableSnapshot, Table, sizeof(Table), "Snapshot is a copy of the table");
+    UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 4);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 1);
+
+    /* An update while the snapshot is checked does not start the entry over */
+    Table[0] = 99;
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFinal), 1, 3);
+
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
+
+    UtAssert_BOOL_TRUE(DoneWithEntry);
+    UtAssert_UINT32_EQ(ComputedCSValue, 3);
+    UtAssert_UINT32_EQ(CS_AppData.TableSnapshot[0], 1);
+    UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 0);
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 2);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 2);
+
+    /* The next pass needs a baseline of the updated table */
+    UtAssert_BOOL_FALSE(ResultsEntry.ComputedYet);
+    UtAssert_BOOL_FALSE(ResultsEntry.InfoCached);
+    UtAssert_BOOL_FALSE(ResultsEntry.SnapshotStale);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_ComputeTables_Test_SnapshotReplaced(void)
+{
+    CS_Res_Tables_Table_Entry_t ResultsEntry;
+    CS_Res_Tables_Table_Entry_t OtherEntry;
+    uint32                      ComputedCSValue = 0;
+    bool                        DoneWithEntry   = false;
+    uint8                       Table[8]        = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.TblHandle          = 99;
+    ResultsEntry.Snapshot           = true;
+    ResultsEntry.InfoCached         = true;
+    ResultsEntry.NumBytesToChecksum = sizeof(Table);
+    ResultsEntry.ByteOffset         = 4;
+    CS_AppData.MaxBytesPerCycle     = 4;
+    CS_AppData.SnapshotOwner        = &OtherEntry;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_TBL_GetAddress), CS_COMPUTE_TEST_CFE_TBL_GetAddressHandler, Table);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(DoneWithEntry);
+    UtAssert_ADDRESS_EQ(CS_AppData.SnapshotOwner, &ResultsEntry);
+    UtAssert_MemCmp(CS_AppData.TableSnapshot, Table, sizeof(Table), "Snapshot is a copy of the table");
+    UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 4);
+    UtAssert_STUB_COUNT(CS_ChecksumInit, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_ComputeTables_Test_SnapshotTooLarge(void)
+{
+    CS_Res_Tables_Table_Entry_t ResultsEntry;
+    uint32                      ComputedCSValue = 0;
+    bool                        DoneWithEntry   = false;
+    size_t                      TableSize       = CS_TABLE_SNAPSHOT_SIZE + 1;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.TblHandle      = 99;
+    ResultsEntry.Snapshot       = true;
+    CS_AppData.MaxBytesPerCycle = 4;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_TBL_GetInfo), CS_COMPUTE_TEST_CFE_TBL_GetInfoHandler, &TableSize);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_NULL(CS_AppData.SnapshotOwner);
+    UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 4);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_COMPUTE_TABLES_SNAPSHOT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    /* The size is only reported when the table is loaded, and it is checksummed in place */
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
+
+    UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 8);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
 void CS_ComputeTables_Test_EntryNotFinished(void)
 {
     CS_Res_Tables_Table_Entry_t ResultsEntry;
@@ -566,6 +917,7 @@ void CS_ComputeTables_Test_EntryNotFinished(void)
     ResultsEntry.ComputedYet = false;
 
     ResultsEntry.ComparisonValue = 2;
+    ResultsEntry.ComparisonDigest.Bytes[3] = 2;
 
     /* Sets ResultsEntry->TblHandle to 99 and returns CFE_SUCCESS */
     UT_SetHandlerFunction(UT_KEY(CFE_TBL_Share), CS_COMPUTE_TEST_CFE_TBL_ShareHandler, NULL);
@@ -579,11 +931,8 @@ void CS_ComputeTables_Test_EntryNotFinished(void)
      * Result */
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
 
-    /* Set to cause ResultsEntry->ComparisonValue to be set to 3 */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 3);
-
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -593,9 +942,9 @@ void CS_ComputeTables_Test_EntryNotFinished(void)
     UtAssert_UINT32_EQ(ResultsEntry.NumBytesToChecksum, 5);
     UtAssert_UINT32_EQ(ResultsEntry.StartAddress, 0);
 
-    UtAssert_UINT32_EQ(ComputedCSValue, 3);
+    UtAssert_UINT32_EQ(ComputedCSValue, 0);
     UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 3);
-    UtAssert_UINT32_EQ(ResultsEntry.TempChecksumValue, 3);
+    UtAssert_STUB_COUNT(CS_ChecksumFinal, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
@@ -621,6 +970,7 @@ void CS_ComputeTables_Test_ComputeTablesReleaseError(void)
     ResultsEntry.ComputedYet = false;
 
     ResultsEntry.ComparisonValue = 2;
+    ResultsEntry.ComparisonDigest.Bytes[3] = 2;
 
     strncpy(ResultsEntry.Name, "name", 10);
 
@@ -636,14 +986,11 @@ void CS_ComputeTables_Test_ComputeTablesReleaseError(void)
      * Result */
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
 
-    /* Set to cause ResultsEntry->ComparisonValue to be set to 3 */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 3);
-
     /* Set to generate error message CS_COMPUTE_TABLES_RELEASE_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_TBL_ReleaseAddress), 1, -1);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -654,8 +1001,8 @@ void CS_ComputeTables_Test_ComputeTablesReleaseError(void)
     UtAssert_UINT32_EQ(ResultsEntry.StartAddress, 0);
 
     UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 3);
-    UtAssert_UINT32_EQ(ResultsEntry.TempChecksumValue, 3);
-    UtAssert_UINT32_EQ(ComputedCSValue, 3);
+    UtAssert_STUB_COUNT(CS_ChecksumFinal, 0);
+    UtAssert_UINT32_EQ(ComputedCSValue, 0);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_COMPUTE_TABLES_RELEASE_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
@@ -696,7 +1043,7 @@ void CS_ComputeTables_Test_ComputeTablesError(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), -1);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERR_NOT_FOUND);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CS_ERR_NOT_FOUND);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -723,16 +1070,17 @@ void CS_ComputeApp_Test_NominalApp(void)
     ResultsEntry.ComputedYet = true;
 
     ResultsEntry.ComparisonValue = 2;
+    ResultsEntry.ComparisonDigest.Bytes[3] = 2;
 
     /* Sets AppInfo.CodeSize = 5, sets AppInfo.CodeAddress = 1, AppInfo.AddressesAreValid = true, and returns
      * CFE_SUCCESS */
     UT_SetHandlerFunction(UT_KEY(CFE_ES_GetModuleInfo), CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler1, NULL);
 
     /* Set to fail condition "NewChecksumValue != ResultsEntry -> ComparisonValue" */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 2);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFinal), 1, 2);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_TRUE(DoneWithEntry);
@@ -742,7 +1090,6 @@ void CS_ComputeApp_Test_NominalApp(void)
 
     UtAssert_UINT32_EQ(ComputedCSValue, 2);
     UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 0);
-    UtAssert_UINT32_EQ(ResultsEntry.TempChecksumValue, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
@@ -760,6 +1107,7 @@ void CS_ComputeApp_Test_NominalLib(void)
     ResultsEntry.ComputedYet = true;
 
     ResultsEntry.ComparisonValue = 2;
+    ResultsEntry.ComparisonDigest.Bytes[3] = 2;
 
     /* Set to generate error CS_COMPUTE_APP_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppIDByName), 1, CFE_ES_ERR_NAME_NOT_FOUND);
@@ -769,10 +1117,10 @@ void CS_ComputeApp_Test_NominalLib(void)
     UT_SetHandlerFunction(UT_KEY(CFE_ES_GetModuleInfo), CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler1, NULL);
 
     /* Set to fail condition "NewChecksumValue != ResultsEntry -> ComparisonValue" */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 2);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFinal), 1, 2);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_TRUE(DoneWithEntry);
@@ -782,7 +1130,6 @@ void CS_ComputeApp_Test_NominalLib(void)
 
     UtAssert_UINT32_EQ(ComputedCSValue, 2);
     UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 0);
-    UtAssert_UINT32_EQ(ResultsEntry.TempChecksumValue, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
@@ -809,7 +1156,7 @@ void CS_ComputeApp_Test_GetAppAndLibIDByNameError(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetLibIDByName), 1, -1);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERR_NOT_FOUND);
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CS_ERR_NOT_FOUND);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -842,7 +1189,7 @@ void CS_ComputeApp_Test_GetModuleInfoError(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetModuleInfo), 1, -1);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERR_NOT_FOUND);
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CS_ERR_NOT_FOUND);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -878,7 +1225,7 @@ void CS_ComputeApp_Test_ComputeAppPlatformError(void)
     UT_SetHandlerFunction(UT_KEY(CFE_ES_GetModuleInfo), CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler2, NULL);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERR_NOT_FOUND);
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CS_ERR_NOT_FOUND);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -911,16 +1258,17 @@ void CS_ComputeApp_Test_DifferFromSavedValue(void)
     ResultsEntry.ComputedYet = true;
 
     ResultsEntry.ComparisonValue = 3;
+    ResultsEntry.ComparisonDigest.Bytes[3] = 3;
 
     /* Sets AppInfo.CodeSize = 5, sets AppInfo.CodeAddress = 1, AppInfo.AddressesAreValid = true, and returns
      * CFE_SUCCESS */
     UT_SetHandlerFunction(UT_KEY(CFE_ES_GetModuleInfo), CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler1, NULL);
 
     /* Set to fail condition "NewChecksumValue != ResultsEntry -> ComparisonValue" */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 2);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFinal), 1, 2);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERROR);
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CS_ERROR);
 
     /* Verify results */
     UtAssert_BOOL_TRUE(DoneWithEntry);
@@ -944,16 +1292,17 @@ void CS_ComputeApp_Test_FirstTimeThrough(void)
     ResultsEntry.ComputedYet = false;
 
     ResultsEntry.ComparisonValue = 3;
+    ResultsEntry.ComparisonDigest.Bytes[3] = 3;
 
     /* Sets AppInfo.CodeSize = 5, sets AppInfo.CodeAddress = 1, AppInfo.AddressesAreValid = true, and returns
      * CFE_SUCCESS */
     UT_SetHandlerFunction(UT_KEY(CFE_ES_GetModuleInfo), CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler1, NULL);
 
     /* Set to fail condition "NewChecksumValue != ResultsEntry -> ComparisonValue" */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 2);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFinal), 1, 2);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_TRUE(DoneWithEntry);
@@ -966,7 +1315,6 @@ void CS_ComputeApp_Test_FirstTimeThrough(void)
 
     UtAssert_UINT32_EQ(ComputedCSValue, 2);
     UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 0);
-    UtAssert_UINT32_EQ(ResultsEntry.TempChecksumValue, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
@@ -986,6 +1334,7 @@ void CS_ComputeApp_Test_EntryNotFinished(void)
     ResultsEntry.ComputedYet = true;
 
     ResultsEntry.ComparisonValue = 3;
+    ResultsEntry.ComparisonDigest.Bytes[3] = 3;
 
     /* Sets AppInfo.CodeSize = 5, sets AppInfo.CodeAddress = 1, AppInfo.AddressesAreValid = true, and returns
      * CFE_SUCCESS */
@@ -997,11 +1346,8 @@ void CS_ComputeApp_Test_EntryNotFinished(void)
 
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetInfo), CFE_TBL_INFO_UPDATED);
 
-    /* Set to fail condition "NewChecksumValue != ResultsEntry -> ComparisonValue" */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 2);
-
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -1009,423 +1355,432 @@ void CS_ComputeApp_Test_EntryNotFinished(void)
     UtAssert_UINT32_EQ(ResultsEntry.StartAddress, 1);
 
     UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 3);
-    UtAssert_UINT32_EQ(ResultsEntry.TempChecksumValue, 2);
-    UtAssert_UINT32_EQ(ComputedCSValue, 2);
+    UtAssert_STUB_COUNT(CS_ChecksumFinal, 0);
+    UtAssert_UINT32_EQ(ComputedCSValue, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void CS_RecomputeEepromMemoryChildTask_Test_EEPROMTable(void)
+void CS_ComputeApp_Test_CachedInfo(void)
 {
-    CS_Res_EepromMemory_Table_Entry_t RecomputeEepromMemoryEntry;
-    CS_Def_EepromMemory_Table_Entry_t DefEepromTbl[10];
-    char                              ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    CS_Res_App_Table_Entry_t ResultsEntry;
+    uint32                   ComputedCSValue = 0;
+    bool                     DoneWithEntry   = false;
+    CFE_ES_AppId_t           AppID           = CFE_ES_APPID_C(CFE_RESOURCEID_WRAP(5));
 
-    memset(&RecomputeEepromMemoryEntry, 0, sizeof(RecomputeEepromMemoryEntry));
-    memset(DefEepromTbl, 0, sizeof(DefEepromTbl));
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "%%s entry %%d recompute finished. New baseline is 0X%%08X");
+    CS_AppData.MaxBytesPerCycle = 2;
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr = &RecomputeEepromMemoryEntry;
-    CS_AppData.DefEepromTblPtr               = DefEepromTbl;
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_GetAppIDByName), CS_COMPUTE_TEST_CFE_ES_GetAppIDByNameHandler, &AppID);
 
-    CS_AppData.ChildTaskTable = CS_EEPROM_TABLE;
+    /* Sets AppInfo.CodeSize = 5, sets AppInfo.CodeAddress = 1, AppInfo.AddressesAreValid = true, and returns
+     * CFE_SUCCESS */
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_GetModuleInfo), CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler1, NULL);
 
-    CS_AppData.ChildTaskEntryID = 1;
+    /* Execute the function being tested, the first cycle looks the module up */
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
+    UtAssert_BOOL_FALSE(DoneWithEntry);
+    UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 2);
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(ResultsEntry.ResourceID, AppID));
+    UtAssert_STUB_COUNT(CFE_ES_GetAppIDByName, 1);
+    UtAssert_STUB_COUNT(CFE_ES_GetModuleInfo, 1);
 
-    CS_AppData.DefEepromTblPtr[1].StartAddress = 1;
+    /* The middle cycle uses the cached module once its ID checks out */
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
+    UtAssert_BOOL_FALSE(DoneWithEntry);
+    UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 4);
+    UtAssert_STUB_COUNT(CFE_ES_GetAppIDByName, 1);
+    UtAssert_STUB_COUNT(CFE_ES_GetModuleInfo, 2);
 
-    RecomputeEepromMemoryEntry.StartAddress = CS_AppData.DefEepromTblPtr[1].StartAddress;
+    /* The last cycle checks the module is the same one */
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
+    UtAssert_BOOL_TRUE(DoneWithEntry);
+    UtAssert_BOOL_TRUE(ResultsEntry.ComputedYet);
+    UtAssert_STUB_COUNT(CFE_ES_GetAppIDByName, 2);
+    UtAssert_STUB_COUNT(CFE_ES_GetModuleInfo, 3);
 
-    DefEepromTbl[1].State = 1;
+    /* Reloaded between entries, so the baseline is computed again */
+    AppID = CFE_ES_APPID_C(CFE_RESOURCEID_WRAP(6));
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                                  = 2;
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
+    UtAssert_BOOL_FALSE(DoneWithEntry);
+    UtAssert_BOOL_FALSE(ResultsEntry.ComputedYet);
+    UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 2);
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(ResultsEntry.ResourceID, AppID));
+    UtAssert_STUB_COUNT(CFE_ES_GetModuleInfo, 4);
 
-    /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_APP_RELOADED_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->State = 99;
+    /* Reloaded part way through an entry, so the entry starts over */
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
+    AppID = CFE_ES_APPID_C(CFE_RESOURCEID_WRAP(7));
 
-    /* Execute the function being tested */
-    CS_RecomputeEepromMemoryChildTask();
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CFE_SUCCESS);
+    UtAssert_BOOL_FALSE(DoneWithEntry);
+    UtAssert_BOOL_FALSE(ResultsEntry.ComputedYet);
+    UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 0);
+    UtAssert_STUB_COUNT(CS_ChecksumFinal, 1);
 
-    /* Verify results */
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
 
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeEepromMemoryEntryPtr->ComputedYet);
-    UtAssert_UINT16_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->State, 99);
-    UtAssert_UINT16_EQ(CS_AppData.DefEepromTblPtr[CS_AppData.ChildTaskEntryID].State, 1);
+void CS_ComputeApp_Test_UnloadedPartWay(void)
+{
+    CS_Res_App_Table_Entry_t ResultsEntry;
+    uint32                   ComputedCSValue = 0;
+    bool                     DoneWithEntry   = true;
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
 
-    UtAssert_STRINGBUF_EQ(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, context_CFE_EVS_SendEvent[0].Spec,
-                          CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    strncpy(ResultsEntry.Name, "name", 10);
+
+    /* Part way through an entry of a module that has since been unloaded */
+    ResultsEntry.ResourceID         = CFE_RESOURCEID_WRAP(5);
+    ResultsEntry.StartAddress       = 1;
+    ResultsEntry.NumBytesToChecksum = 5;
+    ResultsEntry.ByteOffset         = 2;
+    CS_AppData.MaxBytesPerCycle     = 2;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetModuleInfo), -1);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetAppIDByName), CFE_ES_ERR_NAME_NOT_FOUND);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetLibIDByName), CFE_ES_ERR_NAME_NOT_FOUND);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry, NULL), CS_ERR_NOT_FOUND);
+
+    /* Verify results: the entry is dropped without reading the old code */
+    UtAssert_BOOL_FALSE(DoneWithEntry);
+    UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 0);
+    UtAssert_STUB_COUNT(CFE_ES_GetAppIDByName, 1);
+    UtAssert_STUB_COUNT(CS_BudgetChecksumUpdate, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_COMPUTE_APP_ERR_EID);
 }
 
-void CS_RecomputeEepromMemoryChildTask_Test_MemoryTable(void)
+void CS_RecomputeEepromMemory_Test_EEPROMTable(void)
 {
-    CS_Res_EepromMemory_Table_Entry_t RecomputeEepromMemoryEntry;
-    CS_Def_EepromMemory_Table_Entry_t DefMemoryTbl[10];
-    char                              ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    CS_Job_t                           Job;
+    CS_Res_EepromMemory_Table_Entry_t *ResultsEntry = &CS_AppData.ResEepromTblPtr[1];
+    CS_Def_EepromMemory_Table_Entry_t  DefEepromTbl[10];
 
-    memset(&RecomputeEepromMemoryEntry, 0, sizeof(RecomputeEepromMemoryEntry));
-    memset(DefMemoryTbl, 0, sizeof(DefMemoryTbl));
+    memset(&Job, 0, sizeof(Job));
+    memset(DefEepromTbl, 0, sizeof(DefEepromTbl));
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "%%s entry %%d recompute finished. New baseline is 0X%%08X");
+    CS_AppData.DefEepromTblPtr = DefEepromTbl;
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr = &RecomputeEepromMemoryEntry;
-    CS_AppData.DefMemoryTblPtr               = DefMemoryTbl;
+    Job.Info.Table   = CS_EEPROM_TABLE;
+    Job.Info.EntryID = 1;
 
-    CS_AppData.ChildTaskTable = CS_MEMORY_TABLE;
+    CS_AppData.DefEepromTblPtr[1].StartAddress = 1;
 
-    CS_AppData.ChildTaskEntryID = 1;
+    ResultsEntry->StartAddress = CS_AppData.DefEepromTblPtr[1].StartAddress;
 
-    CS_AppData.DefMemoryTblPtr[1].StartAddress = 1;
+    DefEepromTbl[1].State = 1;
 
-    RecomputeEepromMemoryEntry.StartAddress = CS_AppData.DefMemoryTblPtr[1].StartAddress;
+    ResultsEntry->NumBytesToChecksum = 1;
+    CS_AppData.MaxBytesPerCycle      = 2;
 
-    DefMemoryTbl[1].State = 1;
+    /* Set to a value, which will be the job's result */
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFinal), 1, 1);
+
+    ResultsEntry->State = 99;
+
+    /* Execute the function being tested */
+    CS_RecomputeEepromMemory(&Job);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(ResultsEntry->ByteOffset, 0);
+    UtAssert_BOOL_TRUE(ResultsEntry->ComputedYet);
+    UtAssert_UINT16_EQ(ResultsEntry->State, 99);
+    UtAssert_UINT16_EQ(CS_AppData.DefEepromTblPtr[Job.Info.EntryID].State, 1);
+
+    UtAssert_UINT32_EQ(Job.Outcome, CS_JOB_STATUS_DONE);
+    UtAssert_UINT32_EQ(Job.Info.Result, 1);
+
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_RecomputeEepromMemory_Test_BlockTree(void)
+{
+    CS_Job_t                           Job;
+    CS_Res_EepromMemory_Table_Entry_t *ResultsEntry = &CS_AppData.ResEepromTblPtr[1];
+    CS_Def_EepromMemory_Table_Entry_t  DefEepromTbl[10];
+
+    memset(&Job, 0, sizeof(Job));
+    memset(DefEepromTbl, 0, sizeof(DefEepromTbl));
+
+    CS_AppData.DefEepromTblPtr = DefEepromTbl;
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                                  = 2;
+    Job.Info.Table   = CS_EEPROM_TABLE;
+    Job.Info.EntryID = 1;
 
-    /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
+    ResultsEntry->NumBytesToChecksum = 1;
+    ResultsEntry->BlockTree          = 1;
+    CS_AppData.MaxBytesPerCycle      = 2;
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->State = 99;
+    /* The block tree recomputes the baseline */
+    UT_SetDeferredRetcode(UT_KEY(CS_BlockTreeRecompute), 1, true);
 
     /* Execute the function being tested */
-    CS_RecomputeEepromMemoryChildTask();
+    CS_RecomputeEepromMemory(&Job);
 
     /* Verify results */
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_BOOL_TRUE(ResultsEntry->ComputedYet);
 
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeEepromMemoryEntryPtr->ComputedYet);
-    UtAssert_UINT16_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->State, 99);
-    UtAssert_UINT16_EQ(CS_AppData.DefMemoryTblPtr[CS_AppData.ChildTaskEntryID].State, 1);
+    UtAssert_STUB_COUNT(CS_BlockTreeRecompute, 1);
+    UtAssert_STUB_COUNT(CS_BudgetChecksumUpdate, 0);
+    UtAssert_STUB_COUNT(CS_ChecksumFinal, 0);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-
-    UtAssert_STRINGBUF_EQ(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, context_CFE_EVS_SendEvent[0].Spec,
-                          CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    UtAssert_UINT32_EQ(Job.Outcome, CS_JOB_STATUS_DONE);
 
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void CS_RecomputeEepromMemoryChildTask_Test_CFECore(void)
+void CS_RecomputeEepromMemory_Test_MemoryTable(void)
 {
-    CS_Res_EepromMemory_Table_Entry_t RecomputeEepromMemoryEntry;
-    CS_Def_EepromMemory_Table_Entry_t DefMemoryTbl[10];
-    char                              ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    CS_Job_t                           Job;
+    CS_Res_EepromMemory_Table_Entry_t *ResultsEntry = &CS_AppData.ResMemoryTblPtr[1];
+    CS_Def_EepromMemory_Table_Entry_t  DefMemoryTbl[10];
 
-    memset(&RecomputeEepromMemoryEntry, 0, sizeof(RecomputeEepromMemoryEntry));
+    memset(&Job, 0, sizeof(Job));
     memset(DefMemoryTbl, 0, sizeof(DefMemoryTbl));
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "%%s entry %%d recompute finished. New baseline is 0X%%08X");
-
-    CS_AppData.RecomputeEepromMemoryEntryPtr = &RecomputeEepromMemoryEntry;
-    CS_AppData.DefMemoryTblPtr               = DefMemoryTbl;
-
-    CS_AppData.ChildTaskTable = CS_CFECORE;
+    CS_AppData.DefMemoryTblPtr = DefMemoryTbl;
 
-    CS_AppData.ChildTaskEntryID = 1;
+    Job.Info.Table   = CS_MEMORY_TABLE;
+    Job.Info.EntryID = 1;
 
     CS_AppData.DefMemoryTblPtr[1].StartAddress = 1;
 
-    RecomputeEepromMemoryEntry.StartAddress = CS_AppData.DefMemoryTblPtr[1].StartAddress;
+    ResultsEntry->StartAddress = CS_AppData.DefMemoryTblPtr[1].StartAddress;
 
     DefMemoryTbl[1].State = 1;
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                                  = 2;
+    ResultsEntry->NumBytesToChecksum = 1;
+    CS_AppData.MaxBytesPerCycle      = 2;
 
-    /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
+    /* Set to a value, which will be the job's result */
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFinal), 1, 1);
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->State = 99;
+    ResultsEntry->State = 99;
 
     /* Execute the function being tested */
-    CS_RecomputeEepromMemoryChildTask();
+    CS_RecomputeEepromMemory(&Job);
 
     /* Verify results */
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_UINT32_EQ(ResultsEntry->ByteOffset, 0);
+    UtAssert_BOOL_TRUE(ResultsEntry->ComputedYet);
+    UtAssert_UINT16_EQ(ResultsEntry->State, 99);
+    UtAssert_UINT16_EQ(CS_AppData.DefMemoryTblPtr[Job.Info.EntryID].State, 1);
 
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeEepromMemoryEntryPtr->ComputedYet);
-    UtAssert_UINT16_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->State, 99);
-    UtAssert_UINT16_EQ(CS_AppData.DefMemoryTblPtr[CS_AppData.ChildTaskEntryID].State, 1);
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_UINT32_EQ(Job.Outcome, CS_JOB_STATUS_DONE);
+    UtAssert_UINT32_EQ(Job.Info.Result, 1);
 
-    UtAssert_STRINGBUF_EQ(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, context_CFE_EVS_SendEvent[0].Spec,
-                          CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CfeCoreBaseline, 1);
-
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void CS_RecomputeEepromMemoryChildTask_Test_OSCore(void)
+void CS_RecomputeEepromMemory_Test_CFECore(void)
 {
-    CS_Res_EepromMemory_Table_Entry_t RecomputeEepromMemoryEntry;
-    CS_Def_EepromMemory_Table_Entry_t DefMemoryTbl[10];
-    char                              ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    CS_Job_t                           Job;
+    CS_Res_EepromMemory_Table_Entry_t *ResultsEntry = &CS_AppData.CfeCoreCodeSeg;
+    CS_Def_EepromMemory_Table_Entry_t  DefMemoryTbl[10];
 
-    memset(&RecomputeEepromMemoryEntry, 0, sizeof(RecomputeEepromMemoryEntry));
+    memset(&Job, 0, sizeof(Job));
     memset(DefMemoryTbl, 0, sizeof(DefMemoryTbl));
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "%%s entry %%d recompute finished. New baseline is 0X%%08X");
+    CS_AppData.DefMemoryTblPtr = DefMemoryTbl;
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr = &RecomputeEepromMemoryEntry;
-    CS_AppData.DefMemoryTblPtr               = DefMemoryTbl;
-
-    CS_AppData.ChildTaskTable = CS_OSCORE;
-
-    CS_AppData.ChildTaskEntryID = 1;
+    Job.Info.Table   = CS_CFECORE;
+    Job.Info.EntryID = 1;
 
     CS_AppData.DefMemoryTblPtr[1].StartAddress = 1;
 
-    RecomputeEepromMemoryEntry.StartAddress = CS_AppData.DefMemoryTblPtr[1].StartAddress;
+    ResultsEntry->StartAddress = CS_AppData.DefMemoryTblPtr[1].StartAddress;
 
     DefMemoryTbl[1].State = 1;
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                                  = 2;
+    ResultsEntry->NumBytesToChecksum = 1;
+    CS_AppData.MaxBytesPerCycle      = 2;
 
-    /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
+    /* Set to a value, which will be the job's result */
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFinal), 1, 1);
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->State = 99;
+    ResultsEntry->State = 99;
 
     /* Execute the function being tested */
-    CS_RecomputeEepromMemoryChildTask();
+    CS_RecomputeEepromMemory(&Job);
 
     /* Verify results */
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
-
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeEepromMemoryEntryPtr->ComputedYet);
-    UtAssert_UINT16_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->State, 99);
-    UtAssert_UINT16_EQ(CS_AppData.DefMemoryTblPtr[CS_AppData.ChildTaskEntryID].State, 1);
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-
-    UtAssert_STRINGBUF_EQ(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, context_CFE_EVS_SendEvent[0].Spec,
-                          CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    UtAssert_UINT32_EQ(ResultsEntry->ByteOffset, 0);
+    UtAssert_BOOL_TRUE(ResultsEntry->ComputedYet);
+    UtAssert_UINT16_EQ(ResultsEntry->State, 99);
+    UtAssert_UINT16_EQ(CS_AppData.DefMemoryTblPtr[Job.Info.EntryID].State, 1);
 
-    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.OSBaseline, 1);
+    UtAssert_UINT32_EQ(Job.Outcome, CS_JOB_STATUS_DONE);
+    UtAssert_UINT32_EQ(Job.Info.Result, 1);
 
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableEntryId(void)
+void CS_RecomputeEepromMemory_Test_OSCore(void)
 {
-    CS_Res_EepromMemory_Table_Entry_t RecomputeEepromMemoryEntry;
-    CS_Def_EepromMemory_Table_Entry_t DefEepromTbl[10];
-    char                              ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
-    memset(&RecomputeEepromMemoryEntry, 0, sizeof(RecomputeEepromMemoryEntry));
-    memset(DefEepromTbl, 0, sizeof(DefEepromTbl));
-
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "%%s entry %%d recompute finished. New baseline is 0X%%08X");
+    CS_Job_t                           Job;
+    CS_Res_EepromMemory_Table_Entry_t *ResultsEntry = &CS_AppData.OSCodeSeg;
+    CS_Def_EepromMemory_Table_Entry_t  DefMemoryTbl[10];
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr = &RecomputeEepromMemoryEntry;
-    CS_AppData.DefEepromTblPtr               = DefEepromTbl;
+    memset(&Job, 0, sizeof(Job));
+    memset(DefMemoryTbl, 0, sizeof(DefMemoryTbl));
 
-    CS_AppData.ChildTaskTable = CS_EEPROM_TABLE;
+    CS_AppData.DefMemoryTblPtr = DefMemoryTbl;
 
-    CS_AppData.ChildTaskEntryID = CS_MAX_NUM_EEPROM_TABLE_ENTRIES;
+    Job.Info.Table   = CS_OSCORE;
+    Job.Info.EntryID = 1;
 
-    CS_AppData.DefEepromTblPtr[1].StartAddress = 1;
+    CS_AppData.DefMemoryTblPtr[1].StartAddress = 1;
 
-    RecomputeEepromMemoryEntry.StartAddress = CS_AppData.DefEepromTblPtr[1].StartAddress;
+    ResultsEntry->StartAddress = CS_AppData.DefMemoryTblPtr[1].StartAddress;
 
-    DefEepromTbl[1].State = 1;
+    DefMemoryTbl[1].State = 1;
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                                  = 2;
+    ResultsEntry->NumBytesToChecksum = 1;
+    CS_AppData.MaxBytesPerCycle      = 2;
 
-    /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
+    /* Set to a value, which will be the job's result */
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFinal), 1, 1);
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->State = 99;
+    ResultsEntry->State = 99;
 
     /* Execute the function being tested */
-    CS_RecomputeEepromMemoryChildTask();
+    CS_RecomputeEepromMemory(&Job);
 
     /* Verify results */
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
-
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeEepromMemoryEntryPtr->ComputedYet);
-    UtAssert_UINT16_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->State, 99);
+    UtAssert_UINT32_EQ(ResultsEntry->ByteOffset, 0);
+    UtAssert_BOOL_TRUE(ResultsEntry->ComputedYet);
+    UtAssert_UINT16_EQ(ResultsEntry->State, 99);
+    UtAssert_UINT16_EQ(CS_AppData.DefMemoryTblPtr[Job.Info.EntryID].State, 1);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_UINT32_EQ(Job.Outcome, CS_JOB_STATUS_DONE);
+    UtAssert_UINT32_EQ(Job.Info.Result, 1);
 
-    UtAssert_STRINGBUF_EQ(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, context_CFE_EVS_SendEvent[0].Spec,
-                          CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableStartAddress(void)
+void CS_RecomputeEepromMemory_Test_EEPROMTableStartAddress(void)
 {
-    CS_Res_EepromMemory_Table_Entry_t RecomputeEepromMemoryEntry;
-    CS_Def_EepromMemory_Table_Entry_t DefEepromTbl[10];
-    char                              ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    CS_Job_t                           Job;
+    CS_Res_EepromMemory_Table_Entry_t *ResultsEntry = &CS_AppData.ResEepromTblPtr[1];
+    CS_Def_EepromMemory_Table_Entry_t  DefEepromTbl[10];
 
-    memset(&RecomputeEepromMemoryEntry, 0, sizeof(RecomputeEepromMemoryEntry));
+    memset(&Job, 0, sizeof(Job));
     memset(DefEepromTbl, 0, sizeof(DefEepromTbl));
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "%%s entry %%d recompute finished. New baseline is 0X%%08X");
-
-    CS_AppData.RecomputeEepromMemoryEntryPtr = &RecomputeEepromMemoryEntry;
-    CS_AppData.DefEepromTblPtr               = DefEepromTbl;
-
-    CS_AppData.ChildTaskTable = CS_EEPROM_TABLE;
+    CS_AppData.DefEepromTblPtr = DefEepromTbl;
 
-    CS_AppData.ChildTaskEntryID = 1;
+    Job.Info.Table   = CS_EEPROM_TABLE;
+    Job.Info.EntryID = 1;
 
     CS_AppData.DefEepromTblPtr[1].StartAddress = 1;
 
-    RecomputeEepromMemoryEntry.StartAddress = 0;
+    ResultsEntry->StartAddress = 0;
 
     DefEepromTbl[1].State = 1;
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                                  = 2;
+    ResultsEntry->NumBytesToChecksum = 1;
+    CS_AppData.MaxBytesPerCycle      = 2;
 
-    /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
+    /* Set to a value, which will be the job's result */
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFinal), 1, 1);
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->State = 99;
+    ResultsEntry->State = 99;
 
     /* Execute the function being tested */
-    CS_RecomputeEepromMemoryChildTask();
+    CS_RecomputeEepromMemory(&Job);
 
     /* Verify results */
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_UINT32_EQ(ResultsEntry->ByteOffset, 0);
+    UtAssert_BOOL_TRUE(ResultsEntry->ComputedYet);
+    UtAssert_UINT16_EQ(ResultsEntry->State, 99);
+    UtAssert_UINT16_EQ(CS_AppData.DefEepromTblPtr[Job.Info.EntryID].State, 1);
 
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeEepromMemoryEntryPtr->ComputedYet);
-    UtAssert_UINT16_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->State, 99);
-    UtAssert_UINT16_EQ(CS_AppData.DefEepromTblPtr[CS_AppData.ChildTaskEntryID].State, 1);
+    UtAssert_UINT32_EQ(Job.Outcome, CS_JOB_STATUS_DONE);
+    UtAssert_UINT32_EQ(Job.Info.Result, 1);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-
-    UtAssert_STRINGBUF_EQ(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, context_CFE_EVS_SendEvent[0].Spec,
-                          CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableState(void)
+void CS_RecomputeEepromMemory_Test_EEPROMTableState(void)
 {
-    CS_Res_EepromMemory_Table_Entry_t RecomputeEepromMemoryEntry;
-    CS_Def_EepromMemory_Table_Entry_t DefEepromTbl[10];
-    char                              ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    CS_Job_t                           Job;
+    CS_Res_EepromMemory_Table_Entry_t *ResultsEntry = &CS_AppData.ResEepromTblPtr[1];
+    CS_Def_EepromMemory_Table_Entry_t  DefEepromTbl[10];
 
-    memset(&RecomputeEepromMemoryEntry, 0, sizeof(RecomputeEepromMemoryEntry));
+    memset(&Job, 0, sizeof(Job));
     memset(DefEepromTbl, 0, sizeof(DefEepromTbl));
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "%%s entry %%d recompute finished. New baseline is 0X%%08X");
-
-    CS_AppData.RecomputeEepromMemoryEntryPtr = &RecomputeEepromMemoryEntry;
-    CS_AppData.DefEepromTblPtr               = DefEepromTbl;
-
-    CS_AppData.ChildTaskTable = CS_EEPROM_TABLE;
+    CS_AppData.DefEepromTblPtr = DefEepromTbl;
 
-    CS_AppData.ChildTaskEntryID = 1;
+    Job.Info.Table   = CS_EEPROM_TABLE;
+    Job.Info.EntryID = 1;
 
     CS_AppData.DefEepromTblPtr[1].StartAddress = 1;
 
-    RecomputeEepromMemoryEntry.StartAddress = 1;
+    ResultsEntry->StartAddress = 1;
 
     DefEepromTbl[1].State = CS_STATE_EMPTY;
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                                  = 2;
+    ResultsEntry->NumBytesToChecksum = 1;
+    CS_AppData.MaxBytesPerCycle      = 2;
 
-    /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
+    /* Set to a value, which will be the job's result */
+    UT_SetDeferredRetcode(UT_KEY(CS_ChecksumFinal), 1, 1);
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->State = 99;
+    ResultsEntry->State = 99;
 
     /* Execute the function being tested */
-    CS_RecomputeEepromMemoryChildTask();
+    CS_RecomputeEepromMemory(&Job);
 
     /* Verify results */
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_UINT32_EQ(ResultsEntry->ByteOffset, 0);
+    UtAssert_BOOL_TRUE(ResultsEntry->ComputedYet);
+    UtAssert_UINT16_EQ(ResultsEntry->State, 99);
+    UtAssert_UINT16_EQ(CS_AppData.DefEepromTblPtr[Job.Info.EntryID].State, CS_STATE_EMPTY);
 
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeEepromMemoryEntryPtr->ComputedYet);
-    UtAssert_UINT16_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->State, 99);
-    UtAssert_UINT16_EQ(CS_AppData.DefEepromTblPtr[CS_AppData.ChildTaskEntryID].State, CS_STATE_EMPTY);
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-
-    UtAssert_STRINGBUF_EQ(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, context_CFE_EVS_SendEvent[0].Spec,
-                          CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    UtAssert_UINT32_EQ(Job.Outcome, CS_JOB_STATUS_DONE);
+    UtAssert_UINT32_EQ(Job.Info.Result, 1);
 
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void CS_RecomputeAppChildTask_Test_Nominal(void)
+void CS_RecomputeApp_Test_Nominal(void)
 {
-    CS_Res_App_Table_Entry_t RecomputeAppEntry;
-    CS_Def_App_Table_Entry_t DefAppTbl[10];
-    char                     ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    CS_Job_t                  Job;
+    CS_Res_App_Table_Entry_t *ResultsEntry = &CS_AppData.ResAppTblPtr[1];
+    CS_Def_App_Table_Entry_t  DefAppTbl[10];
 
-    memset(&RecomputeAppEntry, 0, sizeof(RecomputeAppEntry));
+    memset(&Job, 0, sizeof(Job));
     memset(&DefAppTbl, 0, sizeof(DefAppTbl));
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "App %%s recompute finished. New baseline is 0x%%08X");
-
-    CS_AppData.RecomputeAppEntryPtr = &RecomputeAppEntry;
-    CS_AppData.DefAppTblPtr         = DefAppTbl;
+    CS_AppData.DefAppTblPtr = DefAppTbl;
 
-    CS_AppData.ChildTaskTable = CS_OSCORE;
-
-    CS_AppData.ChildTaskEntryID = 1;
+    Job.Info.Table   = CS_APP_TABLE;
+    Job.Info.EntryID = 1;
 
     DefAppTbl[1].State = 1;
 
-    CS_AppData.RecomputeAppEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                         = 2;
+    ResultsEntry->NumBytesToChecksum = 1;
+    CS_AppData.MaxBytesPerCycle      = 2;
 
-    /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_APP_INF_EID */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 1);
+    /* Set to a value, which will be the job's result */
+    UT_SetDefaultReturnValue(UT_KEY(CS_ChecksumFinal), 1);
 
-    CS_AppData.RecomputeAppEntryPtr->State = 99;
+    ResultsEntry->State = 99;
 
-    strncpy(CS_AppData.RecomputeAppEntryPtr->Name, "name", 10);
+    strncpy(ResultsEntry->Name, "name", 10);
     strncpy(DefAppTbl[1].Name, "name", 10);
 
     /* Sets AppInfo.CodeSize = 5, sets AppInfo.CodeAddress = 1, AppInfo.AddressesAreValid = true, and returns
@@ -1433,47 +1788,40 @@ void CS_RecomputeAppChildTask_Test_Nominal(void)
     UT_SetHandlerFunction(UT_KEY(CFE_ES_GetModuleInfo), CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler1, NULL);
 
     /* Execute the function being tested */
-    CS_RecomputeAppChildTask();
+    CS_RecomputeApp(&Job);
 
     /* Verify results */
-    UtAssert_UINT16_EQ(CS_AppData.RecomputeAppEntryPtr->State, 99);
-    UtAssert_UINT16_EQ(CS_AppData.DefAppTblPtr[CS_AppData.ChildTaskEntryID].State, 1);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeAppEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeAppEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeAppEntryPtr->ComputedYet);
+    UtAssert_UINT16_EQ(ResultsEntry->State, 99);
+    UtAssert_UINT16_EQ(CS_AppData.DefAppTblPtr[Job.Info.EntryID].State, 1);
+    UtAssert_UINT32_EQ(ResultsEntry->ByteOffset, 0);
+    UtAssert_BOOL_TRUE(ResultsEntry->ComputedYet);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_APP_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_UINT32_EQ(Job.Outcome, CS_JOB_STATUS_DONE);
 
-    UtAssert_STRINGBUF_EQ(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, context_CFE_EVS_SendEvent[0].Spec,
-                          CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
-
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void CS_RecomputeAppChildTask_Test_CouldNotGetAddress(void)
+void CS_RecomputeApp_Test_CouldNotGetAddress(void)
 {
-    CS_Res_App_Table_Entry_t RecomputeAppEntry;
-    CS_Def_App_Table_Entry_t DefAppTbl[CS_MAX_NUM_APP_TABLE_ENTRIES];
+    CS_Job_t                  Job;
+    CS_Res_App_Table_Entry_t *ResultsEntry = &CS_AppData.ResAppTblPtr[1];
+    CS_Def_App_Table_Entry_t  DefAppTbl[CS_MAX_NUM_APP_TABLE_ENTRIES];
 
-    memset(&RecomputeAppEntry, 0, sizeof(RecomputeAppEntry));
+    memset(&Job, 0, sizeof(Job));
     memset(&DefAppTbl, 0, sizeof(DefAppTbl));
 
-    CS_AppData.RecomputeAppEntryPtr = &RecomputeAppEntry;
-    CS_AppData.DefAppTblPtr         = DefAppTbl;
+    CS_AppData.DefAppTblPtr = DefAppTbl;
 
-    CS_AppData.ChildTaskTable = CS_OSCORE;
-
-    CS_AppData.ChildTaskEntryID = 1;
+    Job.Info.Table   = CS_APP_TABLE;
+    Job.Info.EntryID = 1;
 
     /* No matching non-empty state entry */
     DefAppTbl[1].State = CS_STATE_EMPTY;
 
-    CS_AppData.RecomputeAppEntryPtr->State = 99;
+    ResultsEntry->State = 99;
 
-    strncpy(CS_AppData.RecomputeAppEntryPtr->Name, "name", 10);
+    strncpy(ResultsEntry->Name, "name", 10);
     strncpy(DefAppTbl[1].Name, "name", 10);
 
     /* Set to cause CS_ComputeApp to return CS_ERR_NOT_FOUND */
@@ -1485,52 +1833,45 @@ void CS_RecomputeAppChildTask_Test_CouldNotGetAddress(void)
     UT_SetHandlerFunction(UT_KEY(CFE_ES_GetModuleInfo), CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler1, NULL);
 
     /* Execute the function being tested */
-    CS_RecomputeAppChildTask();
+    CS_RecomputeApp(&Job);
 
     /* Verify results */
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeAppEntryPtr->State, 99);
-    UtAssert_UINT32_EQ(CS_AppData.DefAppTblPtr[CS_AppData.ChildTaskEntryID].State, CS_STATE_EMPTY);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeAppEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeAppEntryPtr->ByteOffset, 0);
+    UtAssert_UINT32_EQ(ResultsEntry->State, 99);
+    UtAssert_UINT32_EQ(CS_AppData.DefAppTblPtr[Job.Info.EntryID].State, CS_STATE_EMPTY);
+    UtAssert_UINT32_EQ(ResultsEntry->ByteOffset, 0);
 
-    UtAssert_BOOL_FALSE(CS_AppData.RecomputeAppEntryPtr->ComputedYet);
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_BOOL_FALSE(ResultsEntry->ComputedYet);
 
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_UINT32_EQ(Job.Outcome, CS_JOB_STATUS_FAILED);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_COMPUTE_APP_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, CS_RECOMPUTE_ERROR_APP_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_ERROR);
 }
 
-void CS_RecomputeAppChildTask_Test_DefEntryId(void)
+void CS_RecomputeApp_Test_DefEntryId(void)
 {
-    CS_Res_App_Table_Entry_t RecomputeAppEntry;
-    CS_Def_App_Table_Entry_t DefAppTbl[10];
-    char                     ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    CS_Job_t                  Job;
+    CS_Res_App_Table_Entry_t *ResultsEntry = &CS_AppData.ResAppTblPtr[1];
+    CS_Def_App_Table_Entry_t  DefAppTbl[10];
 
-    memset(&RecomputeAppEntry, 0, sizeof(RecomputeAppEntry));
+    memset(&Job, 0, sizeof(Job));
     memset(&DefAppTbl, 0, sizeof(DefAppTbl));
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "App %%s recompute finished. New baseline is 0x%%08X");
-
-    CS_AppData.RecomputeAppEntryPtr = &RecomputeAppEntry;
-    CS_AppData.DefAppTblPtr         = DefAppTbl;
-
-    CS_AppData.ChildTaskTable = CS_OSCORE;
+    CS_AppData.DefAppTblPtr = DefAppTbl;
 
-    CS_AppData.ChildTaskEntryID = 1;
+    Job.Info.Table   = CS_APP_TABLE;
+    Job.Info.EntryID = 1;
 
-    CS_AppData.RecomputeAppEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                         = 2;
+    ResultsEntry->NumBytesToChecksum = 1;
+    CS_AppData.MaxBytesPerCycle      = 2;
 
-    /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_APP_INF_EID */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 1);
+    /* Set to a value, which will be the job's result */
+    UT_SetDefaultReturnValue(UT_KEY(CS_ChecksumFinal), 1);
 
-    CS_AppData.RecomputeAppEntryPtr->State = 99;
+    ResultsEntry->State = 99;
 
-    strncpy(CS_AppData.RecomputeAppEntryPtr->Name, "name", 10);
+    strncpy(ResultsEntry->Name, "name", 10);
     strncpy(DefAppTbl[1].Name, "name", 10);
     DefAppTbl[1].State = CS_STATE_ENABLED;
 
@@ -1539,67 +1880,55 @@ void CS_RecomputeAppChildTask_Test_DefEntryId(void)
     UT_SetHandlerFunction(UT_KEY(CFE_ES_GetModuleInfo), CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler1, NULL);
 
     /* Execute the function being tested */
-    CS_RecomputeAppChildTask();
+    CS_RecomputeApp(&Job);
 
     /* Verify results */
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeAppEntryPtr->State, 99);
-    UtAssert_UINT32_EQ(CS_AppData.DefAppTblPtr[CS_AppData.ChildTaskEntryID].State, CS_STATE_ENABLED);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeAppEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeAppEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeAppEntryPtr->ComputedYet);
+    UtAssert_UINT32_EQ(ResultsEntry->State, 99);
+    UtAssert_UINT32_EQ(CS_AppData.DefAppTblPtr[Job.Info.EntryID].State, CS_STATE_ENABLED);
+    UtAssert_UINT32_EQ(ResultsEntry->ByteOffset, 0);
+    UtAssert_BOOL_TRUE(ResultsEntry->ComputedYet);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_APP_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-
-    UtAssert_STRINGBUF_EQ(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, context_CFE_EVS_SendEvent[0].Spec,
-                          CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    UtAssert_UINT32_EQ(Job.Outcome, CS_JOB_STATUS_DONE);
 
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
-
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void CS_RecomputeTablesChildTask_Test_Nominal(void)
+void CS_RecomputeTables_Test_Nominal(void)
 {
-    CS_Res_Tables_Table_Entry_t RecomputeTablesEntry;
-    CS_Def_Tables_Table_Entry_t DefTablesTbl[10];
-    CFE_TBL_Info_t              TblInfo;
-    char                        ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    CS_Job_t                     Job;
+    CS_Res_Tables_Table_Entry_t *ResultsEntry = &CS_AppData.ResTablesTblPtr[1];
+    CS_Def_Tables_Table_Entry_t  DefTablesTbl[10];
+    CFE_TBL_Info_t               TblInfo;
 
-    memset(&RecomputeTablesEntry, 0, sizeof(RecomputeTablesEntry));
+    memset(&Job, 0, sizeof(Job));
     memset(&DefTablesTbl, 0, sizeof(DefTablesTbl));
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Table %%s recompute finished. New baseline is 0x%%08X");
-
-    CS_AppData.RecomputeTablesEntryPtr = &RecomputeTablesEntry;
-    CS_AppData.DefTablesTblPtr         = DefTablesTbl;
-
-    CS_AppData.ChildTaskTable = CS_OSCORE;
+    CS_AppData.DefTablesTblPtr = DefTablesTbl;
 
-    CS_AppData.ChildTaskEntryID = 1;
+    Job.Info.Table   = CS_TABLES_TABLE;
+    Job.Info.EntryID = 1;
 
     DefTablesTbl[1].State = 1;
 
-    CS_AppData.RecomputeTablesEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                            = 2;
+    ResultsEntry->NumBytesToChecksum = 1;
+    CS_AppData.MaxBytesPerCycle      = 2;
 
-    /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_TABLES_INF_EID */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 1);
+    /* Set to a value, which will be the job's result */
+    UT_SetDefaultReturnValue(UT_KEY(CS_ChecksumFinal), 1);
 
-    CS_AppData.RecomputeTablesEntryPtr->State = 99;
+    ResultsEntry->State = 99;
 
-    strncpy(CS_AppData.RecomputeTablesEntryPtr->Name, "name", 10);
+    strncpy(ResultsEntry->Name, "name", 10);
     strncpy(DefTablesTbl[1].Name, "name", 10);
 
-    RecomputeTablesEntry.TblHandle = CFE_TBL_BAD_TABLE_HANDLE;
+    ResultsEntry->TblHandle = CFE_TBL_BAD_TABLE_HANDLE;
 
-    RecomputeTablesEntry.ByteOffset = 0;
-    CS_AppData.MaxBytesPerCycle     = 5;
+    ResultsEntry->ByteOffset    = 0;
+    CS_AppData.MaxBytesPerCycle = 5;
 
-    RecomputeTablesEntry.ComputedYet = true;
+    ResultsEntry->ComputedYet = true;
 
-    RecomputeTablesEntry.ComparisonValue = 2;
+    ResultsEntry->ComparisonValue = 2;
 
     /* Sets ResultsEntry->TblHandle to 99 and returns CFE_SUCCESS */
     UT_SetHandlerFunction(UT_KEY(CFE_TBL_Share), CS_COMPUTE_TEST_CFE_TBL_ShareHandler, NULL);
@@ -1614,47 +1943,40 @@ void CS_RecomputeTablesChildTask_Test_Nominal(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
 
     /* Execute the function being tested */
-    CS_RecomputeTablesChildTask();
+    CS_RecomputeTables(&Job);
 
     /* Verify results */
-    UtAssert_UINT16_EQ(CS_AppData.RecomputeTablesEntryPtr->State, 99);
-    UtAssert_UINT16_EQ(CS_AppData.DefTablesTblPtr[CS_AppData.ChildTaskEntryID].State, 1);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeTablesEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeTablesEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeTablesEntryPtr->ComputedYet);
+    UtAssert_UINT16_EQ(ResultsEntry->State, 99);
+    UtAssert_UINT16_EQ(CS_AppData.DefTablesTblPtr[Job.Info.EntryID].State, 1);
+    UtAssert_UINT32_EQ(ResultsEntry->ByteOffset, 0);
+    UtAssert_BOOL_TRUE(ResultsEntry->ComputedYet);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_TABLES_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_UINT32_EQ(Job.Outcome, CS_JOB_STATUS_DONE);
 
-    UtAssert_STRINGBUF_EQ(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, context_CFE_EVS_SendEvent[0].Spec,
-                          CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
-
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void CS_RecomputeTablesChildTask_Test_CouldNotGetAddress(void)
+void CS_RecomputeTables_Test_CouldNotGetAddress(void)
 {
-    CS_Res_Tables_Table_Entry_t RecomputeTablesEntry;
-    CS_Def_Tables_Table_Entry_t DefTablesTbl[CS_MAX_NUM_APP_TABLE_ENTRIES];
+    CS_Job_t                     Job;
+    CS_Res_Tables_Table_Entry_t *ResultsEntry = &CS_AppData.ResTablesTblPtr[1];
+    CS_Def_Tables_Table_Entry_t  DefTablesTbl[CS_MAX_NUM_APP_TABLE_ENTRIES];
 
-    memset(&RecomputeTablesEntry, 0, sizeof(RecomputeTablesEntry));
+    memset(&Job, 0, sizeof(Job));
     memset(&DefTablesTbl, 0, sizeof(DefTablesTbl));
 
-    CS_AppData.RecomputeTablesEntryPtr = &RecomputeTablesEntry;
-    CS_AppData.DefTablesTblPtr         = DefTablesTbl;
-
-    CS_AppData.ChildTaskTable = CS_OSCORE;
+    CS_AppData.DefTablesTblPtr = DefTablesTbl;
 
-    CS_AppData.ChildTaskEntryID = 1;
+    Job.Info.Table   = CS_TABLES_TABLE;
+    Job.Info.EntryID = 1;
 
     /* No matching non-empty state entry */
     DefTablesTbl[1].State = CS_STATE_EMPTY;
 
-    CS_AppData.RecomputeTablesEntryPtr->State = 99;
+    ResultsEntry->State = 99;
 
-    strncpy(CS_AppData.RecomputeTablesEntryPtr->Name, "name", 10);
+    strncpy(ResultsEntry->Name, "name", 10);
     strncpy(DefTablesTbl[1].Name, "name", 10);
 
     /* Set to make CS_ComputeTables return CS_ERR_NOT_FOUND */
@@ -1663,64 +1985,56 @@ void CS_RecomputeTablesChildTask_Test_CouldNotGetAddress(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, -1);
 
     /* Execute the function being tested */
-    CS_RecomputeTablesChildTask();
+    CS_RecomputeTables(&Job);
 
     /* Verify results */
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeTablesEntryPtr->State, 99);
-    UtAssert_UINT32_EQ(CS_AppData.DefTablesTblPtr[CS_AppData.ChildTaskEntryID].State, CS_STATE_EMPTY);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeTablesEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeTablesEntryPtr->ByteOffset, 0);
+    UtAssert_UINT32_EQ(ResultsEntry->State, 99);
+    UtAssert_UINT32_EQ(CS_AppData.DefTablesTblPtr[Job.Info.EntryID].State, CS_STATE_EMPTY);
+    UtAssert_UINT32_EQ(ResultsEntry->ByteOffset, 0);
 
-    UtAssert_BOOL_FALSE(CS_AppData.RecomputeTablesEntryPtr->ComputedYet);
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_BOOL_FALSE(ResultsEntry->ComputedYet);
 
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, CS_RECOMPUTE_ERROR_TABLES_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_UINT32_EQ(Job.Outcome, CS_JOB_STATUS_FAILED);
 
     /* Note: generates 1 event message we don't care about in this test */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
-void CS_RecomputeTablesChildTask_Test_DefEntryId(void)
+void CS_RecomputeTables_Test_DefEntryId(void)
 {
-    CS_Res_Tables_Table_Entry_t RecomputeTablesEntry;
-    CS_Def_Tables_Table_Entry_t DefTablesTbl[10];
-    CFE_TBL_Info_t              TblInfo;
-    char                        ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    CS_Job_t                     Job;
+    CS_Res_Tables_Table_Entry_t *ResultsEntry = &CS_AppData.ResTablesTblPtr[1];
+    CS_Def_Tables_Table_Entry_t  DefTablesTbl[10];
+    CFE_TBL_Info_t               TblInfo;
 
-    memset(&RecomputeTablesEntry, 0, sizeof(RecomputeTablesEntry));
+    memset(&Job, 0, sizeof(Job));
     memset(&DefTablesTbl, 0, sizeof(DefTablesTbl));
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Table %%s recompute finished. New baseline is 0x%%08X");
+    CS_AppData.DefTablesTblPtr = DefTablesTbl;
 
-    CS_AppData.RecomputeTablesEntryPtr = &RecomputeTablesEntry;
-    CS_AppData.DefTablesTblPtr         = DefTablesTbl;
+    Job.Info.Table   = CS_TABLES_TABLE;
+    Job.Info.EntryID = 1;
 
-    CS_AppData.ChildTaskTable = CS_OSCORE;
+    ResultsEntry->NumBytesToChecksum = 1;
+    CS_AppData.MaxBytesPerCycle      = 2;
 
-    CS_AppData.ChildTaskEntryID = 1;
+    /* Set to a value, which will be the job's result */
+    UT_SetDefaultReturnValue(UT_KEY(CS_ChecksumFinal), 1);
 
-    CS_AppData.RecomputeTablesEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                            = 2;
+    ResultsEntry->State = 99;
 
-    /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_TABLES_INF_EID */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 1);
-
-    CS_AppData.RecomputeTablesEntryPtr->State = 99;
-
-    strncpy(CS_AppData.RecomputeTablesEntryPtr->Name, "name", 10);
+    strncpy(ResultsEntry->Name, "name", 10);
     strncpy(DefTablesTbl[1].Name, "name", 10);
     DefTablesTbl[1].State = CS_STATE_ENABLED;
 
-    RecomputeTablesEntry.TblHandle = CFE_TBL_BAD_TABLE_HANDLE;
+    ResultsEntry->TblHandle = CFE_TBL_BAD_TABLE_HANDLE;
 
-    RecomputeTablesEntry.ByteOffset = 0;
-    CS_AppData.MaxBytesPerCycle     = 5;
+    ResultsEntry->ByteOffset    = 0;
+    CS_AppData.MaxBytesPerCycle = 5;
 
-    RecomputeTablesEntry.ComputedYet = true;
+    ResultsEntry->ComputedYet = true;
 
-    RecomputeTablesEntry.ComparisonValue = 2;
+    ResultsEntry->ComparisonValue = 2;
 
     /* Sets ResultsEntry->TblHandle to 99 and returns CFE_SUCCESS */
     UT_SetHandlerFunction(UT_KEY(CFE_TBL_Share), CS_COMPUTE_TEST_CFE_TBL_ShareHandler, NULL);
@@ -1735,58 +2049,243 @@ void CS_RecomputeTablesChildTask_Test_DefEntryId(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
 
     /* Execute the function being tested */
-    CS_RecomputeTablesChildTask();
+    CS_RecomputeTables(&Job);
 
     /* Verify results */
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeTablesEntryPtr->State, 99);
-    UtAssert_UINT32_EQ(CS_AppData.DefTablesTblPtr[CS_AppData.ChildTaskEntryID].State, CS_STATE_ENABLED);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeTablesEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeTablesEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeTablesEntryPtr->ComputedYet);
+    UtAssert_UINT32_EQ(ResultsEntry->State, 99);
+    UtAssert_UINT32_EQ(CS_AppData.DefTablesTblPtr[Job.Info.EntryID].State, CS_STATE_ENABLED);
+    UtAssert_UINT32_EQ(ResultsEntry->ByteOffset, 0);
+    UtAssert_BOOL_TRUE(ResultsEntry->ComputedYet);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_TABLES_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_UINT32_EQ(Job.Outcome, CS_JOB_STATUS_DONE);
 
-    UtAssert_STRINGBUF_EQ(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, context_CFE_EVS_SendEvent[0].Spec,
-                          CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_RecomputeDisableDefEntry_Test_EEPROMTable(void)
+{
+    CS_Job_t                          Job;
+    CS_Def_EepromMemory_Table_Entry_t DefEepromTbl[10];
+
+    memset(&Job, 0, sizeof(Job));
+    memset(DefEepromTbl, 0, sizeof(DefEepromTbl));
 
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    CS_AppData.DefEepromTblPtr = DefEepromTbl;
 
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    Job.Info.Table   = CS_EEPROM_TABLE;
+    Job.Info.EntryID = 1;
+
+    DefEepromTbl[1].StartAddress               = 1;
+    DefEepromTbl[1].State                      = CS_STATE_ENABLED;
+    CS_AppData.ResEepromTblPtr[1].StartAddress = 1;
+
+    /* Execute the function being tested */
+    CS_RecomputeDisableDefEntry(&Job);
+
+    /* Verify results */
+    UtAssert_ADDRESS_EQ(Job.DefState, &DefEepromTbl[1].State);
+    UtAssert_UINT16_EQ(Job.PreviousDefState, CS_STATE_ENABLED);
+    UtAssert_UINT16_EQ(DefEepromTbl[1].State, CS_STATE_DISABLED);
+    UtAssert_STUB_COUNT(CS_ResetTablesTblResultEntry, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 1);
+
+    /* Put it back once the job is reported */
+    CS_RecomputeRestoreDefEntry(&Job);
+
+    UtAssert_NULL(Job.DefState);
+    UtAssert_UINT16_EQ(DefEepromTbl[1].State, CS_STATE_ENABLED);
+    UtAssert_STUB_COUNT(CS_ResetTablesTblResultEntry, 2);
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 2);
+
+    /* Nothing left to put back */
+    CS_RecomputeRestoreDefEntry(&Job);
+
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 2);
 }
 
-void CS_OneShotChildTask_Test_Nominal(void)
+void CS_RecomputeDisableDefEntry_Test_EEPROMTableMismatch(void)
 {
-    char ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    CS_Job_t                          Job;
+    CS_Def_EepromMemory_Table_Entry_t DefEepromTbl[10];
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "OneShot checksum on Address: 0x%%08X, size %%d completed. Checksum =  0x%%08X");
+    memset(&Job, 0, sizeof(Job));
+    memset(DefEepromTbl, 0, sizeof(DefEepromTbl));
 
-    /* NewChecksumValue will be set to value returned by this function */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
+    CS_AppData.DefEepromTblPtr = DefEepromTbl;
+
+    Job.Info.Table   = CS_EEPROM_TABLE;
+    Job.Info.EntryID = 1;
+
+    /* Different start address */
+    DefEepromTbl[1].StartAddress               = 1;
+    DefEepromTbl[1].State                      = CS_STATE_ENABLED;
+    CS_AppData.ResEepromTblPtr[1].StartAddress = 2;
+
+    CS_RecomputeDisableDefEntry(&Job);
+
+    UtAssert_NULL(Job.DefState);
+    UtAssert_UINT16_EQ(DefEepromTbl[1].State, CS_STATE_ENABLED);
+
+    /* Empty definition entry */
+    CS_AppData.ResEepromTblPtr[1].StartAddress = 1;
+    DefEepromTbl[1].State                      = CS_STATE_EMPTY;
+
+    CS_RecomputeDisableDefEntry(&Job);
 
-    CS_AppData.HkPacket.Payload.LastOneShotAddress          = 0;
-    CS_AppData.HkPacket.Payload.LastOneShotSize             = 1;
-    CS_AppData.HkPacket.Payload.LastOneShotChecksum         = 1;
-    CS_AppData.HkPacket.Payload.LastOneShotMaxBytesPerCycle = 1;
+    UtAssert_NULL(Job.DefState);
+    UtAssert_UINT16_EQ(DefEepromTbl[1].State, CS_STATE_EMPTY);
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 0);
+}
+
+void CS_RecomputeDisableDefEntry_Test_MemoryTable(void)
+{
+    CS_Job_t                          Job;
+    CS_Def_EepromMemory_Table_Entry_t DefMemoryTbl[10];
+
+    memset(&Job, 0, sizeof(Job));
+    memset(DefMemoryTbl, 0, sizeof(DefMemoryTbl));
+
+    CS_AppData.DefMemoryTblPtr = DefMemoryTbl;
+
+    Job.Info.Table   = CS_MEMORY_TABLE;
+    Job.Info.EntryID = 1;
+
+    DefMemoryTbl[1].StartAddress               = 1;
+    DefMemoryTbl[1].State                      = CS_STATE_DISABLED;
+    CS_AppData.ResMemoryTblPtr[1].StartAddress = 1;
+
+    CS_RecomputeDisableDefEntry(&Job);
+
+    UtAssert_ADDRESS_EQ(Job.DefState, &DefMemoryTbl[1].State);
+    UtAssert_UINT16_EQ(Job.PreviousDefState, CS_STATE_DISABLED);
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 1);
+}
+
+void CS_RecomputeDisableDefEntry_Test_TablesTable(void)
+{
+    CS_Job_t                    Job;
+    CS_Def_Tables_Table_Entry_t DefEntry;
+
+    memset(&Job, 0, sizeof(Job));
+    memset(&DefEntry, 0, sizeof(DefEntry));
+
+    Job.Info.Table   = CS_TABLES_TABLE;
+    Job.Info.EntryID = 1;
+
+    DefEntry.State = CS_STATE_ENABLED;
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetTableDefTblEntryByName), true);
+    UT_SetHandlerFunction(UT_KEY(CS_GetTableDefTblEntryByName), CS_COMPUTE_TEST_CS_GetDefTblEntryByNameHandler,
+                          &DefEntry);
+
+    CS_RecomputeDisableDefEntry(&Job);
+
+    UtAssert_ADDRESS_EQ(Job.DefState, &DefEntry.State);
+    UtAssert_UINT16_EQ(DefEntry.State, CS_STATE_DISABLED);
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 1);
+
+    CS_RecomputeRestoreDefEntry(&Job);
+
+    UtAssert_UINT16_EQ(DefEntry.State, CS_STATE_ENABLED);
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 2);
+}
+
+void CS_RecomputeDisableDefEntry_Test_AppTable(void)
+{
+    CS_Job_t                 Job;
+    CS_Def_App_Table_Entry_t DefEntry;
+
+    memset(&Job, 0, sizeof(Job));
+    memset(&DefEntry, 0, sizeof(DefEntry));
+
+    Job.Info.Table   = CS_APP_TABLE;
+    Job.Info.EntryID = 1;
+
+    /* Not in the definition table */
+    CS_RecomputeDisableDefEntry(&Job);
+
+    UtAssert_NULL(Job.DefState);
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 0);
+
+    DefEntry.State = CS_STATE_ENABLED;
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetAppDefTblEntryByName), true);
+    UT_SetHandlerFunction(UT_KEY(CS_GetAppDefTblEntryByName), CS_COMPUTE_TEST_CS_GetDefTblEntryByNameHandler,
+                          &DefEntry);
+
+    CS_RecomputeDisableDefEntry(&Job);
+
+    UtAssert_ADDRESS_EQ(Job.DefState, &DefEntry.State);
+    UtAssert_UINT16_EQ(DefEntry.State, CS_STATE_DISABLED);
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 1);
+}
+
+void CS_RecomputeDisableDefEntry_Test_CFECore(void)
+{
+    CS_Job_t Job;
+
+    memset(&Job, 0, sizeof(Job));
+
+    Job.Info.Table = CS_CFECORE;
+
+    /* The code segments have no definition table */
+    CS_RecomputeDisableDefEntry(&Job);
+
+    UtAssert_NULL(Job.DefState);
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 0);
+}
+
+void CS_OneShot_Test_Nominal(void)
+{
+    CS_Job_t Job;
+
+    memset(&Job, 0, sizeof(Job));
+
+    Job.Info.Type        = CS_JOB_TYPE_ONESHOT;
+    Job.Address          = 0;
+    Job.Size             = 2;
+    Job.MaxBytesPerCycle = 1;
+
+    /* NewChecksumValue will be set to value returned by this function */
+    UT_SetDefaultReturnValue(UT_KEY(CS_CalculateCRC), 1);
 
     /* Execute the function being tested */
-    CS_OneShotChildTask();
+    CS_OneShot(&Job);
 
     /* Verify results */
-    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastOneShotChecksum, 1);
+    UtAssert_UINT32_EQ(Job.Outcome, CS_JOB_STATUS_DONE);
+    UtAssert_UINT32_EQ(Job.Info.Result, 1);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_ONESHOT_FINISHED_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_STUB_COUNT(CS_CalculateCRC, 2);
+    UtAssert_STUB_COUNT(CS_BudgetJobCharge, 2);
+    UtAssert_STUB_COUNT(CS_JobsPace, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
 
-    UtAssert_STRINGBUF_EQ(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, context_CFE_EVS_SendEvent[0].Spec,
-                          CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+void CS_OneShot_Test_Cancelled(void)
+{
+    CS_Job_t Job;
 
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.OneShotInProgress);
-    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(CS_AppData.ChildTaskID));
+    memset(&Job, 0, sizeof(Job));
 
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    Job.Info.Type        = CS_JOB_TYPE_ONESHOT;
+    Job.Address          = 0;
+    Job.Size             = 2;
+    Job.MaxBytesPerCycle = 1;
+    Job.Info.Result      = 5;
+
+    /* Cancelled before the job task got to it */
+    Job.Cancel = true;
+
+    /* Execute the function being tested */
+    CS_OneShot(&Job);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Job.Outcome, CS_JOB_STATUS_CANCELLED);
+    UtAssert_UINT32_EQ(Job.Info.Result, 5);
+
+    UtAssert_STUB_COUNT(CS_CalculateCRC, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
 void UtTest_Setup(void)
@@ -1798,6 +2297,10 @@ void UtTest_Setup(void)
                "CS_ComputeEepromMemory_Test_FirstTimeThrough");
     UtTest_Add(CS_ComputeEepromMemory_Test_NotFinished, CS_Test_Setup, CS_Test_TearDown,
                "CS_ComputeEepromMemory_Test_NotFinished");
+    UtTest_Add(CS_ComputeEepromMemory_Test_WorkerLanes, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeEepromMemory_Test_WorkerLanes");
+    UtTest_Add(CS_ComputeEepromMemory_Test_TimeBudget, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeEepromMemory_Test_TimeBudget");
 
     UtTest_Add(CS_ComputeTables_Test_TableNeverLoaded, CS_Test_Setup, CS_Test_TearDown,
                "CS_ComputeTables_Test_TableNeverLoaded");
@@ -1807,6 +2310,7 @@ void UtTest_Setup(void)
                "CS_ComputeTables_Test_ResultShareNotSuccess");
     UtTest_Add(CS_ComputeTables_Test_TblInfoUpdated, CS_Test_Setup, CS_Test_TearDown,
                "CS_ComputeTables_Test_TblInfoUpdated");
+    UtTest_Add(CS_ComputeTables_Test_CachedInfo, CS_Test_Setup, CS_Test_TearDown, "CS_ComputeTables_Test_CachedInfo");
     UtTest_Add(CS_ComputeTables_Test_GetInfoResult, CS_Test_Setup, CS_Test_TearDown,
                "CS_ComputeTables_Test_GetInfoResult");
     UtTest_Add(CS_ComputeTables_Test_CSError, CS_Test_Setup, CS_Test_TearDown, "CS_ComputeTables_Test_CSError");
@@ -1814,6 +2318,15 @@ void UtTest_Setup(void)
                "CS_ComputeTables_Test_NominalBadTableHandle");
     UtTest_Add(CS_ComputeTables_Test_FirstTimeThrough, CS_Test_Setup, CS_Test_TearDown,
                "CS_ComputeTables_Test_FirstTimeThrough");
+    UtTest_Add(CS_ComputeTables_Test_TableServicesCrc, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeTables_Test_TableServicesCrc");
+    UtTest_Add(CS_ComputeTables_Test_TableServicesCrcNotUsed, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeTables_Test_TableServicesCrcNotUsed");
+    UtTest_Add(CS_ComputeTables_Test_Snapshot, CS_Test_Setup, CS_Test_TearDown, "CS_ComputeTables_Test_Snapshot");
+    UtTest_Add(CS_ComputeTables_Test_SnapshotReplaced, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeTables_Test_SnapshotReplaced");
+    UtTest_Add(CS_ComputeTables_Test_SnapshotTooLarge, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeTables_Test_SnapshotTooLarge");
     UtTest_Add(CS_ComputeTables_Test_EntryNotFinished, CS_Test_Setup, CS_Test_TearDown,
                "CS_ComputeTables_Test_EntryNotFinished");
     UtTest_Add(CS_ComputeTables_Test_ComputeTablesReleaseError, CS_Test_Setup, CS_Test_TearDown,
@@ -1835,35 +2348,52 @@ void UtTest_Setup(void)
                "CS_ComputeApp_Test_FirstTimeThrough");
     UtTest_Add(CS_ComputeApp_Test_EntryNotFinished, CS_Test_Setup, CS_Test_TearDown,
                "CS_ComputeApp_Test_EntryNotFinished");
-
-    UtTest_Add(CS_RecomputeEepromMemoryChildTask_Test_EEPROMTable, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeEepromMemoryChildTask_Test_EEPROMTable");
-    UtTest_Add(CS_RecomputeEepromMemoryChildTask_Test_MemoryTable, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeEepromMemoryChildTask_Test_MemoryTable");
-    UtTest_Add(CS_RecomputeEepromMemoryChildTask_Test_CFECore, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeEepromMemoryChildTask_Test_CFECore");
-    UtTest_Add(CS_RecomputeEepromMemoryChildTask_Test_OSCore, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeEepromMemoryChildTask_Test_OSCore");
-    UtTest_Add(CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableEntryId, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableEntryId");
-    UtTest_Add(CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableStartAddress, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableStartAddress");
-    UtTest_Add(CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableState, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableState");
-
-    UtTest_Add(CS_RecomputeAppChildTask_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeAppChildTask_Test_Nominal");
-    UtTest_Add(CS_RecomputeAppChildTask_Test_CouldNotGetAddress, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeAppChildTask_Test_CouldNotGetAddress");
-    UtTest_Add(CS_RecomputeAppChildTask_Test_DefEntryId, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeAppChildTask_Test_DefEntryId");
-
-    UtTest_Add(CS_RecomputeTablesChildTask_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeTablesChildTask_Test_Nominal");
-    UtTest_Add(CS_RecomputeTablesChildTask_Test_CouldNotGetAddress, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeTablesChildTask_Test_CouldNotGetAddress");
-    UtTest_Add(CS_RecomputeTablesChildTask_Test_DefEntryId, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeTablesChildTask_Test_DefEntryId");
-
-    UtTest_Add(CS_OneShotChildTask_Test_Nominal, CS_Test_Setup, CS_Test_TearDown, "CS_OneShotChildTask_Test_Nominal");
+    UtTest_Add(CS_ComputeApp_Test_CachedInfo, CS_Test_Setup, CS_Test_TearDown, "CS_ComputeApp_Test_CachedInfo");
+    UtTest_Add(CS_ComputeApp_Test_UnloadedPartWay, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeApp_Test_UnloadedPartWay");
+
+    UtTest_Add(CS_RecomputeEepromMemory_Test_EEPROMTable, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeEepromMemory_Test_EEPROMTable");
+    UtTest_Add(CS_RecomputeEepromMemory_Test_BlockTree, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeEepromMemory_Test_BlockTree");
+    UtTest_Add(CS_RecomputeEepromMemory_Test_MemoryTable, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeEepromMemory_Test_MemoryTable");
+    UtTest_Add(CS_RecomputeEepromMemory_Test_CFECore, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeEepromMemory_Test_CFECore");
+    UtTest_Add(CS_RecomputeEepromMemory_Test_OSCore, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeEepromMemory_Test_OSCore");
+    UtTest_Add(CS_RecomputeEepromMemory_Test_EEPROMTableStartAddress, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeEepromMemory_Test_EEPROMTableStartAddress");
+    UtTest_Add(CS_RecomputeEepromMemory_Test_EEPROMTableState, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeEepromMemory_Test_EEPROMTableState");
+
+    UtTest_Add(CS_RecomputeApp_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeApp_Test_Nominal");
+    UtTest_Add(CS_RecomputeApp_Test_CouldNotGetAddress, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeApp_Test_CouldNotGetAddress");
+    UtTest_Add(CS_RecomputeApp_Test_DefEntryId, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeApp_Test_DefEntryId");
+
+    UtTest_Add(CS_RecomputeTables_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeTables_Test_Nominal");
+    UtTest_Add(CS_RecomputeTables_Test_CouldNotGetAddress, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeTables_Test_CouldNotGetAddress");
+    UtTest_Add(CS_RecomputeTables_Test_DefEntryId, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeTables_Test_DefEntryId");
+
+    UtTest_Add(CS_RecomputeDisableDefEntry_Test_EEPROMTable, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeDisableDefEntry_Test_EEPROMTable");
+    UtTest_Add(CS_RecomputeDisableDefEntry_Test_EEPROMTableMismatch, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeDisableDefEntry_Test_EEPROMTableMismatch");
+    UtTest_Add(CS_RecomputeDisableDefEntry_Test_MemoryTable, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeDisableDefEntry_Test_MemoryTable");
+    UtTest_Add(CS_RecomputeDisableDefEntry_Test_TablesTable, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeDisableDefEntry_Test_TablesTable");
+    UtTest_Add(CS_RecomputeDisableDefEntry_Test_AppTable, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeDisableDefEntry_Test_AppTable");
+    UtTest_Add(CS_RecomputeDisableDefEntry_Test_CFECore, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeDisableDefEntry_Test_CFECore");
+
+    UtTest_Add(CS_OneShot_Test_Nominal, CS_Test_Setup, CS_Test_TearDown, "CS_OneShot_Test_Nominal");
+    UtTest_Add(CS_OneShot_Test_Cancelled, CS_Test_Setup, CS_Test_TearDown, "CS_OneShot_Test_Cancelled");
 }
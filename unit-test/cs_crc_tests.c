@@ -0,0 +1,389 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cs_crc.h"
+#include "cs_test_utils.h"
+#include <string.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* cs_crc_tests globals */
+static const char CS_Test_CrcCheckString[] = "123456789";
+
+/*
+ * Function Definitions
+ */
+
+/*
+ * Bit-at-a-time reference implementations, independent of the slice tables.
+ * The CRC-16 result is sign-extended just as CFE_ES_CalculateCRC returns it.
+ */
+static uint32 CS_Test_ReferenceCrc16(const uint8 *Data, size_t Length, uint32 InputCRC)
+{
+    uint16 Crc = (uint16)(InputCRC & 0xFFFF);
+    uint32 i;
+    uint32 Bit;
+
+    for (i = 0; i < Length; i++)
+    {
+        Crc ^= Data[i];
+
+        for (Bit = 0; Bit < 8; Bit++)
+        {
+            Crc = (Crc & 1) ? (uint16)((Crc >> 1) ^ 0xA001) : (uint16)(Crc >> 1);
+        }
+    }
+
+    return (uint32)(int16)Crc;
+}
+
+static uint32 CS_Test_ReferenceCrc32(const uint8 *Data, size_t Length, uint32 InputCRC, uint32 Poly)
+{
+    uint32 Crc = ~InputCRC;
+    uint32 i;
+    uint32 Bit;
+
+    for (i = 0; i < Length; i++)
+    {
+        Crc ^= Data[i];
+
+        for (Bit = 0; Bit < 8; Bit++)
+        {
+            Crc = (Crc & 1) ? ((Crc >> 1) ^ Poly) : (Crc >> 1);
+        }
+    }
+
+    return ~Crc;
+}
+
+static uint64 CS_Test_ReferenceCrc64(const uint8 *Data, size_t Length, uint64 InputCRC)
+{
+    uint64 Crc = ~InputCRC;
+    uint32 i;
+    uint32 Bit;
+
+    for (i = 0; i < Length; i++)
+    {
+        Crc ^= Data[i];
+
+        for (Bit = 0; Bit < 8; Bit++)
+        {
+            Crc = (Crc & 1) ? ((Crc >> 1) ^ 0xC96C5795D7870F42ULL) : (Crc >> 1);
+        }
+    }
+
+    return ~Crc;
+}
+
+static void CS_Test_FillPattern(uint8 *Buffer, size_t Length)
+{
+    uint32 Seed = 0x12345678;
+    uint32 i;
+
+    for (i = 0; i < Length; i++)
+    {
+        Seed      = (Seed * 1103515245) + 12345;
+        Buffer[i] = (uint8)(Seed >> 16);
+    }
+}
+
+void CS_CalculateCRC_Test_Crc16CheckValue(void)
+{
+    /* CRC-16/ARC check value is 0xBB3D, which CFE_ES_CalculateCRC returns sign-extended */
+    UtAssert_UINT32_EQ(CS_CalculateCRC(CS_Test_CrcCheckString, strlen(CS_Test_CrcCheckString), 0,
+                                       CFE_ES_CrcType_CRC_16),
+                       0xFFFFBB3D);
+}
+
+void CS_CalculateCRC_Test_Crc32CheckValue(void)
+{
+    UtAssert_UINT32_EQ(CS_CalculateCRC(CS_Test_CrcCheckString, strlen(CS_Test_CrcCheckString), 0,
+                                       CFE_ES_CrcType_CRC_32),
+                       0xCBF43926);
+}
+
+void CS_CalculateCRC_Test_Crc16MatchesReference(void)
+{
+    uint8  Buffer[300];
+    uint32 Length;
+
+    CS_Test_FillPattern(Buffer, sizeof(Buffer));
+
+    /* Cover every tail length around the slice width as well as long runs of whole slices */
+    for (Length = 0; Length < sizeof(Buffer); Length += 7)
+    {
+        UtAssert_UINT32_EQ(CS_CalculateCRC(Buffer, Length, 0, CFE_ES_CrcType_CRC_16),
+                           CS_Test_ReferenceCrc16(Buffer, Length, 0));
+        UtAssert_UINT32_EQ(CS_CalculateCRC(&Buffer[1], Length, 0x1D0F, CFE_ES_CrcType_CRC_16),
+                           CS_Test_ReferenceCrc16(&Buffer[1], Length, 0x1D0F));
+    }
+}
+
+void CS_CalculateCRC_Test_Crc32MatchesReference(void)
+{
+    uint8  Buffer[300];
+    uint32 Length;
+
+    CS_Test_FillPattern(Buffer, sizeof(Buffer));
+
+    for (Length = 0; Length < sizeof(Buffer); Length += 7)
+    {
+        UtAssert_UINT32_EQ(CS_CalculateCRC(Buffer, Length, 0, CFE_ES_CrcType_CRC_32),
+                           CS_Test_ReferenceCrc32(Buffer, Length, 0, 0xEDB88320));
+        UtAssert_UINT32_EQ(CS_CalculateCRC(&Buffer[3], Length, 0xDEADBEEF, CFE_ES_CrcType_CRC_32),
+                           CS_Test_ReferenceCrc32(&Buffer[3], Length, 0xDEADBEEF, 0xEDB88320));
+    }
+}
+
+void CS_CalculateCRC_Test_Crc32cCheckValue(void)
+{
+    UtAssert_UINT32_EQ(CS_CalculateCRC(CS_Test_CrcCheckString, strlen(CS_Test_CrcCheckString), 0,
+                                       CS_CRC_TYPE_CRC_32C),
+                       0xE3069283);
+}
+
+void CS_CalculateCRC_Test_Crc32cMatchesReference(void)
+{
+    uint8  Buffer[300];
+    uint32 Length;
+
+    CS_Test_FillPattern(Buffer, sizeof(Buffer));
+
+    for (Length = 0; Length < sizeof(Buffer); Length += 7)
+    {
+        UtAssert_UINT32_EQ(CS_CalculateCRC(&Buffer[5], Length, 0x600DF00D, CS_CRC_TYPE_CRC_32C),
+                           CS_Test_ReferenceCrc32(&Buffer[5], Length, 0x600DF00D, 0x82F63B78));
+    }
+}
+
+void CS_CrcInit_Test_KernelsAgree(void)
+{
+    uint8  Buffer[2100];
+    uint32 Portable16[6];
+    uint32 Portable32[6];
+    uint32 Portable32c[6];
+    uint32 Lengths[6] = {0, 15, 64, 79, 1024, 2047};
+    uint32 i;
+
+    CS_Test_FillPattern(Buffer, sizeof(Buffer));
+
+    CS_CrcInit(false);
+
+    for (i = 0; i < 6; i++)
+    {
+        Portable16[i]  = CS_CalculateCRC(&Buffer[i], Lengths[i], 0x1234, CFE_ES_CrcType_CRC_16);
+        Portable32[i]  = CS_CalculateCRC(&Buffer[i], Lengths[i], 0x1234, CFE_ES_CrcType_CRC_32);
+        Portable32c[i] = CS_CalculateCRC(&Buffer[i], Lengths[i], 0x1234, CS_CRC_TYPE_CRC_32C);
+    }
+
+    /* Whatever kernels this processor provides must give the same answers, including the folding thresholds */
+    CS_CrcInit(true);
+
+    for (i = 0; i < 6; i++)
+    {
+        UtAssert_UINT32_EQ(CS_CalculateCRC(&Buffer[i], Lengths[i], 0x1234, CFE_ES_CrcType_CRC_16), Portable16[i]);
+        UtAssert_UINT32_EQ(CS_CalculateCRC(&Buffer[i], Lengths[i], 0x1234, CFE_ES_CrcType_CRC_32), Portable32[i]);
+        UtAssert_UINT32_EQ(CS_CalculateCRC(&Buffer[i], Lengths[i], 0x1234, CS_CRC_TYPE_CRC_32C), Portable32c[i]);
+    }
+
+    UtAssert_UINT32_EQ(Portable16[5], CS_Test_ReferenceCrc16(&Buffer[5], Lengths[5], 0x1234));
+    UtAssert_UINT32_EQ(Portable32[5], CS_Test_ReferenceCrc32(&Buffer[5], Lengths[5], 0x1234, 0xEDB88320));
+    UtAssert_UINT32_EQ(Portable32c[5], CS_Test_ReferenceCrc32(&Buffer[5], Lengths[5], 0x1234, 0x82F63B78));
+}
+
+void CS_CalculateCRC_Test_Incremental(void)
+{
+    uint8  Buffer[1000];
+    uint32 Crc16 = 0;
+    uint32 Crc32 = 0;
+    uint32 Offset;
+
+    CS_Test_FillPattern(Buffer, sizeof(Buffer));
+
+    /* Feed the previous result back in as the seed, as the background cycle does with TempChecksumContext */
+    for (Offset = 0; Offset < sizeof(Buffer); Offset += 100)
+    {
+        Crc16 = CS_CalculateCRC(&Buffer[Offset], 100, Crc16, CFE_ES_CrcType_CRC_16);
+        Crc32 = CS_CalculateCRC(&Buffer[Offset], 100, Crc32, CFE_ES_CrcType_CRC_32);
+    }
+
+    UtAssert_UINT32_EQ(Crc16, CS_CalculateCRC(Buffer, sizeof(Buffer), 0, CFE_ES_CrcType_CRC_16));
+    UtAssert_UINT32_EQ(Crc32, CS_CalculateCRC(Buffer, sizeof(Buffer), 0, CFE_ES_CrcType_CRC_32));
+}
+
+void CS_CalculateCRC_Test_Crc16SeedUpperBitsIgnored(void)
+{
+    /* Only the low 16 bits of a sign-extended CRC-16 are used as the seed */
+    UtAssert_UINT32_EQ(CS_CalculateCRC(CS_Test_CrcCheckString, 4, 0xFFFF8001, CFE_ES_CrcType_CRC_16),
+                       CS_CalculateCRC(CS_Test_CrcCheckString, 4, 0x00008001, CFE_ES_CrcType_CRC_16));
+}
+
+void CS_CalculateCRC_Test_ZeroLength(void)
+{
+    UtAssert_UINT32_EQ(CS_CalculateCRC(CS_Test_CrcCheckString, 0, 0x1234, CFE_ES_CrcType_CRC_16), 0x1234);
+    UtAssert_UINT32_EQ(CS_CalculateCRC(CS_Test_CrcCheckString, 0, 0x9234, CFE_ES_CrcType_CRC_16), 0xFFFF9234);
+    UtAssert_UINT32_EQ(CS_CalculateCRC(CS_Test_CrcCheckString, 0, 0x12345678, CFE_ES_CrcType_CRC_32), 0x12345678);
+}
+
+void CS_CalculateCRC_Test_Unsupported(void)
+{
+    UtAssert_UINT32_EQ(CS_CalculateCRC(CS_Test_CrcCheckString, strlen(CS_Test_CrcCheckString), 0,
+                                       CFE_ES_CrcType_CRC_8),
+                       0);
+}
+
+void CS_CrcCombine_Test_MatchesSequential(void)
+{
+    uint8                 Buffer[3000];
+    CFE_ES_CrcType_Enum_t Types[3] = {CFE_ES_CrcType_CRC_16, CFE_ES_CrcType_CRC_32, CS_CRC_TYPE_CRC_32C};
+    uint32                Splits[5] = {0, 1, 17, 1500, 3000};
+    uint32                CrcA;
+    uint32                CrcB;
+    uint32                i;
+    uint32                j;
+
+    CS_Test_FillPattern(Buffer, sizeof(Buffer));
+
+    for (i = 0; i < 3; i++)
+    {
+        for (j = 0; j < 5; j++)
+        {
+            /* A is seeded the way a resumed background checksum would be */
+            CrcA = CS_CalculateCRC(Buffer, Splits[j], 0x5A5A, Types[i]);
+            CrcB = CS_CalculateCRC(&Buffer[Splits[j]], sizeof(Buffer) - Splits[j], 0, Types[i]);
+
+            UtAssert_UINT32_EQ(CS_CrcCombine(CrcA, CrcB, sizeof(Buffer) - Splits[j], Types[i]),
+                               CS_CalculateCRC(Buffer, sizeof(Buffer), 0x5A5A, Types[i]));
+        }
+    }
+}
+
+void CS_CrcCombine_Test_OutOfOrder(void)
+{
+    uint8  Buffer[4096];
+    uint32 Stripe[4];
+    uint32 Crc;
+    int32  i;
+
+    CS_Test_FillPattern(Buffer, sizeof(Buffer));
+
+    /* Compute the stripes last to first, then merge them in address order */
+    for (i = 3; i >= 0; i--)
+    {
+        Stripe[i] = CS_CalculateCRC(&Buffer[i * 1024], 1024, 0, CFE_ES_CrcType_CRC_16);
+    }
+
+    Crc = Stripe[0];
+    for (i = 1; i < 4; i++)
+    {
+        Crc = CS_CrcCombine(Crc, Stripe[i], 1024, CFE_ES_CrcType_CRC_16);
+    }
+
+    UtAssert_UINT32_EQ(Crc, CS_CalculateCRC(Buffer, sizeof(Buffer), 0, CFE_ES_CrcType_CRC_16));
+}
+
+void CS_CrcCombine_Test_Unsupported(void)
+{
+    UtAssert_UINT32_EQ(CS_CrcCombine(0x1234, 0x5678, 100, CFE_ES_CrcType_CRC_8), 0);
+}
+
+void CS_CalculateCRC64_Test_CheckValue(void)
+{
+    uint64 Crc = CS_CalculateCRC64(CS_Test_CrcCheckString, strlen(CS_Test_CrcCheckString), 0);
+
+    UtAssert_True(Crc == 0x995DC9BBDF1939FAULL, "CRC-64/XZ check value 0x%08X%08X", (unsigned int)(Crc >> 32),
+                  (unsigned int)Crc);
+}
+
+void CS_CalculateCRC64_Test_MatchesReference(void)
+{
+    uint8  Buffer[1000];
+    uint64 Crc = 0;
+    uint32 Offset;
+
+    CS_Test_FillPattern(Buffer, sizeof(Buffer));
+
+    /* Odd chunk sizes exercise both the slice loop and the byte tail */
+    for (Offset = 0; Offset < sizeof(Buffer); Offset += 125)
+    {
+        Crc = CS_CalculateCRC64(&Buffer[Offset], 125, Crc);
+    }
+
+    UtAssert_True(Crc == CS_Test_ReferenceCrc64(Buffer, sizeof(Buffer), 0), "Crc == Reference");
+}
+
+void CS_Crc64Combine_Test_MatchesSequential(void)
+{
+    uint8  Buffer[3000];
+    uint32 Splits[5] = {0, 1, 17, 1500, 3000};
+    uint64 CrcA;
+    uint64 CrcB;
+    uint32 j;
+
+    CS_Test_FillPattern(Buffer, sizeof(Buffer));
+
+    for (j = 0; j < 5; j++)
+    {
+        CrcA = CS_CalculateCRC64(Buffer, Splits[j], 0x5A5A);
+        CrcB = CS_CalculateCRC64(&Buffer[Splits[j]], sizeof(Buffer) - Splits[j], 0);
+
+        UtAssert_True(CS_Crc64Combine(CrcA, CrcB, sizeof(Buffer) - Splits[j]) ==
+                          CS_CalculateCRC64(Buffer, sizeof(Buffer), 0x5A5A),
+                      "Combined CRC-64 matches sequential, split %u", (unsigned int)Splits[j]);
+    }
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(CS_CalculateCRC_Test_Crc16CheckValue, CS_Test_Setup, CS_Test_TearDown,
+               "CS_CalculateCRC_Test_Crc16CheckValue");
+    UtTest_Add(CS_CalculateCRC_Test_Crc32CheckValue, CS_Test_Setup, CS_Test_TearDown,
+               "CS_CalculateCRC_Test_Crc32CheckValue");
+    UtTest_Add(CS_CalculateCRC_Test_Crc16MatchesReference, CS_Test_Setup, CS_Test_TearDown,
+               "CS_CalculateCRC_Test_Crc16MatchesReference");
+    UtTest_Add(CS_CalculateCRC_Test_Crc32MatchesReference, CS_Test_Setup, CS_Test_TearDown,
+               "CS_CalculateCRC_Test_Crc32MatchesReference");
+    UtTest_Add(CS_CalculateCRC_Test_Crc32cCheckValue, CS_Test_Setup, CS_Test_TearDown,
+               "CS_CalculateCRC_Test_Crc32cCheckValue");
+    UtTest_Add(CS_CalculateCRC_Test_Crc32cMatchesReference, CS_Test_Setup, CS_Test_TearDown,
+               "CS_CalculateCRC_Test_Crc32cMatchesReference");
+    UtTest_Add(CS_CrcInit_Test_KernelsAgree, CS_Test_Setup, CS_Test_TearDown, "CS_CrcInit_Test_KernelsAgree");
+    UtTest_Add(CS_CalculateCRC_Test_Incremental, CS_Test_Setup, CS_Test_TearDown, "CS_CalculateCRC_Test_Incremental");
+    UtTest_Add(CS_CalculateCRC_Test_Crc16SeedUpperBitsIgnored, CS_Test_Setup, CS_Test_TearDown,
+               "CS_CalculateCRC_Test_Crc16SeedUpperBitsIgnored");
+    UtTest_Add(CS_CalculateCRC_Test_ZeroLength, CS_Test_Setup, CS_Test_TearDown, "CS_CalculateCRC_Test_ZeroLength");
+    UtTest_Add(CS_CalculateCRC_Test_Unsupported, CS_Test_Setup, CS_Test_TearDown, "CS_CalculateCRC_Test_Unsupported");
+    UtTest_Add(CS_CrcCombine_Test_MatchesSequential, CS_Test_Setup, CS_Test_TearDown,
+               "CS_CrcCombine_Test_MatchesSequential");
+    UtTest_Add(CS_CrcCombine_Test_OutOfOrder, CS_Test_Setup, CS_Test_TearDown, "CS_CrcCombine_Test_OutOfOrder");
+    UtTest_Add(CS_CrcCombine_Test_Unsupported, CS_Test_Setup, CS_Test_TearDown, "CS_CrcCombine_Test_Unsupported");
+    UtTest_Add(CS_CalculateCRC64_Test_CheckValue, CS_Test_Setup, CS_Test_TearDown,
+               "CS_CalculateCRC64_Test_CheckValue");
+    UtTest_Add(CS_CalculateCRC64_Test_MatchesReference, CS_Test_Setup, CS_Test_TearDown,
+               "CS_CalculateCRC64_Test_MatchesReference");
+    UtTest_Add(CS_Crc64Combine_Test_MatchesSequential, CS_Test_Setup, CS_Test_TearDown,
+               "CS_Crc64Combine_Test_MatchesSequential");
+}
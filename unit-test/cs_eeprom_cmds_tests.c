@@ -75,17 +75,18 @@ void CS_DisableEepromCmd_Test(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_DisableEepromCmd_Test_OneShot(void)
+void CS_DisableEepromCmd_Test_RecomputeInProgress(void)
 {
     CS_NoArgsCmd_t CmdPacket;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeTable), 1, true);
 
     /* Execute the function being tested */
     CS_DisableEepromCmd(&CmdPacket);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(CS_CheckRecomputeTable, 1);
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 0, "CS_AppData.HkPacket.Payload.CmdCounter == 0");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -126,17 +127,18 @@ void CS_EnableEepromCmd_Test(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_EnableEepromCmd_Test_OneShot(void)
+void CS_EnableEepromCmd_Test_RecomputeInProgress(void)
 {
     CS_NoArgsCmd_t CmdPacket;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeTable), 1, true);
 
     /* Execute the function being tested */
     CS_EnableEepromCmd(&CmdPacket);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(CS_CheckRecomputeTable, 1);
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 0, "CS_AppData.HkPacket.Payload.CmdCounter == 0");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -296,18 +298,13 @@ void CS_RecomputeBaselineEepromCmd_Test_Nominal(void)
     CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID].State = 99;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitRecompute), true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineEepromCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_True(CS_AppData.HkPacket.Payload.RecomputeInProgress == true, "CS_AppData.HkPacket.Payload.RecomputeInProgress == true");
-    UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == false, "CS_AppData.HkPacket.Payload.OneShotInProgress == false");
-
-    UtAssert_True(CS_AppData.ChildTaskTable == CS_EEPROM_TABLE, "CS_AppData.ChildTaskTable == CS_EEPROM_TABLE");
-    UtAssert_True(CS_AppData.ChildTaskEntryID == CmdPacket.Payload.EntryID, "CS_AppData.ChildTaskEntryID == CmdPacket.Payload.EntryID");
-    UtAssert_True(CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID],
-                  "CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID]");
+    UtAssert_STUB_COUNT(CS_JobsSubmitRecompute, 1);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_EEPROM_STARTED_DBG_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
@@ -324,21 +321,21 @@ void CS_RecomputeBaselineEepromCmd_Test_Nominal(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_RecomputeBaselineEepromCmd_Test_CreateChildTaskError(void)
+void CS_RecomputeBaselineEepromCmd_Test_JobNotQueued(void)
 {
     CS_EntryCmd_t CmdPacket;
     int32         strCmpResult;
     char          ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Recompute baseline of EEPROM Entry ID %%d failed, CFE_ES_CreateChildTask returned:  0x%%08X");
+             "Recompute baseline of EEPROM Entry ID %%d failed: job queue full or recompute already queued");
 
     CmdPacket.Payload.EntryID = 1;
 
     CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID].State = 99;
 
-    /* Set to generate error message CS_RECOMPUTE_EEPROM_CREATE_CHDTASK_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, -1);
+    /* Set to generate error message CS_RECOMPUTE_EEPROM_CHDTASK_ERR_EID */
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitRecompute), false);
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
 
@@ -346,14 +343,9 @@ void CS_RecomputeBaselineEepromCmd_Test_CreateChildTaskError(void)
     CS_RecomputeBaselineEepromCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == false, "CS_AppData.HkPacket.Payload.OneShotInProgress == false");
-
-    UtAssert_True(CS_AppData.ChildTaskTable == CS_EEPROM_TABLE, "CS_AppData.ChildTaskTable == CS_EEPROM_TABLE");
-    UtAssert_True(CS_AppData.ChildTaskEntryID == CmdPacket.Payload.EntryID, "CS_AppData.ChildTaskEntryID == CmdPacket.Payload.EntryID");
-    UtAssert_True(CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID],
-                  "CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID]");
+    UtAssert_STUB_COUNT(CS_JobsSubmitRecompute, 1);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_EEPROM_CREATE_CHDTASK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_EEPROM_CHDTASK_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
@@ -361,7 +353,6 @@ void CS_RecomputeBaselineEepromCmd_Test_CreateChildTaskError(void)
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdErrCounter == 1, "CS_AppData.HkPacket.Payload.CmdErrCounter == 1");
-    UtAssert_True(CS_AppData.HkPacket.Payload.RecomputeInProgress == false, "CS_AppData.HkPacket.Payload.RecomputeInProgress == false");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -442,26 +433,30 @@ void CS_RecomputeBaselineEepromCmd_Test_RecomputeInProgress(void)
     char          ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Recompute baseline of EEPROM Entry ID %%d failed: child task in use");
+             "Recompute baseline of EEPROM Entry ID %%d started");
 
     CmdPacket.Payload.EntryID = 1;
 
+    CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID].State = 99;
+
+    /* A recompute of another entry does not keep this one from being queued */
     CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitRecompute), true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineEepromCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_EEPROM_CHDTASK_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_EEPROM_STARTED_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_True(CS_AppData.HkPacket.Payload.CmdErrCounter == 1, "CS_AppData.HkPacket.Payload.CmdErrCounter == 1");
+    UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -476,27 +471,31 @@ void CS_RecomputeBaselineEepromCmd_Test_OneShot(void)
     char          ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Recompute baseline of EEPROM Entry ID %%d failed: child task in use");
+             "Recompute baseline of EEPROM Entry ID %%d started");
 
     CmdPacket.Payload.EntryID = 1;
 
+    CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID].State = 99;
+
+    /* A OneShot in progress does not keep the recompute from being queued */
     CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
     CS_AppData.HkPacket.Payload.OneShotInProgress   = true;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitRecompute), true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineEepromCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_EEPROM_CHDTASK_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_EEPROM_STARTED_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_True(CS_AppData.HkPacket.Payload.CmdErrCounter == 1, "CS_AppData.HkPacket.Payload.CmdErrCounter == 1");
+    UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -538,6 +537,8 @@ void CS_EnableEntryIDEepromCmd_Test_Nominal(void)
 
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
+    UtAssert_STUB_COUNT(CS_SetEnabledMapEntry, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
@@ -660,17 +661,18 @@ void CS_EnableEntryIDEepromCmd_Test_InvalidEntryErrorStateEmpty(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_EnableEntryIDEepromCmd_Test_OneShot(void)
+void CS_EnableEntryIDEepromCmd_Test_RecomputeInProgress(void)
 {
     CS_EntryCmd_t CmdPacket;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeEntry), 1, true);
 
     /* Execute the function being tested */
     CS_EnableEntryIDEepromCmd(&CmdPacket);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(CS_CheckRecomputeEntry, 1);
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 0, "CS_AppData.HkPacket.Payload.CmdCounter == 0");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -701,8 +703,6 @@ void CS_DisableEntryIDEepromCmd_Test_Nominal(void)
     /* Verify results */
     UtAssert_True(CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID].State == CS_STATE_DISABLED,
                   "CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID].State == CS_STATE_DISABLED");
-    UtAssert_True(CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID].TempChecksumValue == 0,
-                  "CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID].TempChecksumValue == 0");
     UtAssert_True(CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID].ByteOffset == 0,
                   "CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID].ByteOffset == 0");
 
@@ -718,6 +718,8 @@ void CS_DisableEntryIDEepromCmd_Test_Nominal(void)
 
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
+    UtAssert_STUB_COUNT(CS_SetEnabledMapEntry, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
@@ -749,8 +751,6 @@ void CS_DisableEntryIDEepromCmd_Test_DefEepromTblPtrStateEmpty(void)
     /* Verify results */
     UtAssert_True(CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID].State == CS_STATE_DISABLED,
                   "CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID].State == CS_STATE_DISABLED");
-    UtAssert_True(CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID].TempChecksumValue == 0,
-                  "CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID].TempChecksumValue == 0");
     UtAssert_True(CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID].ByteOffset == 0,
                   "CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID].ByteOffset == 0");
 
@@ -844,17 +844,18 @@ void CS_DisableEntryIDEepromCmd_Test_InvalidEntryErrorStateEmpty(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_DisableEntryIDEepromCmd_Test_OneShot(void)
+void CS_DisableEntryIDEepromCmd_Test_RecomputeInProgress(void)
 {
     CS_EntryCmd_t CmdPacket;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeEntry), 1, true);
 
     /* Execute the function being tested */
     CS_DisableEntryIDEepromCmd(&CmdPacket);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(CS_CheckRecomputeEntry, 1);
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 0, "CS_AppData.HkPacket.Payload.CmdCounter == 0");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -1005,10 +1006,12 @@ void CS_GetEntryIDEepromCmd_Test_State(void)
 void UtTest_Setup(void)
 {
     UtTest_Add(CS_DisableEepromCmd_Test, CS_Test_Setup, CS_Test_TearDown, "CS_DisableEepromCmd_Test");
-    UtTest_Add(CS_DisableEepromCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown, "CS_DisableEepromCmd_Test_OneShot");
+    UtTest_Add(CS_DisableEepromCmd_Test_RecomputeInProgress, CS_Test_Setup, CS_Test_TearDown,
+               "CS_DisableEepromCmd_Test_RecomputeInProgress");
 
     UtTest_Add(CS_EnableEepromCmd_Test, CS_Test_Setup, CS_Test_TearDown, "CS_EnableEepromCmd_Test");
-    UtTest_Add(CS_EnableEepromCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown, "CS_EnableEepromCmd_Test_OneShot");
+    UtTest_Add(CS_EnableEepromCmd_Test_RecomputeInProgress, CS_Test_Setup, CS_Test_TearDown,
+               "CS_EnableEepromCmd_Test_RecomputeInProgress");
 
     UtTest_Add(CS_ReportBaselineEntryIDEepromCmd_Test_Computed, CS_Test_Setup, CS_Test_TearDown,
                "CS_ReportBaselineEntryIDEepromCmd_Test_Computed");
@@ -1021,8 +1024,8 @@ void UtTest_Setup(void)
 
     UtTest_Add(CS_RecomputeBaselineEepromCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineEepromCmd_Test_Nominal");
-    UtTest_Add(CS_RecomputeBaselineEepromCmd_Test_CreateChildTaskError, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeBaselineEepromCmd_Test_CreateChildTaskError");
+    UtTest_Add(CS_RecomputeBaselineEepromCmd_Test_JobNotQueued, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeBaselineEepromCmd_Test_JobNotQueued");
     UtTest_Add(CS_RecomputeBaselineEepromCmd_Test_InvalidEntryErrorEntryIDTooHigh, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineEepromCmd_Test_InvalidEntryErrorEntryIDTooHigh");
     UtTest_Add(CS_RecomputeBaselineEepromCmd_Test_InvalidEntryErrorStateEmpty, CS_Test_Setup, CS_Test_TearDown,
@@ -1040,8 +1043,8 @@ void UtTest_Setup(void)
                "CS_EnableEntryIDEepromCmd_Test_InvalidEntryErrorEntryIDTooHigh");
     UtTest_Add(CS_EnableEntryIDEepromCmd_Test_InvalidEntryErrorStateEmpty, CS_Test_Setup, CS_Test_TearDown,
                "CS_EnableEntryIDEepromCmd_Test_InvalidEntryErrorStateEmpty");
-    UtTest_Add(CS_EnableEntryIDEepromCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown,
-               "CS_EnableEntryIDEepromCmd_Test_OneShot");
+    UtTest_Add(CS_EnableEntryIDEepromCmd_Test_RecomputeInProgress, CS_Test_Setup, CS_Test_TearDown,
+               "CS_EnableEntryIDEepromCmd_Test_RecomputeInProgress");
 
     UtTest_Add(CS_DisableEntryIDEepromCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
                "CS_DisableEntryIDEepromCmd_Test_Nominal");
@@ -1051,8 +1054,8 @@ void UtTest_Setup(void)
                "CS_DisableEntryIDEepromCmd_Test_InvalidEntryErrorEntryIDTooHigh");
     UtTest_Add(CS_DisableEntryIDEepromCmd_Test_InvalidEntryErrorStateEmpty, CS_Test_Setup, CS_Test_TearDown,
                "CS_DisableEntryIDEepromCmd_Test_InvalidEntryErrorStateEmpty");
-    UtTest_Add(CS_DisableEntryIDEepromCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown,
-               "CS_DisableEntryIDEepromCmd_Test_OneShot");
+    UtTest_Add(CS_DisableEntryIDEepromCmd_Test_RecomputeInProgress, CS_Test_Setup, CS_Test_TearDown,
+               "CS_DisableEntryIDEepromCmd_Test_RecomputeInProgress");
 
     UtTest_Add(CS_GetEntryIDEepromCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
                "CS_GetEntryIDEepromCmd_Test_Nominal");
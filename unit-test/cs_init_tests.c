@@ -27,6 +27,7 @@
 #include "cs_events.h"
 #include "cs_version.h"
 #include "cs_utils.h"
+#include "cs_block.h"
 #include "cs_test_utils.h"
 #include <unistd.h>
 #include <stdlib.h>
@@ -192,6 +193,9 @@ void CS_Init_Test_TableInitNominal(void)
 
     UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
 
+    UtAssert_STUB_COUNT(CS_BlockTreeInit, 1);
+    UtAssert_STUB_COUNT(CS_BaselineRestore, 2);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -224,6 +228,8 @@ void CS_Init_Test_TableInitErrorEEPROM(void)
 
     UtAssert_True(Result == -1, "Result == -1");
 
+    UtAssert_STUB_COUNT(CS_BaselineRestore, 0);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
@@ -262,6 +268,9 @@ void CS_Init_Test_TableInitErrorMemory(void)
 
     UtAssert_True(Result == -1, "Result == -1");
 
+    /* Only the EEPROM baselines are restored */
+    UtAssert_STUB_COUNT(CS_BaselineRestore, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
@@ -370,6 +379,8 @@ void CS_Init_Test_CFETextSegmentInfoError(void)
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
+    UtAssert_STUB_COUNT(CS_BaselineRestore, 2);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
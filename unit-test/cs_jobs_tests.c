@@ -0,0 +1,907 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cs_app.h"
+#include "cs_events.h"
+#include "cs_compute.h"
+#include "cs_block.h"
+#include "cs_jobs.h"
+#include "cs_test_utils.h"
+#include <string.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+void CS_JOBS_TEST_DoneHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CS_Job_t *Job = (CS_Job_t *)UT_Hook_GetArgValueByName(Context, "Job", CS_Job_t *);
+
+    Job->Outcome = CS_JOB_STATUS_DONE;
+}
+
+/* Puts a job that a job task has finished on the first completion ring */
+void CS_JOBS_TEST_Complete(uint32 Slot, uint8 Type, uint16 Table, uint8 Outcome)
+{
+    CS_JobRing_t *Ring = &CS_AppData.Jobs.Completed[0];
+
+    CS_AppData.Jobs.Job[Slot].Info.Type   = Type;
+    CS_AppData.Jobs.Job[Slot].Info.Table  = Table;
+    CS_AppData.Jobs.Job[Slot].Info.Status = CS_JOB_STATUS_RUNNING;
+    CS_AppData.Jobs.Job[Slot].Outcome     = Outcome;
+
+    Ring->Slot[Ring->Head % CS_JOB_QUEUE_DEPTH] = Slot;
+    Ring->Head++;
+}
+
+void CS_JobsInit_Test_Nominal(void)
+{
+    CS_AppData.Jobs.Pending.Head = 1;
+
+    /* Execute the function being tested */
+    CS_JobsInit();
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(CS_AppData.Jobs.Active);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.NumTasks, CS_NUM_JOB_TASKS);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Pending.Head, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.JobRate, CS_DEFAULT_JOB_RATE);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.JobBurst, CS_DEFAULT_JOB_BURST);
+
+    UtAssert_STUB_COUNT(OS_MutSemCreate, 1);
+    UtAssert_STUB_COUNT(OS_CountSemCreate, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, CS_NUM_JOB_TASKS);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_JobsInit_Test_MutexError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 1, -1);
+
+    /* Execute the function being tested */
+    CS_JobsInit();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(CS_AppData.Jobs.Active);
+
+    UtAssert_STUB_COUNT(OS_CountSemCreate, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_JOB_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_JobsInit_Test_SemError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 1, -1);
+
+    /* Execute the function being tested */
+    CS_JobsInit();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(CS_AppData.Jobs.Active);
+
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_JOB_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_JobsInit_Test_TaskError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, -1);
+
+    /* Execute the function being tested */
+    CS_JobsInit();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(CS_AppData.Jobs.Active);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.NumTasks, 0);
+
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_JOB_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_JobsSubmitRecompute_Test_Nominal(void)
+{
+    CS_AppData.Jobs.Active               = true;
+    CS_AppData.HkPacket.Payload.JobRate  = 1000;
+    CS_AppData.HkPacket.Payload.JobBurst = 500;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE, CS_MEMORY_TABLE, 1));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[0].Info.Type, CS_JOB_TYPE_RECOMPUTE);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[0].Info.Table, CS_MEMORY_TABLE);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[0].Info.EntryID, 1);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[0].Info.Status, CS_JOB_STATUS_QUEUED);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[0].Rate, 1000);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[0].Burst, 500);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Pending.Head, 1);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Pending.Slot[0], 0);
+
+    UtAssert_BOOL_TRUE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.OneShotInProgress);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.Jobs[0].Status, CS_JOB_STATUS_QUEUED);
+
+    /* The definition entry is disabled by the main task before a job task can see the job */
+    UtAssert_STUB_COUNT(CS_RecomputeDisableDefEntry, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+
+    /* The leaves checksummed before the request are not trusted by the recompute */
+    UtAssert_STUB_COUNT(CS_BlockTreeInvalidate, 1);
+}
+
+void CS_JobsSubmitRecompute_Test_OtherEntry(void)
+{
+    CS_AppData.Jobs.Active = true;
+
+    UtAssert_BOOL_TRUE(CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE, CS_MEMORY_TABLE, 1));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE, CS_MEMORY_TABLE, 2));
+    UtAssert_BOOL_TRUE(CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE, CS_EEPROM_TABLE, 1));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Pending.Head, 3);
+
+    UtAssert_STUB_COUNT(OS_CountSemGive, 3);
+}
+
+void CS_JobsSubmitRecompute_Test_Duplicate(void)
+{
+    CS_AppData.Jobs.Active = true;
+
+    UtAssert_BOOL_TRUE(CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE, CS_MEMORY_TABLE, 1));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE, CS_MEMORY_TABLE, 1));
+    UtAssert_BOOL_FALSE(CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE_ALL, CS_MEMORY_TABLE, 0));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Pending.Head, 1);
+
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+}
+
+void CS_JobsSubmitRecompute_Test_AllConflict(void)
+{
+    CS_AppData.Jobs.Active = true;
+
+    UtAssert_BOOL_TRUE(CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE_ALL, CS_APP_TABLE, 3));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE, CS_APP_TABLE, 1));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[0].Info.Type, CS_JOB_TYPE_RECOMPUTE_ALL);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[0].Info.EntryID, 0);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Pending.Head, 1);
+
+    UtAssert_STUB_COUNT(CS_RecomputeDisableDefEntry, 0);
+    UtAssert_STUB_COUNT(CS_BlockTreeInvalidate, 1);
+}
+
+void CS_JobsSubmitRecompute_Test_Inactive(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE, CS_MEMORY_TABLE, 1));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Pending.Head, 0);
+    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+}
+
+void CS_JobsSubmitOneShot_Test_Nominal(void)
+{
+    CS_AppData.Jobs.Active = true;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(CS_JobsSubmitOneShot(0x1000, 0x200, 0x20));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[0].Info.Type, CS_JOB_TYPE_ONESHOT);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[0].Address, 0x1000);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[0].Size, 0x200);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[0].MaxBytesPerCycle, 0x20);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[0].Info.Status, CS_JOB_STATUS_QUEUED);
+
+    UtAssert_BOOL_TRUE(CS_AppData.HkPacket.Payload.OneShotInProgress);
+    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+}
+
+void CS_JobsSubmitOneShot_Test_QueueFull(void)
+{
+    uint32 i = 0;
+
+    CS_AppData.Jobs.Active = true;
+
+    for (i = 0; i < CS_JOB_QUEUE_DEPTH; i++)
+    {
+        UtAssert_BOOL_TRUE(CS_JobsSubmitOneShot(0, 1, 1));
+    }
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(CS_JobsSubmitOneShot(0, 1, 1));
+    UtAssert_BOOL_FALSE(CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE, CS_MEMORY_TABLE, 1));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Pending.Head, CS_JOB_QUEUE_DEPTH);
+
+    UtAssert_STUB_COUNT(OS_CountSemGive, CS_JOB_QUEUE_DEPTH);
+}
+
+void CS_JobsCancelOneShots_Test_Nominal(void)
+{
+    CS_AppData.Jobs.Active = true;
+
+    UtAssert_BOOL_TRUE(CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE, CS_MEMORY_TABLE, 1));
+    UtAssert_BOOL_TRUE(CS_JobsSubmitOneShot(0, 1, 1));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(CS_JobsCancelOneShots());
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(CS_AppData.Jobs.Job[0].Cancel);
+    UtAssert_BOOL_TRUE(CS_AppData.Jobs.Job[1].Cancel);
+
+    /* Already marked, so there is nothing more to cancel */
+    UtAssert_BOOL_FALSE(CS_JobsCancelOneShots());
+}
+
+void CS_JobsCancelOneShots_Test_NoOneShot(void)
+{
+    CS_AppData.Jobs.Active = true;
+
+    UtAssert_BOOL_TRUE(CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE, CS_MEMORY_TABLE, 1));
+
+    /* A finished OneShot that has been reported is not cancelled */
+    CS_AppData.Jobs.Job[1].Info.Type   = CS_JOB_TYPE_ONESHOT;
+    CS_AppData.Jobs.Job[1].Info.Status = CS_JOB_STATUS_DONE;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(CS_JobsCancelOneShots());
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(CS_AppData.Jobs.Job[0].Cancel);
+    UtAssert_BOOL_FALSE(CS_AppData.Jobs.Job[1].Cancel);
+}
+
+void CS_JobsBusy_Test(void)
+{
+    CS_AppData.Jobs.Active = true;
+
+    UtAssert_BOOL_TRUE(CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE, CS_TABLES_TABLE, 1));
+    UtAssert_BOOL_TRUE(CS_JobsSubmitOneShot(0, 1, 1));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(CS_JobsBusy(CS_TABLES_TABLE));
+    UtAssert_BOOL_FALSE(CS_JobsBusy(CS_APP_TABLE));
+
+    /* A OneShot's table is not meaningful */
+    UtAssert_BOOL_FALSE(CS_JobsBusy(CS_CFECORE));
+
+    /* Once the job is reported the table is free */
+    CS_AppData.Jobs.Job[0].Info.Status = CS_JOB_STATUS_DONE;
+    UtAssert_BOOL_FALSE(CS_JobsBusy(CS_TABLES_TABLE));
+}
+
+void CS_JobsEntryBusy_Test_Recompute(void)
+{
+    CS_AppData.Jobs.Active = true;
+
+    UtAssert_BOOL_TRUE(CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE, CS_MEMORY_TABLE, 2));
+    UtAssert_BOOL_TRUE(CS_JobsSubmitOneShot(0, 1, 1));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(CS_JobsEntryBusy(CS_MEMORY_TABLE, 2));
+    UtAssert_BOOL_FALSE(CS_JobsEntryBusy(CS_MEMORY_TABLE, 1));
+    UtAssert_BOOL_FALSE(CS_JobsEntryBusy(CS_MEMORY_TABLE, 3));
+    UtAssert_BOOL_FALSE(CS_JobsEntryBusy(CS_EEPROM_TABLE, 2));
+
+    /* A OneShot owns no entry */
+    UtAssert_BOOL_FALSE(CS_JobsEntryBusy(CS_CFECORE, 0));
+
+    /* Once the job is reported the entry is free */
+    CS_AppData.Jobs.Job[0].Info.Status = CS_JOB_STATUS_DONE;
+    UtAssert_BOOL_FALSE(CS_JobsEntryBusy(CS_MEMORY_TABLE, 2));
+}
+
+void CS_JobsEntryBusy_Test_RecomputeAll(void)
+{
+    CS_AppData.Jobs.Active = true;
+
+    UtAssert_BOOL_TRUE(CS_JobsSubmitRecompute(CS_JOB_TYPE_RECOMPUTE_ALL, CS_APP_TABLE, 0));
+
+    /* The job task has moved on to the third entry */
+    CS_AppData.Jobs.Job[0].Info.EntryID = 2;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(CS_JobsEntryBusy(CS_APP_TABLE, 1));
+    UtAssert_BOOL_TRUE(CS_JobsEntryBusy(CS_APP_TABLE, 2));
+    UtAssert_BOOL_TRUE(CS_JobsEntryBusy(CS_APP_TABLE, 3));
+    UtAssert_BOOL_FALSE(CS_JobsEntryBusy(CS_TABLES_TABLE, 3));
+}
+
+void CS_JobsCollectCharges_Test(void)
+{
+    uint32 Bytes = 0;
+    uint32 Time  = 0;
+
+    CS_AppData.Jobs.Job[0].BytesCharged = 100;
+    CS_AppData.Jobs.Job[0].TimeCharged  = 10;
+    CS_AppData.Jobs.Job[1].BytesCharged = 50;
+    CS_AppData.Jobs.Job[1].TimeCharged  = 5;
+
+    /* Execute the function being tested */
+    CS_JobsCollectCharges(&Bytes, &Time);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Bytes, 150);
+    UtAssert_UINT32_EQ(Time, 15);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[0].BytesTaken, 100);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[1].TimeTaken, 5);
+
+    /* Only what has been charged since is collected next time */
+    CS_AppData.Jobs.Job[1].BytesCharged = 80;
+    CS_AppData.Jobs.Job[1].TimeCharged  = 8;
+
+    CS_JobsCollectCharges(&Bytes, &Time);
+
+    UtAssert_UINT32_EQ(Bytes, 30);
+    UtAssert_UINT32_EQ(Time, 3);
+
+    CS_JobsCollectCharges(&Bytes, &Time);
+
+    UtAssert_UINT32_EQ(Bytes, 0);
+    UtAssert_UINT32_EQ(Time, 0);
+}
+
+void CS_JobsPace_Test_Unlimited(void)
+{
+    CS_Job_t Job;
+
+    memset(&Job, 0, sizeof(Job));
+
+    /* Execute the function being tested */
+    CS_JobsPace(&Job, 100000);
+
+    /* Verify results */
+    UtAssert_True(Job.Tokens == 0, "Job.Tokens == 0");
+
+    UtAssert_STUB_COUNT(CS_BudgetGetTime, 0);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+}
+
+void CS_JobsPace_Test_WithinBurst(void)
+{
+    CS_Job_t Job;
+
+    memset(&Job, 0, sizeof(Job));
+
+    Job.Rate   = 1000;
+    Job.Burst  = 500;
+    Job.Tokens = 500000000;
+
+    /* Execute the function being tested */
+    CS_JobsPace(&Job, 400);
+
+    /* Verify results */
+    UtAssert_True(Job.Tokens == 100000000, "Job.Tokens == 100000000");
+
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+}
+
+void CS_JobsPace_Test_Refill(void)
+{
+    CS_Job_t Job;
+    uint64   Time = 250000;
+
+    memset(&Job, 0, sizeof(Job));
+
+    Job.Rate     = 1000;
+    Job.Burst    = 500;
+    Job.Refilled = 50000;
+
+    UT_SetDataBuffer(UT_KEY(CS_BudgetGetTime), &Time, sizeof(Time), false);
+
+    /* Execute the function being tested */
+    CS_JobsPace(&Job, 100);
+
+    /* Verify results: 200 ms at 1000 bytes per second is 200 bytes */
+    UtAssert_True(Job.Tokens == 100000000, "Job.Tokens == 100000000");
+    UtAssert_True(Job.Refilled == 250000, "Job.Refilled == 250000");
+
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+
+    /* A long idle only fills the bucket to the burst size */
+    Time = 10000000;
+    UT_SetDataBuffer(UT_KEY(CS_BudgetGetTime), &Time, sizeof(Time), false);
+
+    CS_JobsPace(&Job, 100);
+
+    UtAssert_True(Job.Tokens == 400000000, "Job.Tokens == 400000000");
+}
+
+void CS_JobsPace_Test_Overdrawn(void)
+{
+    CS_Job_t Job;
+
+    memset(&Job, 0, sizeof(Job));
+
+    Job.Rate   = 1000;
+    Job.Burst  = 500;
+    Job.Tokens = 500000000;
+
+    /* Execute the function being tested, more than the bucket holds */
+    CS_JobsPace(&Job, 1500);
+
+    /* Verify results: the job waits for the 1000 bytes it is short */
+    UtAssert_True(Job.Tokens == -1000000000, "Job.Tokens == -1000000000");
+
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+}
+
+void CS_JobsDrain_Test_OneShotDone(void)
+{
+    CS_AppData.Jobs.Job[0].Address          = 0x1000;
+    CS_AppData.Jobs.Job[0].Size             = 0x200;
+    CS_AppData.Jobs.Job[0].MaxBytesPerCycle = 0x20;
+    CS_AppData.Jobs.Job[0].Info.Result      = 5;
+
+    CS_JOBS_TEST_Complete(0, CS_JOB_TYPE_ONESHOT, 0, CS_JOB_STATUS_DONE);
+
+    CS_AppData.HkPacket.Payload.OneShotInProgress = true;
+
+    /* Execute the function being tested */
+    CS_JobsDrain();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[0].Info.Status, CS_JOB_STATUS_DONE);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Completed[0].Tail, 1);
+
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastOneShotAddress, 0x1000);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastOneShotSize, 0x200);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastOneShotMaxBytesPerCycle, 0x20);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastOneShotChecksum, 5);
+    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.OneShotInProgress);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.Jobs[0].Status, CS_JOB_STATUS_DONE);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_ONESHOT_FINISHED_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void CS_JobsDrain_Test_OneShotCancelled(void)
+{
+    CS_AppData.Jobs.Job[0].Info.Result = 5;
+
+    CS_JOBS_TEST_Complete(0, CS_JOB_TYPE_ONESHOT, 0, CS_JOB_STATUS_CANCELLED);
+
+    /* Execute the function being tested */
+    CS_JobsDrain();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[0].Info.Status, CS_JOB_STATUS_CANCELLED);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastOneShotChecksum, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_JobsDrain_Test_RecomputeAll(void)
+{
+    CS_AppData.Jobs.Job[0].Info.Result        = 1;
+    CS_AppData.Jobs.Job[1].Info.Result        = 1;
+    CS_AppData.CfeCoreCodeSeg.ComparisonValue = 3;
+    CS_AppData.OSCodeSeg.ComparisonValue      = 4;
+
+    CS_JOBS_TEST_Complete(0, CS_JOB_TYPE_RECOMPUTE_ALL, CS_CFECORE, CS_JOB_STATUS_DONE);
+    CS_JOBS_TEST_Complete(1, CS_JOB_TYPE_RECOMPUTE_ALL, CS_OSCORE, CS_JOB_STATUS_DONE);
+    CS_JOBS_TEST_Complete(2, CS_JOB_TYPE_RECOMPUTE_ALL, CS_EEPROM_TABLE, CS_JOB_STATUS_DONE);
+
+    CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
+
+    /* Execute the function being tested */
+    CS_JobsDrain();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CfeCoreBaseline, 3);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.OSBaseline, 4);
+    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_ALL_FINISH_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, CS_RECOMPUTE_ALL_FINISH_INF_EID);
+}
+
+void CS_JobsDrain_Test_EepromMemory(void)
+{
+    CS_AppData.Jobs.Job[0].Info.Result = 3;
+    CS_AppData.Jobs.Job[1].Info.Result = 4;
+
+    CS_JOBS_TEST_Complete(0, CS_JOB_TYPE_RECOMPUTE, CS_CFECORE, CS_JOB_STATUS_DONE);
+    CS_JOBS_TEST_Complete(1, CS_JOB_TYPE_RECOMPUTE, CS_OSCORE, CS_JOB_STATUS_DONE);
+    CS_JOBS_TEST_Complete(2, CS_JOB_TYPE_RECOMPUTE, CS_MEMORY_TABLE, CS_JOB_STATUS_DONE);
+
+    /* Execute the function being tested */
+    CS_JobsDrain();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CfeCoreBaseline, 3);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.OSBaseline, 4);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[2].Info.Status, CS_JOB_STATUS_DONE);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID);
+}
+
+void CS_JobsDrain_Test_Blocks(void)
+{
+    CS_AppData.Jobs.Job[0].Info.EntryID      = 2;
+    CS_AppData.Jobs.Job[0].NumBlocks         = 8;
+    CS_AppData.Jobs.Job[0].NumBlocksRehashed = 3;
+
+    CS_JOBS_TEST_Complete(0, CS_JOB_TYPE_RECOMPUTE, CS_EEPROM_TABLE, CS_JOB_STATUS_DONE);
+
+    /* Execute the function being tested */
+    CS_JobsDrain();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_BLOCKS_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_STRINGBUF_EQ(context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+                          "%s entry %d recompute rehashed %u of %u blocks", CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID);
+}
+
+void CS_JobsDrain_Test_Tables(void)
+{
+    CS_JOBS_TEST_Complete(0, CS_JOB_TYPE_RECOMPUTE, CS_TABLES_TABLE, CS_JOB_STATUS_DONE);
+    CS_JOBS_TEST_Complete(1, CS_JOB_TYPE_RECOMPUTE, CS_TABLES_TABLE, CS_JOB_STATUS_FAILED);
+
+    /* Execute the function being tested */
+    CS_JobsDrain();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[0].Info.Status, CS_JOB_STATUS_DONE);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[1].Info.Status, CS_JOB_STATUS_FAILED);
+
+    /* Failed or not, the definition entry is put back */
+    UtAssert_STUB_COUNT(CS_RecomputeRestoreDefEntry, 2);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_TABLES_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, CS_RECOMPUTE_ERROR_TABLES_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_JobsDrain_Test_App(void)
+{
+    CS_JOBS_TEST_Complete(0, CS_JOB_TYPE_RECOMPUTE, CS_APP_TABLE, CS_JOB_STATUS_DONE);
+    CS_JOBS_TEST_Complete(1, CS_JOB_TYPE_RECOMPUTE, CS_APP_TABLE, CS_JOB_STATUS_FAILED);
+
+    /* Execute the function being tested */
+    CS_JobsDrain();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[0].Info.Status, CS_JOB_STATUS_DONE);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[1].Info.Status, CS_JOB_STATUS_FAILED);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_APP_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, CS_RECOMPUTE_ERROR_APP_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_JobsDrain_Test_Empty(void)
+{
+    CS_AppData.Jobs.Job[0].Info.Type   = CS_JOB_TYPE_RECOMPUTE;
+    CS_AppData.Jobs.Job[0].Info.Status = CS_JOB_STATUS_RUNNING;
+
+    /* Execute the function being tested */
+    CS_JobsDrain();
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.Jobs[0].Status, CS_JOB_STATUS_RUNNING);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_JobsRun_Test_Cancelled(void)
+{
+    CS_Job_t Job;
+
+    memset(&Job, 0, sizeof(Job));
+
+    Job.Info.Type = CS_JOB_TYPE_ONESHOT;
+    Job.Cancel    = true;
+
+    /* Execute the function being tested */
+    CS_JobsRun(&Job);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Job.Outcome, CS_JOB_STATUS_CANCELLED);
+
+    UtAssert_STUB_COUNT(CS_OneShot, 0);
+}
+
+void CS_JobsRun_Test_OneShot(void)
+{
+    CS_Job_t Job;
+    uint64   Time = 5000;
+
+    memset(&Job, 0, sizeof(Job));
+
+    Job.Info.Type = CS_JOB_TYPE_ONESHOT;
+    Job.Rate      = 1000;
+    Job.Burst     = 500;
+    Job.Tokens    = -1;
+
+    UT_SetDataBuffer(UT_KEY(CS_BudgetGetTime), &Time, sizeof(Time), false);
+
+    /* Execute the function being tested */
+    CS_JobsRun(&Job);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_OneShot, 1);
+
+    /* The job starts with a full bucket at the normal job task priority */
+    UtAssert_True(Job.Tokens == 500000000, "Job.Tokens == 500000000");
+    UtAssert_True(Job.Refilled == 5000, "Job.Refilled == 5000");
+    UtAssert_STUB_COUNT(OS_TaskSetPriority, 1);
+}
+
+void CS_JobsRun_Test_Unlimited(void)
+{
+    CS_Job_t Job;
+
+    memset(&Job, 0, sizeof(Job));
+
+    Job.Info.Type = CS_JOB_TYPE_ONESHOT;
+
+    /* Execute the function being tested */
+    CS_JobsRun(&Job);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_OneShot, 1);
+    UtAssert_STUB_COUNT(OS_TaskSetPriority, 1);
+}
+
+void CS_JobsRun_Test_Recompute(void)
+{
+    CS_Job_t Job;
+
+    memset(&Job, 0, sizeof(Job));
+
+    Job.Info.Type = CS_JOB_TYPE_RECOMPUTE;
+
+    /* Execute the function being tested */
+    Job.Info.Table = CS_EEPROM_TABLE;
+    CS_JobsRun(&Job);
+    Job.Info.Table = CS_TABLES_TABLE;
+    CS_JobsRun(&Job);
+    Job.Info.Table = CS_APP_TABLE;
+    CS_JobsRun(&Job);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Job.Outcome, CS_JOB_STATUS_FAILED);
+
+    UtAssert_STUB_COUNT(CS_RecomputeEepromMemory, 1);
+    UtAssert_STUB_COUNT(CS_RecomputeTables, 1);
+    UtAssert_STUB_COUNT(CS_RecomputeApp, 1);
+}
+
+void CS_JobsRun_Test_RecomputeAllEeprom(void)
+{
+    CS_Job_t Job;
+
+    memset(&Job, 0, sizeof(Job));
+
+    Job.Info.Type  = CS_JOB_TYPE_RECOMPUTE_ALL;
+    Job.Info.Table = CS_EEPROM_TABLE;
+
+    CS_AppData.ResEepromTblPtr[0].State = CS_STATE_ENABLED;
+    CS_AppData.ResEepromTblPtr[1].State = CS_STATE_DISABLED;
+
+    UT_SetHandlerFunction(UT_KEY(CS_RecomputeEepromMemory), CS_JOBS_TEST_DoneHandler, NULL);
+
+    /* Execute the function being tested */
+    CS_JobsRun(&Job);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Job.Outcome, CS_JOB_STATUS_DONE);
+    UtAssert_UINT32_EQ(Job.Info.Result, 2);
+
+    UtAssert_STUB_COUNT(CS_RecomputeEepromMemory, 2);
+}
+
+void CS_JobsRun_Test_RecomputeAllMemory(void)
+{
+    CS_Job_t Job;
+
+    memset(&Job, 0, sizeof(Job));
+
+    Job.Info.Type  = CS_JOB_TYPE_RECOMPUTE_ALL;
+    Job.Info.Table = CS_MEMORY_TABLE;
+
+    CS_AppData.ResMemoryTblPtr[0].State = CS_STATE_ENABLED;
+
+    /* Execute the function being tested */
+    CS_JobsRun(&Job);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Job.Outcome, CS_JOB_STATUS_DONE);
+    UtAssert_UINT32_EQ(Job.Info.Result, 0);
+
+    UtAssert_STUB_COUNT(CS_RecomputeEepromMemory, 1);
+}
+
+void CS_JobsRun_Test_RecomputeAllTablesApp(void)
+{
+    CS_Job_t Job;
+
+    memset(&Job, 0, sizeof(Job));
+
+    Job.Info.Type  = CS_JOB_TYPE_RECOMPUTE_ALL;
+    Job.Info.Table = CS_TABLES_TABLE;
+
+    CS_AppData.ResTablesTblPtr[0].State = CS_STATE_ENABLED;
+    CS_AppData.ResAppTblPtr[0].State    = CS_STATE_ENABLED;
+
+    UT_SetHandlerFunction(UT_KEY(CS_RecomputeTables), CS_JOBS_TEST_DoneHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_RecomputeApp), CS_JOBS_TEST_DoneHandler, NULL);
+
+    /* Execute the function being tested */
+    CS_JobsRun(&Job);
+    UtAssert_UINT32_EQ(Job.Info.Result, 1);
+
+    Job.Info.Table = CS_APP_TABLE;
+    CS_JobsRun(&Job);
+    UtAssert_UINT32_EQ(Job.Info.Result, 1);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_RecomputeTables, 1);
+    UtAssert_STUB_COUNT(CS_RecomputeApp, 1);
+}
+
+void CS_JobsRun_Test_RecomputeAllCodeSeg(void)
+{
+    CS_Job_t Job;
+
+    memset(&Job, 0, sizeof(Job));
+
+    Job.Info.Type  = CS_JOB_TYPE_RECOMPUTE_ALL;
+    Job.Info.Table = CS_OSCORE;
+
+    UT_SetHandlerFunction(UT_KEY(CS_RecomputeEepromMemory), CS_JOBS_TEST_DoneHandler, NULL);
+
+    /* Execute the function being tested */
+    CS_JobsRun(&Job);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Job.Outcome, CS_JOB_STATUS_DONE);
+    UtAssert_UINT32_EQ(Job.Info.Result, 1);
+    UtAssert_UINT32_EQ(Job.Info.EntryID, 0);
+
+    UtAssert_STUB_COUNT(CS_RecomputeEepromMemory, 1);
+}
+
+void CS_JobTask_Test(void)
+{
+    CS_AppData.Jobs.Job[1].Info.Type   = CS_JOB_TYPE_ONESHOT;
+    CS_AppData.Jobs.Job[1].Info.Status = CS_JOB_STATUS_QUEUED;
+    CS_AppData.Jobs.Pending.Slot[0]    = 1;
+    CS_AppData.Jobs.Pending.Head       = 1;
+
+    /* One job, then the semaphore is deleted */
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, -1);
+
+    /* Execute the function being tested */
+    CS_JobTask();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.NextTaskIndex, 1);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Pending.Tail, 1);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Job[1].Info.Status, CS_JOB_STATUS_RUNNING);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Completed[0].Head, 1);
+    UtAssert_UINT32_EQ(CS_AppData.Jobs.Completed[0].Slot[0], 1);
+
+    UtAssert_STUB_COUNT(CS_OneShot, 1);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(CS_JobsInit_Test_Nominal, CS_Test_Setup, CS_Test_TearDown, "CS_JobsInit_Test_Nominal");
+    UtTest_Add(CS_JobsInit_Test_MutexError, CS_Test_Setup, CS_Test_TearDown, "CS_JobsInit_Test_MutexError");
+    UtTest_Add(CS_JobsInit_Test_SemError, CS_Test_Setup, CS_Test_TearDown, "CS_JobsInit_Test_SemError");
+    UtTest_Add(CS_JobsInit_Test_TaskError, CS_Test_Setup, CS_Test_TearDown, "CS_JobsInit_Test_TaskError");
+    UtTest_Add(CS_JobsSubmitRecompute_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_JobsSubmitRecompute_Test_Nominal");
+    UtTest_Add(CS_JobsSubmitRecompute_Test_OtherEntry, CS_Test_Setup, CS_Test_TearDown,
+               "CS_JobsSubmitRecompute_Test_OtherEntry");
+    UtTest_Add(CS_JobsSubmitRecompute_Test_Duplicate, CS_Test_Setup, CS_Test_TearDown,
+               "CS_JobsSubmitRecompute_Test_Duplicate");
+    UtTest_Add(CS_JobsSubmitRecompute_Test_AllConflict, CS_Test_Setup, CS_Test_TearDown,
+               "CS_JobsSubmitRecompute_Test_AllConflict");
+    UtTest_Add(CS_JobsSubmitRecompute_Test_Inactive, CS_Test_Setup, CS_Test_TearDown,
+               "CS_JobsSubmitRecompute_Test_Inactive");
+    UtTest_Add(CS_JobsSubmitOneShot_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_JobsSubmitOneShot_Test_Nominal");
+    UtTest_Add(CS_JobsSubmitOneShot_Test_QueueFull, CS_Test_Setup, CS_Test_TearDown,
+               "CS_JobsSubmitOneShot_Test_QueueFull");
+    UtTest_Add(CS_JobsCancelOneShots_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_JobsCancelOneShots_Test_Nominal");
+    UtTest_Add(CS_JobsCancelOneShots_Test_NoOneShot, CS_Test_Setup, CS_Test_TearDown,
+               "CS_JobsCancelOneShots_Test_NoOneShot");
+    UtTest_Add(CS_JobsBusy_Test, CS_Test_Setup, CS_Test_TearDown, "CS_JobsBusy_Test");
+    UtTest_Add(CS_JobsEntryBusy_Test_Recompute, CS_Test_Setup, CS_Test_TearDown,
+               "CS_JobsEntryBusy_Test_Recompute");
+    UtTest_Add(CS_JobsEntryBusy_Test_RecomputeAll, CS_Test_Setup, CS_Test_TearDown,
+               "CS_JobsEntryBusy_Test_RecomputeAll");
+    UtTest_Add(CS_JobsCollectCharges_Test, CS_Test_Setup, CS_Test_TearDown, "CS_JobsCollectCharges_Test");
+    UtTest_Add(CS_JobsPace_Test_Unlimited, CS_Test_Setup, CS_Test_TearDown, "CS_JobsPace_Test_Unlimited");
+    UtTest_Add(CS_JobsPace_Test_WithinBurst, CS_Test_Setup, CS_Test_TearDown, "CS_JobsPace_Test_WithinBurst");
+    UtTest_Add(CS_JobsPace_Test_Refill, CS_Test_Setup, CS_Test_TearDown, "CS_JobsPace_Test_Refill");
+    UtTest_Add(CS_JobsPace_Test_Overdrawn, CS_Test_Setup, CS_Test_TearDown, "CS_JobsPace_Test_Overdrawn");
+    UtTest_Add(CS_JobsDrain_Test_OneShotDone, CS_Test_Setup, CS_Test_TearDown, "CS_JobsDrain_Test_OneShotDone");
+    UtTest_Add(CS_JobsDrain_Test_OneShotCancelled, CS_Test_Setup, CS_Test_TearDown,
+               "CS_JobsDrain_Test_OneShotCancelled");
+    UtTest_Add(CS_JobsDrain_Test_RecomputeAll, CS_Test_Setup, CS_Test_TearDown, "CS_JobsDrain_Test_RecomputeAll");
+    UtTest_Add(CS_JobsDrain_Test_EepromMemory, CS_Test_Setup, CS_Test_TearDown, "CS_JobsDrain_Test_EepromMemory");
+    UtTest_Add(CS_JobsDrain_Test_Blocks, CS_Test_Setup, CS_Test_TearDown, "CS_JobsDrain_Test_Blocks");
+    UtTest_Add(CS_JobsDrain_Test_Tables, CS_Test_Setup, CS_Test_TearDown, "CS_JobsDrain_Test_Tables");
+    UtTest_Add(CS_JobsDrain_Test_App, CS_Test_Setup, CS_Test_TearDown, "CS_JobsDrain_Test_App");
+    UtTest_Add(CS_JobsDrain_Test_Empty, CS_Test_Setup, CS_Test_TearDown, "CS_JobsDrain_Test_Empty");
+    UtTest_Add(CS_JobsRun_Test_Cancelled, CS_Test_Setup, CS_Test_TearDown, "CS_JobsRun_Test_Cancelled");
+    UtTest_Add(CS_JobsRun_Test_OneShot, CS_Test_Setup, CS_Test_TearDown, "CS_JobsRun_Test_OneShot");
+    UtTest_Add(CS_JobsRun_Test_Unlimited, CS_Test_Setup, CS_Test_TearDown, "CS_JobsRun_Test_Unlimited");
+    UtTest_Add(CS_JobsRun_Test_Recompute, CS_Test_Setup, CS_Test_TearDown, "CS_JobsRun_Test_Recompute");
+    UtTest_Add(CS_JobsRun_Test_RecomputeAllEeprom, CS_Test_Setup, CS_Test_TearDown,
+               "CS_JobsRun_Test_RecomputeAllEeprom");
+    UtTest_Add(CS_JobsRun_Test_RecomputeAllMemory, CS_Test_Setup, CS_Test_TearDown,
+               "CS_JobsRun_Test_RecomputeAllMemory");
+    UtTest_Add(CS_JobsRun_Test_RecomputeAllTablesApp, CS_Test_Setup, CS_Test_TearDown,
+               "CS_JobsRun_Test_RecomputeAllTablesApp");
+    UtTest_Add(CS_JobsRun_Test_RecomputeAllCodeSeg, CS_Test_Setup, CS_Test_TearDown,
+               "CS_JobsRun_Test_RecomputeAllCodeSeg");
+    UtTest_Add(CS_JobTask_Test, CS_Test_Setup, CS_Test_TearDown, "CS_JobTask_Test");
+}
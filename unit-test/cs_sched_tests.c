@@ -0,0 +1,338 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cs_app.h"
+#include "cs_events.h"
+#include "cs_budget.h"
+#include "cs_sched.h"
+#include "cs_test_utils.h"
+#include <string.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* Time returned by the next call to CS_BudgetGetTime */
+static uint64 CS_SCHED_TEST_Time;
+
+void CS_SCHED_TEST_SetTime(uint64 Time)
+{
+    CS_SCHED_TEST_Time = Time;
+
+    UT_SetDataBuffer(UT_KEY(CS_BudgetGetTime), &CS_SCHED_TEST_Time, sizeof(CS_SCHED_TEST_Time), false);
+}
+
+void CS_SchedInit_Test(void)
+{
+    CS_AppData.Sched.Deadline[CS_EEPROM_TABLE] = 1;
+    CS_AppData.Sched.Preempted                 = true;
+
+    /* Execute the function being tested */
+    CS_SchedInit();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.Sched.RevisitPeriod[CS_CFECORE], CS_DEFAULT_CFECORE_REVISIT_PERIOD);
+    UtAssert_UINT32_EQ(CS_AppData.Sched.RevisitPeriod[CS_OSCORE], CS_DEFAULT_OS_REVISIT_PERIOD);
+    UtAssert_UINT32_EQ(CS_AppData.Sched.RevisitPeriod[CS_EEPROM_TABLE], CS_DEFAULT_EEPROM_REVISIT_PERIOD);
+    UtAssert_UINT32_EQ(CS_AppData.Sched.RevisitPeriod[CS_MEMORY_TABLE], CS_DEFAULT_MEMORY_REVISIT_PERIOD);
+    UtAssert_UINT32_EQ(CS_AppData.Sched.RevisitPeriod[CS_TABLES_TABLE], CS_DEFAULT_TABLES_REVISIT_PERIOD);
+    UtAssert_UINT32_EQ(CS_AppData.Sched.RevisitPeriod[CS_APP_TABLE], CS_DEFAULT_APP_REVISIT_PERIOD);
+    UtAssert_UINT32_EQ(CS_AppData.Sched.Deadline[CS_EEPROM_TABLE], 0);
+    UtAssert_BOOL_FALSE(CS_AppData.Sched.Preempted);
+}
+
+void CS_SchedSelectTable_Test_NoPeriods(void)
+{
+    CS_AppData.HkPacket.Payload.CurrentCSTable      = CS_EEPROM_TABLE;
+    CS_AppData.HkPacket.Payload.CurrentEntryInTable = 4;
+
+    /* Execute the function being tested */
+    CS_SchedSelectTable();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, CS_EEPROM_TABLE);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 4);
+    UtAssert_BOOL_FALSE(CS_AppData.Sched.SweepStarted[CS_EEPROM_TABLE]);
+    UtAssert_STUB_COUNT(CS_BudgetGetTime, 0);
+}
+
+void CS_SchedSelectTable_Test_FirstSweep(void)
+{
+    CS_AppData.HkPacket.Payload.CurrentCSTable      = CS_EEPROM_TABLE;
+    CS_AppData.HkPacket.Payload.CurrentEntryInTable = 4;
+    CS_AppData.Sched.RevisitPeriod[CS_MEMORY_TABLE] = 10;
+    CS_AppData.Sched.Cursor[CS_MEMORY_TABLE]        = 7;
+
+    CS_SCHED_TEST_SetTime(5000000);
+
+    /* Execute the function being tested */
+    CS_SchedSelectTable();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, CS_MEMORY_TABLE);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 7);
+    UtAssert_UINT32_EQ(CS_AppData.Sched.Cursor[CS_EEPROM_TABLE], 4);
+    UtAssert_BOOL_TRUE(CS_AppData.Sched.Preempted);
+    UtAssert_UINT32_EQ(CS_AppData.Sched.ResumeTable, CS_EEPROM_TABLE);
+    UtAssert_BOOL_TRUE(CS_AppData.Sched.SweepStarted[CS_MEMORY_TABLE]);
+    UtAssert_UINT32_EQ(CS_AppData.Sched.SweepStart[CS_MEMORY_TABLE], 5000000);
+}
+
+void CS_SchedSelectTable_Test_EarliestDeadline(void)
+{
+    CS_AppData.HkPacket.Payload.CurrentCSTable      = CS_CFECORE;
+    CS_AppData.Sched.RevisitPeriod[CS_MEMORY_TABLE] = 10;
+    CS_AppData.Sched.RevisitPeriod[CS_TABLES_TABLE] = 10;
+    CS_AppData.Sched.Deadline[CS_MEMORY_TABLE]      = 20000000;
+    CS_AppData.Sched.Deadline[CS_TABLES_TABLE]      = 18000000;
+
+    CS_SCHED_TEST_SetTime(16000000);
+
+    /* Execute the function being tested */
+    CS_SchedSelectTable();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, CS_TABLES_TABLE);
+    UtAssert_BOOL_FALSE(CS_AppData.Sched.SweepStarted[CS_MEMORY_TABLE]);
+}
+
+void CS_SchedSelectTable_Test_NotReleased(void)
+{
+    CS_AppData.HkPacket.Payload.CurrentCSTable      = CS_EEPROM_TABLE;
+    CS_AppData.HkPacket.Payload.CurrentEntryInTable = 4;
+    CS_AppData.Sched.RevisitPeriod[CS_MEMORY_TABLE] = 10;
+    CS_AppData.Sched.Deadline[CS_MEMORY_TABLE]      = 20000000;
+
+    /* Released half the period before the deadline, at 15 seconds */
+    CS_SCHED_TEST_SetTime(14000000);
+
+    /* Execute the function being tested */
+    CS_SchedSelectTable();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, CS_EEPROM_TABLE);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 4);
+    UtAssert_BOOL_FALSE(CS_AppData.Sched.Preempted);
+    UtAssert_BOOL_TRUE(CS_AppData.Sched.SweepStarted[CS_EEPROM_TABLE]);
+    UtAssert_UINT32_EQ(CS_AppData.Sched.SweepStart[CS_EEPROM_TABLE], 14000000);
+}
+
+void CS_SchedSelectTable_Test_AlreadyPreempted(void)
+{
+    CS_AppData.HkPacket.Payload.CurrentCSTable      = CS_MEMORY_TABLE;
+    CS_AppData.HkPacket.Payload.CurrentEntryInTable = 2;
+    CS_AppData.Sched.Preempted                      = true;
+    CS_AppData.Sched.ResumeTable                    = CS_OSCORE;
+    CS_AppData.Sched.SweepStarted[CS_MEMORY_TABLE]  = true;
+    CS_AppData.Sched.SweepStart[CS_MEMORY_TABLE]    = 1;
+    CS_AppData.Sched.RevisitPeriod[CS_MEMORY_TABLE] = 10;
+    CS_AppData.Sched.RevisitPeriod[CS_APP_TABLE]    = 2;
+    CS_AppData.Sched.Deadline[CS_MEMORY_TABLE]      = 20000000;
+    CS_AppData.Sched.Deadline[CS_APP_TABLE]         = 17000000;
+
+    CS_SCHED_TEST_SetTime(16000000);
+
+    /* Execute the function being tested */
+    CS_SchedSelectTable();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, CS_APP_TABLE);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 0);
+    UtAssert_UINT32_EQ(CS_AppData.Sched.Cursor[CS_MEMORY_TABLE], 2);
+    UtAssert_UINT32_EQ(CS_AppData.Sched.ResumeTable, CS_OSCORE);
+    UtAssert_UINT32_EQ(CS_AppData.Sched.SweepStart[CS_MEMORY_TABLE], 1);
+}
+
+void CS_SchedTableDone_Test_Deadline(void)
+{
+    CS_AppData.HkPacket.Payload.CurrentCSTable      = CS_MEMORY_TABLE;
+    CS_AppData.Sched.RevisitPeriod[CS_MEMORY_TABLE] = 10;
+    CS_AppData.Sched.SweepStarted[CS_MEMORY_TABLE]  = true;
+    CS_AppData.Sched.SweepStart[CS_MEMORY_TABLE]    = 5000000;
+    CS_AppData.Sched.Cursor[CS_MEMORY_TABLE]        = 3;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(CS_SchedTableDone());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.Sched.Deadline[CS_MEMORY_TABLE], 15000000);
+    UtAssert_BOOL_FALSE(CS_AppData.Sched.SweepStarted[CS_MEMORY_TABLE]);
+    UtAssert_UINT32_EQ(CS_AppData.Sched.Cursor[CS_MEMORY_TABLE], 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, CS_MEMORY_TABLE);
+}
+
+void CS_SchedTableDone_Test_NoPeriod(void)
+{
+    CS_AppData.HkPacket.Payload.CurrentCSTable     = CS_MEMORY_TABLE;
+    CS_AppData.Sched.SweepStarted[CS_MEMORY_TABLE] = true;
+    CS_AppData.Sched.SweepStart[CS_MEMORY_TABLE]   = 5000000;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(CS_SchedTableDone());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.Sched.Deadline[CS_MEMORY_TABLE], 0);
+    UtAssert_BOOL_FALSE(CS_AppData.Sched.SweepStarted[CS_MEMORY_TABLE]);
+}
+
+void CS_SchedTableDone_Test_Resume(void)
+{
+    CS_AppData.HkPacket.Payload.CurrentCSTable      = CS_MEMORY_TABLE;
+    CS_AppData.Sched.RevisitPeriod[CS_MEMORY_TABLE] = 10;
+    CS_AppData.Sched.Preempted                      = true;
+    CS_AppData.Sched.ResumeTable                    = CS_EEPROM_TABLE;
+    CS_AppData.Sched.Cursor[CS_EEPROM_TABLE]        = 6;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(CS_SchedTableDone());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, CS_EEPROM_TABLE);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 6);
+    UtAssert_BOOL_FALSE(CS_AppData.Sched.Preempted);
+}
+
+void CS_SchedTableDone_Test_ResumeTableDue(void)
+{
+    CS_AppData.HkPacket.Payload.CurrentCSTable      = CS_MEMORY_TABLE;
+    CS_AppData.Sched.RevisitPeriod[CS_MEMORY_TABLE] = 10;
+    CS_AppData.Sched.Preempted                      = true;
+    CS_AppData.Sched.ResumeTable                    = CS_MEMORY_TABLE;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(CS_SchedTableDone());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, CS_MEMORY_TABLE);
+    UtAssert_BOOL_FALSE(CS_AppData.Sched.Preempted);
+}
+
+void CS_SchedTableDone_Test_EndOfList(void)
+{
+    CS_AppData.HkPacket.Payload.CurrentCSTable = CS_NUM_TABLES;
+    CS_AppData.Sched.Preempted                 = true;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(CS_SchedTableDone());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, CS_NUM_TABLES);
+    UtAssert_BOOL_TRUE(CS_AppData.Sched.Preempted);
+}
+
+void CS_SchedEntryChecked_Test_Miss(void)
+{
+    uint32 LastCheckTime  = 1000;
+    uint32 DeadlineMisses = 2;
+
+    CS_AppData.Sched.RevisitPeriod[CS_APP_TABLE] = 1;
+
+    CS_SCHED_TEST_SetTime(2500000);
+
+    /* Execute the function being tested */
+    CS_SchedEntryChecked(CS_APP_TABLE, &LastCheckTime, &DeadlineMisses);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LastCheckTime, 2500);
+    UtAssert_UINT32_EQ(DeadlineMisses, 3);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.DeadlineMissCounter, 1);
+}
+
+void CS_SchedEntryChecked_Test_OnTime(void)
+{
+    uint32 LastCheckTime  = 1000;
+    uint32 DeadlineMisses = 0;
+
+    CS_AppData.Sched.RevisitPeriod[CS_APP_TABLE] = 1;
+
+    CS_SCHED_TEST_SetTime(2000000);
+
+    /* Execute the function being tested */
+    CS_SchedEntryChecked(CS_APP_TABLE, &LastCheckTime, &DeadlineMisses);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LastCheckTime, 2000);
+    UtAssert_UINT32_EQ(DeadlineMisses, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.DeadlineMissCounter, 0);
+}
+
+void CS_SchedEntryChecked_Test_FirstCheck(void)
+{
+    uint32 LastCheckTime  = 0;
+    uint32 DeadlineMisses = 0;
+
+    CS_AppData.Sched.RevisitPeriod[CS_APP_TABLE] = 1;
+
+    CS_SCHED_TEST_SetTime(9000000);
+
+    /* Execute the function being tested */
+    CS_SchedEntryChecked(CS_APP_TABLE, &LastCheckTime, &DeadlineMisses);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LastCheckTime, 9000);
+    UtAssert_UINT32_EQ(DeadlineMisses, 0);
+}
+
+void CS_SchedEntryChecked_Test_NoPeriod(void)
+{
+    uint32 LastCheckTime  = 1000;
+    uint32 DeadlineMisses = 0;
+
+    CS_SCHED_TEST_SetTime(9000000);
+
+    /* Execute the function being tested */
+    CS_SchedEntryChecked(CS_APP_TABLE, &LastCheckTime, &DeadlineMisses);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LastCheckTime, 9000);
+    UtAssert_UINT32_EQ(DeadlineMisses, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.DeadlineMissCounter, 0);
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(CS_SchedInit_Test, CS_Test_Setup, CS_Test_TearDown, "CS_SchedInit_Test");
+    UtTest_Add(CS_SchedSelectTable_Test_NoPeriods, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SchedSelectTable_Test_NoPeriods");
+    UtTest_Add(CS_SchedSelectTable_Test_FirstSweep, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SchedSelectTable_Test_FirstSweep");
+    UtTest_Add(CS_SchedSelectTable_Test_EarliestDeadline, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SchedSelectTable_Test_EarliestDeadline");
+    UtTest_Add(CS_SchedSelectTable_Test_NotReleased, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SchedSelectTable_Test_NotReleased");
+    UtTest_Add(CS_SchedSelectTable_Test_AlreadyPreempted, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SchedSelectTable_Test_AlreadyPreempted");
+    UtTest_Add(CS_SchedTableDone_Test_Deadline, CS_Test_Setup, CS_Test_TearDown, "CS_SchedTableDone_Test_Deadline");
+    UtTest_Add(CS_SchedTableDone_Test_NoPeriod, CS_Test_Setup, CS_Test_TearDown, "CS_SchedTableDone_Test_NoPeriod");
+    UtTest_Add(CS_SchedTableDone_Test_Resume, CS_Test_Setup, CS_Test_TearDown, "CS_SchedTableDone_Test_Resume");
+    UtTest_Add(CS_SchedTableDone_Test_ResumeTableDue, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SchedTableDone_Test_ResumeTableDue");
+    UtTest_Add(CS_SchedTableDone_Test_EndOfList, CS_Test_Setup, CS_Test_TearDown, "CS_SchedTableDone_Test_EndOfList");
+    UtTest_Add(CS_SchedEntryChecked_Test_Miss, CS_Test_Setup, CS_Test_TearDown, "CS_SchedEntryChecked_Test_Miss");
+    UtTest_Add(CS_SchedEntryChecked_Test_OnTime, CS_Test_Setup, CS_Test_TearDown, "CS_SchedEntryChecked_Test_OnTime");
+    UtTest_Add(CS_SchedEntryChecked_Test_FirstCheck, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SchedEntryChecked_Test_FirstCheck");
+    UtTest_Add(CS_SchedEntryChecked_Test_NoPeriod, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SchedEntryChecked_Test_NoPeriod");
+}
@@ -0,0 +1,259 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cs_app.h"
+#include "cs_events.h"
+#include "cs_crc.h"
+#include "cs_algorithm.h"
+#include "cs_syndrome.h"
+#include "cs_test_utils.h"
+#include <string.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* The check string "123456789" and its CRCs */
+#define CS_SYNDROME_TEST_CHECK_LENGTH 9
+#define CS_SYNDROME_TEST_CRC_16       0xBB3D
+#define CS_SYNDROME_TEST_CRC_32       0xCBF43926
+#define CS_SYNDROME_TEST_CRC_32C      0xE3069283
+
+static CS_Algorithm_t        CS_SYNDROME_TEST_Algorithm;
+static const CS_Algorithm_t *CS_SYNDROME_TEST_AlgorithmPtr = &CS_SYNDROME_TEST_Algorithm;
+
+void CS_SYNDROME_TEST_SetupAlgorithm(CFE_ES_CrcType_Enum_t TypeCRC)
+{
+    memset(&CS_SYNDROME_TEST_Algorithm, 0, sizeof(CS_SYNDROME_TEST_Algorithm));
+    CS_SYNDROME_TEST_Algorithm.TypeCRC = TypeCRC;
+
+    UT_SetDataBuffer(UT_KEY(CS_GetAlgorithm), &CS_SYNDROME_TEST_AlgorithmPtr, sizeof(CS_SYNDROME_TEST_AlgorithmPtr),
+                     false);
+}
+
+void CS_SyndromeInit_Test(void)
+{
+    uint32 CrcIndex;
+    uint32 Index;
+    bool   Sorted = true;
+
+    /* Execute the function being tested */
+    CS_SyndromeInit();
+
+    /* Verify results */
+    for (CrcIndex = 0; CrcIndex < CS_SYNDROME_NUM_CRCS; CrcIndex++)
+    {
+        for (Index = 1; Index < CS_SYNDROME_TABLE_SIZE; Index++)
+        {
+            if (CS_AppData.Syndrome.Steps[CrcIndex][Index - 1].Syndrome >=
+                CS_AppData.Syndrome.Steps[CrcIndex][Index].Syndrome)
+            {
+                Sorted = false;
+            }
+        }
+
+        UtAssert_NONZERO(CS_AppData.Syndrome.GiantStep[CrcIndex]);
+    }
+
+    UtAssert_True(Sorted, "Every table is sorted with no repeated syndromes");
+}
+
+void CS_SyndromeLocate_Test_Crc16(void)
+{
+    uint32 ByteOffset = 0;
+    uint8  BitNumber  = 0;
+
+    CS_SyndromeInit();
+
+    /* Execute the function being tested, with the CRC-16 sign extended as CS_CalculateCRC returns it */
+    UtAssert_BOOL_TRUE(CS_SyndromeLocate(CFE_ES_CrcType_CRC_16, CS_SYNDROME_TEST_CRC_16, 0xFFFFDB3C,
+                                         CS_SYNDROME_TEST_CHECK_LENGTH, &ByteOffset, &BitNumber));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(ByteOffset, 7);
+    UtAssert_UINT8_EQ(BitNumber, 1);
+}
+
+void CS_SyndromeLocate_Test_Crc32(void)
+{
+    uint32 ByteOffset = 0;
+    uint8  BitNumber  = 0;
+
+    CS_SyndromeInit();
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(CS_SyndromeLocate(CFE_ES_CrcType_CRC_32, CS_SYNDROME_TEST_CRC_32, 0xAC2AA5E8,
+                                         CS_SYNDROME_TEST_CHECK_LENGTH, &ByteOffset, &BitNumber));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(ByteOffset, 2);
+    UtAssert_UINT8_EQ(BitNumber, 4);
+}
+
+void CS_SyndromeLocate_Test_Crc32C(void)
+{
+    uint32 ByteOffset = 0;
+    uint8  BitNumber  = 0;
+
+    CS_SyndromeInit();
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(CS_SyndromeLocate(CS_CRC_TYPE_CRC_32C, CS_SYNDROME_TEST_CRC_32C, 0x456E9768,
+                                         CS_SYNDROME_TEST_CHECK_LENGTH, &ByteOffset, &BitNumber));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(ByteOffset, 0);
+    UtAssert_UINT8_EQ(BitNumber, 7);
+}
+
+void CS_SyndromeLocate_Test_LargeRegion(void)
+{
+    uint32 ByteOffset = 0;
+    uint8  BitNumber  = 0;
+
+    CS_SyndromeInit();
+
+    /* Bit 0 of byte 700000 of a megabyte of zeros, many giant steps from the end */
+    UtAssert_BOOL_TRUE(
+        CS_SyndromeLocate(CFE_ES_CrcType_CRC_32, 0xA738EA1C, 0xB4CD7D8F, 1024 * 1024, &ByteOffset, &BitNumber));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(ByteOffset, 700000);
+    UtAssert_UINT8_EQ(BitNumber, 0);
+
+    /* Bit 6 of byte 1234 of 4000 bytes of zeros, within the CRC-16 period */
+    UtAssert_BOOL_TRUE(CS_SyndromeLocate(CFE_ES_CrcType_CRC_16, 0, 0x3D11, 4000, &ByteOffset, &BitNumber));
+
+    UtAssert_UINT32_EQ(ByteOffset, 1234);
+    UtAssert_UINT8_EQ(BitNumber, 6);
+}
+
+void CS_SyndromeLocate_Test_NotLocated(void)
+{
+    uint32 ByteOffset = 99;
+    uint8  BitNumber  = 99;
+
+    CS_SyndromeInit();
+
+    /* Two bits flipped */
+    UtAssert_BOOL_FALSE(CS_SyndromeLocate(CFE_ES_CrcType_CRC_32, CS_SYNDROME_TEST_CRC_32, 0x1496C28D,
+                                          CS_SYNDROME_TEST_CHECK_LENGTH, &ByteOffset, &BitNumber));
+
+    /* The bit that fits is past the end of a shorter region */
+    UtAssert_BOOL_FALSE(
+        CS_SyndromeLocate(CFE_ES_CrcType_CRC_32, CS_SYNDROME_TEST_CRC_32, 0xAC2AA5E8, 2, &ByteOffset, &BitNumber));
+
+    /* No difference */
+    UtAssert_BOOL_FALSE(CS_SyndromeLocate(CFE_ES_CrcType_CRC_32, CS_SYNDROME_TEST_CRC_32, CS_SYNDROME_TEST_CRC_32,
+                                          CS_SYNDROME_TEST_CHECK_LENGTH, &ByteOffset, &BitNumber));
+
+    /* The last bit of 5000 bytes matches another bit one CRC-16 period earlier */
+    UtAssert_BOOL_FALSE(CS_SyndromeLocate(CFE_ES_CrcType_CRC_16, 0, 0xA001, 5000, &ByteOffset, &BitNumber));
+
+    /* Not a supported CRC */
+    UtAssert_BOOL_FALSE(CS_SyndromeLocate(CFE_ES_CrcType_NONE, CS_SYNDROME_TEST_CRC_32, 0xAC2AA5E8,
+                                          CS_SYNDROME_TEST_CHECK_LENGTH, &ByteOffset, &BitNumber));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(ByteOffset, 99);
+    UtAssert_UINT8_EQ(BitNumber, 99);
+}
+
+void CS_SyndromeReport_Test_Located(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Single bit error: %%s entry %%d, address 0x%%08X bit %%d");
+
+    CS_SyndromeInit();
+    CS_SYNDROME_TEST_SetupAlgorithm(CFE_ES_CrcType_CRC_32);
+
+    CS_AppData.HkPacket.Payload.BitErrorCounter = 1;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(CS_SyndromeReport(CS_MEMORY_TABLE, 3, CS_ALGORITHM_CRC_32, 0x1000,
+                                         CS_SYNDROME_TEST_CHECK_LENGTH, CS_SYNDROME_TEST_CRC_32, 0xAC2AA5E8));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.BitErrorCounter, 2);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastBitErrorTable, CS_MEMORY_TABLE);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastBitErrorEntry, 3);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastBitErrorBit, 4);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastBitErrorAddress, 0x1002);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SINGLE_BIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_SyndromeReport_Test_NotLocated(void)
+{
+    CS_SyndromeInit();
+    CS_SYNDROME_TEST_SetupAlgorithm(CFE_ES_CrcType_CRC_32);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(CS_SyndromeReport(CS_EEPROM_TABLE, 0, CS_ALGORITHM_CRC_32, 0x1000,
+                                          CS_SYNDROME_TEST_CHECK_LENGTH, CS_SYNDROME_TEST_CRC_32, 0x1496C28D));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.BitErrorCounter, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_SyndromeReport_Test_NotCrc(void)
+{
+    CS_SyndromeInit();
+    CS_SYNDROME_TEST_SetupAlgorithm(CFE_ES_CrcType_NONE);
+
+    /* Execute the function being tested, with values that would locate a CRC-32 error */
+    UtAssert_BOOL_FALSE(CS_SyndromeReport(CS_APP_TABLE, 0, CS_ALGORITHM_SHA_256, 0x1000,
+                                          CS_SYNDROME_TEST_CHECK_LENGTH, CS_SYNDROME_TEST_CRC_32, 0xAC2AA5E8));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.BitErrorCounter, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(CS_SyndromeInit_Test, CS_Test_Setup, CS_Test_TearDown, "CS_SyndromeInit_Test");
+    UtTest_Add(CS_SyndromeLocate_Test_Crc16, CS_Test_Setup, CS_Test_TearDown, "CS_SyndromeLocate_Test_Crc16");
+    UtTest_Add(CS_SyndromeLocate_Test_Crc32, CS_Test_Setup, CS_Test_TearDown, "CS_SyndromeLocate_Test_Crc32");
+    UtTest_Add(CS_SyndromeLocate_Test_Crc32C, CS_Test_Setup, CS_Test_TearDown, "CS_SyndromeLocate_Test_Crc32C");
+    UtTest_Add(CS_SyndromeLocate_Test_LargeRegion, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SyndromeLocate_Test_LargeRegion");
+    UtTest_Add(CS_SyndromeLocate_Test_NotLocated, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SyndromeLocate_Test_NotLocated");
+    UtTest_Add(CS_SyndromeReport_Test_Located, CS_Test_Setup, CS_Test_TearDown, "CS_SyndromeReport_Test_Located");
+    UtTest_Add(CS_SyndromeReport_Test_NotLocated, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SyndromeReport_Test_NotLocated");
+    UtTest_Add(CS_SyndromeReport_Test_NotCrc, CS_Test_Setup, CS_Test_TearDown, "CS_SyndromeReport_Test_NotCrc");
+}
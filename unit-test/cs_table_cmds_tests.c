@@ -85,7 +85,6 @@ void CS_DisableTablesCmd_Test(void)
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Checksumming of Tables is Disabled");
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, false);
 
     /* Execute the function being tested */
     CS_DisableTablesCmd(&CmdPacket);
@@ -109,17 +108,18 @@ void CS_DisableTablesCmd_Test(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_DisableTablesCmd_Test_OneShot(void)
+void CS_DisableTablesCmd_Test_RecomputeInProgress(void)
 {
     CS_NoArgsCmd_t CmdPacket;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeTable), 1, true);
 
     /* Execute the function being tested */
     CS_DisableTablesCmd(&CmdPacket);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(CS_CheckRecomputeTable, 1);
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 0, "CS_AppData.HkPacket.Payload.CmdCounter == 0");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -137,7 +137,6 @@ void CS_EnableTablesCmd_Test(void)
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Checksumming of Tables is Enabled");
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, false);
 
     /* Execute the function being tested */
     CS_EnableTablesCmd(&CmdPacket);
@@ -161,17 +160,18 @@ void CS_EnableTablesCmd_Test(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_EnableTablesCmd_Test_OneShot(void)
+void CS_EnableTablesCmd_Test_RecomputeInProgress(void)
 {
     CS_NoArgsCmd_t CmdPacket;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeTable), 1, true);
 
     /* Execute the function being tested */
     CS_EnableTablesCmd(&CmdPacket);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(CS_CheckRecomputeTable, 1);
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 0, "CS_AppData.HkPacket.Payload.CmdCounter == 0");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -311,19 +311,16 @@ void CS_RecomputeBaselineTablesCmd_Test_Nominal(void)
     CS_AppData.ResTablesTblPtr[0].State = 99; /* Needed to make CS_GetTableResTblEntryByName return correct results */
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, false);
     UT_SetHandlerFunction(UT_KEY(CS_GetTableResTblEntryByName), CS_APP_CMDS_TEST_CS_GetTableResTblEntryByNameHandler1,
                           NULL);
     UT_SetDeferredRetcode(UT_KEY(CS_GetTableResTblEntryByName), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitRecompute), true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineTablesCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_True(CS_AppData.HkPacket.Payload.RecomputeInProgress == true, "CS_AppData.HkPacket.Payload.RecomputeInProgress == true");
-    UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == false, "CS_AppData.HkPacket.Payload.OneShotInProgress == false");
-
-    UtAssert_True(CS_AppData.ChildTaskTable == CS_TABLES_TABLE, "CS_AppData.ChildTaskTable == CS_TABLES_TABLE");
+    UtAssert_STUB_COUNT(CS_JobsSubmitRecompute, 1);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_TABLES_STARTED_DBG_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
@@ -340,25 +337,24 @@ void CS_RecomputeBaselineTablesCmd_Test_Nominal(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_RecomputeBaselineTablesCmd_Test_CreateChildTaskError(void)
+void CS_RecomputeBaselineTablesCmd_Test_JobNotQueued(void)
 {
     CS_TableNameCmd_t CmdPacket;
     int32             strCmpResult;
     char              ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Recompute baseline of table %%s failed, CFE_ES_CreateChildTask returned: 0x%%08X");
+             "Tables recompute baseline for table %%s failed: job queue full or already queued");
 
     strncpy(CS_AppData.ResTablesTblPtr[0].Name, "name", 10);
     strncpy(CmdPacket.Payload.Name, "name", 10);
 
     CS_AppData.ResTablesTblPtr[0].State = 99; /* Needed to make CS_GetTableResTblEntryByName return correct results */
 
-    /* Set to generate error message CS_RECOMPUTE_TABLES_CREATE_CHDTASK_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, -1);
+    /* Set to generate error message CS_RECOMPUTE_TABLES_CHDTASK_ERR_EID */
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitRecompute), false);
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, false);
     UT_SetHandlerFunction(UT_KEY(CS_GetTableResTblEntryByName), CS_APP_CMDS_TEST_CS_GetTableResTblEntryByNameHandler1,
                           NULL);
     UT_SetDeferredRetcode(UT_KEY(CS_GetTableResTblEntryByName), 1, true);
@@ -367,11 +363,9 @@ void CS_RecomputeBaselineTablesCmd_Test_CreateChildTaskError(void)
     CS_RecomputeBaselineTablesCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == false, "CS_AppData.HkPacket.Payload.OneShotInProgress == false");
-
-    UtAssert_True(CS_AppData.ChildTaskTable == CS_TABLES_TABLE, "CS_AppData.ChildTaskTable == CS_TABLES_TABLE");
+    UtAssert_STUB_COUNT(CS_JobsSubmitRecompute, 1);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_TABLES_CREATE_CHDTASK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_TABLES_CHDTASK_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
@@ -380,8 +374,6 @@ void CS_RecomputeBaselineTablesCmd_Test_CreateChildTaskError(void)
 
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdErrCounter == 1, "CS_AppData.HkPacket.Payload.CmdErrCounter == 1");
 
-    UtAssert_True(CS_AppData.HkPacket.Payload.RecomputeInProgress == false, "CS_AppData.HkPacket.Payload.RecomputeInProgress == false");
-
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
@@ -400,7 +392,6 @@ void CS_RecomputeBaselineTablesCmd_Test_TableNotFound(void)
     strncpy(CmdPacket.Payload.Name, "name", 10);
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, false);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineTablesCmd(&CmdPacket);
@@ -428,29 +419,34 @@ void CS_RecomputeBaselineTablesCmd_Test_RecomputeInProgress(void)
     int32             strCmpResult;
     char              ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Tables recompute baseline for table %%s failed: child task in use");
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Recompute baseline of table %%s started");
 
+    strncpy(CS_AppData.ResTablesTblPtr[0].Name, "name", 10);
     strncpy(CmdPacket.Payload.Name, "name", 10);
 
+    CS_AppData.ResTablesTblPtr[0].State = 99; /* Needed to make CS_GetTableResTblEntryByName return correct results */
+
+    /* A recompute of another entry does not keep this one from being queued */
     CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, false);
+    UT_SetHandlerFunction(UT_KEY(CS_GetTableResTblEntryByName), CS_APP_CMDS_TEST_CS_GetTableResTblEntryByNameHandler1,
+                          NULL);
+    UT_SetDeferredRetcode(UT_KEY(CS_GetTableResTblEntryByName), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitRecompute), true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineTablesCmd(&CmdPacket);
 
     /* Verify results */
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_TABLES_CHDTASK_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_TABLES_STARTED_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_True(CS_AppData.HkPacket.Payload.CmdErrCounter == 1, "CS_AppData.HkPacket.Payload.CmdErrCounter == 1");
+    UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -464,29 +460,35 @@ void CS_RecomputeBaselineTablesCmd_Test_OneShot(void)
     int32             strCmpResult;
     char              ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Tables recompute baseline for table %%s failed: child task in use");
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Recompute baseline of table %%s started");
 
+    strncpy(CS_AppData.ResTablesTblPtr[0].Name, "name", 10);
     strncpy(CmdPacket.Payload.Name, "name", 10);
 
+    CS_AppData.ResTablesTblPtr[0].State = 99; /* Needed to make CS_GetTableResTblEntryByName return correct results */
+
+    /* A OneShot in progress does not keep the recompute from being queued */
     CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
     CS_AppData.HkPacket.Payload.OneShotInProgress   = true;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, false);
+    UT_SetHandlerFunction(UT_KEY(CS_GetTableResTblEntryByName), CS_APP_CMDS_TEST_CS_GetTableResTblEntryByNameHandler1,
+                          NULL);
+    UT_SetDeferredRetcode(UT_KEY(CS_GetTableResTblEntryByName), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsSubmitRecompute), true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineTablesCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_TABLES_CHDTASK_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_TABLES_STARTED_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_True(CS_AppData.HkPacket.Payload.CmdErrCounter == 1, "CS_AppData.HkPacket.Payload.CmdErrCounter == 1");
+    UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -512,7 +514,6 @@ void CS_DisableNameTablesCmd_Test_Nominal(void)
     CS_AppData.DefTablesTblPtr[0].State = 99; /* Needed to make CS_GetTableDefTblEntryByName return correct results */
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, false);
     UT_SetHandlerFunction(UT_KEY(CS_GetTableResTblEntryByName), CS_APP_CMDS_TEST_CS_GetTableResTblEntryByNameHandler1,
                           NULL);
     UT_SetDeferredRetcode(UT_KEY(CS_GetTableResTblEntryByName), 1, true);
@@ -524,8 +525,6 @@ void CS_DisableNameTablesCmd_Test_Nominal(void)
     CS_DisableNameTablesCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_True(CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0,
-                  "CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ByteOffset == 0, "CS_AppData.ResTablesTblPtr[0].ByteOffset == 0");
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_DISABLE_TABLES_NAME_INF_EID);
@@ -537,6 +536,8 @@ void CS_DisableNameTablesCmd_Test_Nominal(void)
 
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
+    UtAssert_STUB_COUNT(CS_SetEnabledMapEntry, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
@@ -560,7 +561,6 @@ void CS_DisableNameTablesCmd_Test_TableDefNotFound(void)
     CS_AppData.ResTablesTblPtr[0].State = 99; /* Needed to make CS_GetTableResTblEntryByName return correct results */
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, false);
     UT_SetHandlerFunction(UT_KEY(CS_GetTableResTblEntryByName), CS_APP_CMDS_TEST_CS_GetTableResTblEntryByNameHandler1,
                           NULL);
     UT_SetDeferredRetcode(UT_KEY(CS_GetTableResTblEntryByName), 1, true);
@@ -570,8 +570,6 @@ void CS_DisableNameTablesCmd_Test_TableDefNotFound(void)
     CS_DisableNameTablesCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_True(CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0,
-                  "CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ByteOffset == 0, "CS_AppData.ResTablesTblPtr[0].ByteOffset == 0");
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_DISABLE_TABLES_NAME_INF_EID);
@@ -610,7 +608,6 @@ void CS_DisableNameTablesCmd_Test_TableNotFound(void)
     strncpy(CmdPacket.Payload.Name, "name", 10);
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, false);
     UT_SetDeferredRetcode(UT_KEY(CS_GetTableResTblEntryByName), 1, false);
 
     /* Execute the function being tested */
@@ -633,17 +630,21 @@ void CS_DisableNameTablesCmd_Test_TableNotFound(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_DisableNameTablesCmd_Test_OneShot(void)
+void CS_DisableNameTablesCmd_Test_RecomputeInProgress(void)
 {
     CS_TableNameCmd_t CmdPacket;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_GetTableResTblEntryByName), 1, true);
+    UT_SetHandlerFunction(UT_KEY(CS_GetTableResTblEntryByName), CS_APP_CMDS_TEST_CS_GetTableResTblEntryByNameHandler1,
+                          NULL);
+    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeEntry), 1, true);
 
     /* Execute the function being tested */
     CS_DisableNameTablesCmd(&CmdPacket);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(CS_CheckRecomputeEntry, 1);
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 0, "CS_AppData.HkPacket.Payload.CmdCounter == 0");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -670,7 +671,6 @@ void CS_EnableNameTablesCmd_Test_Nominal(void)
     CS_AppData.DefTablesTblPtr[0].State = 99; /* Needed to make CS_GetTableDefTblEntryByName return correct results */
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, false);
     UT_SetHandlerFunction(UT_KEY(CS_GetTableResTblEntryByName), CS_APP_CMDS_TEST_CS_GetTableResTblEntryByNameHandler1,
                           NULL);
     UT_SetDeferredRetcode(UT_KEY(CS_GetTableResTblEntryByName), 1, true);
@@ -692,6 +692,8 @@ void CS_EnableNameTablesCmd_Test_Nominal(void)
 
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
+    UtAssert_STUB_COUNT(CS_SetEnabledMapEntry, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
@@ -715,7 +717,6 @@ void CS_EnableNameTablesCmd_Test_TableDefNotFound(void)
     CS_AppData.ResTablesTblPtr[0].State = 99; /* Needed to make CS_GetTableResTblEntryByName return correct results */
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, false);
     UT_SetHandlerFunction(UT_KEY(CS_GetTableResTblEntryByName), CS_APP_CMDS_TEST_CS_GetTableResTblEntryByNameHandler1,
                           NULL);
     UT_SetDeferredRetcode(UT_KEY(CS_GetTableResTblEntryByName), 1, true);
@@ -762,7 +763,6 @@ void CS_EnableNameTablesCmd_Test_TableNotFound(void)
     strncpy(CmdPacket.Payload.Name, "name", 10);
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, false);
     UT_SetDeferredRetcode(UT_KEY(CS_GetTableResTblEntryByName), 1, false);
 
     /* Execute the function being tested */
@@ -785,17 +785,21 @@ void CS_EnableNameTablesCmd_Test_TableNotFound(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_EnableNameTablesCmd_Test_OneShot(void)
+void CS_EnableNameTablesCmd_Test_RecomputeInProgress(void)
 {
     CS_TableNameCmd_t CmdPacket;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
-    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_GetTableResTblEntryByName), 1, true);
+    UT_SetHandlerFunction(UT_KEY(CS_GetTableResTblEntryByName), CS_APP_CMDS_TEST_CS_GetTableResTblEntryByNameHandler1,
+                          NULL);
+    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeEntry), 1, true);
 
     /* Execute the function being tested */
     CS_EnableNameTablesCmd(&CmdPacket);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(CS_CheckRecomputeEntry, 1);
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 0, "CS_AppData.HkPacket.Payload.CmdCounter == 0");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -807,10 +811,12 @@ void CS_EnableNameTablesCmd_Test_OneShot(void)
 void UtTest_Setup(void)
 {
     UtTest_Add(CS_DisableTablesCmd_Test, CS_Test_Setup, CS_Test_TearDown, "CS_DisableTablesCmd_Test");
-    UtTest_Add(CS_DisableTablesCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown, "CS_DisableTablesCmd_Test_OneShot");
+    UtTest_Add(CS_DisableTablesCmd_Test_RecomputeInProgress, CS_Test_Setup, CS_Test_TearDown,
+               "CS_DisableTablesCmd_Test_RecomputeInProgress");
 
     UtTest_Add(CS_EnableTablesCmd_Test, CS_Test_Setup, CS_Test_TearDown, "CS_EnableTablesCmd_Test");
-    UtTest_Add(CS_EnableTablesCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown, "CS_EnableTablesCmd_Test_OneShot");
+    UtTest_Add(CS_EnableTablesCmd_Test_RecomputeInProgress, CS_Test_Setup, CS_Test_TearDown,
+               "CS_EnableTablesCmd_Test_RecomputeInProgress");
 
     UtTest_Add(CS_ReportBaselineTablesCmd_Test_Computed, CS_Test_Setup, CS_Test_TearDown,
                "CS_ReportBaselineTablesCmd_Test_Computed");
@@ -821,8 +827,8 @@ void UtTest_Setup(void)
 
     UtTest_Add(CS_RecomputeBaselineTablesCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineTablesCmd_Test_Nominal");
-    UtTest_Add(CS_RecomputeBaselineTablesCmd_Test_CreateChildTaskError, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeBaselineTablesCmd_Test_CreateChildTaskError");
+    UtTest_Add(CS_RecomputeBaselineTablesCmd_Test_JobNotQueued, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeBaselineTablesCmd_Test_JobNotQueued");
     UtTest_Add(CS_RecomputeBaselineTablesCmd_Test_TableNotFound, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineTablesCmd_Test_TableNotFound");
     UtTest_Add(CS_RecomputeBaselineTablesCmd_Test_RecomputeInProgress, CS_Test_Setup, CS_Test_TearDown,
@@ -836,8 +842,8 @@ void UtTest_Setup(void)
                "CS_DisableNameTablesCmd_Test_TableDefNotFound");
     UtTest_Add(CS_DisableNameTablesCmd_Test_TableNotFound, CS_Test_Setup, CS_Test_TearDown,
                "CS_DisableNameTablesCmd_Test_TableNotFound");
-    UtTest_Add(CS_DisableNameTablesCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown,
-               "CS_DisableNameTablesCmd_Test_OneShot");
+    UtTest_Add(CS_DisableNameTablesCmd_Test_RecomputeInProgress, CS_Test_Setup, CS_Test_TearDown,
+               "CS_DisableNameTablesCmd_Test_RecomputeInProgress");
 
     UtTest_Add(CS_EnableNameTablesCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
                "CS_EnableNameTablesCmd_Test_Nominal");
@@ -845,6 +851,6 @@ void UtTest_Setup(void)
                "CS_EnableNameTablesCmd_Test_TableDefNotFound");
     UtTest_Add(CS_EnableNameTablesCmd_Test_TableNotFound, CS_Test_Setup, CS_Test_TearDown,
                "CS_EnableNameTablesCmd_Test_TableNotFound");
-    UtTest_Add(CS_EnableNameTablesCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown,
-               "CS_EnableNameTablesCmd_Test_OneShot");
+    UtTest_Add(CS_EnableNameTablesCmd_Test_RecomputeInProgress, CS_Test_Setup, CS_Test_TearDown,
+               "CS_EnableNameTablesCmd_Test_RecomputeInProgress");
 }
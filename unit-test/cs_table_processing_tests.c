@@ -26,6 +26,7 @@
 #include "cs_events.h"
 #include "cs_version.h"
 #include "cs_utils.h"
+#include "cs_block.h"
 #include "cs_test_utils.h"
 #include <unistd.h>
 #include <stdlib.h>
@@ -62,6 +63,50 @@ CFE_Status_t CS_TABLE_PROCESSING_TEST_CFE_TBL_LoadHook(void *UserObj, int32 Stub
     return CFE_SUCCESS;
 }
 
+/* Finds the first later entry with the same name, as the real index lookup does */
+int32 CS_TABLE_PROCESSING_TEST_CS_FindTablesNameDuplicateHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                                              const UT_StubContext_t *Context)
+{
+    const CS_Def_Tables_Table_Entry_t *DefinitionTblPtr =
+        UT_Hook_GetArgValueByName(Context, "DefinitionTblPtr", const CS_Def_Tables_Table_Entry_t *);
+    uint16  Entry     = UT_Hook_GetArgValueByName(Context, "Entry", uint16);
+    uint16 *Duplicate = UT_Hook_GetArgValueByName(Context, "Duplicate", uint16 *);
+    uint16  Loop;
+
+    for (Loop = Entry + 1; Loop < CS_MAX_NUM_TABLES_TABLE_ENTRIES; Loop++)
+    {
+        if (strncmp(DefinitionTblPtr[Entry].Name, DefinitionTblPtr[Loop].Name, CFE_TBL_MAX_FULL_NAME_LEN) == 0)
+        {
+            *Duplicate = Loop;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* Finds the first earlier entry with the same name, as the real index lookup does */
+int32 CS_TABLE_PROCESSING_TEST_CS_FindAppNameDuplicateHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                                           const UT_StubContext_t *Context)
+{
+    const CS_Def_App_Table_Entry_t *DefinitionTblPtr =
+        UT_Hook_GetArgValueByName(Context, "DefinitionTblPtr", const CS_Def_App_Table_Entry_t *);
+    uint16  Entry     = UT_Hook_GetArgValueByName(Context, "Entry", uint16);
+    uint16 *Duplicate = UT_Hook_GetArgValueByName(Context, "Duplicate", uint16 *);
+    uint16  Loop;
+
+    for (Loop = 0; Loop < Entry; Loop++)
+    {
+        if (strncmp(DefinitionTblPtr[Entry].Name, DefinitionTblPtr[Loop].Name, OS_MAX_API_NAME) == 0)
+        {
+            *Duplicate = Loop;
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void CS_ValidateEepromChecksumDefinitionTable_Test_Nominal(void)
 {
     CFE_Status_t Result;
@@ -230,6 +275,50 @@ void CS_ValidateEepromChecksumDefinitionTable_Test_IllegalStateField(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_ValidateEepromChecksumDefinitionTable_Test_IllegalAlgorithm(void)
+{
+    CFE_Status_t Result;
+    int32        strCmpResult;
+    char         ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "EEPROM Table Validate: Illegal Algorithm (0x%%04X) found in Entry ID %%d");
+
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "CS EEPROM Table verification results: good = %%d, bad = %%d, unused = %%d");
+
+    CS_AppData.DefEepromTblPtr[0].State     = CS_STATE_ENABLED;
+    CS_AppData.DefEepromTblPtr[0].Algorithm = CS_NUM_ALGORITHMS;
+
+    /* Execute the function being tested */
+    Result = CS_ValidateEepromChecksumDefinitionTable(CS_AppData.DefEepromTblPtr);
+
+    /* Verify results */
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_VAL_EEPROM_ALG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, CS_VAL_EEPROM_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+
+    UtAssert_True(Result == CS_TABLE_ERROR, "Result == CS_TABLE_ERROR");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+                  call_count_CFE_EVS_SendEvent);
+}
+
 void CS_ValidateEepromChecksumDefinitionTable_Test_TableErrorResult(void)
 {
     CFE_Status_t Result;
@@ -492,6 +581,50 @@ void CS_ValidateMemoryChecksumDefinitionTable_Test_IllegalStateField(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_ValidateMemoryChecksumDefinitionTable_Test_IllegalAlgorithm(void)
+{
+    CFE_Status_t Result;
+    int32        strCmpResult;
+    char         ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Memory Table Validate: Illegal Algorithm (0x%%04X) found in Entry ID %%d");
+
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "CS Memory Table verification results: good = %%d, bad = %%d, unused = %%d");
+
+    CS_AppData.DefMemoryTblPtr[0].State     = CS_STATE_ENABLED;
+    CS_AppData.DefMemoryTblPtr[0].Algorithm = CS_NUM_ALGORITHMS;
+
+    /* Execute the function being tested */
+    Result = CS_ValidateMemoryChecksumDefinitionTable(CS_AppData.DefMemoryTblPtr);
+
+    /* Verify results */
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_VAL_MEMORY_ALG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, CS_VAL_MEMORY_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+
+    UtAssert_True(Result == CS_TABLE_ERROR, "Result == CS_TABLE_ERROR");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+                  call_count_CFE_EVS_SendEvent);
+}
+
 void CS_ValidateMemoryChecksumDefinitionTable_Test_TableErrorResult(void)
 {
     CFE_Status_t Result;
@@ -636,6 +769,9 @@ void CS_ValidateTablesChecksumDefinitionTable_Test_DuplicateNameStateEmpty(void)
     strncpy(CS_AppData.DefTablesTblPtr[0].Name, "name", 10);
     strncpy(CS_AppData.DefTablesTblPtr[1].Name, "name", 10);
 
+    UT_SetHookFunction(UT_KEY(CS_FindTablesNameDuplicate), CS_TABLE_PROCESSING_TEST_CS_FindTablesNameDuplicateHook,
+                       NULL);
+
     /* Execute the function being tested */
     Result = CS_ValidateTablesChecksumDefinitionTable(CS_AppData.DefTablesTblPtr);
 
@@ -685,6 +821,9 @@ void CS_ValidateTablesChecksumDefinitionTable_Test_DuplicateNameStateEnabled(voi
     strncpy(CS_AppData.DefTablesTblPtr[0].Name, "name", 10);
     strncpy(CS_AppData.DefTablesTblPtr[1].Name, "name", 10);
 
+    UT_SetHookFunction(UT_KEY(CS_FindTablesNameDuplicate), CS_TABLE_PROCESSING_TEST_CS_FindTablesNameDuplicateHook,
+                       NULL);
+
     /* Execute the function being tested */
     Result = CS_ValidateTablesChecksumDefinitionTable(CS_AppData.DefTablesTblPtr);
 
@@ -734,6 +873,9 @@ void CS_ValidateTablesChecksumDefinitionTable_Test_DuplicateNameStateDisabled(vo
     strncpy(CS_AppData.DefTablesTblPtr[0].Name, "name", 10);
     strncpy(CS_AppData.DefTablesTblPtr[1].Name, "name", 10);
 
+    UT_SetHookFunction(UT_KEY(CS_FindTablesNameDuplicate), CS_TABLE_PROCESSING_TEST_CS_FindTablesNameDuplicateHook,
+                       NULL);
+
     /* Execute the function being tested */
     Result = CS_ValidateTablesChecksumDefinitionTable(CS_AppData.DefTablesTblPtr);
 
@@ -851,6 +993,52 @@ void CS_ValidateTablesChecksumDefinitionTable_Test_IllegalStateEmptyName(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_ValidateTablesChecksumDefinitionTable_Test_IllegalAlgorithm(void)
+{
+    CFE_Status_t Result;
+    int32        strCmpResult;
+    char         ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "CS Tables Table Validate: Illegal Algorithm (0x%%04X) found with name %%s");
+
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "CS Tables Table verification results: good = %%d, bad = %%d, unused = %%d");
+
+    CS_AppData.DefTablesTblPtr[0].State     = CS_STATE_ENABLED;
+    CS_AppData.DefTablesTblPtr[0].Algorithm = CS_NUM_ALGORITHMS;
+
+    strncpy(CS_AppData.DefTablesTblPtr[0].Name, "name", 10);
+
+    /* Execute the function being tested */
+    Result = CS_ValidateTablesChecksumDefinitionTable(CS_AppData.DefTablesTblPtr);
+
+    /* Verify results */
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_VAL_TABLES_ALG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, CS_VAL_TABLES_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+
+    UtAssert_True(Result == CS_TABLE_ERROR, "Result == CS_TABLE_ERROR");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+                  call_count_CFE_EVS_SendEvent);
+}
+
 void CS_ValidateTablesChecksumDefinitionTable_Test_TableErrorResult(void)
 {
     CFE_Status_t Result;
@@ -872,6 +1060,9 @@ void CS_ValidateTablesChecksumDefinitionTable_Test_TableErrorResult(void)
     strncpy(CS_AppData.DefTablesTblPtr[1].Name, "name", 10);
     strncpy(CS_AppData.DefTablesTblPtr[2].Name, "name", 10);
 
+    UT_SetHookFunction(UT_KEY(CS_FindTablesNameDuplicate), CS_TABLE_PROCESSING_TEST_CS_FindTablesNameDuplicateHook,
+                       NULL);
+
     /* Execute the function being tested */
     Result = CS_ValidateTablesChecksumDefinitionTable(CS_AppData.DefTablesTblPtr);
 
@@ -921,6 +1112,9 @@ void CS_ValidateTablesChecksumDefinitionTable_Test_UndefTableErrorResult(void)
     strncpy(CS_AppData.DefTablesTblPtr[1].Name, "name", 10);
     strncpy(CS_AppData.DefTablesTblPtr[2].Name, "name", 10);
 
+    UT_SetHookFunction(UT_KEY(CS_FindTablesNameDuplicate), CS_TABLE_PROCESSING_TEST_CS_FindTablesNameDuplicateHook,
+                       NULL);
+
     /* Execute the function being tested */
     Result = CS_ValidateTablesChecksumDefinitionTable(CS_AppData.DefTablesTblPtr);
 
@@ -968,6 +1162,9 @@ void CS_ValidateTablesChecksumDefinitionTable_Test_CsTableError(void)
     strncpy(CS_AppData.DefTablesTblPtr[0].Name, "name", 10);
     strncpy(CS_AppData.DefTablesTblPtr[1].Name, "name", 10);
 
+    UT_SetHookFunction(UT_KEY(CS_FindTablesNameDuplicate), CS_TABLE_PROCESSING_TEST_CS_FindTablesNameDuplicateHook,
+                       NULL);
+
     /* Execute the function being tested */
     Result = CS_ValidateTablesChecksumDefinitionTable(CS_AppData.DefTablesTblPtr);
 
@@ -1029,6 +1226,9 @@ void CS_ValidateAppChecksumDefinitionTable_Test_DuplicateNameStateEmpty(void)
     strncpy(CS_AppData.DefAppTblPtr[0].Name, "name", 10);
     strncpy(CS_AppData.DefAppTblPtr[1].Name, "name", 10);
 
+    UT_SetHookFunction(UT_KEY(CS_FindAppNameDuplicate), CS_TABLE_PROCESSING_TEST_CS_FindAppNameDuplicateHook,
+                       NULL);
+
     /* Execute the function being tested */
     Result = CS_ValidateAppChecksumDefinitionTable(CS_AppData.DefAppTblPtr);
 
@@ -1078,6 +1278,9 @@ void CS_ValidateAppChecksumDefinitionTable_Test_DuplicateNameStateEnabled(void)
     strncpy(CS_AppData.DefAppTblPtr[0].Name, "name", 10);
     strncpy(CS_AppData.DefAppTblPtr[1].Name, "name", 10);
 
+    UT_SetHookFunction(UT_KEY(CS_FindAppNameDuplicate), CS_TABLE_PROCESSING_TEST_CS_FindAppNameDuplicateHook,
+                       NULL);
+
     /* Execute the function being tested */
     Result = CS_ValidateAppChecksumDefinitionTable(CS_AppData.DefAppTblPtr);
 
@@ -1127,6 +1330,9 @@ void CS_ValidateAppChecksumDefinitionTable_Test_DuplicateNameStateDisabled(void)
     strncpy(CS_AppData.DefAppTblPtr[0].Name, "name", 10);
     strncpy(CS_AppData.DefAppTblPtr[1].Name, "name", 10);
 
+    UT_SetHookFunction(UT_KEY(CS_FindAppNameDuplicate), CS_TABLE_PROCESSING_TEST_CS_FindAppNameDuplicateHook,
+                       NULL);
+
     /* Execute the function being tested */
     Result = CS_ValidateAppChecksumDefinitionTable(CS_AppData.DefAppTblPtr);
 
@@ -1259,6 +1465,52 @@ void CS_ValidateAppChecksumDefinitionTable_Test_LongName(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
 }
 
+void CS_ValidateAppChecksumDefinitionTable_Test_IllegalAlgorithm(void)
+{
+    CFE_Status_t Result;
+    int32        strCmpResult;
+    char         ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "CS Apps Table Validate: Illegal Algorithm (0x%%04X) found with name %%s");
+
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "CS Apps Table verification results: good = %%d, bad = %%d, unused = %%d");
+
+    CS_AppData.DefAppTblPtr[0].State     = CS_STATE_ENABLED;
+    CS_AppData.DefAppTblPtr[0].Algorithm = CS_NUM_ALGORITHMS;
+
+    strncpy(CS_AppData.DefAppTblPtr[0].Name, "name", 10);
+
+    /* Execute the function being tested */
+    Result = CS_ValidateAppChecksumDefinitionTable(CS_AppData.DefAppTblPtr);
+
+    /* Verify results */
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_VAL_APP_ALG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, CS_VAL_APP_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+
+    UtAssert_True(Result == CS_TABLE_ERROR, "Result == CS_TABLE_ERROR");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+                  call_count_CFE_EVS_SendEvent);
+}
+
 void CS_ValidateAppChecksumDefinitionTable_Test_TableErrorResult(void)
 {
     CFE_Status_t Result;
@@ -1280,6 +1532,9 @@ void CS_ValidateAppChecksumDefinitionTable_Test_TableErrorResult(void)
     strncpy(CS_AppData.DefAppTblPtr[1].Name, "name", 10);
     strncpy(CS_AppData.DefAppTblPtr[2].Name, "name", 10);
 
+    UT_SetHookFunction(UT_KEY(CS_FindAppNameDuplicate), CS_TABLE_PROCESSING_TEST_CS_FindAppNameDuplicateHook,
+                       NULL);
+
     /* Execute the function being tested */
     Result = CS_ValidateAppChecksumDefinitionTable(CS_AppData.DefAppTblPtr);
 
@@ -1328,6 +1583,9 @@ void CS_ValidateAppChecksumDefinitionTable_Test_UndefTableErrorResult(void)
     strncpy(CS_AppData.DefAppTblPtr[1].Name, "name", 10);
     strncpy(CS_AppData.DefAppTblPtr[2].Name, "name", 10);
 
+    UT_SetHookFunction(UT_KEY(CS_FindAppNameDuplicate), CS_TABLE_PROCESSING_TEST_CS_FindAppNameDuplicateHook,
+                       NULL);
+
     /* Execute the function being tested */
     Result = CS_ValidateAppChecksumDefinitionTable(CS_AppData.DefAppTblPtr);
 
@@ -1412,6 +1670,8 @@ void CS_ProcessNewEepromMemoryDefinitionTable_Test_EEPROMTableNominal(void)
     CS_AppData.DefEepromTblPtr[0].State              = 1;
     CS_AppData.DefEepromTblPtr[0].NumBytesToChecksum = 2;
     CS_AppData.DefEepromTblPtr[0].StartAddress       = 3;
+    CS_AppData.DefEepromTblPtr[0].Algorithm          = CS_ALGORITHM_CRC_64;
+    CS_AppData.DefEepromTblPtr[0].Streaming          = true;
 
     /* Execute the function being tested */
     /* Note: first 2 arguments are passed in as addresses of pointers in the source code, even though the variable
@@ -1432,8 +1692,9 @@ void CS_ProcessNewEepromMemoryDefinitionTable_Test_EEPROMTableNominal(void)
     UtAssert_True(CS_AppData.ResEepromTblPtr[0].ComparisonValue == 0,
                   "CS_AppData.ResEepromTblPtr[0].ComparisonValue == 0");
     UtAssert_True(CS_AppData.ResEepromTblPtr[0].ByteOffset == 0, "CS_AppData.ResEepromTblPtr[0].ByteOffset == 0");
-    UtAssert_True(CS_AppData.ResEepromTblPtr[0].TempChecksumValue == 0,
-                  "CS_AppData.ResEepromTblPtr[0].TempChecksumValue == 0");
+    UtAssert_True(CS_AppData.ResEepromTblPtr[0].Algorithm == CS_ALGORITHM_CRC_64,
+                  "CS_AppData.ResEepromTblPtr[0].Algorithm == CS_ALGORITHM_CRC_64");
+    UtAssert_True(CS_AppData.ResEepromTblPtr[0].Streaming == true, "CS_AppData.ResEepromTblPtr[0].Streaming == true");
     UtAssert_True(CS_AppData.ResEepromTblPtr[0].StartAddress == 3, "CS_AppData.ResEepromTblPtr[0].StartAddress == 3");
 
     UtAssert_True(CS_AppData.ResEepromTblPtr[1].State == CS_STATE_EMPTY,
@@ -1445,16 +1706,47 @@ void CS_ProcessNewEepromMemoryDefinitionTable_Test_EEPROMTableNominal(void)
     UtAssert_True(CS_AppData.ResEepromTblPtr[1].ComparisonValue == 0,
                   "CS_AppData.ResEepromTblPtr[1].ComparisonValue == 0");
     UtAssert_True(CS_AppData.ResEepromTblPtr[1].ByteOffset == 0, "CS_AppData.ResEepromTblPtr[1].ByteOffset == 0");
-    UtAssert_True(CS_AppData.ResEepromTblPtr[1].TempChecksumValue == 0,
-                  "CS_AppData.ResEepromTblPtr[1].TempChecksumValue == 0");
+    UtAssert_True(CS_AppData.ResEepromTblPtr[1].Algorithm == CS_ALGORITHM_DEFAULT,
+                  "CS_AppData.ResEepromTblPtr[1].Algorithm == CS_ALGORITHM_DEFAULT");
+    UtAssert_True(CS_AppData.ResEepromTblPtr[1].Streaming == false,
+                  "CS_AppData.ResEepromTblPtr[1].Streaming == false");
     UtAssert_True(CS_AppData.ResEepromTblPtr[1].StartAddress == 0, "CS_AppData.ResEepromTblPtr[1].StartAddress == 0");
 
+    UtAssert_STUB_COUNT(CS_BlockTreeAllocate, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_ProcessNewEepromMemoryDefinitionTable_Test_ExpectedValue(void)
+{
+    CS_AppData.DefEepromTblPtr[0].State                  = CS_STATE_ENABLED;
+    CS_AppData.DefEepromTblPtr[0].NumBytesToChecksum     = 2;
+    CS_AppData.DefEepromTblPtr[0].HasExpectedValue       = true;
+    CS_AppData.DefEepromTblPtr[0].ExpectedValue.Bytes[0] = 0x12;
+    CS_AppData.DefEepromTblPtr[0].ExpectedValue.Bytes[3] = 0x34;
+    CS_AppData.DefEepromTblPtr[0].ExpectedValue.Bytes[7] = 0x56;
+    CS_AppData.DefEepromTblPtr[1].State                  = CS_STATE_ENABLED;
+    CS_AppData.DefEepromTblPtr[1].NumBytesToChecksum     = 2;
+
+    /* Execute the function being tested */
+    CS_ProcessNewEepromMemoryDefinitionTable((CS_Def_EepromMemory_Table_Entry_t *)&CS_AppData.DefEepromTblPtr,
+                                             (CS_Res_EepromMemory_Table_Entry_t *)&CS_AppData.ResEepromTblPtr, 2,
+                                             CS_EEPROM_TABLE);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.ResEepromTblPtr[0].ComputedYet, true);
+    UtAssert_UINT32_EQ(CS_AppData.ResEepromTblPtr[0].ComparisonValue, 0x12000034);
+    UtAssert_MemCmp(&CS_AppData.ResEepromTblPtr[0].ComparisonDigest, &CS_AppData.DefEepromTblPtr[0].ExpectedValue,
+                    sizeof(CS_Digest_t), "ComparisonDigest is the expected value");
+
+    /* Without an expected value the first pass learns the baseline */
+    UtAssert_UINT32_EQ(CS_AppData.ResEepromTblPtr[1].ComputedYet, false);
+    UtAssert_UINT32_EQ(CS_AppData.ResEepromTblPtr[1].ComparisonValue, 0);
+}
+
 void CS_ProcessNewEepromMemoryDefinitionTable_Test_MemoryTableNominal(void)
 {
     /* Handles both cases of "DefEntry -> State" */
@@ -1486,8 +1778,8 @@ void CS_ProcessNewEepromMemoryDefinitionTable_Test_MemoryTableNominal(void)
     UtAssert_True(CS_AppData.ResMemoryTblPtr[0].ComparisonValue == 0,
                   "CS_AppData.ResMemoryTblPtr[0].ComparisonValue == 0");
     UtAssert_True(CS_AppData.ResMemoryTblPtr[0].ByteOffset == 0, "CS_AppData.ResMemoryTblPtr[0].ByteOffset == 0");
-    UtAssert_True(CS_AppData.ResMemoryTblPtr[0].TempChecksumValue == 0,
-                  "CS_AppData.ResMemoryTblPtr[0].TempChecksumValue == 0");
+    UtAssert_True(CS_AppData.ResMemoryTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT,
+                  "CS_AppData.ResMemoryTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT");
     UtAssert_True(CS_AppData.ResMemoryTblPtr[0].StartAddress == 3, "CS_AppData.ResMemoryTblPtr[0].StartAddress == 3");
 
     UtAssert_True(CS_AppData.ResMemoryTblPtr[1].State == CS_STATE_EMPTY,
@@ -1499,8 +1791,8 @@ void CS_ProcessNewEepromMemoryDefinitionTable_Test_MemoryTableNominal(void)
     UtAssert_True(CS_AppData.ResMemoryTblPtr[1].ComparisonValue == 0,
                   "CS_AppData.ResMemoryTblPtr[1].ComparisonValue == 0");
     UtAssert_True(CS_AppData.ResMemoryTblPtr[1].ByteOffset == 0, "CS_AppData.ResMemoryTblPtr[1].ByteOffset == 0");
-    UtAssert_True(CS_AppData.ResMemoryTblPtr[1].TempChecksumValue == 0,
-                  "CS_AppData.ResMemoryTblPtr[1].TempChecksumValue == 0");
+    UtAssert_True(CS_AppData.ResMemoryTblPtr[1].Algorithm == CS_ALGORITHM_DEFAULT,
+                  "CS_AppData.ResMemoryTblPtr[1].Algorithm == CS_ALGORITHM_DEFAULT");
     UtAssert_True(CS_AppData.ResMemoryTblPtr[1].StartAddress == 0, "CS_AppData.ResMemoryTblPtr[1].StartAddress == 0");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -1612,6 +1904,9 @@ void CS_ProcessNewTablesDefinitionTable_Test_DefEepromTableHandle(void)
     UtAssert_True(CS_AppData.EepResTablesTblPtr == CS_AppData.ResTablesTblPtr,
                   "CS_AppData.EepResTablesTblPtr == CS_AppData.ResTablesTblPtr");
 
+    UtAssert_STUB_COUNT(CS_BuildTablesNameIndex, 1);
+    UtAssert_STUB_COUNT(CS_SetEnabledMapEntry, CS_MAX_NUM_TABLES_TABLE_ENTRIES);
+
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].State == 88, "CS_AppData.ResTablesTblPtr[0].State == 88");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ComputedYet == false,
                   "CS_AppData.ResTablesTblPtr[0].ComputedYet == false");
@@ -1620,8 +1915,8 @@ void CS_ProcessNewTablesDefinitionTable_Test_DefEepromTableHandle(void)
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ComparisonValue == 0,
                   "CS_AppData.ResTablesTblPtr[0].ComparisonValue == 0");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ByteOffset == 0, "CS_AppData.ResTablesTblPtr[0].ByteOffset == 0");
-    UtAssert_True(CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0,
-                  "CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0");
+    UtAssert_True(CS_AppData.ResTablesTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT,
+                  "CS_AppData.ResTablesTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].StartAddress == 0, "CS_AppData.ResTablesTblPtr[0].StartAddress == 0");
 
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].TblHandle == 11, "CS_AppData.ResTablesTblPtr[0].TblHandle == 11");
@@ -1637,6 +1932,45 @@ void CS_ProcessNewTablesDefinitionTable_Test_DefEepromTableHandle(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_ProcessNewTablesDefinitionTable_Test_ExpectedValue(void)
+{
+    CS_AppData.DefTablesTblPtr[0].State                  = CS_STATE_ENABLED;
+    CS_AppData.DefTablesTblPtr[0].HasExpectedValue       = true;
+    CS_AppData.DefTablesTblPtr[0].ExpectedValue.Bytes[0] = 0xAB;
+    CS_AppData.DefTablesTblPtr[0].ExpectedValue.Bytes[3] = 0xCD;
+
+    strncpy(CS_AppData.DefTablesTblPtr[0].Name, "App1.Tbl", 20);
+
+    /* Execute the function being tested */
+    CS_ProcessNewTablesDefinitionTable((CS_Def_Tables_Table_Entry_t *)&CS_AppData.DefTablesTblPtr,
+                                       (CS_Res_Tables_Table_Entry_t *)&CS_AppData.ResTablesTblPtr);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.ResTablesTblPtr[0].ComputedYet, true);
+    UtAssert_UINT32_EQ(CS_AppData.ResTablesTblPtr[0].ComparisonValue, 0xAB0000CD);
+    UtAssert_MemCmp(&CS_AppData.ResTablesTblPtr[0].ComparisonDigest, &CS_AppData.DefTablesTblPtr[0].ExpectedValue,
+                    sizeof(CS_Digest_t), "ComparisonDigest is the expected value");
+}
+
+void CS_ProcessNewTablesDefinitionTable_Test_Snapshot(void)
+{
+    CS_AppData.DefTablesTblPtr[0].State    = CS_STATE_ENABLED;
+    CS_AppData.DefTablesTblPtr[0].Snapshot = true;
+    CS_AppData.DefTablesTblPtr[1].State    = CS_STATE_ENABLED;
+    CS_AppData.ResTablesTblPtr[1].Snapshot = true;
+
+    strncpy(CS_AppData.DefTablesTblPtr[0].Name, "App1.Tbl", 20);
+    strncpy(CS_AppData.DefTablesTblPtr[1].Name, "App2.Tbl", 20);
+
+    /* Execute the function being tested */
+    CS_ProcessNewTablesDefinitionTable((CS_Def_Tables_Table_Entry_t *)&CS_AppData.DefTablesTblPtr,
+                                       (CS_Res_Tables_Table_Entry_t *)&CS_AppData.ResTablesTblPtr);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(CS_AppData.ResTablesTblPtr[0].Snapshot);
+    UtAssert_BOOL_FALSE(CS_AppData.ResTablesTblPtr[1].Snapshot);
+}
+
 void CS_ProcessNewTablesDefinitionTable_Test_DefMemoryTableHandle(void)
 {
     CS_AppData.HkPacket.Payload.TablesCSState   = 99;
@@ -1672,8 +2006,8 @@ void CS_ProcessNewTablesDefinitionTable_Test_DefMemoryTableHandle(void)
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ComparisonValue == 0,
                   "CS_AppData.ResTablesTblPtr[0].ComparisonValue == 0");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ByteOffset == 0, "CS_AppData.ResTablesTblPtr[0].ByteOffset == 0");
-    UtAssert_True(CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0,
-                  "CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0");
+    UtAssert_True(CS_AppData.ResTablesTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT,
+                  "CS_AppData.ResTablesTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].StartAddress == 0, "CS_AppData.ResTablesTblPtr[0].StartAddress == 0");
 
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].TblHandle == 11, "CS_AppData.ResTablesTblPtr[0].TblHandle == 11");
@@ -1724,8 +2058,8 @@ void CS_ProcessNewTablesDefinitionTable_Test_DefTablesTableHandle(void)
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ComparisonValue == 0,
                   "CS_AppData.ResTablesTblPtr[0].ComparisonValue == 0");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ByteOffset == 0, "CS_AppData.ResTablesTblPtr[0].ByteOffset == 0");
-    UtAssert_True(CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0,
-                  "CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0");
+    UtAssert_True(CS_AppData.ResTablesTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT,
+                  "CS_AppData.ResTablesTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].StartAddress == 0, "CS_AppData.ResTablesTblPtr[0].StartAddress == 0");
 
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].TblHandle == 11, "CS_AppData.ResTablesTblPtr[0].TblHandle == 11");
@@ -1776,8 +2110,8 @@ void CS_ProcessNewTablesDefinitionTable_Test_DefAppTableHandle(void)
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ComparisonValue == 0,
                   "CS_AppData.ResTablesTblPtr[0].ComparisonValue == 0");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ByteOffset == 0, "CS_AppData.ResTablesTblPtr[0].ByteOffset == 0");
-    UtAssert_True(CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0,
-                  "CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0");
+    UtAssert_True(CS_AppData.ResTablesTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT,
+                  "CS_AppData.ResTablesTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].StartAddress == 0, "CS_AppData.ResTablesTblPtr[0].StartAddress == 0");
 
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].TblHandle == 11, "CS_AppData.ResTablesTblPtr[0].TblHandle == 11");
@@ -1826,8 +2160,8 @@ void CS_ProcessNewTablesDefinitionTable_Test_ResEepromTableHandle(void)
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ComparisonValue == 0,
                   "CS_AppData.ResTablesTblPtr[0].ComparisonValue == 0");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ByteOffset == 0, "CS_AppData.ResTablesTblPtr[0].ByteOffset == 0");
-    UtAssert_True(CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0,
-                  "CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0");
+    UtAssert_True(CS_AppData.ResTablesTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT,
+                  "CS_AppData.ResTablesTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].StartAddress == 0, "CS_AppData.ResTablesTblPtr[0].StartAddress == 0");
 
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].TblHandle == 11, "CS_AppData.ResTablesTblPtr[0].TblHandle == 11");
@@ -1876,8 +2210,8 @@ void CS_ProcessNewTablesDefinitionTable_Test_ResMemoryTableHandle(void)
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ComparisonValue == 0,
                   "CS_AppData.ResTablesTblPtr[0].ComparisonValue == 0");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ByteOffset == 0, "CS_AppData.ResTablesTblPtr[0].ByteOffset == 0");
-    UtAssert_True(CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0,
-                  "CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0");
+    UtAssert_True(CS_AppData.ResTablesTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT,
+                  "CS_AppData.ResTablesTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].StartAddress == 0, "CS_AppData.ResTablesTblPtr[0].StartAddress == 0");
 
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].TblHandle == 11, "CS_AppData.ResTablesTblPtr[0].TblHandle == 11");
@@ -1926,8 +2260,8 @@ void CS_ProcessNewTablesDefinitionTable_Test_ResTablesTableHandle(void)
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ComparisonValue == 0,
                   "CS_AppData.ResTablesTblPtr[0].ComparisonValue == 0");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ByteOffset == 0, "CS_AppData.ResTablesTblPtr[0].ByteOffset == 0");
-    UtAssert_True(CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0,
-                  "CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0");
+    UtAssert_True(CS_AppData.ResTablesTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT,
+                  "CS_AppData.ResTablesTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].StartAddress == 0, "CS_AppData.ResTablesTblPtr[0].StartAddress == 0");
 
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].TblHandle == 11, "CS_AppData.ResTablesTblPtr[0].TblHandle == 11");
@@ -1976,8 +2310,8 @@ void CS_ProcessNewTablesDefinitionTable_Test_ResAppTableHandle(void)
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ComparisonValue == 0,
                   "CS_AppData.ResTablesTblPtr[0].ComparisonValue == 0");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ByteOffset == 0, "CS_AppData.ResTablesTblPtr[0].ByteOffset == 0");
-    UtAssert_True(CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0,
-                  "CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0");
+    UtAssert_True(CS_AppData.ResTablesTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT,
+                  "CS_AppData.ResTablesTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].StartAddress == 0, "CS_AppData.ResTablesTblPtr[0].StartAddress == 0");
 
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].TblHandle == 11, "CS_AppData.ResTablesTblPtr[0].TblHandle == 11");
@@ -2028,8 +2362,8 @@ void CS_ProcessNewTablesDefinitionTable_Test_StateEmptyNoValidEntries(void)
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ComparisonValue == 0,
                   "CS_AppData.ResTablesTblPtr[0].ComparisonValue == 0");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].ByteOffset == 0, "CS_AppData.ResTablesTblPtr[0].ByteOffset == 0");
-    UtAssert_True(CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0,
-                  "CS_AppData.ResTablesTblPtr[0].TempChecksumValue == 0");
+    UtAssert_True(CS_AppData.ResTablesTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT,
+                  "CS_AppData.ResTablesTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT");
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].StartAddress == 0, "CS_AppData.ResTablesTblPtr[0].StartAddress == 0");
 
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].TblHandle == CFE_TBL_BAD_TABLE_HANDLE,
@@ -2203,20 +2537,42 @@ void CS_ProcessNewAppDefinitionTable_Test_Nominal(void)
                   "CS_AppData.ResAppTblPtr[0].NumBytesToChecksum == 0");
     UtAssert_True(CS_AppData.ResAppTblPtr[0].ComparisonValue == 0, "CS_AppData.ResAppTblPtr[0].ComparisonValue == 0");
     UtAssert_True(CS_AppData.ResAppTblPtr[0].ByteOffset == 0, "CS_AppData.ResAppTblPtr[0].ByteOffset == 0");
-    UtAssert_True(CS_AppData.ResAppTblPtr[0].TempChecksumValue == 0,
-                  "CS_AppData.ResAppTblPtr[0].TempChecksumValue == 0");
+    UtAssert_True(CS_AppData.ResAppTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT,
+                  "CS_AppData.ResAppTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT");
     UtAssert_True(CS_AppData.ResAppTblPtr[0].StartAddress == 0, "CS_AppData.ResAppTblPtr[0].StartAddress == 0");
     UtAssert_True(strncmp(CS_AppData.ResAppTblPtr[0].Name, "name", 20) == 0,
                   "strncmp(CS_AppData.ResAppTblPtr[0].Name, 'name', 20) == 0");
 
     UtAssert_True(CS_AppData.HkPacket.Payload.AppCSState == 99, "CS_AppData.HkPacket.Payload.AppCSState == 99");
 
+    UtAssert_STUB_COUNT(CS_BuildAppNameIndex, 1);
+    UtAssert_STUB_COUNT(CS_SetEnabledMapEntry, CS_MAX_NUM_APP_TABLE_ENTRIES);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_ProcessNewAppDefinitionTable_Test_ExpectedValue(void)
+{
+    CS_AppData.DefAppTblPtr[0].State                  = CS_STATE_ENABLED;
+    CS_AppData.DefAppTblPtr[0].HasExpectedValue       = true;
+    CS_AppData.DefAppTblPtr[0].ExpectedValue.Bytes[1] = 0x77;
+
+    strncpy(CS_AppData.DefAppTblPtr[0].Name, "name", 20);
+
+    /* Execute the function being tested */
+    CS_ProcessNewAppDefinitionTable((CS_Def_App_Table_Entry_t *)&CS_AppData.DefAppTblPtr,
+                                    (CS_Res_App_Table_Entry_t *)&CS_AppData.ResAppTblPtr);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.ResAppTblPtr[0].ComputedYet, true);
+    UtAssert_UINT32_EQ(CS_AppData.ResAppTblPtr[0].ComparisonValue, 0x00770000);
+    UtAssert_MemCmp(&CS_AppData.ResAppTblPtr[0].ComparisonDigest, &CS_AppData.DefAppTblPtr[0].ExpectedValue,
+                    sizeof(CS_Digest_t), "ComparisonDigest is the expected value");
+}
+
 void CS_ProcessNewAppDefinitionTable_Test_StateEmptyNoValidEntries(void)
 {
     int32 strCmpResult;
@@ -2242,8 +2598,8 @@ void CS_ProcessNewAppDefinitionTable_Test_StateEmptyNoValidEntries(void)
                   "CS_AppData.ResAppTblPtr[0].NumBytesToChecksum == 0");
     UtAssert_True(CS_AppData.ResAppTblPtr[0].ComparisonValue == 0, "CS_AppData.ResAppTblPtr[0].ComparisonValue == 0");
     UtAssert_True(CS_AppData.ResAppTblPtr[0].ByteOffset == 0, "CS_AppData.ResAppTblPtr[0].ByteOffset == 0");
-    UtAssert_True(CS_AppData.ResAppTblPtr[0].TempChecksumValue == 0,
-                  "CS_AppData.ResAppTblPtr[0].TempChecksumValue == 0");
+    UtAssert_True(CS_AppData.ResAppTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT,
+                  "CS_AppData.ResAppTblPtr[0].Algorithm == CS_ALGORITHM_DEFAULT");
     UtAssert_True(CS_AppData.ResAppTblPtr[0].StartAddress == 0, "CS_AppData.ResAppTblPtr[0].StartAddress == 0");
     UtAssert_True(CS_AppData.ResAppTblPtr[0].Name[0] == 0, "CS_AppData.ResAppTblPtr[0].Name[0] == 0");
 
@@ -2497,6 +2853,8 @@ void CS_TableInit_Test_EepromTableAndNotLoadedFromMemory(void)
 
     /* Verify results */
     UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+    UtAssert_STUB_COUNT(CFE_TBL_NotifyByMessage, 2);
+    UtAssert_BOOL_TRUE((CS_AppData.TableNotified & CS_TABLE_BIT(CS_EEPROM_TABLE)) != 0);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -2505,6 +2863,33 @@ void CS_TableInit_Test_EepromTableAndNotLoadedFromMemory(void)
     /* Generates 1 error message we don't care about in this test */
 }
 
+void CS_TableInit_Test_NotifyByMessageError(void)
+{
+    CFE_Status_t     Result;
+    CFE_TBL_Handle_t DefinitionTableHandle = 0;
+    CFE_TBL_Handle_t ResultsTableHandle    = 0;
+
+    CS_AppData.TableNotified = CS_TABLE_BIT(CS_MEMORY_TABLE) | CS_TABLE_BIT(CS_APP_TABLE);
+
+    /* Set to prevent unintended errors */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Load), CFE_SUCCESS);
+
+    /* Set to fail registering the notification for the results table */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_NotifyByMessage), 2, -1);
+
+    /* Execute the function being tested */
+    Result = CS_TableInit(&DefinitionTableHandle, &ResultsTableHandle, &CS_AppData.DefMemoryTblPtr,
+                          &CS_AppData.ResMemoryTblPtr, CS_MEMORY_TABLE, CS_DEF_MEMORY_TABLE_NAME,
+                          CS_RESULTS_MEMORY_TABLE_NAME, CS_MAX_NUM_MEMORY_TABLE_ENTRIES, CS_DEF_MEMORY_TABLE_FILENAME,
+                          &CS_AppData.DefaultMemoryDefTable, sizeof(CS_Def_EepromMemory_Table_Entry_t),
+                          sizeof(CS_Res_EepromMemory_Table_Entry_t), NULL);
+
+    /* Verify results: the table is left to be managed at every housekeeping request */
+    UtAssert_INT32_EQ(Result, CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CFE_TBL_NotifyByMessage, 2);
+    UtAssert_UINT32_EQ(CS_AppData.TableNotified, CS_TABLE_BIT(CS_APP_TABLE));
+}
+
 void CS_TableInit_Test_EepromTableAndLoadedFromMemoryAfterResultsTableRegisterError(void)
 {
     CFE_Status_t     Result;
@@ -3337,6 +3722,8 @@ void UtTest_Setup(void)
                CS_Test_TearDown, "CS_ValidateEepromChecksumDefinitionTable_Test_IllegalChecksumRangeStateDisabled");
     UtTest_Add(CS_ValidateEepromChecksumDefinitionTable_Test_IllegalStateField, CS_Test_Setup, CS_Test_TearDown,
                "CS_ValidateEepromChecksumDefinitionTable_Test_IllegalStateField");
+    UtTest_Add(CS_ValidateEepromChecksumDefinitionTable_Test_IllegalAlgorithm, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ValidateEepromChecksumDefinitionTable_Test_IllegalAlgorithm");
     UtTest_Add(CS_ValidateEepromChecksumDefinitionTable_Test_TableErrorResult, CS_Test_Setup, CS_Test_TearDown,
                "CS_ValidateEepromChecksumDefinitionTable_Test_TableErrorResult");
     UtTest_Add(CS_ValidateEepromChecksumDefinitionTable_Test_UndefTableErrorResult, CS_Test_Setup, CS_Test_TearDown,
@@ -3350,6 +3737,8 @@ void UtTest_Setup(void)
                CS_Test_TearDown, "CS_ValidateMemoryChecksumDefinitionTable_Test_IllegalChecksumRangeStateDisabled");
     UtTest_Add(CS_ValidateMemoryChecksumDefinitionTable_Test_IllegalStateField, CS_Test_Setup, CS_Test_TearDown,
                "CS_ValidateMemoryChecksumDefinitionTable_Test_IllegalStateField");
+    UtTest_Add(CS_ValidateMemoryChecksumDefinitionTable_Test_IllegalAlgorithm, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ValidateMemoryChecksumDefinitionTable_Test_IllegalAlgorithm");
     UtTest_Add(CS_ValidateMemoryChecksumDefinitionTable_Test_TableErrorResult, CS_Test_Setup, CS_Test_TearDown,
                "CS_ValidateMemoryChecksumDefinitionTable_Test_TableErrorResult");
     UtTest_Add(CS_ValidateMemoryChecksumDefinitionTable_Test_UndefTableErrorResult, CS_Test_Setup, CS_Test_TearDown,
@@ -3367,6 +3756,8 @@ void UtTest_Setup(void)
                "CS_ValidateTablesChecksumDefinitionTable_Test_IllegalStateField");
     UtTest_Add(CS_ValidateTablesChecksumDefinitionTable_Test_IllegalStateEmptyName, CS_Test_Setup, CS_Test_TearDown,
                "CS_ValidateTablesChecksumDefinitionTable_Test_IllegalStateEmptyName");
+    UtTest_Add(CS_ValidateTablesChecksumDefinitionTable_Test_IllegalAlgorithm, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ValidateTablesChecksumDefinitionTable_Test_IllegalAlgorithm");
     UtTest_Add(CS_ValidateTablesChecksumDefinitionTable_Test_TableErrorResult, CS_Test_Setup, CS_Test_TearDown,
                "CS_ValidateTablesChecksumDefinitionTable_Test_TableErrorResult");
     UtTest_Add(CS_ValidateTablesChecksumDefinitionTable_Test_UndefTableErrorResult, CS_Test_Setup, CS_Test_TearDown,
@@ -3388,6 +3779,8 @@ void UtTest_Setup(void)
                "CS_ValidateAppChecksumDefinitionTable_Test_IllegalStateEmptyName");
     UtTest_Add(CS_ValidateAppChecksumDefinitionTable_Test_LongName, CS_Test_Setup, CS_Test_TearDown,
                "CS_ValidateAppChecksumDefinitionTable_Test_LongName");
+    UtTest_Add(CS_ValidateAppChecksumDefinitionTable_Test_IllegalAlgorithm, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ValidateAppChecksumDefinitionTable_Test_IllegalAlgorithm");
     UtTest_Add(CS_ValidateAppChecksumDefinitionTable_Test_TableErrorResult, CS_Test_Setup, CS_Test_TearDown,
                "CS_ValidateAppChecksumDefinitionTable_Test_TableErrorResult");
     UtTest_Add(CS_ValidateAppChecksumDefinitionTable_Test_UndefTableErrorResult, CS_Test_Setup, CS_Test_TearDown,
@@ -3397,6 +3790,8 @@ void UtTest_Setup(void)
 
     UtTest_Add(CS_ProcessNewEepromMemoryDefinitionTable_Test_EEPROMTableNominal, CS_Test_Setup, CS_Test_TearDown,
                "CS_ProcessNewEepromMemoryDefinitionTable_Test_EEPROMTableNominal");
+    UtTest_Add(CS_ProcessNewEepromMemoryDefinitionTable_Test_ExpectedValue, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessNewEepromMemoryDefinitionTable_Test_ExpectedValue");
     UtTest_Add(CS_ProcessNewEepromMemoryDefinitionTable_Test_MemoryTableNominal, CS_Test_Setup, CS_Test_TearDown,
                "CS_ProcessNewEepromMemoryDefinitionTable_Test_MemoryTableNominal");
     UtTest_Add(CS_ProcessNewEepromMemoryDefinitionTable_Test_EEPROMTableNoValidEntries, CS_Test_Setup, CS_Test_TearDown,
@@ -3406,6 +3801,10 @@ void UtTest_Setup(void)
 
     UtTest_Add(CS_ProcessNewTablesDefinitionTable_Test_DefEepromTableHandle, CS_Test_Setup, CS_Test_TearDown,
                "CS_ProcessNewTablesDefinitionTable_Test_DefEepromTableHandle");
+    UtTest_Add(CS_ProcessNewTablesDefinitionTable_Test_ExpectedValue, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessNewTablesDefinitionTable_Test_ExpectedValue");
+    UtTest_Add(CS_ProcessNewTablesDefinitionTable_Test_Snapshot, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessNewTablesDefinitionTable_Test_Snapshot");
     UtTest_Add(CS_ProcessNewTablesDefinitionTable_Test_DefMemoryTableHandle, CS_Test_Setup, CS_Test_TearDown,
                "CS_ProcessNewTablesDefinitionTable_Test_DefMemoryTableHandle");
     UtTest_Add(CS_ProcessNewTablesDefinitionTable_Test_DefTablesTableHandle, CS_Test_Setup, CS_Test_TearDown,
@@ -3431,6 +3830,8 @@ void UtTest_Setup(void)
 
     UtTest_Add(CS_ProcessNewAppDefinitionTable_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
                "CS_ProcessNewAppDefinitionTable_Test_Nominal");
+    UtTest_Add(CS_ProcessNewAppDefinitionTable_Test_ExpectedValue, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessNewAppDefinitionTable_Test_ExpectedValue");
     UtTest_Add(CS_ProcessNewAppDefinitionTable_Test_StateEmptyNoValidEntries, CS_Test_Setup, CS_Test_TearDown,
                "CS_ProcessNewAppDefinitionTable_Test_StateEmptyNoValidEntries");
 
@@ -3446,6 +3847,8 @@ void UtTest_Setup(void)
                "CS_TableInit_Test_DefinitionTableGetAddressErrorApps");
     UtTest_Add(CS_TableInit_Test_EepromTableAndNotLoadedFromMemory, CS_Test_Setup, CS_Test_TearDown,
                "CS_TableInit_Test_EepromTableAndNotLoadedFromMemory");
+    UtTest_Add(CS_TableInit_Test_NotifyByMessageError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_TableInit_Test_NotifyByMessageError");
     UtTest_Add(CS_TableInit_Test_EepromTableAndLoadedFromMemoryAfterResultsTableRegisterError, CS_Test_Setup,
                CS_Test_TearDown, "CS_TableInit_Test_EepromTableAndLoadedFromMemoryAfterResultsTableRegisterError");
     UtTest_Add(CS_TableInit_Test_EepromTableAndLoadedFromMemoryAfterResultsTableGetAddressError, CS_Test_Setup,
@@ -27,6 +27,7 @@
 #include "cs_events.h"
 #include "cs_version.h"
 #include "cs_compute.h"
+#include "cs_block.h"
 #include "cs_test_utils.h"
 #include <unistd.h>
 #include <stdlib.h>
@@ -93,6 +94,7 @@ void CS_GoToNextTable_Test(void)
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, CS_NUM_TABLES - 1);
     UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.PassCounter, 0);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 0);
+    UtAssert_STUB_COUNT(CS_BudgetEndPass, 0);
 
     /* Cause loop */
     CS_GoToNextTable();
@@ -101,6 +103,129 @@ void CS_GoToNextTable_Test(void)
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 0);
     UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.PassCounter, 1);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 0);
+    UtAssert_STUB_COUNT(CS_BudgetEndPass, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_GoToNextTable_Test_Cursor(void)
+{
+    CS_AppData.HkPacket.Payload.CurrentCSTable = CS_EEPROM_TABLE;
+    CS_AppData.Sched.Cursor[CS_MEMORY_TABLE]   = 5;
+
+    /* Execute the function being tested */
+    CS_GoToNextTable();
+
+    /* Verify results */
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, CS_MEMORY_TABLE);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 5);
+    UtAssert_STUB_COUNT(CS_SchedTableDone, 1);
+}
+
+void CS_GoToNextTable_Test_Resumed(void)
+{
+    CS_AppData.HkPacket.Payload.CurrentCSTable      = CS_EEPROM_TABLE;
+    CS_AppData.HkPacket.Payload.CurrentEntryInTable = 3;
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_SchedTableDone), true);
+
+    /* Execute the function being tested */
+    CS_GoToNextTable();
+
+    /* Verify results */
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, CS_EEPROM_TABLE);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 3);
+    UtAssert_STUB_COUNT(CS_BudgetEndPass, 0);
+}
+
+void CS_NameHash_Test(void)
+{
+    /* FNV-1a reference values */
+    UtAssert_UINT32_EQ(CS_NameHash("", 10), 0x811C9DC5);
+    UtAssert_UINT32_EQ(CS_NameHash("a", 10), 0xE40C292C);
+    UtAssert_UINT32_EQ(CS_NameHash("foobar", 10), 0xBF9CF968);
+
+    /* Stops at the terminator or the field size */
+    UtAssert_UINT32_EQ(CS_NameHash("foobar\0x", 10), 0xBF9CF968);
+    UtAssert_UINT32_EQ(CS_NameHash("foobarbaz", 6), 0xBF9CF968);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_NameIndex_Test(void)
+{
+    uint32 NameIndex[4];
+    uint32 Probe = 0;
+    uint16 Entry = 0;
+
+    memset(NameIndex, 0, sizeof(NameIndex));
+
+    /* Two entries share a hash and collide with a third whose hash differs in the top half */
+    CS_NameIndexAdd(NameIndex, 4, 0x00010002, 7);
+    CS_NameIndexAdd(NameIndex, 4, 0x00020002, 8);
+    CS_NameIndexAdd(NameIndex, 4, 0x00010002, 9);
+
+    UtAssert_UINT32_EQ(NameIndex[2], 0x00010008);
+    UtAssert_UINT32_EQ(NameIndex[3], 0x00020009);
+    UtAssert_UINT32_EQ(NameIndex[0], 0x0001000A);
+    UtAssert_UINT32_EQ(NameIndex[1], 0);
+
+    /* Execute and verify */
+    UtAssert_BOOL_TRUE(CS_NameIndexNext(NameIndex, 4, 0x00010002, &Probe, &Entry));
+    UtAssert_UINT16_EQ(Entry, 7);
+    UtAssert_BOOL_TRUE(CS_NameIndexNext(NameIndex, 4, 0x00010002, &Probe, &Entry));
+    UtAssert_UINT16_EQ(Entry, 9);
+    UtAssert_BOOL_FALSE(CS_NameIndexNext(NameIndex, 4, 0x00010002, &Probe, &Entry));
+
+    /* A hash that selects an empty slot finds nothing */
+    Probe = 0;
+    UtAssert_BOOL_FALSE(CS_NameIndexNext(NameIndex, 4, 0x00010001, &Probe, &Entry));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_FindTablesNameDuplicate_Test(void)
+{
+    uint16 Duplicate = 0;
+
+    strncpy(CS_AppData.DefTablesTblPtr[0].Name, "name", 10);
+    strncpy(CS_AppData.DefTablesTblPtr[1].Name, "other", 10);
+    strncpy(CS_AppData.DefTablesTblPtr[2].Name, "name", 10);
+    strncpy(CS_AppData.DefTablesTblPtr[3].Name, "name", 10);
+    CS_BuildTablesNameIndex(CS_AppData.TablesNameIndex, CS_AppData.DefTablesTblPtr);
+
+    /* Execute and verify */
+    UtAssert_BOOL_TRUE(
+        CS_FindTablesNameDuplicate(CS_AppData.TablesNameIndex, CS_AppData.DefTablesTblPtr, 0, &Duplicate));
+    UtAssert_UINT16_EQ(Duplicate, 2);
+    UtAssert_BOOL_TRUE(
+        CS_FindTablesNameDuplicate(CS_AppData.TablesNameIndex, CS_AppData.DefTablesTblPtr, 2, &Duplicate));
+    UtAssert_UINT16_EQ(Duplicate, 3);
+    UtAssert_BOOL_FALSE(
+        CS_FindTablesNameDuplicate(CS_AppData.TablesNameIndex, CS_AppData.DefTablesTblPtr, 3, &Duplicate));
+    UtAssert_BOOL_FALSE(
+        CS_FindTablesNameDuplicate(CS_AppData.TablesNameIndex, CS_AppData.DefTablesTblPtr, 1, &Duplicate));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_FindAppNameDuplicate_Test(void)
+{
+    uint16 Duplicate = 0;
+
+    strncpy(CS_AppData.DefAppTblPtr[0].Name, "name", 10);
+    strncpy(CS_AppData.DefAppTblPtr[1].Name, "other", 10);
+    strncpy(CS_AppData.DefAppTblPtr[2].Name, "name", 10);
+    strncpy(CS_AppData.DefAppTblPtr[3].Name, "name", 10);
+    CS_BuildAppNameIndex(CS_AppData.AppNameIndex, CS_AppData.DefAppTblPtr);
+
+    /* Execute and verify */
+    UtAssert_BOOL_TRUE(CS_FindAppNameDuplicate(CS_AppData.AppNameIndex, CS_AppData.DefAppTblPtr, 3, &Duplicate));
+    UtAssert_UINT16_EQ(Duplicate, 0);
+    UtAssert_BOOL_TRUE(CS_FindAppNameDuplicate(CS_AppData.AppNameIndex, CS_AppData.DefAppTblPtr, 2, &Duplicate));
+    UtAssert_UINT16_EQ(Duplicate, 0);
+    UtAssert_BOOL_FALSE(CS_FindAppNameDuplicate(CS_AppData.AppNameIndex, CS_AppData.DefAppTblPtr, 0, &Duplicate));
+    UtAssert_BOOL_FALSE(CS_FindAppNameDuplicate(CS_AppData.AppNameIndex, CS_AppData.DefAppTblPtr, 1, &Duplicate));
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
@@ -118,7 +243,9 @@ void CS_GetTableResTblEntryByName_Test(void)
 
     /* Matching name, empty state */
     strncpy(CS_AppData.ResTablesTblPtr[0].Name, "name", 10);
+    strncpy(CS_AppData.DefTablesTblPtr[0].Name, "name", 10);
     CS_AppData.ResTablesTblPtr[0].State = CS_STATE_EMPTY;
+    CS_BuildTablesNameIndex(CS_AppData.TablesNameIndex, CS_AppData.DefTablesTblPtr);
 
     /* Execute and verify */
     UtAssert_BOOL_FALSE(CS_GetTableResTblEntryByName(&EntryPtr, "name"));
@@ -148,6 +275,7 @@ void CS_GetTableDefTblEntryByName_Test(void)
     /* Matching name, empty state */
     strncpy(CS_AppData.DefTablesTblPtr[0].Name, "name", 10);
     CS_AppData.DefTablesTblPtr[0].State = CS_STATE_EMPTY;
+    CS_BuildTablesNameIndex(CS_AppData.TablesNameIndex, CS_AppData.DefTablesTblPtr);
 
     /* Execute and verify */
     UtAssert_BOOL_FALSE(CS_GetTableDefTblEntryByName(&EntryPtr, "name"));
@@ -176,7 +304,9 @@ void CS_GetAppResTblEntryByName_Test(void)
 
     /* Matching name, empty state */
     strncpy(CS_AppData.ResAppTblPtr[0].Name, "name", 10);
+    strncpy(CS_AppData.DefAppTblPtr[0].Name, "name", 10);
     CS_AppData.ResAppTblPtr[0].State = CS_STATE_EMPTY;
+    CS_BuildAppNameIndex(CS_AppData.AppNameIndex, CS_AppData.DefAppTblPtr);
 
     /* Execute and verify */
     UtAssert_BOOL_FALSE(CS_GetAppResTblEntryByName(&EntryPtr, "name"));
@@ -206,6 +336,7 @@ void CS_GetAppDefTblEntryByName_Test(void)
     /* Matching name, empty state */
     strncpy(CS_AppData.DefAppTblPtr[0].Name, "name", 10);
     CS_AppData.DefAppTblPtr[0].State = CS_STATE_EMPTY;
+    CS_BuildAppNameIndex(CS_AppData.AppNameIndex, CS_AppData.DefAppTblPtr);
 
     /* Execute and verify */
     UtAssert_BOOL_FALSE(CS_GetAppDefTblEntryByName(&EntryPtr, "name"));
@@ -221,6 +352,88 @@ void CS_GetAppDefTblEntryByName_Test(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void CS_SetEnabledMapEntry_Test(void)
+{
+    /* One summary word followed by three bit words */
+    uint32 EnabledMap[CS_ENABLED_MAP_WORDS(70)] = {0};
+
+    /* Execute and verify */
+    CS_SetEnabledMapEntry(EnabledMap, 70, 0, CS_STATE_ENABLED);
+    CS_SetEnabledMapEntry(EnabledMap, 70, 33, CS_STATE_ENABLED);
+    CS_SetEnabledMapEntry(EnabledMap, 70, 34, CS_STATE_ENABLED);
+    UtAssert_UINT32_EQ(EnabledMap[0], 0x00000003);
+    UtAssert_UINT32_EQ(EnabledMap[1], 0x00000001);
+    UtAssert_UINT32_EQ(EnabledMap[2], 0x00000006);
+    UtAssert_UINT32_EQ(EnabledMap[3], 0);
+
+    /* The summary bit stays set while any entry of the word is enabled */
+    CS_SetEnabledMapEntry(EnabledMap, 70, 0, CS_STATE_DISABLED);
+    CS_SetEnabledMapEntry(EnabledMap, 70, 33, CS_STATE_EMPTY);
+    UtAssert_UINT32_EQ(EnabledMap[0], 0x00000002);
+    UtAssert_UINT32_EQ(EnabledMap[1], 0);
+    UtAssert_UINT32_EQ(EnabledMap[2], 0x00000004);
+
+    CS_SetEnabledMapEntry(EnabledMap, 70, 34, CS_STATE_DISABLED);
+    UtAssert_UINT32_EQ(EnabledMap[0], 0);
+    UtAssert_UINT32_EQ(EnabledMap[2], 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_FindNextEnabledMapEntry_Test(void)
+{
+    uint32 EnabledMap[CS_ENABLED_MAP_WORDS(70)] = {0};
+    uint32 LargeMap[CS_ENABLED_MAP_WORDS(5000)] = {0};
+    uint16 Entry                                = 0;
+
+    CS_SetEnabledMapEntry(EnabledMap, 70, 0, CS_STATE_ENABLED);
+    CS_SetEnabledMapEntry(EnabledMap, 70, 31, CS_STATE_ENABLED);
+    CS_SetEnabledMapEntry(EnabledMap, 70, 68, CS_STATE_ENABLED);
+
+    /* Execute and verify */
+    UtAssert_BOOL_TRUE(CS_FindNextEnabledMapEntry(EnabledMap, 70, &Entry));
+    UtAssert_UINT16_EQ(Entry, 0);
+
+    Entry = 1;
+    UtAssert_BOOL_TRUE(CS_FindNextEnabledMapEntry(EnabledMap, 70, &Entry));
+    UtAssert_UINT16_EQ(Entry, 31);
+
+    /* Skips a whole empty word */
+    Entry = 32;
+    UtAssert_BOOL_TRUE(CS_FindNextEnabledMapEntry(EnabledMap, 70, &Entry));
+    UtAssert_UINT16_EQ(Entry, 68);
+
+    /* Nothing after the last set bit */
+    Entry = 69;
+    UtAssert_BOOL_FALSE(CS_FindNextEnabledMapEntry(EnabledMap, 70, &Entry));
+    UtAssert_UINT16_EQ(Entry, 70);
+
+    /* Bits past the end of the table are ignored */
+    Entry = 32;
+    UtAssert_BOOL_FALSE(CS_FindNextEnabledMapEntry(EnabledMap, 68, &Entry));
+    UtAssert_UINT16_EQ(Entry, 68);
+
+    /* Already at the end */
+    Entry = 70;
+    UtAssert_BOOL_FALSE(CS_FindNextEnabledMapEntry(EnabledMap, 70, &Entry));
+    UtAssert_UINT16_EQ(Entry, 70);
+
+    /* A large sparse table skips whole summary words */
+    CS_SetEnabledMapEntry(LargeMap, 5000, 1, CS_STATE_ENABLED);
+    CS_SetEnabledMapEntry(LargeMap, 5000, 4999, CS_STATE_ENABLED);
+
+    Entry = 2;
+    UtAssert_BOOL_TRUE(CS_FindNextEnabledMapEntry(LargeMap, 5000, &Entry));
+    UtAssert_UINT16_EQ(Entry, 4999);
+
+    CS_SetEnabledMapEntry(LargeMap, 5000, 4999, CS_STATE_DISABLED);
+    Entry = 2;
+    UtAssert_BOOL_FALSE(CS_FindNextEnabledMapEntry(LargeMap, 5000, &Entry));
+    UtAssert_UINT16_EQ(Entry, 5000);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void CS_FindEnabledEepromEntry_Test(void)
 {
     uint16 EnabledEntry = 0;
@@ -234,11 +447,21 @@ void CS_FindEnabledEepromEntry_Test(void)
     CS_AppData.ResEepromTblPtr[0].State                                   = CS_STATE_ENABLED;
     CS_AppData.ResEepromTblPtr[CS_MAX_NUM_EEPROM_TABLE_ENTRIES - 1].State = CS_STATE_ENABLED;
     CS_AppData.HkPacket.Payload.CurrentEntryInTable                               = 1;
+    CS_SetEnabledMapEntry(CS_AppData.EepromEnabledMap, CS_MAX_NUM_EEPROM_TABLE_ENTRIES, 0, CS_STATE_ENABLED);
+    CS_SetEnabledMapEntry(CS_AppData.EepromEnabledMap, CS_MAX_NUM_EEPROM_TABLE_ENTRIES,
+                          CS_MAX_NUM_EEPROM_TABLE_ENTRIES - 1, CS_STATE_ENABLED);
 
     UtAssert_BOOL_TRUE(CS_FindEnabledEepromEntry(&EnabledEntry));
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, CS_MAX_NUM_EEPROM_TABLE_ENTRIES - 1);
     UtAssert_UINT16_EQ(EnabledEntry, CS_MAX_NUM_EEPROM_TABLE_ENTRIES - 1);
 
+    /* Entry owned by a recompute */
+    CS_AppData.HkPacket.Payload.CurrentEntryInTable = 1;
+    UT_SetDeferredRetcode(UT_KEY(CS_JobsEntryBusy), 1, true);
+
+    UtAssert_BOOL_FALSE(CS_FindEnabledEepromEntry(&EnabledEntry));
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, CS_MAX_NUM_EEPROM_TABLE_ENTRIES);
+
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
@@ -255,6 +478,9 @@ void CS_FindEnabledMemoryEntry_Test(void)
     CS_AppData.ResMemoryTblPtr[0].State                                   = CS_STATE_ENABLED;
     CS_AppData.ResMemoryTblPtr[CS_MAX_NUM_MEMORY_TABLE_ENTRIES - 1].State = CS_STATE_ENABLED;
     CS_AppData.HkPacket.Payload.CurrentEntryInTable                               = 1;
+    CS_SetEnabledMapEntry(CS_AppData.MemoryEnabledMap, CS_MAX_NUM_MEMORY_TABLE_ENTRIES, 0, CS_STATE_ENABLED);
+    CS_SetEnabledMapEntry(CS_AppData.MemoryEnabledMap, CS_MAX_NUM_MEMORY_TABLE_ENTRIES,
+                          CS_MAX_NUM_MEMORY_TABLE_ENTRIES - 1, CS_STATE_ENABLED);
 
     UtAssert_BOOL_TRUE(CS_FindEnabledMemoryEntry(&EnabledEntry));
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, CS_MAX_NUM_MEMORY_TABLE_ENTRIES - 1);
@@ -276,11 +502,21 @@ void CS_FindEnabledTablesEntry_Test(void)
     CS_AppData.ResTablesTblPtr[0].State                                   = CS_STATE_ENABLED;
     CS_AppData.ResTablesTblPtr[CS_MAX_NUM_TABLES_TABLE_ENTRIES - 1].State = CS_STATE_ENABLED;
     CS_AppData.HkPacket.Payload.CurrentEntryInTable                               = 1;
+    CS_SetEnabledMapEntry(CS_AppData.TablesEnabledMap, CS_MAX_NUM_TABLES_TABLE_ENTRIES, 0, CS_STATE_ENABLED);
+    CS_SetEnabledMapEntry(CS_AppData.TablesEnabledMap, CS_MAX_NUM_TABLES_TABLE_ENTRIES,
+                          CS_MAX_NUM_TABLES_TABLE_ENTRIES - 1, CS_STATE_ENABLED);
 
     UtAssert_BOOL_TRUE(CS_FindEnabledTablesEntry(&EnabledEntry));
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, CS_MAX_NUM_TABLES_TABLE_ENTRIES - 1);
     UtAssert_UINT16_EQ(EnabledEntry, CS_MAX_NUM_TABLES_TABLE_ENTRIES - 1);
 
+    /* Entry disabled for a while but still in the map */
+    CS_AppData.ResTablesTblPtr[CS_MAX_NUM_TABLES_TABLE_ENTRIES - 1].State = CS_STATE_DISABLED;
+    CS_AppData.HkPacket.Payload.CurrentEntryInTable                       = 1;
+
+    UtAssert_BOOL_FALSE(CS_FindEnabledTablesEntry(&EnabledEntry));
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, CS_MAX_NUM_TABLES_TABLE_ENTRIES);
+
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
@@ -297,11 +533,21 @@ void CS_FindEnabledAppEntry_Test(void)
     CS_AppData.ResAppTblPtr[0].State                                = CS_STATE_ENABLED;
     CS_AppData.ResAppTblPtr[CS_MAX_NUM_APP_TABLE_ENTRIES - 1].State = CS_STATE_ENABLED;
     CS_AppData.HkPacket.Payload.CurrentEntryInTable                         = 1;
+    CS_SetEnabledMapEntry(CS_AppData.AppEnabledMap, CS_MAX_NUM_APP_TABLE_ENTRIES, 0, CS_STATE_ENABLED);
+    CS_SetEnabledMapEntry(CS_AppData.AppEnabledMap, CS_MAX_NUM_APP_TABLE_ENTRIES,
+                          CS_MAX_NUM_APP_TABLE_ENTRIES - 1, CS_STATE_ENABLED);
 
     UtAssert_BOOL_TRUE(CS_FindEnabledAppEntry(&EnabledEntry));
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, CS_MAX_NUM_APP_TABLE_ENTRIES - 1);
     UtAssert_UINT16_EQ(EnabledEntry, CS_MAX_NUM_APP_TABLE_ENTRIES - 1);
 
+    /* Entry owned by a recompute */
+    CS_AppData.HkPacket.Payload.CurrentEntryInTable = 1;
+    UT_SetDeferredRetcode(UT_KEY(CS_JobsEntryBusy), 1, true);
+
+    UtAssert_BOOL_FALSE(CS_FindEnabledAppEntry(&EnabledEntry));
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, CS_MAX_NUM_APP_TABLE_ENTRIES);
+
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
@@ -345,19 +591,28 @@ void CS_BackgroundCfeCore_Test(void)
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 0);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 2);
 
-    /* Enabled, miscompare, not done with entry */
+    /* Segment owned by a recompute */
     CS_AppData.CfeCoreCodeSeg.State = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.CurrentCSTable = 1;
+    UT_SetDeferredRetcode(UT_KEY(CS_JobsEntryBusy), 1, true);
+    UtAssert_BOOL_FALSE(CS_BackgroundCfeCore());
+    UtAssert_STUB_COUNT(CS_ComputeEepromMemory, 0);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 0);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 2);
+
+    /* Enabled, miscompare, not done with entry */
     UT_SetDeferredRetcode(UT_KEY(CS_ComputeEepromMemory), 1, CS_ERROR);
     UtAssert_BOOL_TRUE(CS_BackgroundCfeCore());
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CfeCoreCSErrCounter, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_CFECORE_MISCOMPARE_ERR_EID);
+    UtAssert_STUB_COUNT(CS_SyndromeReport, 1);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 0);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 2);
 
-    /* Enabled, compares, done with entry */
+    /* Enabled, compares, done with entry, budget left for the next table */
     UT_SetHandlerFunction(UT_KEY(CS_ComputeEepromMemory), CS_UTILS_TEST_CS_ComputeHandler, NULL);
-    UtAssert_BOOL_TRUE(CS_BackgroundCfeCore());
+    UtAssert_BOOL_FALSE(CS_BackgroundCfeCore());
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CfeCoreCSErrCounter, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 0);
@@ -379,19 +634,28 @@ void CS_BackgroundOS_Test(void)
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 0);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 2);
 
-    /* Enabled, miscompare, not done with entry */
+    /* Segment owned by a recompute */
     CS_AppData.OSCodeSeg.State = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.CurrentCSTable = 1;
+    UT_SetDeferredRetcode(UT_KEY(CS_JobsEntryBusy), 1, true);
+    UtAssert_BOOL_FALSE(CS_BackgroundOS());
+    UtAssert_STUB_COUNT(CS_ComputeEepromMemory, 0);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 0);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 2);
+
+    /* Enabled, miscompare, not done with entry */
     UT_SetDeferredRetcode(UT_KEY(CS_ComputeEepromMemory), 1, CS_ERROR);
     UtAssert_BOOL_TRUE(CS_BackgroundOS());
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.OSCSErrCounter, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_OS_MISCOMPARE_ERR_EID);
+    UtAssert_STUB_COUNT(CS_SyndromeReport, 1);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 0);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 2);
 
-    /* Enabled, compares, done with entry */
+    /* Enabled, compares, done with entry, budget left for the next table */
     UT_SetHandlerFunction(UT_KEY(CS_ComputeEepromMemory), CS_UTILS_TEST_CS_ComputeHandler, NULL);
-    UtAssert_BOOL_TRUE(CS_BackgroundOS());
+    UtAssert_BOOL_FALSE(CS_BackgroundOS());
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.OSCSErrCounter, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 0);
@@ -417,25 +681,31 @@ void CS_BackgroundEeprom_Test(void)
 
     /* Enabled, miscompare, not done with entry */
     CS_AppData.ResEepromTblPtr[0].State = CS_STATE_ENABLED;
+    CS_SetEnabledMapEntry(CS_AppData.EepromEnabledMap, CS_MAX_NUM_EEPROM_TABLE_ENTRIES, 0, CS_STATE_ENABLED);
     UT_SetDeferredRetcode(UT_KEY(CS_ComputeEepromMemory), 1, CS_ERROR);
     UtAssert_BOOL_TRUE(CS_BackgroundEeprom());
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.EepromCSErrCounter, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_EEPROM_MISCOMPARE_ERR_EID);
+    UtAssert_STUB_COUNT(CS_BlockTreeReportMiscompare, 1);
+    UtAssert_STUB_COUNT(CS_SyndromeReport, 1);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 0);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 2);
 
-    /* Last entry, Enabled, compares, done with entry */
+    /* Last entry, Enabled, compares, done with entry, budget left for the next table */
     CS_AppData.HkPacket.Payload.CurrentEntryInTable                                   = CS_MAX_NUM_EEPROM_TABLE_ENTRIES - 1;
     CS_AppData.ResEepromTblPtr[CS_AppData.HkPacket.Payload.CurrentEntryInTable].State = CS_STATE_ENABLED;
     CS_AppData.ResEepromTblPtr[CS_AppData.HkPacket.Payload.CurrentEntryInTable].ComparisonValue = 3;
+    CS_SetEnabledMapEntry(CS_AppData.EepromEnabledMap, CS_MAX_NUM_EEPROM_TABLE_ENTRIES,
+                          CS_MAX_NUM_EEPROM_TABLE_ENTRIES - 1, CS_STATE_ENABLED);
     UT_SetHandlerFunction(UT_KEY(CS_ComputeEepromMemory), CS_UTILS_TEST_CS_ComputeHandler, NULL);
-    UtAssert_BOOL_TRUE(CS_BackgroundEeprom());
+    UtAssert_BOOL_FALSE(CS_BackgroundEeprom());
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.EepromCSErrCounter, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 0);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 3);
     UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.EepromBaseline, 6);
+    UtAssert_STUB_COUNT(CS_SchedEntryChecked, 1);
 }
 
 void CS_BackgroundMemory_Test(void)
@@ -454,19 +724,24 @@ void CS_BackgroundMemory_Test(void)
 
     /* Enabled, miscompare, not done with entry */
     CS_AppData.ResMemoryTblPtr[0].State = CS_STATE_ENABLED;
+    CS_SetEnabledMapEntry(CS_AppData.MemoryEnabledMap, CS_MAX_NUM_MEMORY_TABLE_ENTRIES, 0, CS_STATE_ENABLED);
     UT_SetDeferredRetcode(UT_KEY(CS_ComputeEepromMemory), 1, CS_ERROR);
     UtAssert_BOOL_TRUE(CS_BackgroundMemory());
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.MemoryCSErrCounter, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_MEMORY_MISCOMPARE_ERR_EID);
+    UtAssert_STUB_COUNT(CS_BlockTreeReportMiscompare, 1);
+    UtAssert_STUB_COUNT(CS_SyndromeReport, 1);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 0);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 2);
 
-    /* Last entry, Enabled, compares, done with entry */
+    /* Last entry, Enabled, compares, done with entry, budget left for the next table */
     CS_AppData.HkPacket.Payload.CurrentEntryInTable                                   = CS_MAX_NUM_MEMORY_TABLE_ENTRIES - 1;
     CS_AppData.ResMemoryTblPtr[CS_AppData.HkPacket.Payload.CurrentEntryInTable].State = CS_STATE_ENABLED;
+    CS_SetEnabledMapEntry(CS_AppData.MemoryEnabledMap, CS_MAX_NUM_MEMORY_TABLE_ENTRIES,
+                          CS_MAX_NUM_MEMORY_TABLE_ENTRIES - 1, CS_STATE_ENABLED);
     UT_SetHandlerFunction(UT_KEY(CS_ComputeEepromMemory), CS_UTILS_TEST_CS_ComputeHandler, NULL);
-    UtAssert_BOOL_TRUE(CS_BackgroundMemory());
+    UtAssert_BOOL_FALSE(CS_BackgroundMemory());
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.MemoryCSErrCounter, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 0);
@@ -489,6 +764,7 @@ void CS_BackgroundTables_Test(void)
 
     /* Enabled, miscompare, not done with entry */
     CS_AppData.ResTablesTblPtr[0].State = CS_STATE_ENABLED;
+    CS_SetEnabledMapEntry(CS_AppData.TablesEnabledMap, CS_MAX_NUM_TABLES_TABLE_ENTRIES, 0, CS_STATE_ENABLED);
     UT_SetDeferredRetcode(UT_KEY(CS_ComputeTables), 1, CS_ERROR);
     UtAssert_BOOL_TRUE(CS_BackgroundTables());
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.TablesCSErrCounter, 1);
@@ -506,17 +782,48 @@ void CS_BackgroundTables_Test(void)
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 1);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 2);
 
-    /* Last entry, Enabled, compares, done with entry */
+    /* Last entry, Enabled, compares, done with entry, budget left for the next table */
     CS_AppData.HkPacket.Payload.CurrentEntryInTable                                   = CS_MAX_NUM_TABLES_TABLE_ENTRIES - 1;
     CS_AppData.ResTablesTblPtr[CS_AppData.HkPacket.Payload.CurrentEntryInTable].State = CS_STATE_ENABLED;
+    CS_SetEnabledMapEntry(CS_AppData.TablesEnabledMap, CS_MAX_NUM_TABLES_TABLE_ENTRIES,
+                          CS_MAX_NUM_TABLES_TABLE_ENTRIES - 1, CS_STATE_ENABLED);
     UT_SetHandlerFunction(UT_KEY(CS_ComputeTables), CS_UTILS_TEST_CS_ComputeHandler, NULL);
-    UtAssert_BOOL_TRUE(CS_BackgroundTables());
+    UtAssert_BOOL_FALSE(CS_BackgroundTables());
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.TablesCSErrCounter, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 0);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 3);
 }
 
+void CS_BackgroundTables_Test_Batch(void)
+{
+    UT_SetHandlerFunction(UT_KEY(CS_ComputeTables), CS_UTILS_TEST_CS_ComputeHandler, NULL);
+
+    CS_AppData.HkPacket.Payload.TablesCSState = CS_STATE_ENABLED;
+
+    CS_AppData.ResTablesTblPtr[0].State = CS_STATE_ENABLED;
+    CS_AppData.ResTablesTblPtr[2].State = CS_STATE_ENABLED;
+    CS_AppData.ResTablesTblPtr[3].State = CS_STATE_ENABLED;
+    CS_SetEnabledMapEntry(CS_AppData.TablesEnabledMap, CS_MAX_NUM_TABLES_TABLE_ENTRIES, 0, CS_STATE_ENABLED);
+    CS_SetEnabledMapEntry(CS_AppData.TablesEnabledMap, CS_MAX_NUM_TABLES_TABLE_ENTRIES, 2, CS_STATE_ENABLED);
+    CS_SetEnabledMapEntry(CS_AppData.TablesEnabledMap, CS_MAX_NUM_TABLES_TABLE_ENTRIES, 3, CS_STATE_ENABLED);
+
+    /* The budget is used up by the second table */
+    UT_SetDeferredRetcode(UT_KEY(CS_BudgetCycleSpent), 2, true);
+    UtAssert_BOOL_TRUE(CS_BackgroundTables());
+    UtAssert_STUB_COUNT(CS_ComputeTables, 2);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 3);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 0);
+
+    /* The next cycle carries on from the third table and leaves its budget for the next table */
+    UtAssert_BOOL_FALSE(CS_BackgroundTables());
+    UtAssert_STUB_COUNT(CS_ComputeTables, 3);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 0);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void CS_BackgroundApp_Test(void)
 {
     /* Entirely disabled */
@@ -533,11 +840,13 @@ void CS_BackgroundApp_Test(void)
 
     /* Enabled, miscompare, not done with entry */
     CS_AppData.ResAppTblPtr[0].State = CS_STATE_ENABLED;
+    CS_SetEnabledMapEntry(CS_AppData.AppEnabledMap, CS_MAX_NUM_APP_TABLE_ENTRIES, 0, CS_STATE_ENABLED);
     UT_SetDeferredRetcode(UT_KEY(CS_ComputeApp), 1, CS_ERROR);
     UtAssert_BOOL_TRUE(CS_BackgroundApp());
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.AppCSErrCounter, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_APP_MISCOMPARE_ERR_EID);
+    UtAssert_STUB_COUNT(CS_SyndromeReport, 1);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 0);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 2);
 
@@ -550,11 +859,13 @@ void CS_BackgroundApp_Test(void)
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 1);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 2);
 
-    /* Last entry, Enabled, compares, done with entry */
+    /* Last entry, Enabled, compares, done with entry, budget left for the next table */
     CS_AppData.HkPacket.Payload.CurrentEntryInTable                                = CS_MAX_NUM_APP_TABLE_ENTRIES - 1;
     CS_AppData.ResAppTblPtr[CS_AppData.HkPacket.Payload.CurrentEntryInTable].State = CS_STATE_ENABLED;
+    CS_SetEnabledMapEntry(CS_AppData.AppEnabledMap, CS_MAX_NUM_APP_TABLE_ENTRIES,
+                          CS_MAX_NUM_APP_TABLE_ENTRIES - 1, CS_STATE_ENABLED);
     UT_SetHandlerFunction(UT_KEY(CS_ComputeApp), CS_UTILS_TEST_CS_ComputeHandler, NULL);
-    UtAssert_BOOL_TRUE(CS_BackgroundApp());
+    UtAssert_BOOL_FALSE(CS_BackgroundApp());
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.AppCSErrCounter, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 0);
@@ -574,62 +885,33 @@ void CS_ResetTablesTblResultEntry_Test(void)
 
     /* Verify results */
     UtAssert_UINT32_EQ(ResTablesTbl.ByteOffset, 0);
-    UtAssert_UINT32_EQ(ResTablesTbl.TempChecksumValue, 0);
     UtAssert_UINT16_EQ(ResTablesTbl.ComputedYet, false);
 }
 
 void CS_HandleRoutineTableUpdates_Test(void)
 {
-    uint16 ChildTaskTable[] = {CS_CFECORE, CS_EEPROM_TABLE, CS_MEMORY_TABLE, CS_APP_TABLE, CS_TABLES_TABLE};
-    uint16 TblMax           = sizeof(ChildTaskTable) / sizeof(ChildTaskTable[0]);
     uint16 i;
 
-    /* Cycle through each all true case */
-    CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
-    CS_AppData.HkPacket.Payload.OneShotInProgress   = false;
-    for (i = 0; i < TblMax; i++)
+    /* Cycle through each table, in the order checked, having a recompute job queued or running */
+    for (i = 1; i <= 4; i++)
     {
-        CS_AppData.ChildTaskTable = ChildTaskTable[i];
+        UT_ResetState(UT_KEY(CS_JobsBusy));
+        UT_SetDeferredRetcode(UT_KEY(CS_JobsBusy), i, true);
 
         UT_ResetState(UT_KEY(CS_HandleTableUpdate));
         UtAssert_INT32_EQ(CS_HandleRoutineTableUpdates(), CFE_SUCCESS);
-
-        /* Confirm stub call count based on selected table */
-        if (CS_AppData.ChildTaskTable == CS_CFECORE)
-        {
-            UtAssert_STUB_COUNT(CS_HandleTableUpdate, 4);
-        }
-        else
-        {
-            UtAssert_STUB_COUNT(CS_HandleTableUpdate, 3);
-        }
+        UtAssert_STUB_COUNT(CS_JobsBusy, 6);
+        UtAssert_STUB_COUNT(CS_HandleTableUpdate, 3);
+        UtAssert_STUB_COUNT(CS_BlockTreeManage, i);
         UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
     }
 
-    /* OneShotInProgress true case will update all */
-    CS_AppData.HkPacket.Payload.OneShotInProgress = true;
-    for (i = 0; i < TblMax; i++)
-    {
-        CS_AppData.ChildTaskTable = ChildTaskTable[i];
-
-        UT_ResetState(UT_KEY(CS_HandleTableUpdate));
-        UtAssert_INT32_EQ(CS_HandleRoutineTableUpdates(), CFE_SUCCESS);
-        UtAssert_STUB_COUNT(CS_HandleTableUpdate, 4);
-        UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
-    }
-
-    /* Recompute false will update all */
-    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
-    CS_AppData.HkPacket.Payload.OneShotInProgress   = false;
-    for (i = 0; i < TblMax; i++)
-    {
-        CS_AppData.ChildTaskTable = ChildTaskTable[i];
-
-        UT_ResetState(UT_KEY(CS_HandleTableUpdate));
-        UtAssert_INT32_EQ(CS_HandleRoutineTableUpdates(), CFE_SUCCESS);
-        UtAssert_STUB_COUNT(CS_HandleTableUpdate, 4);
-        UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
-    }
+    /* No jobs will update all */
+    UT_ResetState(UT_KEY(CS_JobsBusy));
+    UT_ResetState(UT_KEY(CS_HandleTableUpdate));
+    UtAssert_INT32_EQ(CS_HandleRoutineTableUpdates(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CS_HandleTableUpdate, 4);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 
     /* Force each update error */
     UT_ResetState(UT_KEY(CS_HandleTableUpdate));
@@ -648,6 +930,60 @@ void CS_HandleRoutineTableUpdates_Test(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 4);
 }
 
+void CS_HandleRoutineTableUpdates_Test_Notified(void)
+{
+    CS_AppData.TableNotified = CS_TABLE_BIT(CS_EEPROM_TABLE) | CS_TABLE_BIT(CS_MEMORY_TABLE) |
+                               CS_TABLE_BIT(CS_TABLES_TABLE) | CS_TABLE_BIT(CS_APP_TABLE) |
+                               CS_TABLE_BIT(CS_BLOCK_TABLE);
+
+    /* Notified tables without a notification pending are left alone */
+    UtAssert_INT32_EQ(CS_HandleRoutineTableUpdates(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CS_HandleTableUpdate, 0);
+    UtAssert_STUB_COUNT(CS_BlockTreeManage, 0);
+
+    /* A pending dump of the block results table is serviced, but not
+     * while an EEPROM or Memory recompute may be using the trees */
+    CS_AppData.TableManagePending = CS_TABLE_BIT(CS_BLOCK_TABLE);
+    UT_SetDeferredRetcode(UT_KEY(CS_JobsBusy), 6, true);
+    UtAssert_INT32_EQ(CS_HandleRoutineTableUpdates(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CS_BlockTreeManage, 0);
+    UtAssert_UINT32_EQ(CS_AppData.TableManagePending, CS_TABLE_BIT(CS_BLOCK_TABLE));
+
+    UtAssert_INT32_EQ(CS_HandleRoutineTableUpdates(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CS_BlockTreeManage, 1);
+    UtAssert_STUB_COUNT(CS_HandleTableUpdate, 0);
+    UtAssert_UINT32_EQ(CS_AppData.TableManagePending, 0);
+
+    /* Only the pending table is managed, once; the failed update shows which one */
+    CS_AppData.TableManagePending = CS_TABLE_BIT(CS_MEMORY_TABLE);
+    UT_SetDeferredRetcode(UT_KEY(CS_HandleTableUpdate), 1, -1);
+    UtAssert_INT32_EQ(CS_HandleRoutineTableUpdates(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CS_HandleTableUpdate, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_UPDATE_MEMORY_ERR_EID);
+    UtAssert_UINT32_EQ(CS_AppData.TableManagePending, 0);
+
+    UtAssert_INT32_EQ(CS_HandleRoutineTableUpdates(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CS_HandleTableUpdate, 1);
+
+    /* A recompute of the pending table keeps the notification pending */
+    CS_AppData.TableManagePending = CS_TABLE_BIT(CS_APP_TABLE);
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsBusy), true);
+    UtAssert_INT32_EQ(CS_HandleRoutineTableUpdates(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CS_HandleTableUpdate, 1);
+    UtAssert_UINT32_EQ(CS_AppData.TableManagePending, CS_TABLE_BIT(CS_APP_TABLE));
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_JobsBusy), false);
+    UtAssert_INT32_EQ(CS_HandleRoutineTableUpdates(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CS_HandleTableUpdate, 2);
+    UtAssert_UINT32_EQ(CS_AppData.TableManagePending, 0);
+
+    /* Tables that are not notified are managed every time */
+    CS_AppData.TableNotified &= ~CS_TABLE_BIT(CS_TABLES_TABLE);
+    UtAssert_INT32_EQ(CS_HandleRoutineTableUpdates(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CS_HandleTableUpdate, 3);
+}
+
 void CS_AttemptTableReshare_Test(void)
 {
     CS_Res_Tables_Table_Entry_t TblEntry;
@@ -679,30 +1015,34 @@ void CS_AttemptTableReshare_Test(void)
     UtAssert_INT32_EQ(CS_AttemptTableReshare(&TblEntry, &LocalTblHandle, &TblInfo, &LocalAddress, &ResultGetInfo), -2);
 }
 
-void CS_CheckRecomputeOneShot_Test(void)
+void CS_CheckRecomputeTable_Test(void)
 {
     /* Set up for false return */
-    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
-    CS_AppData.HkPacket.Payload.OneShotInProgress   = false;
-
-    UtAssert_BOOL_FALSE(CS_CheckRecomputeOneshot());
+    UtAssert_BOOL_FALSE(CS_CheckRecomputeTable(CS_EEPROM_TABLE));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
     UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 0);
 
-    /* One shot in progress */
-    CS_AppData.HkPacket.Payload.OneShotInProgress = true;
-    UtAssert_BOOL_TRUE(CS_CheckRecomputeOneshot());
+    /* Recompute of the table type in progress */
+    UT_SetDeferredRetcode(UT_KEY(CS_JobsBusy), 1, true);
+    UtAssert_BOOL_TRUE(CS_CheckRecomputeTable(CS_EEPROM_TABLE));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_CMD_COMPUTE_PROG_ERR_EID);
     UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+}
 
-    /* Recompute in progress */
-    CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
-    CS_AppData.HkPacket.Payload.OneShotInProgress   = false;
-    UtAssert_BOOL_TRUE(CS_CheckRecomputeOneshot());
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, CS_CMD_COMPUTE_PROG_ERR_EID);
-    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 2);
+void CS_CheckRecomputeEntry_Test(void)
+{
+    /* Set up for false return */
+    UtAssert_BOOL_FALSE(CS_CheckRecomputeEntry(CS_APP_TABLE, 1));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 0);
+
+    /* Recompute of the entry in progress */
+    UT_SetDeferredRetcode(UT_KEY(CS_JobsEntryBusy), 1, true);
+    UtAssert_BOOL_TRUE(CS_CheckRecomputeEntry(CS_APP_TABLE, 1));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_CMD_COMPUTE_PROG_ERR_EID);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
 }
 
 void UtTest_Setup(void)
@@ -715,10 +1055,18 @@ void UtTest_Setup(void)
     UtTest_Add(CS_ZeroOSTempValues_Test, CS_Test_Setup, CS_Test_TearDown, "CS_ZeroOSTempValues_Test");
     UtTest_Add(CS_InitializeDefaultTables_Test, CS_Test_Setup, CS_Test_TearDown, "CS_InitializeDefaultTables_Test");
     UtTest_Add(CS_GoToNextTable_Test, CS_Test_Setup, CS_Test_TearDown, "CS_GoToNextTable_Test");
+    UtTest_Add(CS_GoToNextTable_Test_Cursor, CS_Test_Setup, CS_Test_TearDown, "CS_GoToNextTable_Test_Cursor");
+    UtTest_Add(CS_GoToNextTable_Test_Resumed, CS_Test_Setup, CS_Test_TearDown, "CS_GoToNextTable_Test_Resumed");
+    UtTest_Add(CS_NameHash_Test, CS_Test_Setup, CS_Test_TearDown, "CS_NameHash_Test");
+    UtTest_Add(CS_NameIndex_Test, CS_Test_Setup, CS_Test_TearDown, "CS_NameIndex_Test");
+    UtTest_Add(CS_FindTablesNameDuplicate_Test, CS_Test_Setup, CS_Test_TearDown, "CS_FindTablesNameDuplicate_Test");
+    UtTest_Add(CS_FindAppNameDuplicate_Test, CS_Test_Setup, CS_Test_TearDown, "CS_FindAppNameDuplicate_Test");
     UtTest_Add(CS_GetTableResTblEntryByName_Test, CS_Test_Setup, CS_Test_TearDown, "CS_GetTableResTblEntryByName_Test");
     UtTest_Add(CS_GetTableDefTblEntryByName_Test, CS_Test_Setup, CS_Test_TearDown, "CS_GetTableDefTblEntryByName_Test");
     UtTest_Add(CS_GetAppResTblEntryByName_Test, CS_Test_Setup, CS_Test_TearDown, "CS_GetAppResTblEntryByName_Test");
     UtTest_Add(CS_GetAppDefTblEntryByName_Test, CS_Test_Setup, CS_Test_TearDown, "CS_GetAppDefTblEntryByName_Test");
+    UtTest_Add(CS_SetEnabledMapEntry_Test, CS_Test_Setup, CS_Test_TearDown, "CS_SetEnabledMapEntry_Test");
+    UtTest_Add(CS_FindNextEnabledMapEntry_Test, CS_Test_Setup, CS_Test_TearDown, "CS_FindNextEnabledMapEntry_Test");
     UtTest_Add(CS_FindEnabledEepromEntry_Test, CS_Test_Setup, CS_Test_TearDown, "CS_FindEnabledEepromEntry_Test");
     UtTest_Add(CS_FindEnabledMemoryEntry_Test, CS_Test_Setup, CS_Test_TearDown, "CS_FindEnabledMemoryEntry_Test");
     UtTest_Add(CS_FindEnabledTablesEntry_Test, CS_Test_Setup, CS_Test_TearDown, "CS_FindEnabledTablesEntry_Test");
@@ -729,9 +1077,13 @@ void UtTest_Setup(void)
     UtTest_Add(CS_BackgroundEeprom_Test, CS_Test_Setup, CS_Test_TearDown, "CS_BackgroundEeprom_Test");
     UtTest_Add(CS_BackgroundMemory_Test, CS_Test_Setup, CS_Test_TearDown, "CS_BackgroundMemory_Test");
     UtTest_Add(CS_BackgroundTables_Test, CS_Test_Setup, CS_Test_TearDown, "CS_BackgroundTables_Test");
+    UtTest_Add(CS_BackgroundTables_Test_Batch, CS_Test_Setup, CS_Test_TearDown, "CS_BackgroundTables_Test_Batch");
     UtTest_Add(CS_BackgroundApp_Test, CS_Test_Setup, CS_Test_TearDown, "CS_BackgroundApp_Test");
     UtTest_Add(CS_ResetTablesTblResultEntry_Test, CS_Test_Setup, CS_Test_TearDown, "CS_ResetTablesTblResultEntry_Test");
     UtTest_Add(CS_HandleRoutineTableUpdates_Test, CS_Test_Setup, CS_Test_TearDown, "CS_HandleRoutineTableUpdates_Test");
+    UtTest_Add(CS_HandleRoutineTableUpdates_Test_Notified, CS_Test_Setup, CS_Test_TearDown,
+               "CS_HandleRoutineTableUpdates_Test_Notified");
     UtTest_Add(CS_AttemptTableReshare_Test, CS_Test_Setup, CS_Test_TearDown, "CS_AttemptTableReshare_Test");
-    UtTest_Add(CS_CheckRecomputeOneShot_Test, CS_Test_Setup, CS_Test_TearDown, "CS_CheckRecomputeOneShot_Test");
+    UtTest_Add(CS_CheckRecomputeTable_Test, CS_Test_Setup, CS_Test_TearDown, "CS_CheckRecomputeTable_Test");
+    UtTest_Add(CS_CheckRecomputeEntry_Test, CS_Test_Setup, CS_Test_TearDown, "CS_CheckRecomputeEntry_Test");
 }
@@ -0,0 +1,381 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cs_app.h"
+#include "cs_events.h"
+#include "cs_algorithm.h"
+#include "cs_worker.h"
+#include "cs_test_utils.h"
+#include <string.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* Never dereferenced; the checksum functions are stubbed */
+static uint8 CS_WORKER_TEST_Buffer[4];
+
+int32 CS_WORKER_TEST_AbandonJobHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                    const UT_StubContext_t *Context)
+{
+    /* Simulate the submitting task timing out while the stripe is computed */
+    CS_AppData.WorkerPool.JobId++;
+
+    return StubRetcode;
+}
+
+void CS_WORKER_TEST_SetupActivePool(uint32 NumWorkers)
+{
+    CS_AppData.WorkerPool.Active     = true;
+    CS_AppData.WorkerPool.NumWorkers = NumWorkers;
+}
+
+#if (CS_NUM_WORKER_TASKS > 0)
+void CS_WorkerPoolInit_Test_Nominal(void)
+{
+    /* Execute the function being tested */
+    CS_WorkerPoolInit();
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(CS_AppData.WorkerPool.Active);
+    UtAssert_UINT32_EQ(CS_AppData.WorkerPool.NumWorkers, CS_NUM_WORKER_TASKS);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, CS_NUM_WORKER_TASKS);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_WorkerPoolInit_Test_SemCreateError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 1, OS_ERROR);
+
+    /* Execute the function being tested */
+    CS_WorkerPoolInit();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(CS_AppData.WorkerPool.Active);
+    UtAssert_UINT32_EQ(CS_AppData.WorkerPool.NumWorkers, 0);
+    UtAssert_STUB_COUNT(OS_BinSemCreate, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_WORKER_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_WorkerPoolInit_Test_TaskCreateError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, -1);
+
+    /* Execute the function being tested */
+    CS_WorkerPoolInit();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(CS_AppData.WorkerPool.Active);
+    UtAssert_UINT32_EQ(CS_AppData.WorkerPool.NumWorkers, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_WORKER_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+#else
+void CS_WorkerPoolInit_Test_Disabled(void)
+{
+    /* Execute the function being tested */
+    CS_WorkerPoolInit();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(CS_AppData.WorkerPool.Active);
+    UtAssert_UINT32_EQ(CS_AppData.WorkerPool.NumWorkers, 0);
+    UtAssert_STUB_COUNT(OS_MutSemCreate, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+#endif /* #if (CS_NUM_WORKER_TASKS > 0) */
+
+void CS_WorkerPoolChecksumUpdate_Test_Inactive(void)
+{
+    CS_ChecksumContext_t Context;
+
+    memset(&Context, 0, sizeof(Context));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(CS_WorkerPoolChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, CS_WORKER_TEST_Buffer,
+                                                    4 * CS_WORKER_STRIPE_SIZE, false));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_STUB_COUNT(CS_ChecksumCombine, 0);
+}
+
+void CS_WorkerPoolChecksumUpdate_Test_Short(void)
+{
+    CS_ChecksumContext_t Context;
+
+    memset(&Context, 0, sizeof(Context));
+
+    CS_WORKER_TEST_SetupActivePool(2);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(CS_WorkerPoolChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, CS_WORKER_TEST_Buffer,
+                                                    (2 * CS_WORKER_STRIPE_SIZE) - 1, false));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+}
+
+void CS_WorkerPoolChecksumUpdate_Test_CannotCombine(void)
+{
+    CS_ChecksumContext_t Context;
+
+    memset(&Context, 0, sizeof(Context));
+
+    CS_WORKER_TEST_SetupActivePool(2);
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_ChecksumCanCombine), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(CS_WorkerPoolChecksumUpdate(CS_ALGORITHM_SHA_256, &Context, CS_WORKER_TEST_Buffer,
+                                                    4 * CS_WORKER_STRIPE_SIZE, false));
+
+    /* Verify results: the calling task does the whole region */
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+    UtAssert_STUB_COUNT(CS_ChecksumCombine, 0);
+}
+
+void CS_WorkerPoolChecksumUpdate_Test_Nominal(void)
+{
+    CS_ChecksumContext_t Context;
+
+    memset(&Context, 0, sizeof(Context));
+
+    CS_WORKER_TEST_SetupActivePool(2);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(CS_WorkerPoolChecksumUpdate(CS_ALGORITHM_CRC_32, &Context, CS_WORKER_TEST_Buffer,
+                                                   (3 * CS_WORKER_STRIPE_SIZE) + 100, false));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.WorkerPool.Algorithm, CS_ALGORITHM_CRC_32);
+    UtAssert_UINT32_EQ(CS_AppData.WorkerPool.NumStripes, 4);
+    UtAssert_UINT32_EQ(CS_AppData.WorkerPool.StripesDone, 4);
+    UtAssert_UINT32_EQ(CS_AppData.WorkerPool.StripeSize, CS_WORKER_STRIPE_SIZE);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 2);
+    UtAssert_STUB_COUNT(CS_ChecksumInit, 4);
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 4);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+    UtAssert_STUB_COUNT(CS_ChecksumCombine, 4);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_WorkerPoolChecksumUpdate_Test_Streaming(void)
+{
+    CS_ChecksumContext_t Context;
+
+    memset(&Context, 0, sizeof(Context));
+
+    CS_WORKER_TEST_SetupActivePool(1);
+
+    /* Execute the function being tested */
+    CS_WorkerPoolChecksumUpdate(CS_ALGORITHM_CRC_32, &Context, CS_WORKER_TEST_Buffer,
+                                2 * CS_WORKER_STRIPE_SIZE, true);
+
+    /* Verify results: every stripe is read with streaming hints */
+    UtAssert_BOOL_TRUE(CS_AppData.WorkerPool.Streaming);
+    UtAssert_STUB_COUNT(CS_ChecksumUpdateStreaming, 2);
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 0);
+    UtAssert_STUB_COUNT(CS_ChecksumCombine, 2);
+
+    /* A region checksummed by the calling task alone streams too */
+    CS_WorkerPoolChecksumUpdate(CS_ALGORITHM_CRC_32, &Context, CS_WORKER_TEST_Buffer, 10, true);
+
+    UtAssert_STUB_COUNT(CS_ChecksumUpdateStreaming, 3);
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 0);
+}
+
+void CS_WorkerPoolChecksumUpdate_Test_FewStripes(void)
+{
+    CS_ChecksumContext_t Context;
+
+    memset(&Context, 0, sizeof(Context));
+
+    CS_WORKER_TEST_SetupActivePool(4);
+
+    /* Execute the function being tested */
+    CS_WorkerPoolChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, CS_WORKER_TEST_Buffer,
+                                2 * CS_WORKER_STRIPE_SIZE, false);
+
+    /* Verify results: only one worker is woken for two stripes */
+    UtAssert_UINT32_EQ(CS_AppData.WorkerPool.NumStripes, 2);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 2);
+    UtAssert_STUB_COUNT(CS_ChecksumCombine, 2);
+}
+
+void CS_WorkerPoolChecksumUpdate_Test_MaxStripes(void)
+{
+    CS_ChecksumContext_t Context;
+    size_t               DataLength = ((size_t)CS_WORKER_STRIPE_SIZE * CS_WORKER_MAX_STRIPES * 2) + 1;
+
+    memset(&Context, 0, sizeof(Context));
+
+    CS_WORKER_TEST_SetupActivePool(2);
+
+    /* Execute the function being tested */
+    CS_WorkerPoolChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, CS_WORKER_TEST_Buffer, DataLength, false);
+
+    /* Verify results: the stripes grow so the job still fits, and stay aligned */
+    UtAssert_UINT32_EQ(CS_AppData.WorkerPool.NumStripes, CS_WORKER_MAX_STRIPES);
+    UtAssert_True(CS_AppData.WorkerPool.StripeSize > 2 * CS_WORKER_STRIPE_SIZE,
+                  "StripeSize %lu > 2 * CS_WORKER_STRIPE_SIZE", (unsigned long)CS_AppData.WorkerPool.StripeSize);
+    UtAssert_UINT32_EQ(CS_AppData.WorkerPool.StripeSize % CS_WORKER_STRIPE_ALIGN, 0);
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, CS_WORKER_MAX_STRIPES);
+    UtAssert_STUB_COUNT(CS_ChecksumCombine, CS_WORKER_MAX_STRIPES);
+}
+
+void CS_WorkerPoolChecksumUpdate_Test_Timeout(void)
+{
+    CS_ChecksumContext_t Context;
+
+    memset(&Context, 0, sizeof(Context));
+
+    CS_WORKER_TEST_SetupActivePool(2);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, OS_SEM_TIMEOUT);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(CS_WorkerPoolChecksumUpdate(CS_ALGORITHM_DEFAULT, &Context, CS_WORKER_TEST_Buffer,
+                                                    2 * CS_WORKER_STRIPE_SIZE, false));
+
+    /* Verify results: the pool is disabled and the region done sequentially */
+    UtAssert_BOOL_FALSE(CS_AppData.WorkerPool.Active);
+    UtAssert_UINT32_EQ(CS_WorkerPoolLanes(), 1);
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 3);
+    UtAssert_STUB_COUNT(CS_ChecksumCombine, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_WORKER_TIMEOUT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_WorkerProcessStripes_Test_AbandonedJob(void)
+{
+    CS_AppData.WorkerPool.NumStripes = 1;
+    CS_AppData.WorkerPool.Length     = 10;
+    CS_AppData.WorkerPool.StripeSize = 10;
+
+    UT_SetHookFunction(UT_KEY(CS_ChecksumUpdate), CS_WORKER_TEST_AbandonJobHook, NULL);
+
+    /* Execute the function being tested */
+    CS_WorkerProcessStripes();
+
+    /* Verify results: the late result is dropped */
+    UtAssert_UINT32_EQ(CS_AppData.WorkerPool.NextStripe, 1);
+    UtAssert_UINT32_EQ(CS_AppData.WorkerPool.StripesDone, 0);
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 1);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 0);
+}
+
+void CS_WorkerPoolStripes_Test(void)
+{
+    CS_ChecksumContext_t Context;
+
+    memset(&Context, 0, sizeof(Context));
+
+    UtAssert_BOOL_FALSE(CS_WorkerPoolStripes(CS_ALGORITHM_CRC_32, &Context, 4 * CS_WORKER_STRIPE_SIZE));
+
+    CS_WORKER_TEST_SetupActivePool(1);
+
+    UtAssert_BOOL_FALSE(CS_WorkerPoolStripes(CS_ALGORITHM_CRC_32, &Context, (2 * CS_WORKER_STRIPE_SIZE) - 1));
+    UtAssert_BOOL_TRUE(CS_WorkerPoolStripes(CS_ALGORITHM_CRC_32, &Context, 2 * CS_WORKER_STRIPE_SIZE));
+
+    /* SHA-256 checksums cannot be combined */
+    UT_SetDefaultReturnValue(UT_KEY(CS_ChecksumCanCombine), false);
+    UtAssert_BOOL_FALSE(CS_WorkerPoolStripes(CS_ALGORITHM_SHA_256, &Context, 4 * CS_WORKER_STRIPE_SIZE));
+}
+
+void CS_WorkerPoolLanes_Test(void)
+{
+    UtAssert_UINT32_EQ(CS_WorkerPoolLanes(), 1);
+
+    CS_WORKER_TEST_SetupActivePool(3);
+
+    UtAssert_UINT32_EQ(CS_WorkerPoolLanes(), 4);
+}
+
+void CS_WorkerTask_Test(void)
+{
+    /* Wake once, then fail as if the semaphore had been deleted */
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, OS_ERROR);
+
+    /* Execute the function being tested */
+    CS_WorkerTask();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_CountSemTake, 2);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(CS_ChecksumUpdate, 0);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+}
+
+void UtTest_Setup(void)
+{
+#if (CS_NUM_WORKER_TASKS > 0)
+    UtTest_Add(CS_WorkerPoolInit_Test_Nominal, CS_Test_Setup, CS_Test_TearDown, "CS_WorkerPoolInit_Test_Nominal");
+    UtTest_Add(CS_WorkerPoolInit_Test_SemCreateError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_WorkerPoolInit_Test_SemCreateError");
+    UtTest_Add(CS_WorkerPoolInit_Test_TaskCreateError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_WorkerPoolInit_Test_TaskCreateError");
+#else
+    UtTest_Add(CS_WorkerPoolInit_Test_Disabled, CS_Test_Setup, CS_Test_TearDown, "CS_WorkerPoolInit_Test_Disabled");
+#endif /* #if (CS_NUM_WORKER_TASKS > 0) */
+    UtTest_Add(CS_WorkerPoolChecksumUpdate_Test_Inactive, CS_Test_Setup, CS_Test_TearDown,
+               "CS_WorkerPoolChecksumUpdate_Test_Inactive");
+    UtTest_Add(CS_WorkerPoolChecksumUpdate_Test_Short, CS_Test_Setup, CS_Test_TearDown,
+               "CS_WorkerPoolChecksumUpdate_Test_Short");
+    UtTest_Add(CS_WorkerPoolChecksumUpdate_Test_CannotCombine, CS_Test_Setup, CS_Test_TearDown,
+               "CS_WorkerPoolChecksumUpdate_Test_CannotCombine");
+    UtTest_Add(CS_WorkerPoolChecksumUpdate_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_WorkerPoolChecksumUpdate_Test_Nominal");
+    UtTest_Add(CS_WorkerPoolChecksumUpdate_Test_Streaming, CS_Test_Setup, CS_Test_TearDown,
+               "CS_WorkerPoolChecksumUpdate_Test_Streaming");
+    UtTest_Add(CS_WorkerPoolChecksumUpdate_Test_FewStripes, CS_Test_Setup, CS_Test_TearDown,
+               "CS_WorkerPoolChecksumUpdate_Test_FewStripes");
+    UtTest_Add(CS_WorkerPoolChecksumUpdate_Test_MaxStripes, CS_Test_Setup, CS_Test_TearDown,
+               "CS_WorkerPoolChecksumUpdate_Test_MaxStripes");
+    UtTest_Add(CS_WorkerPoolChecksumUpdate_Test_Timeout, CS_Test_Setup, CS_Test_TearDown,
+               "CS_WorkerPoolChecksumUpdate_Test_Timeout");
+    UtTest_Add(CS_WorkerProcessStripes_Test_AbandonedJob, CS_Test_Setup, CS_Test_TearDown,
+               "CS_WorkerProcessStripes_Test_AbandonedJob");
+    UtTest_Add(CS_WorkerPoolStripes_Test, CS_Test_Setup, CS_Test_TearDown, "CS_WorkerPoolStripes_Test");
+    UtTest_Add(CS_WorkerPoolLanes_Test, CS_Test_Setup, CS_Test_TearDown, "CS_WorkerPoolLanes_Test");
+    UtTest_Add(CS_WorkerTask_Test, CS_Test_Setup, CS_Test_TearDown, "CS_WorkerTask_Test");
+}
@@ -0,0 +1,146 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cs_algorithm.h"
+#include <string.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+const CS_Algorithm_t *CS_GetAlgorithm(uint16 AlgorithmId)
+{
+    const CS_Algorithm_t *Algorithm = NULL;
+
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_GetAlgorithm), AlgorithmId);
+
+    UT_DEFAULT_IMPL(CS_GetAlgorithm);
+
+    UT_Stub_CopyToLocal(UT_KEY(CS_GetAlgorithm), &Algorithm, sizeof(Algorithm));
+
+    return Algorithm;
+}
+
+void CS_ChecksumInit(uint16 AlgorithmId, CS_ChecksumContext_t *Context)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ChecksumInit), AlgorithmId);
+    UT_Stub_RegisterContext(UT_KEY(CS_ChecksumInit), Context);
+
+    UT_DEFAULT_IMPL(CS_ChecksumInit);
+}
+
+void CS_ChecksumUpdate(uint16 AlgorithmId, CS_ChecksumContext_t *Context, const void *DataPtr, size_t DataLength)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ChecksumUpdate), AlgorithmId);
+    UT_Stub_RegisterContext(UT_KEY(CS_ChecksumUpdate), Context);
+    UT_Stub_RegisterContext(UT_KEY(CS_ChecksumUpdate), DataPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ChecksumUpdate), DataLength);
+
+    UT_DEFAULT_IMPL(CS_ChecksumUpdate);
+}
+
+void CS_ChecksumUpdateStreaming(uint16 AlgorithmId, CS_ChecksumContext_t *Context, const void *DataPtr,
+                                size_t DataLength)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ChecksumUpdateStreaming), AlgorithmId);
+    UT_Stub_RegisterContext(UT_KEY(CS_ChecksumUpdateStreaming), Context);
+    UT_Stub_RegisterContext(UT_KEY(CS_ChecksumUpdateStreaming), DataPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ChecksumUpdateStreaming), DataLength);
+
+    UT_DEFAULT_IMPL(CS_ChecksumUpdateStreaming);
+}
+
+uint32 CS_ChecksumFinal(uint16 AlgorithmId, const CS_ChecksumContext_t *Context, CS_Digest_t *Digest)
+{
+    uint32 Summary;
+
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ChecksumFinal), AlgorithmId);
+    UT_Stub_RegisterContext(UT_KEY(CS_ChecksumFinal), Context);
+    UT_Stub_RegisterContext(UT_KEY(CS_ChecksumFinal), Digest);
+
+    Summary = UT_DEFAULT_IMPL(CS_ChecksumFinal);
+
+    /* Hand back a 4-byte digest whose summary is the stub return value */
+    memset(Digest, 0, sizeof(*Digest));
+    Digest->Bytes[0] = (uint8)(Summary >> 24);
+    Digest->Bytes[1] = (uint8)(Summary >> 16);
+    Digest->Bytes[2] = (uint8)(Summary >> 8);
+    Digest->Bytes[3] = (uint8)Summary;
+
+    return Summary;
+}
+
+bool CS_ChecksumFromCrc(uint16 AlgorithmId, CFE_ES_CrcType_Enum_t TypeCRC, uint32 Crc, CS_Digest_t *Digest)
+{
+    bool Matches;
+
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ChecksumFromCrc), AlgorithmId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ChecksumFromCrc), TypeCRC);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ChecksumFromCrc), Crc);
+    UT_Stub_RegisterContext(UT_KEY(CS_ChecksumFromCrc), Digest);
+
+    Matches = UT_DEFAULT_IMPL_RC(CS_ChecksumFromCrc, true);
+
+    /* Hand back a 4-byte digest of the CRC, as for a CRC algorithm */
+    if (Matches)
+    {
+        memset(Digest, 0, sizeof(*Digest));
+        Digest->Bytes[0] = (uint8)(Crc >> 24);
+        Digest->Bytes[1] = (uint8)(Crc >> 16);
+        Digest->Bytes[2] = (uint8)(Crc >> 8);
+        Digest->Bytes[3] = (uint8)Crc;
+    }
+
+    return Matches;
+}
+
+uint32 CS_DigestSummary(const CS_Digest_t *Digest)
+{
+    uint32 Summary = ((uint32)Digest->Bytes[0] << 24) | ((uint32)Digest->Bytes[1] << 16) |
+                     ((uint32)Digest->Bytes[2] << 8) | (uint32)Digest->Bytes[3];
+
+    UT_Stub_RegisterContext(UT_KEY(CS_DigestSummary), Digest);
+
+    /* The real summary unless a test sets a return value */
+    return UT_DEFAULT_IMPL_RC(CS_DigestSummary, Summary);
+}
+
+bool CS_ChecksumCanCombine(uint16 AlgorithmId, const CS_ChecksumContext_t *ContextA)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ChecksumCanCombine), AlgorithmId);
+    UT_Stub_RegisterContext(UT_KEY(CS_ChecksumCanCombine), ContextA);
+
+    return UT_DEFAULT_IMPL_RC(CS_ChecksumCanCombine, true);
+}
+
+void CS_ChecksumCombine(uint16 AlgorithmId, CS_ChecksumContext_t *ContextA, const CS_ChecksumContext_t *ContextB,
+                        size_t LengthB)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ChecksumCombine), AlgorithmId);
+    UT_Stub_RegisterContext(UT_KEY(CS_ChecksumCombine), ContextA);
+    UT_Stub_RegisterContext(UT_KEY(CS_ChecksumCombine), ContextB);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ChecksumCombine), LengthB);
+
+    UT_DEFAULT_IMPL(CS_ChecksumCombine);
+}
@@ -0,0 +1,91 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cs_block.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+void CS_BlockTreeInit(void)
+{
+    UT_DEFAULT_IMPL(CS_BlockTreeInit);
+}
+
+void CS_BlockTreeManage(void)
+{
+    UT_DEFAULT_IMPL(CS_BlockTreeManage);
+}
+
+uint32 CS_BlockTreeNumNodes(uint32 NumLeaves)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_BlockTreeNumNodes), NumLeaves);
+
+    return UT_DEFAULT_IMPL(CS_BlockTreeNumNodes);
+}
+
+void CS_BlockTreeAllocate(uint16 Table, const CS_Def_EepromMemory_Table_Entry_t *DefinitionTblPtr,
+                          CS_Res_EepromMemory_Table_Entry_t *ResultsTblPtr, uint16 NumEntries)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_BlockTreeAllocate), Table);
+    UT_Stub_RegisterContext(UT_KEY(CS_BlockTreeAllocate), DefinitionTblPtr);
+    UT_Stub_RegisterContext(UT_KEY(CS_BlockTreeAllocate), ResultsTblPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_BlockTreeAllocate), NumEntries);
+
+    UT_DEFAULT_IMPL(CS_BlockTreeAllocate);
+}
+
+void CS_BlockTreeUpdate(const CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint32 Offset, uint32 Length)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_BlockTreeUpdate), ResultsEntry);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_BlockTreeUpdate), Offset);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_BlockTreeUpdate), Length);
+
+    UT_DEFAULT_IMPL(CS_BlockTreeUpdate);
+}
+
+void CS_BlockTreeReportMiscompare(const CS_Res_EepromMemory_Table_Entry_t *ResultsEntry)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_BlockTreeReportMiscompare), ResultsEntry);
+
+    UT_DEFAULT_IMPL(CS_BlockTreeReportMiscompare);
+}
+
+void CS_BlockTreeInvalidate(uint16 Table, uint16 EntryID, bool AllEntries)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_BlockTreeInvalidate), Table);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_BlockTreeInvalidate), EntryID);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_BlockTreeInvalidate), AllEntries);
+
+    UT_DEFAULT_IMPL(CS_BlockTreeInvalidate);
+}
+
+bool CS_BlockTreeRecompute(CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, CS_Job_t *Job)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_BlockTreeRecompute), ResultsEntry);
+    UT_Stub_RegisterContext(UT_KEY(CS_BlockTreeRecompute), ComputedCSValue);
+    UT_Stub_RegisterContext(UT_KEY(CS_BlockTreeRecompute), Job);
+
+    return UT_DEFAULT_IMPL_RC(CS_BlockTreeRecompute, false);
+}
@@ -0,0 +1,85 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cs_budget.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+void CS_BudgetInit(void)
+{
+    UT_DEFAULT_IMPL(CS_BudgetInit);
+}
+
+uint64 CS_BudgetGetTime(void)
+{
+    uint64 Time = 0;
+
+    UT_DEFAULT_IMPL(CS_BudgetGetTime);
+
+    UT_Stub_CopyToLocal(UT_KEY(CS_BudgetGetTime), &Time, sizeof(Time));
+
+    return Time;
+}
+
+void CS_BudgetStartCycle(void)
+{
+    UT_DEFAULT_IMPL(CS_BudgetStartCycle);
+}
+
+bool CS_BudgetCycleSpent(void)
+{
+    return UT_DEFAULT_IMPL(CS_BudgetCycleSpent);
+}
+
+uint32 CS_BudgetChecksumUpdate(uint16 AlgorithmId, CS_ChecksumContext_t *Context, cpuaddr Address, uint32 DataLength,
+                               uint32 MaxBytes, bool UseWorkerPool, bool Streaming, CS_Job_t *Job)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_BudgetChecksumUpdate), AlgorithmId);
+    UT_Stub_RegisterContext(UT_KEY(CS_BudgetChecksumUpdate), Context);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_BudgetChecksumUpdate), Address);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_BudgetChecksumUpdate), DataLength);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_BudgetChecksumUpdate), MaxBytes);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_BudgetChecksumUpdate), UseWorkerPool);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_BudgetChecksumUpdate), Streaming);
+    UT_Stub_RegisterContext(UT_KEY(CS_BudgetChecksumUpdate), Job);
+
+    /* By default behave as the byte limit does */
+    return UT_DEFAULT_IMPL_RC(CS_BudgetChecksumUpdate, (DataLength < MaxBytes) ? DataLength : MaxBytes);
+}
+
+void CS_BudgetJobCharge(CS_Job_t *Job, uint32 Bytes, uint64 Start)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_BudgetJobCharge), Job);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_BudgetJobCharge), Bytes);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_BudgetJobCharge), Start);
+
+    UT_DEFAULT_IMPL(CS_BudgetJobCharge);
+}
+
+void CS_BudgetEndPass(void)
+{
+    UT_DEFAULT_IMPL(CS_BudgetEndPass);
+}
@@ -118,3 +118,33 @@ void CS_CancelOneShotCmd(const CS_NoArgsCmd_t *CmdPtr)
     UT_Stub_RegisterContext(UT_KEY(CS_CancelOneShotCmd), CmdPtr);
     UT_DEFAULT_IMPL(CS_CancelOneShotCmd);
 }
+
+void CS_SetTimeBudgetCmd(const CS_SetTimeBudgetCmd_t *CmdPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_SetTimeBudgetCmd), CmdPtr);
+    UT_DEFAULT_IMPL(CS_SetTimeBudgetCmd);
+}
+
+void CS_SetRevisitPeriodCmd(const CS_SetRevisitPeriodCmd_t *CmdPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_SetRevisitPeriodCmd), CmdPtr);
+    UT_DEFAULT_IMPL(CS_SetRevisitPeriodCmd);
+}
+
+void CS_SetJobRateCmd(const CS_SetJobRateCmd_t *CmdPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_SetJobRateCmd), CmdPtr);
+    UT_DEFAULT_IMPL(CS_SetJobRateCmd);
+}
+
+void CS_ManageTableCmd(const CS_ManageTableCmd_t *CmdPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_ManageTableCmd), CmdPtr);
+    UT_DEFAULT_IMPL(CS_ManageTableCmd);
+}
+
+void CS_RecomputeAllCmd(const CS_RecomputeAllCmd_t *CmdPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_RecomputeAllCmd), CmdPtr);
+    UT_DEFAULT_IMPL(CS_RecomputeAllCmd);
+}
@@ -29,49 +29,70 @@
 #include "utstubs.h"
 
 CFE_Status_t CS_ComputeEepromMemory(CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue,
-                                    bool *DoneWithEntry)
+                                    bool *DoneWithEntry, CS_Job_t *Job)
 {
     UT_Stub_RegisterContext(UT_KEY(CS_ComputeEepromMemory), ResultsEntry);
     UT_Stub_RegisterContext(UT_KEY(CS_ComputeEepromMemory), ComputedCSValue);
     UT_Stub_RegisterContext(UT_KEY(CS_ComputeEepromMemory), DoneWithEntry);
+    UT_Stub_RegisterContext(UT_KEY(CS_ComputeEepromMemory), Job);
 
     return UT_DEFAULT_IMPL(CS_ComputeEepromMemory);
 }
 
-CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, bool *DoneWithEntry)
+CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, bool *DoneWithEntry,
+                              CS_Job_t *Job)
 {
     UT_Stub_RegisterContext(UT_KEY(CS_ComputeTables), ResultsEntry);
     UT_Stub_RegisterContext(UT_KEY(CS_ComputeTables), ComputedCSValue);
     UT_Stub_RegisterContext(UT_KEY(CS_ComputeTables), DoneWithEntry);
+    UT_Stub_RegisterContext(UT_KEY(CS_ComputeTables), Job);
 
     return UT_DEFAULT_IMPL(CS_ComputeTables);
 }
 
-CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, bool *DoneWithEntry)
+CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, bool *DoneWithEntry,
+                           CS_Job_t *Job)
 {
     UT_Stub_RegisterContext(UT_KEY(CS_ComputeApp), ResultsEntry);
     UT_Stub_RegisterContext(UT_KEY(CS_ComputeApp), ComputedCSValue);
     UT_Stub_RegisterContext(UT_KEY(CS_ComputeApp), DoneWithEntry);
+    UT_Stub_RegisterContext(UT_KEY(CS_ComputeApp), Job);
 
     return UT_DEFAULT_IMPL(CS_ComputeApp);
 }
 
-void CS_RecomputeEepromMemoryChildTask(void)
+void CS_RecomputeEepromMemory(CS_Job_t *Job)
 {
-    UT_DEFAULT_IMPL(CS_RecomputeEepromMemoryChildTask);
+    UT_Stub_RegisterContext(UT_KEY(CS_RecomputeEepromMemory), Job);
+    UT_DEFAULT_IMPL(CS_RecomputeEepromMemory);
 }
 
-void CS_RecomputeTablesChildTask(void)
+void CS_RecomputeTables(CS_Job_t *Job)
 {
-    UT_DEFAULT_IMPL(CS_RecomputeTablesChildTask);
+    UT_Stub_RegisterContext(UT_KEY(CS_RecomputeTables), Job);
+    UT_DEFAULT_IMPL(CS_RecomputeTables);
 }
 
-void CS_RecomputeAppChildTask(void)
+void CS_RecomputeApp(CS_Job_t *Job)
 {
-    UT_DEFAULT_IMPL(CS_RecomputeAppChildTask);
+    UT_Stub_RegisterContext(UT_KEY(CS_RecomputeApp), Job);
+    UT_DEFAULT_IMPL(CS_RecomputeApp);
 }
 
-void CS_OneShotChildTask(void)
+void CS_RecomputeDisableDefEntry(CS_Job_t *Job)
 {
-    UT_DEFAULT_IMPL(CS_OneShotChildTask);
+    UT_Stub_RegisterContext(UT_KEY(CS_RecomputeDisableDefEntry), Job);
+    UT_DEFAULT_IMPL(CS_RecomputeDisableDefEntry);
+}
+
+void CS_RecomputeRestoreDefEntry(CS_Job_t *Job)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_RecomputeRestoreDefEntry), Job);
+    UT_DEFAULT_IMPL(CS_RecomputeRestoreDefEntry);
+}
+
+void CS_OneShot(CS_Job_t *Job)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_OneShot), Job);
+    UT_DEFAULT_IMPL(CS_OneShot);
 }
@@ -0,0 +1,86 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cs_crc.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+void CS_CrcInit(bool UseHardware)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_CrcInit), UseHardware);
+
+    UT_DEFAULT_IMPL(CS_CrcInit);
+}
+
+uint32 CS_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC, CFE_ES_CrcType_Enum_t TypeCRC)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_CalculateCRC), DataPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_CalculateCRC), DataLength);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_CalculateCRC), InputCRC);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_CalculateCRC), TypeCRC);
+
+    return UT_DEFAULT_IMPL(CS_CalculateCRC);
+}
+
+uint32 CS_CrcCombine(uint32 CrcA, uint32 CrcB, size_t LengthB, CFE_ES_CrcType_Enum_t TypeCRC)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_CrcCombine), CrcA);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_CrcCombine), CrcB);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_CrcCombine), LengthB);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_CrcCombine), TypeCRC);
+
+    return UT_DEFAULT_IMPL(CS_CrcCombine);
+}
+
+uint64 CS_CalculateCRC64(const void *DataPtr, size_t DataLength, uint64 InputCRC)
+{
+    uint64 Crc = 0;
+
+    UT_Stub_RegisterContext(UT_KEY(CS_CalculateCRC64), DataPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_CalculateCRC64), DataLength);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_CalculateCRC64), InputCRC);
+
+    UT_DEFAULT_IMPL(CS_CalculateCRC64);
+
+    UT_Stub_CopyToLocal(UT_KEY(CS_CalculateCRC64), &Crc, sizeof(Crc));
+
+    return Crc;
+}
+
+uint64 CS_Crc64Combine(uint64 CrcA, uint64 CrcB, size_t LengthB)
+{
+    uint64 Crc = 0;
+
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_Crc64Combine), CrcA);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_Crc64Combine), CrcB);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_Crc64Combine), LengthB);
+
+    UT_DEFAULT_IMPL(CS_Crc64Combine);
+
+    UT_Stub_CopyToLocal(UT_KEY(CS_Crc64Combine), &Crc, sizeof(Crc));
+
+    return Crc;
+}
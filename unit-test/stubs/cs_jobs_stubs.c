@@ -0,0 +1,98 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cs_jobs.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+void CS_JobsInit(void)
+{
+    UT_DEFAULT_IMPL(CS_JobsInit);
+}
+
+bool CS_JobsSubmitRecompute(uint8 Type, uint16 Table, uint16 EntryID)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_JobsSubmitRecompute), Type);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_JobsSubmitRecompute), Table);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_JobsSubmitRecompute), EntryID);
+    return UT_DEFAULT_IMPL(CS_JobsSubmitRecompute);
+}
+
+bool CS_JobsSubmitOneShot(cpuaddr Address, uint32 Size, uint32 MaxBytesPerCycle)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_JobsSubmitOneShot), Address);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_JobsSubmitOneShot), Size);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_JobsSubmitOneShot), MaxBytesPerCycle);
+    return UT_DEFAULT_IMPL(CS_JobsSubmitOneShot);
+}
+
+bool CS_JobsCancelOneShots(void)
+{
+    return UT_DEFAULT_IMPL(CS_JobsCancelOneShots);
+}
+
+bool CS_JobsBusy(uint16 Table)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_JobsBusy), Table);
+    return UT_DEFAULT_IMPL(CS_JobsBusy);
+}
+
+bool CS_JobsEntryBusy(uint16 Table, uint16 EntryID)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_JobsEntryBusy), Table);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_JobsEntryBusy), EntryID);
+    return UT_DEFAULT_IMPL(CS_JobsEntryBusy);
+}
+
+void CS_JobsCollectCharges(uint32 *Bytes, uint32 *Time)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_JobsCollectCharges), Bytes);
+    UT_Stub_RegisterContext(UT_KEY(CS_JobsCollectCharges), Time);
+    UT_DEFAULT_IMPL(CS_JobsCollectCharges);
+}
+
+void CS_JobsPace(CS_Job_t *Job, uint32 Bytes)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_JobsPace), Job);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_JobsPace), Bytes);
+    UT_DEFAULT_IMPL(CS_JobsPace);
+}
+
+void CS_JobsDrain(void)
+{
+    UT_DEFAULT_IMPL(CS_JobsDrain);
+}
+
+void CS_JobsRun(CS_Job_t *Job)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_JobsRun), Job);
+    UT_DEFAULT_IMPL(CS_JobsRun);
+}
+
+void CS_JobTask(void)
+{
+    UT_DEFAULT_IMPL(CS_JobTask);
+}
@@ -0,0 +1,61 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cs_syndrome.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+void CS_SyndromeInit(void)
+{
+    UT_DEFAULT_IMPL(CS_SyndromeInit);
+}
+
+bool CS_SyndromeLocate(CFE_ES_CrcType_Enum_t TypeCRC, uint32 Expected, uint32 Computed, uint32 NumBytes,
+                       uint32 *ByteOffset, uint8 *BitNumber)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_SyndromeLocate), TypeCRC);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_SyndromeLocate), Expected);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_SyndromeLocate), Computed);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_SyndromeLocate), NumBytes);
+    UT_Stub_RegisterContext(UT_KEY(CS_SyndromeLocate), ByteOffset);
+    UT_Stub_RegisterContext(UT_KEY(CS_SyndromeLocate), BitNumber);
+
+    return UT_DEFAULT_IMPL_RC(CS_SyndromeLocate, false);
+}
+
+bool CS_SyndromeReport(uint16 Table, uint16 EntryID, uint16 Algorithm, cpuaddr StartAddress, uint32 NumBytes,
+                       uint32 Expected, uint32 Computed)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_SyndromeReport), Table);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_SyndromeReport), EntryID);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_SyndromeReport), Algorithm);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_SyndromeReport), StartAddress);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_SyndromeReport), NumBytes);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_SyndromeReport), Expected);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_SyndromeReport), Computed);
+
+    return UT_DEFAULT_IMPL_RC(CS_SyndromeReport, false);
+}
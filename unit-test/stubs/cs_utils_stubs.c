@@ -68,6 +68,85 @@ void CS_GoToNextTable(void)
     UT_DEFAULT_IMPL(CS_GoToNextTable);
 }
 
+uint32 CS_NameHash(const char *Name, size_t MaxLength)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_NameHash), Name);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_NameHash), MaxLength);
+
+    return UT_DEFAULT_IMPL(CS_NameHash);
+}
+
+void CS_NameIndexAdd(uint32 *NameIndex, uint32 IndexSize, uint32 Hash, uint16 Entry)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_NameIndexAdd), NameIndex);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_NameIndexAdd), IndexSize);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_NameIndexAdd), Hash);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_NameIndexAdd), Entry);
+
+    UT_DEFAULT_IMPL(CS_NameIndexAdd);
+}
+
+bool CS_NameIndexNext(const uint32 *NameIndex, uint32 IndexSize, uint32 Hash, uint32 *Probe, uint16 *Entry)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_NameIndexNext), NameIndex);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_NameIndexNext), IndexSize);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_NameIndexNext), Hash);
+    UT_Stub_RegisterContext(UT_KEY(CS_NameIndexNext), Probe);
+    UT_Stub_RegisterContext(UT_KEY(CS_NameIndexNext), Entry);
+
+    return UT_DEFAULT_IMPL(CS_NameIndexNext);
+}
+
+void CS_BuildTablesNameIndex(uint32 *NameIndex, const CS_Def_Tables_Table_Entry_t *DefinitionTblPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_BuildTablesNameIndex), NameIndex);
+    UT_Stub_RegisterContext(UT_KEY(CS_BuildTablesNameIndex), DefinitionTblPtr);
+
+    UT_DEFAULT_IMPL(CS_BuildTablesNameIndex);
+}
+
+void CS_BuildAppNameIndex(uint32 *NameIndex, const CS_Def_App_Table_Entry_t *DefinitionTblPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_BuildAppNameIndex), NameIndex);
+    UT_Stub_RegisterContext(UT_KEY(CS_BuildAppNameIndex), DefinitionTblPtr);
+
+    UT_DEFAULT_IMPL(CS_BuildAppNameIndex);
+}
+
+bool CS_FindTablesNameDuplicate(const uint32 *NameIndex, const CS_Def_Tables_Table_Entry_t *DefinitionTblPtr,
+                                uint16 Entry, uint16 *Duplicate)
+{
+    bool Status;
+
+    UT_Stub_RegisterContext(UT_KEY(CS_FindTablesNameDuplicate), NameIndex);
+    UT_Stub_RegisterContext(UT_KEY(CS_FindTablesNameDuplicate), DefinitionTblPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_FindTablesNameDuplicate), Entry);
+    UT_Stub_RegisterContext(UT_KEY(CS_FindTablesNameDuplicate), Duplicate);
+
+    Status = UT_DEFAULT_IMPL(CS_FindTablesNameDuplicate);
+
+    UT_Stub_CopyToLocal(UT_KEY(CS_FindTablesNameDuplicate), Duplicate, sizeof(*Duplicate));
+
+    return Status;
+}
+
+bool CS_FindAppNameDuplicate(const uint32 *NameIndex, const CS_Def_App_Table_Entry_t *DefinitionTblPtr, uint16 Entry,
+                             uint16 *Duplicate)
+{
+    bool Status;
+
+    UT_Stub_RegisterContext(UT_KEY(CS_FindAppNameDuplicate), NameIndex);
+    UT_Stub_RegisterContext(UT_KEY(CS_FindAppNameDuplicate), DefinitionTblPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_FindAppNameDuplicate), Entry);
+    UT_Stub_RegisterContext(UT_KEY(CS_FindAppNameDuplicate), Duplicate);
+
+    Status = UT_DEFAULT_IMPL(CS_FindAppNameDuplicate);
+
+    UT_Stub_CopyToLocal(UT_KEY(CS_FindAppNameDuplicate), Duplicate, sizeof(*Duplicate));
+
+    return Status;
+}
+
 bool CS_GetTableResTblEntryByName(CS_Res_Tables_Table_Entry_t **EntryPtr, const char *Name)
 {
     UT_Stub_RegisterContext(UT_KEY(CS_GetTableResTblEntryByName), EntryPtr);
@@ -100,6 +179,25 @@ bool CS_GetAppDefTblEntryByName(CS_Def_App_Table_Entry_t **EntryPtr, const char
     return UT_DEFAULT_IMPL(CS_GetAppDefTblEntryByName);
 }
 
+void CS_SetEnabledMapEntry(uint32 *EnabledMap, uint16 NumEntries, uint16 Entry, uint16 State)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_SetEnabledMapEntry), EnabledMap);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_SetEnabledMapEntry), NumEntries);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_SetEnabledMapEntry), Entry);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_SetEnabledMapEntry), State);
+
+    UT_DEFAULT_IMPL(CS_SetEnabledMapEntry);
+}
+
+bool CS_FindNextEnabledMapEntry(const uint32 *EnabledMap, uint16 NumEntries, uint16 *Entry)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_FindNextEnabledMapEntry), EnabledMap);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_FindNextEnabledMapEntry), NumEntries);
+    UT_Stub_RegisterContext(UT_KEY(CS_FindNextEnabledMapEntry), Entry);
+
+    return UT_DEFAULT_IMPL(CS_FindNextEnabledMapEntry);
+}
+
 bool CS_FindEnabledEepromEntry(uint16 *EnabledEntry)
 {
     UT_Stub_RegisterContext(UT_KEY(CS_FindEnabledEepromEntry), EnabledEntry);
@@ -186,7 +284,17 @@ CFE_Status_t CS_AttemptTableReshare(CS_Res_Tables_Table_Entry_t *ResultsEntry, C
     return UT_DEFAULT_IMPL(CS_AttemptTableReshare);
 }
 
-bool CS_CheckRecomputeOneshot(void)
+bool CS_CheckRecomputeTable(uint16 Table)
 {
-    return UT_DEFAULT_IMPL(CS_CheckRecomputeOneshot);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_CheckRecomputeTable), Table);
+
+    return UT_DEFAULT_IMPL(CS_CheckRecomputeTable);
+}
+
+bool CS_CheckRecomputeEntry(uint16 Table, uint16 EntryID)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_CheckRecomputeEntry), Table);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_CheckRecomputeEntry), EntryID);
+
+    return UT_DEFAULT_IMPL(CS_CheckRecomputeEntry);
 }
@@ -0,0 +1,70 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cs_worker.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+void CS_WorkerPoolInit(void)
+{
+    UT_DEFAULT_IMPL(CS_WorkerPoolInit);
+}
+
+void CS_WorkerProcessStripes(void)
+{
+    UT_DEFAULT_IMPL(CS_WorkerProcessStripes);
+}
+
+bool CS_WorkerPoolChecksumUpdate(uint16 AlgorithmId, CS_ChecksumContext_t *Context, const void *DataPtr,
+                                 size_t DataLength, bool Streaming)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_WorkerPoolChecksumUpdate), AlgorithmId);
+    UT_Stub_RegisterContext(UT_KEY(CS_WorkerPoolChecksumUpdate), Context);
+    UT_Stub_RegisterContext(UT_KEY(CS_WorkerPoolChecksumUpdate), DataPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_WorkerPoolChecksumUpdate), DataLength);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_WorkerPoolChecksumUpdate), Streaming);
+
+    return UT_DEFAULT_IMPL(CS_WorkerPoolChecksumUpdate);
+}
+
+bool CS_WorkerPoolStripes(uint16 AlgorithmId, const CS_ChecksumContext_t *Context, size_t DataLength)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_WorkerPoolStripes), AlgorithmId);
+    UT_Stub_RegisterContext(UT_KEY(CS_WorkerPoolStripes), Context);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_WorkerPoolStripes), DataLength);
+
+    return UT_DEFAULT_IMPL(CS_WorkerPoolStripes);
+}
+
+uint32 CS_WorkerPoolLanes(void)
+{
+    return UT_DEFAULT_IMPL_RC(CS_WorkerPoolLanes, 1);
+}
+
+void CS_WorkerTask(void)
+{
+    UT_DEFAULT_IMPL(CS_WorkerTask);
+}